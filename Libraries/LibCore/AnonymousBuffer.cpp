@@ -18,6 +18,12 @@
 
 namespace Core {
 
+#if defined(F_ADD_SEALS) && defined(F_GET_SEALS) && defined(F_SEAL_GROW) && defined(F_SEAL_SHRINK) && defined(F_SEAL_FUTURE_WRITE)
+#    define ANONYMOUS_BUFFER_HAS_READ_ONLY_SEALS
+// F_SEAL_FUTURE_WRITE rather than F_SEAL_WRITE, as the latter can't be added while we still have a writable mapping.
+static constexpr auto READ_ONLY_SEALS = F_SEAL_GROW | F_SEAL_SHRINK | F_SEAL_FUTURE_WRITE;
+#endif
+
 ErrorOr<AnonymousBuffer> AnonymousBuffer::create_with_size(size_t size, Sealability sealability)
 {
     auto allow_sealing = sealability == Sealability::Sealable
@@ -99,19 +105,41 @@ ErrorOr<AnonymousBuffer> AnonymousBuffer::snapshot(Sealability sealability) cons
     return copy;
 }
 
+ErrorOr<void> AnonymousBuffer::seal_read_only()
+{
+    if (!is_valid())
+        return Error::from_string_literal("Cannot seal an invalid anonymous buffer");
+
+#ifdef ANONYMOUS_BUFFER_HAS_READ_ONLY_SEALS
+    TRY(Core::System::fcntl(fd(), F_ADD_SEALS, READ_ONLY_SEALS | F_SEAL_SEAL));
+    m_impl->m_is_sealed_read_only = true;
+    return {};
+#else
+    return Error::from_string_literal("Anonymous buffers cannot be sealed read-only on this platform");
+#endif
+}
+
 ErrorOr<NonnullRefPtr<AnonymousBufferImpl>> AnonymousBufferImpl::create(int fd, size_t size)
 {
+    bool is_sealed_read_only = false;
+#ifdef ANONYMOUS_BUFFER_HAS_READ_ONLY_SEALS
+    // A writable shared mapping of a sealed buffer would fail, so we map it read-only.
+    auto seals = ::fcntl(fd, F_GET_SEALS);
+    is_sealed_read_only = seals >= 0 && (seals & READ_ONLY_SEALS) == READ_ONLY_SEALS;
+#endif
+
     void* data = nullptr;
     // POSIX mmap rejects a zero length with EINVAL, so leave m_data null for zero-size buffers.
     if (size > 0) {
-        data = mmap(nullptr, round_up_to_power_of_two(size, PAGE_SIZE), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        auto protection = is_sealed_read_only ? PROT_READ : PROT_READ | PROT_WRITE;
+        data = mmap(nullptr, round_up_to_power_of_two(size, PAGE_SIZE), protection, MAP_SHARED, fd, 0);
         if (data == MAP_FAILED) {
             auto error = Error::from_errno(errno);
             close(fd);
             return error;
         }
     }
-    auto impl_or_error = AK::adopt_nonnull_ref_or_enomem(new (nothrow) AnonymousBufferImpl(fd, size, data));
+    auto impl_or_error = AK::adopt_nonnull_ref_or_enomem(new (nothrow) AnonymousBufferImpl(fd, size, data, is_sealed_read_only));
     if (impl_or_error.is_error()) {
         close(fd);
         if (data != nullptr)
@@ -132,10 +160,11 @@ AnonymousBufferImpl::~AnonymousBufferImpl()
     }
 }
 
-AnonymousBufferImpl::AnonymousBufferImpl(int fd, size_t size, void* data)
+AnonymousBufferImpl::AnonymousBufferImpl(int fd, size_t size, void* data, bool is_sealed_read_only)
     : m_fd(fd)
     , m_size(size)
     , m_data(data)
+    , m_is_sealed_read_only(is_sealed_read_only)
 {
 }
 
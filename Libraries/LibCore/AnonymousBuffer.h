@@ -26,13 +26,17 @@ public:
     size_t size() const { return m_size; }
     void* data() { return m_data; }
     void const* data() const { return m_data; }
+    bool is_sealed_read_only() const { return m_is_sealed_read_only; }
 
 private:
-    AnonymousBufferImpl(int fd, size_t, void*);
+    friend class AnonymousBuffer;
+
+    AnonymousBufferImpl(int fd, size_t, void*, bool is_sealed_read_only);
 
     int m_fd { -1 };
     size_t m_size { 0 };
     void* m_data { nullptr };
+    bool m_is_sealed_read_only { false };
 };
 
 class CORE_API AnonymousBuffer {
@@ -51,6 +55,11 @@ public:
 
     ErrorOr<AnonymousBuffer> snapshot(Sealability = Sealability::Unsealable) const;
 
+    // Stops the size and contents from ever changing again. Mappings that already exist stay writable, but any process
+    // that receives the buffer afterwards can only map it read-only. The buffer must have been created as Sealable.
+    ErrorOr<void> seal_read_only();
+    bool is_sealed_read_only() const { return m_impl && m_impl->is_sealed_read_only(); }
+
     int fd() const { return m_impl ? m_impl->fd() : -1; }
     size_t size() const { return m_impl ? m_impl->size() : 0; }
 
@@ -12,10 +12,11 @@
 
 namespace Core {
 
-AnonymousBufferImpl::AnonymousBufferImpl(int fd, size_t size, void* data)
+AnonymousBufferImpl::AnonymousBufferImpl(int fd, size_t size, void* data, bool is_sealed_read_only)
     : m_fd(fd)
     , m_size(size)
     , m_data(data)
+    , m_is_sealed_read_only(is_sealed_read_only)
 {
 }
 
@@ -52,7 +53,7 @@ ErrorOr<NonnullRefPtr<AnonymousBufferImpl>> AnonymousBufferImpl::create(int fd,
         }
     }
 
-    return adopt_ref(*new AnonymousBufferImpl(fd, size, ptr));
+    return adopt_ref(*new AnonymousBufferImpl(fd, size, ptr, false));
 }
 
 ErrorOr<AnonymousBuffer> AnonymousBuffer::create_with_size(size_t size, Sealability)
@@ -78,4 +79,10 @@ ErrorOr<AnonymousBuffer> AnonymousBuffer::snapshot(Sealability sealability) cons
     return copy;
 }
 
+ErrorOr<void> AnonymousBuffer::seal_read_only()
+{
+    // FIXME: Support sealing on Windows.
+    return Error::from_string_literal("Anonymous buffers cannot be sealed read-only on Windows");
+}
+
 }
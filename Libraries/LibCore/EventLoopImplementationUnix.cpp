@@ -5,6 +5,7 @@
  */
 
 #include <AK/HashMap.h>
+#include <AK/HashTable.h>
 #include <AK/NeverDestroyed.h>
 #include <AK/Singleton.h>
 #include <AK/TemporaryChange.h>
@@ -25,6 +26,14 @@
 #include <sys/select.h>
 #include <unistd.h>
 
+// On Linux, notifiers are registered with epoll once instead of being handed to poll() on every iteration, so that
+// waking up costs time proportional to the number of ready file descriptors rather than the number of registered ones.
+#if defined(AK_OS_LINUX) && !defined(AK_OS_ANDROID)
+#    define EVENT_LOOP_USE_EPOLL
+#    include <sys/epoll.h>
+#    include <sys/eventfd.h>
+#endif
+
 namespace Core {
 
 namespace {
@@ -61,6 +70,39 @@ static void ensure_thread_data_key()
     });
 }
 
+bool has_flag(int value, int flag)
+{
+    return (value & flag) == flag;
+}
+
+#ifdef EVENT_LOOP_USE_EPOLL
+
+u32 notification_type_to_epoll_events(NotificationType type)
+{
+    u32 events = 0;
+    if (has_flag(type, NotificationType::Read))
+        events |= EPOLLIN;
+    if (has_flag(type, NotificationType::Write))
+        events |= EPOLLOUT;
+    return events;
+}
+
+NotificationType epoll_events_to_notification_type(u32 events)
+{
+    NotificationType type = NotificationType::None;
+    if (has_flag(events, EPOLLIN))
+        type |= NotificationType::Read;
+    if (has_flag(events, EPOLLOUT))
+        type |= NotificationType::Write;
+    if (has_flag(events, EPOLLHUP))
+        type |= NotificationType::Read | NotificationType::Write | NotificationType::HangUp;
+    if (has_flag(events, EPOLLERR))
+        type |= NotificationType::Error;
+    return type;
+}
+
+#else
+
 short notification_type_to_poll_events(NotificationType type)
 {
     short events = 0;
@@ -71,10 +113,7 @@ short notification_type_to_poll_events(NotificationType type)
     return events;
 }
 
-bool has_flag(int value, int flag)
-{
-    return (value & flag) == flag;
-}
+#endif
 
 class EventLoopTimer final : public EventLoopTimeout {
 public:
@@ -154,15 +193,42 @@ struct ThreadData {
 
         wake_pipe_fds = result.release_value();
 
+#ifdef EVENT_LOOP_USE_EPOLL
+        epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+        if (epoll_fd < 0) {
+            perror("epoll_create1");
+            VERIFY_NOT_REACHED();
+        }
+
+        wake_event_fd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+        if (wake_event_fd < 0) {
+            perror("eventfd");
+            VERIFY_NOT_REACHED();
+        }
+
+        // The wake pipe informs us of POSIX signals, and the wake eventfd of manual calls to wake().
+        for (auto fd : { wake_pipe_fds[0], wake_event_fd }) {
+            epoll_event event { .events = EPOLLIN, .data = { .fd = fd } };
+            if (epoll_ctl(epoll_fd, EPOLL_CTL_ADD, fd, &event) < 0) {
+                perror("epoll_ctl");
+                VERIFY_NOT_REACHED();
+            }
+        }
+#else
         // The wake pipe informs us of POSIX signals as well as manual calls to wake()
         poll_fds.append({ .fd = wake_pipe_fds[0], .events = POLLIN, .revents = 0 });
         notifiers.append(nullptr);
+#endif
     }
 
     ~ThreadData()
     {
         close(wake_pipe_fds[0]);
         close(wake_pipe_fds[1]);
+#ifdef EVENT_LOOP_USE_EPOLL
+        close(wake_event_fd);
+        close(epoll_fd);
+#endif
 
         Sync::RWLockLocker<Sync::LockMode::Write> locker(thread_data_lock());
         thread_data().remove(thread_id);
@@ -173,12 +239,60 @@ struct ThreadData {
     // Each thread has its own timers, notifiers and a wake pipe.
     TimeoutSet timeouts;
 
+#ifdef EVENT_LOOP_USE_EPOLL
+    // Brings the epoll interest list in line with the notifiers that are registered for fd.
+    void update_epoll_interest(int fd, bool is_new_fd)
+    {
+        auto notifiers = notifiers_by_fd.get(fd);
+        if (!notifiers.has_value() || notifiers->is_empty()) {
+            notifiers_by_fd.remove(fd);
+            fds_without_epoll_support.remove(fd);
+
+            // The kernel drops closed file descriptors from the interest list by itself, so this may fail harmlessly.
+            (void)epoll_ctl(epoll_fd, EPOLL_CTL_DEL, fd, nullptr);
+            return;
+        }
+
+        if (fds_without_epoll_support.contains(fd))
+            return;
+
+        epoll_event event { .events = 0, .data = { .fd = fd } };
+        for (auto* notifier : *notifiers)
+            event.events |= notification_type_to_epoll_events(notifier->type());
+
+        // The fd may have been closed and reused behind our back, in which case the kernel has already forgotten it.
+        auto operation = is_new_fd ? EPOLL_CTL_ADD : EPOLL_CTL_MOD;
+        if (epoll_ctl(epoll_fd, operation, fd, &event) == 0)
+            return;
+        if (errno == EEXIST && epoll_ctl(epoll_fd, EPOLL_CTL_MOD, fd, &event) == 0)
+            return;
+        if (errno == ENOENT && epoll_ctl(epoll_fd, EPOLL_CTL_ADD, fd, &event) == 0)
+            return;
+
+        // Regular files and directories can't be watched with epoll. poll() always reports them as ready, so do the same.
+        if (errno == EPERM) {
+            fds_without_epoll_support.set(fd);
+            return;
+        }
+
+        dbgln("EventLoopImplementationUnix: Unable to watch fd {} with epoll: {}", fd, Error::from_errno(errno));
+    }
+
+    int epoll_fd { -1 };
+    int wake_event_fd { -1 };
+
+    // Several notifiers may watch the same file descriptor, but epoll only accepts one registration for each.
+    HashMap<int, Vector<Notifier*, 1>> notifiers_by_fd;
+    HashTable<int> fds_without_epoll_support;
+#else
     HashMap<Notifier*, size_t> notifier_to_index;
     Vector<Notifier*, 32> notifiers;
     Vector<pollfd, 32> poll_fds;
+#endif
 
-    // The wake pipe is used to notify another event loop that someone has called wake(), or a signal has been received.
-    // wake() writes 0i32 into the pipe, signals write the signal number (guaranteed non-zero).
+    // The wake pipe is used to notify another event loop that a signal has been received, or (where we don't use an
+    // eventfd for that) that someone has called wake(). wake() writes 0i32 into the pipe, signals write the signal
+    // number (guaranteed non-zero).
     Array<int, 2> wake_pipe_fds { -1, -1 };
 
     pid_t pid { 0 };
@@ -194,9 +308,13 @@ static void destroy_thread_data(void* value)
 }
 
 EventLoopImplementationUnix::EventLoopImplementationUnix()
-    : m_wake_pipe_write_fd(ThreadData::the().wake_pipe_fds[1])
+#ifdef EVENT_LOOP_USE_EPOLL
+    : m_wake_fd(ThreadData::the().wake_event_fd)
+#else
+    : m_wake_fd(ThreadData::the().wake_pipe_fds[1])
+#endif
 {
-    VERIFY(m_wake_pipe_write_fd >= 0);
+    VERIFY(m_wake_fd >= 0);
 }
 
 EventLoopImplementationUnix::~EventLoopImplementationUnix() = default;
@@ -226,8 +344,13 @@ void EventLoopImplementationUnix::quit(int code)
 
 void EventLoopImplementationUnix::wake()
 {
+#ifdef EVENT_LOOP_USE_EPOLL
+    // Unlike a pipe, the eventfd never fills up: repeated wakes just add to its counter.
+    u64 wake_event = 1;
+#else
     int wake_event = 0;
-    auto result = Core::System::write(m_wake_pipe_write_fd, { &wake_event, sizeof(wake_event) });
+#endif
+    auto result = Core::System::write(m_wake_fd, { &wake_event, sizeof(wake_event) });
     // EBADF here just indicates that the ThreadData is destroyed, so we must be exiting the thread.
     // Ignore it.
     if (result.is_error() && result.error().code() == EBADF)
@@ -240,6 +363,36 @@ void EventLoopManagerUnix::wait_for_events(EventLoopImplementation::PumpMode mod
     auto& thread_data = ThreadData::the();
     Sync::MutexLocker locker(thread_data.mutex);
 
+    // Handles calls to wake() and POSIX signals that were written to the wake pipe. Returns true if the pipe may hold
+    // more signals than we were able to read at once.
+    auto read_wake_pipe = [&] {
+        int wake_events[8];
+        ssize_t nread;
+        // We might receive another signal while read()ing here. The signal will go to the handle_signal properly,
+        // but we get interrupted. Therefore, just retry while we were interrupted.
+        do {
+            errno = 0;
+            nread = read(thread_data.wake_pipe_fds[0], wake_events, sizeof(wake_events));
+            if (nread == 0)
+                break;
+        } while (nread < 0 && errno == EINTR);
+        if (nread < 0) {
+            perror("EventLoopImplementationUnix::wait_for_events: read from wake pipe");
+            VERIFY_NOT_REACHED();
+        }
+        VERIFY(nread > 0);
+        bool wake_requested = false;
+        int event_count = nread / sizeof(wake_events[0]);
+        for (int i = 0; i < event_count; i++) {
+            if (wake_events[i] != 0)
+                dispatch_signal(wake_events[i]);
+            else
+                wake_requested = true;
+        }
+
+        return !wake_requested && nread == sizeof(wake_events);
+    };
+
 retry:
     bool has_pending_events = ThreadEventQueue::current().has_pending_events();
 
@@ -263,6 +416,62 @@ retry:
         }
     }
 
+#ifdef EVENT_LOOP_USE_EPOLL
+    // File descriptors that epoll can't watch are always ready, so don't block on their behalf.
+    if (!thread_data.fds_without_epoll_support.is_empty()) {
+        timeout = 0;
+        should_wait_forever = false;
+    }
+
+    // Anything beyond this many ready file descriptors is level-triggered, and will be reported again next time.
+    Array<epoll_event, 64> ready_events;
+    int ready_count = 0;
+
+    // Wait for file system events, calls to wake(), POSIX signals, or timer expirations.
+    do {
+        ready_count = epoll_wait(thread_data.epoll_fd, ready_events.data(), ready_events.size(), should_wait_forever ? -1 : timeout);
+    } while (ready_count < 0 && errno == EINTR);
+    auto time_after_poll = MonotonicTime::now_coarse();
+    if (ready_count < 0) {
+        perror("EventLoopImplementationUnix::wait_for_events: epoll_wait");
+        VERIFY_NOT_REACHED();
+    }
+
+    auto ready_events_span = ready_events.span().trim(ready_count);
+
+    // We woke up due to a call to wake() or a POSIX signal.
+    // Handle signals and see whether we need to handle events as well.
+    for (auto const& ready_event : ready_events_span) {
+        if (ready_event.data.fd == thread_data.wake_event_fd) {
+            u64 wake_count = 0;
+            (void)read(thread_data.wake_event_fd, &wake_count, sizeof(wake_count));
+        } else if (ready_event.data.fd == thread_data.wake_pipe_fds[0]) {
+            if (read_wake_pipe())
+                goto retry;
+        }
+    }
+
+    // Handle file system notifiers by making them normal events.
+    auto post_notifier_activations = [&](int fd, NotificationType type) {
+        auto notifiers = thread_data.notifiers_by_fd.get(fd);
+        if (!notifiers.has_value())
+            return;
+        for (auto* notifier : *notifiers) {
+            if ((type & notifier->type()) != NotificationType::None)
+                ThreadEventQueue::current().post_event(notifier, Core::Event::Type::NotifierActivation);
+        }
+    };
+
+    for (auto const& ready_event : ready_events_span) {
+        auto fd = ready_event.data.fd;
+        if (fd == thread_data.wake_event_fd || fd == thread_data.wake_pipe_fds[0])
+            continue;
+        post_notifier_activations(fd, epoll_events_to_notification_type(ready_event.events));
+    }
+
+    for (auto fd : thread_data.fds_without_epoll_support)
+        post_notifier_activations(fd, NotificationType::Read | NotificationType::Write);
+#else
 try_select_again:
     // select() and wait for file system events, calls to wake(), POSIX signals, or timer expirations.
     auto error_or_marked_fd_count = System::poll(thread_data.poll_fds, should_wait_forever ? -1 : timeout);
@@ -278,31 +487,7 @@ try_select_again:
     // We woke up due to a call to wake() or a POSIX signal.
     // Handle signals and see whether we need to handle events as well.
     if (has_flag(thread_data.poll_fds[0].revents, POLLIN)) {
-        int wake_events[8];
-        ssize_t nread;
-        // We might receive another signal while read()ing here. The signal will go to the handle_signal properly,
-        // but we get interrupted. Therefore, just retry while we were interrupted.
-        do {
-            errno = 0;
-            nread = read(thread_data.wake_pipe_fds[0], wake_events, sizeof(wake_events));
-            if (nread == 0)
-                break;
-        } while (nread < 0 && errno == EINTR);
-        if (nread < 0) {
-            perror("EventLoopImplementationUnix::wait_for_events: read from wake pipe");
-            VERIFY_NOT_REACHED();
-        }
-        VERIFY(nread > 0);
-        bool wake_requested = false;
-        int event_count = nread / sizeof(wake_events[0]);
-        for (int i = 0; i < event_count; i++) {
-            if (wake_events[i] != 0)
-                dispatch_signal(wake_events[i]);
-            else
-                wake_requested = true;
-        }
-
-        if (!wake_requested && nread == sizeof(wake_events))
+        if (read_wake_pipe())
             goto retry;
     }
 
@@ -335,6 +520,8 @@ try_select_again:
         }
     }
 
+#endif
+
     // Handle expired timers.
     thread_data.timeouts.fire_expired(time_after_poll);
 }
@@ -563,11 +750,17 @@ void EventLoopManagerUnix::register_notifier(Notifier& notifier)
     auto& thread_data = ThreadData::the();
     Sync::MutexLocker locker(thread_data.mutex);
 
+#ifdef EVENT_LOOP_USE_EPOLL
+    auto& notifiers = thread_data.notifiers_by_fd.ensure(notifier.fd());
+    notifiers.append(&notifier);
+    thread_data.update_epoll_interest(notifier.fd(), notifiers.size() == 1);
+#else
     thread_data.notifier_to_index.set(&notifier, thread_data.poll_fds.size());
     thread_data.notifiers.append(&notifier);
 
     auto events = notification_type_to_poll_events(notifier.type());
     thread_data.poll_fds.append({ .fd = notifier.fd(), .events = events, .revents = 0 });
+#endif
 
     notifier.set_owner_thread(thread_data.thread_id);
 }
@@ -580,6 +773,11 @@ void EventLoopManagerUnix::unregister_notifier(Notifier& notifier)
         return;
     Sync::MutexLocker thread_data_content_locker(thread_data->mutex);
 
+#ifdef EVENT_LOOP_USE_EPOLL
+    if (auto notifiers = thread_data->notifiers_by_fd.get(notifier.fd()); notifiers.has_value())
+        notifiers->remove_first_matching([&](auto* registered_notifier) { return registered_notifier == &notifier; });
+    thread_data->update_epoll_interest(notifier.fd(), false);
+#else
     auto notifier_index = thread_data->notifier_to_index.take(&notifier).release_value();
 
     if (notifier_index + 1 < thread_data->poll_fds.size()) {
@@ -592,6 +790,7 @@ void EventLoopManagerUnix::unregister_notifier(Notifier& notifier)
 
     thread_data->notifiers.take_last();
     thread_data->poll_fds.take_last();
+#endif
 }
 
 void EventLoopManagerUnix::did_post_event()
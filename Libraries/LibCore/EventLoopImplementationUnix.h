@@ -55,9 +55,9 @@ private:
     bool m_exit_requested { false };
     int m_exit_code { 0 };
 
-    // The write end of the wake pipe, copied by value so it remains valid even
-    // if ThreadData is destroyed before this event loop (e.g. during exit()).
-    int m_wake_pipe_write_fd;
+    // The fd that wake() writes to (an eventfd on Linux, the write end of the wake pipe elsewhere), copied by value so
+    // it remains valid even if ThreadData is destroyed before this event loop (e.g. during exit()).
+    int m_wake_fd;
 };
 
 using EventLoopManagerPlatform = EventLoopManagerUnix;
@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Atomic.h>
+#include <AK/BuiltinWrappers.h>
+#include <AK/Error.h>
+#include <AK/Span.h>
+#include <AK/StdLibExtras.h>
+#include <LibCore/AnonymousBuffer.h>
+
+namespace Core {
+
+// A single-producer single-consumer ring of bytes whose storage lives in shared memory, so that a stream of bytes can
+// be handed to another process without copying it through the kernel. The ring does not block: both sides are
+// expected to pair it with some other channel (e.g. a socket) to wake each other up. The wake-up flags below tell
+// them when that is necessary.
+//
+// The other process may be less trusted than we are, so positions read from shared memory are validated before they
+// are used to index the ring.
+class SharedByteRing {
+public:
+    static constexpr size_t default_capacity = 512 * KiB;
+
+    SharedByteRing() = default;
+
+    static ErrorOr<SharedByteRing> create(size_t capacity = default_capacity)
+    {
+        VERIFY(popcount(capacity) == 1);
+
+        auto buffer = TRY(AnonymousBuffer::create_with_size(sizeof(Header) + capacity));
+        new (buffer.data<void>()) Header;
+        return SharedByteRing { move(buffer) };
+    }
+
+    static ErrorOr<SharedByteRing> adopt(AnonymousBuffer buffer)
+    {
+        if (buffer.size() <= sizeof(Header) || popcount(buffer.size() - sizeof(Header)) != 1)
+            return Error::from_string_literal("Shared byte ring has an invalid size");
+        return SharedByteRing { move(buffer) };
+    }
+
+    bool is_valid() const { return m_buffer.is_valid(); }
+    AnonymousBuffer const& anonymous_buffer() const { return m_buffer; }
+    size_t capacity() const { return m_capacity; }
+
+    // Producer side.
+
+    // Copies as many bytes as fit into the ring, and returns how many that was.
+    ErrorOr<size_t> write(ReadonlyBytes bytes)
+    {
+        auto& header = this->header();
+        auto write_position = header.write_position.load(AK::MemoryOrder::memory_order_relaxed);
+        auto used_size = TRY(validated_used_size(write_position, header.read_position.load()));
+
+        auto size = min(bytes.size(), m_capacity - used_size);
+        auto offset = write_position & (m_capacity - 1);
+        auto size_before_wrap = min(size, m_capacity - offset);
+        __builtin_memcpy(storage() + offset, bytes.data(), size_before_wrap);
+        __builtin_memcpy(storage(), bytes.data() + size_before_wrap, size - size_before_wrap);
+
+        header.write_position.store(write_position + size);
+        return size;
+    }
+
+    // Returns whether the consumer has to be woken up to see the bytes written since it last caught up. Call this
+    // after writing.
+    bool needs_to_wake_reader() { return !header().reader_wake_up_pending.exchange(true); }
+
+    // Asks the consumer to wake us up once it has freed up space. Returns false if it already did so in the meantime,
+    // in which case there is no wake-up to wait for and writing should just be retried.
+    bool wait_for_space()
+    {
+        auto& header = this->header();
+        header.writer_waiting_for_space.store(true);
+        return header.write_position.load() - header.read_position.load() >= m_capacity;
+    }
+
+    // Consumer side.
+
+    // Returns the next contiguous run of unread bytes, without consuming them. The bytes are only valid until they are
+    // consumed.
+    ErrorOr<ReadonlyBytes> peek_some_contiguous() const
+    {
+        auto& header = this->header();
+        auto read_position = header.read_position.load(AK::MemoryOrder::memory_order_relaxed);
+        auto used_size = TRY(validated_used_size(header.write_position.load(), read_position));
+
+        auto offset = read_position & (m_capacity - 1);
+        return ReadonlyBytes { storage() + offset, min(used_size, m_capacity - offset) };
+    }
+
+    // Returns whether the producer has to be woken up to make use of the space that was freed up.
+    bool consume(size_t size)
+    {
+        auto& header = this->header();
+        header.read_position.store(header.read_position.load(AK::MemoryOrder::memory_order_relaxed) + size);
+        return header.writer_waiting_for_space.exchange(false);
+    }
+
+    // Call this before reading once the producer's wake-up has been received, so the next write wakes us up again.
+    // Bytes written before that are seen by the next read.
+    void did_wake_reader() { header().reader_wake_up_pending.store(false); }
+
+    bool is_empty() const
+    {
+        auto const& header = this->header();
+        return header.write_position.load() == header.read_position.load();
+    }
+
+private:
+    // The positions count all bytes ever written and consumed, so the ring is empty if they are equal and full if
+    // they are a capacity apart. Everything but each side's reads of its own position is sequentially consistent, so
+    // that a wake-up flag can't be cleared or set without the other side seeing the bytes or space it was about.
+    struct Header {
+        AK_CACHE_ALIGNED Atomic<u64> write_position { 0 };
+        AK_CACHE_ALIGNED Atomic<u64> read_position { 0 };
+        AK_CACHE_ALIGNED Atomic<bool> reader_wake_up_pending { false };
+        Atomic<bool> writer_waiting_for_space { false };
+    };
+
+    explicit SharedByteRing(AnonymousBuffer buffer)
+        : m_buffer(move(buffer))
+        , m_capacity(m_buffer.size() - sizeof(Header))
+    {
+    }
+
+    ErrorOr<size_t> validated_used_size(u64 write_position, u64 read_position) const
+    {
+        if (write_position < read_position || write_position - read_position > m_capacity)
+            return Error::from_string_literal("Shared byte ring is corrupted");
+        return static_cast<size_t>(write_position - read_position);
+    }
+
+    Header& header() { return *reinterpret_cast<Header*>(m_buffer.data<void>()); }
+    Header const& header() const { return *reinterpret_cast<Header const*>(m_buffer.data<void>()); }
+
+    u8* storage() { return m_buffer.data<u8>() + sizeof(Header); }
+    u8 const* storage() const { return m_buffer.data<u8>() + sizeof(Header); }
+
+    AnonymousBuffer m_buffer;
+    size_t m_capacity { 0 };
+};
+
+}
@@ -499,7 +499,8 @@ public:
                                 timing]() mutable {
                                 handle_system_resolver_completion(name, *state, family, move(record_or_error), timing);
                             });
-                    });
+                    },
+                    Threading::ThreadPool::Priority::UserBlocking);
             };
 
             submit_worker(Core::Socket::AddressFamily::IPv4Only);
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/Atomic.h>
 #include <AK/Format.h>
 #include <AK/Forward.h>
 #include <AK/HashMap.h>
@@ -49,11 +50,22 @@ class GC_API Cell {
 public:
     static constexpr bool OVERRIDES_FINALIZE = false;
 
+    // Cell types whose destructor only releases memory owned by the cell (no shared caches, tables, non-atomic
+    // refcounts or finalize()) may set this so that their dead cells are destroyed on a background thread.
+    // The destructor runs while the mutator keeps going, so it must not read any state the mutator can change,
+    // including that of other cells. The sweeper itself only touches mark bits and never calls into live cells.
+    static constexpr bool SWEEPS_CONCURRENTLY = false;
+
     virtual ~Cell() = default;
 
     bool is_marked() const { return m_mark; }
     void set_marked(bool b) { m_mark = b; }
 
+    // Used while several marking threads may race to mark the same cell.
+    // Returns true if this call is the one that marked the cell.
+    bool is_marked_concurrently() const { return AK::atomic_load(&m_mark, AK::MemoryOrder::memory_order_relaxed); }
+    bool try_set_marked_concurrently() { return !AK::atomic_exchange(&m_mark, true, AK::MemoryOrder::memory_order_relaxed); }
+
     enum class State : bool {
         Live,
         Dead,
@@ -62,6 +74,11 @@ public:
     State state() const { return m_state; }
     void set_state(State state) { m_state = state; }
 
+    // A cell is young until it has survived its first collection. Sweeping uses this to measure how much of what was
+    // allocated since the previous collection is already garbage.
+    bool is_young() const { return m_young; }
+    void set_young(bool b) { m_young = b; }
+
     virtual StringView class_name() const = 0;
 
     class GC_API Visitor {
@@ -239,7 +256,10 @@ protected:
 
 private:
     bool m_mark { false };
-    State m_state { State::Live };
+    // NB: These share a byte so that subclasses can keep using the tail padding after it. Both are only written by
+    //     whoever owns the cell's block at the time: the mutator, or the background sweeper.
+    State m_state : 1 { State::Live };
+    bool m_young : 1 { true };
 };
 
 template<typename T>
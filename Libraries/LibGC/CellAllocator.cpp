@@ -19,11 +19,12 @@ BlockAllocator& CellAllocator::shared_block_allocator()
     return *allocator;
 }
 
-CellAllocator::CellAllocator(size_t cell_size, Optional<StringView> class_name, bool overrides_finalize)
+CellAllocator::CellAllocator(size_t cell_size, Optional<StringView> class_name, bool overrides_finalize, bool sweeps_concurrently)
     : m_class_name(class_name)
     , m_cell_size(cell_size)
     , m_block_allocator(shared_block_allocator())
     , m_overrides_finalize(overrides_finalize)
+    , m_sweeps_concurrently(sweeps_concurrently)
 {
 }
 
@@ -18,7 +18,7 @@
     static GC::TypeIsolatingCellAllocator<ClassName> cell_allocator
 
 #define GC_DEFINE_ALLOCATOR(ClassName) \
-    GC::TypeIsolatingCellAllocator<ClassName> ClassName::cell_allocator { #ClassName##sv, ClassName::OVERRIDES_FINALIZE }
+    GC::TypeIsolatingCellAllocator<ClassName> ClassName::cell_allocator { #ClassName##sv, ClassName::OVERRIDES_FINALIZE, ClassName::SWEEPS_CONCURRENTLY }
 
 namespace GC {
 
@@ -30,6 +30,7 @@ public:
     Optional<StringView> class_name() const { return m_class_name; }
     size_t cell_size() const { return m_cell_size; }
     bool overrides_finalize() const { return m_overrides_finalize; }
+    bool sweeps_concurrently() const { return m_sweeps_concurrently; }
 
     CellAllocator& for_heap(Heap&);
 
@@ -42,10 +43,11 @@ public:
     }
 
 protected:
-    CellAllocatorDescriptorBase(size_t cell_size, StringView class_name, bool overrides_finalize)
+    CellAllocatorDescriptorBase(size_t cell_size, StringView class_name, bool overrides_finalize, bool sweeps_concurrently)
         : m_class_name(class_name)
         , m_cell_size(cell_size)
         , m_overrides_finalize(overrides_finalize)
+        , m_sweeps_concurrently(sweeps_concurrently)
     {
     }
 
@@ -53,6 +55,7 @@ private:
     Optional<StringView> m_class_name;
     size_t m_cell_size { 0 };
     bool m_overrides_finalize { false };
+    bool m_sweeps_concurrently { false };
 
     Heap* m_last_heap { nullptr };
     CellAllocator* m_last_allocator { nullptr };
@@ -60,13 +63,14 @@ private:
 
 class GC_API CellAllocator {
 public:
-    CellAllocator(size_t cell_size, Optional<StringView> = {}, bool overrides_finalize = false);
+    CellAllocator(size_t cell_size, Optional<StringView> = {}, bool overrides_finalize = false, bool sweeps_concurrently = false);
     ~CellAllocator();
 
     static BlockAllocator& shared_block_allocator();
 
     Optional<StringView> class_name() const { return m_class_name; }
     size_t cell_size() const { return m_cell_size; }
+    bool sweeps_concurrently() const { return m_sweeps_concurrently; }
 
     Cell* allocate_cell(Heap&);
 
@@ -111,6 +115,7 @@ private:
     BlockList m_usable_blocks;
     SweepBlockList m_blocks_pending_sweep;
     bool m_overrides_finalize { false };
+    bool m_sweeps_concurrently { false };
 };
 
 template<typename T>
@@ -118,8 +123,8 @@ class GC_API TypeIsolatingCellAllocator final : public CellAllocatorDescriptorBa
 public:
     using CellType = T;
 
-    TypeIsolatingCellAllocator(StringView class_name, bool overrides_finalize)
-        : CellAllocatorDescriptorBase(sizeof(T), class_name, overrides_finalize)
+    TypeIsolatingCellAllocator(StringView class_name, bool overrides_finalize, bool sweeps_concurrently)
+        : CellAllocatorDescriptorBase(sizeof(T), class_name, overrides_finalize, sweeps_concurrently)
     {
     }
 };
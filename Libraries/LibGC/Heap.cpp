@@ -5,6 +5,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Atomic.h>
 #include <AK/Badge.h>
 #include <AK/BinarySearch.h>
 #include <AK/Checked.h>
@@ -23,6 +24,7 @@
 #include <AK/TemporaryChange.h>
 #include <AK/Time.h>
 #include <LibCore/ElapsedTimer.h>
+#include <LibCore/Environment.h>
 #include <LibCore/File.h>
 #include <LibCore/StandardPaths.h>
 #include <LibCore/Timer.h>
@@ -33,6 +35,9 @@
 #include <LibGC/NanBoxedValue.h>
 #include <LibGC/Root.h>
 #include <LibGC/Weak.h>
+#include <LibSync/ConditionVariable.h>
+#include <LibSync/Mutex.h>
+#include <LibThreading/Thread.h>
 #include <setjmp.h>
 
 #ifdef HAS_ADDRESS_SANITIZER
@@ -123,6 +128,8 @@ struct SweepStats {
     size_t collected_cell_bytes { 0 };
     size_t live_cell_bytes { 0 };
     size_t live_external_bytes { 0 };
+    size_t young_collected_bytes { 0 };
+    size_t young_surviving_bytes { 0 };
     size_t freed_block_count { 0 };
 };
 SweepStats g_sweep_stats;
@@ -152,6 +159,14 @@ bool g_next_incremental_sweep_should_report { false };
 // the GC's helpers to decide whether they should record subphase timings.
 bool g_recording_phase_timings { false };
 
+double young_survival_percentage(size_t young_collected_bytes, size_t young_surviving_bytes)
+{
+    auto young_bytes = young_collected_bytes + young_surviving_bytes;
+    if (young_bytes == 0)
+        return 0.0;
+    return 100.0 * static_cast<double>(young_surviving_bytes) / static_cast<double>(young_bytes);
+}
+
 void print_gc_report(i64 total_us, size_t live_block_count)
 {
     auto const& t = g_phase_timings;
@@ -170,6 +185,7 @@ void print_gc_report(i64 total_us, size_t live_block_count)
     dbgln("       Live cells: {} ({})", s.live_cells, human_readable_size(s.live_cell_bytes));
     dbgln("    Live external: {}", human_readable_size(s.live_external_bytes));
     dbgln("  Collected cells: {} ({})", s.collected_cells, human_readable_size(s.collected_cell_bytes));
+    dbgln("      Young cells: {} collected, {} survived ({:.1f}%)", human_readable_size(s.young_collected_bytes), human_readable_size(s.young_surviving_bytes), young_survival_percentage(s.young_collected_bytes, s.young_surviving_bytes));
     dbgln("      Live blocks: {} ({})", live_block_count, human_readable_size(live_block_count * HeapBlock::BLOCK_SIZE));
     dbgln("     Freed blocks: {} ({})", s.freed_block_count, human_readable_size(s.freed_block_count * HeapBlock::BLOCK_SIZE));
     dbgln("");
@@ -210,7 +226,7 @@ void record_incremental_sweep_batch(size_t blocks_swept, i64 elapsed_us, bool fo
     });
 }
 
-void print_incremental_sweep_report(size_t live_cell_bytes, size_t live_external_bytes, size_t next_gc_bytes_threshold)
+void print_incremental_sweep_report(size_t live_cell_bytes, size_t live_external_bytes, size_t young_collected_bytes, size_t young_surviving_bytes, size_t next_gc_bytes_threshold)
 {
     if (!incremental_sweep_stats().should_report)
         return;
@@ -238,6 +254,7 @@ void print_incremental_sweep_report(size_t live_cell_bytes, size_t live_external
     dbgln("    Swept blocks: {} / {} ({})", swept_blocks, incremental_sweep_stats().total_blocks, human_readable_size(swept_blocks * HeapBlock::BLOCK_SIZE));
     dbgln("     Live cells: {}", human_readable_size(live_cell_bytes));
     dbgln("  Live external: {}", human_readable_size(live_external_bytes));
+    dbgln("    Young cells: {} collected, {} survived ({:.1f}%)", human_readable_size(young_collected_bytes), human_readable_size(young_surviving_bytes), young_survival_percentage(young_collected_bytes, young_surviving_bytes));
     dbgln("  Next threshold: {}", human_readable_size(next_gc_bytes_threshold));
     dbgln("");
     dbgln("Batch timings:");
@@ -286,10 +303,23 @@ void Heap::set_default_heap_for_testing(Heap& heap)
 CellAllocator& Heap::cell_allocator_for(Badge<CellAllocatorDescriptorBase>, CellAllocatorDescriptorBase& descriptor)
 {
     return *m_cell_allocators_by_type.ensure(&descriptor, [&] {
-        return make<CellAllocator>(descriptor.cell_size(), descriptor.class_name(), descriptor.overrides_finalize());
+        return make<CellAllocator>(descriptor.cell_size(), descriptor.class_name(), descriptor.overrides_finalize(), descriptor.sweeps_concurrently());
     });
 }
 
+// Blocks of allocators that opted into SWEEPS_CONCURRENTLY are detached from their allocator when an incremental
+// sweep starts, swept by the background sweeper thread, and handed back to the allocator on the main thread.
+struct ConcurrentSweepJob {
+    Vector<HeapBlock*> blocks;
+
+    // Written by the sweeper thread, read on the main thread once the job is done.
+    Vector<HeapBlock*> empty_blocks;
+    size_t live_cell_bytes { 0 };
+    size_t young_collected_bytes { 0 };
+    size_t young_surviving_bytes { 0 };
+    bool done { false };
+};
+
 Heap::Heap(AK::Function<void(HashMap<Cell*, GC::HeapRoot>&)> gather_embedder_roots, BecomeProcessDefault become_process_default)
     : m_gather_embedder_roots(move(gather_embedder_roots))
 {
@@ -1015,6 +1045,185 @@ NO_SANITIZE_ADDRESS void Heap::gather_conservative_roots(HashMap<Cell*, HeapRoot
     }
 }
 
+// Work shared between the threads of a parallel mark phase. Each marking thread keeps a private work queue and
+// donates fixed-size packets of grey cells here whenever another thread has run out of work.
+class ParallelMarkingWorkPool {
+    AK_MAKE_NONCOPYABLE(ParallelMarkingWorkPool);
+    AK_MAKE_NONMOVABLE(ParallelMarkingWorkPool);
+
+public:
+    static constexpr size_t packet_size = 256;
+
+    explicit ParallelMarkingWorkPool(size_t participant_count)
+        : m_participant_count(participant_count)
+    {
+    }
+
+    bool has_idle_participants() const { return m_idle_participant_count.load(AK::MemoryOrder::memory_order_relaxed) > 0; }
+
+    void donate_packet(Vector<Ref<Cell>>& work_queue)
+    {
+        VERIFY(work_queue.size() >= packet_size);
+        Vector<Ref<Cell>> packet;
+        packet.ensure_capacity(packet_size);
+        for (size_t i = 0; i < packet_size; ++i)
+            packet.unchecked_append(work_queue.take_last());
+
+        {
+            Sync::MutexLocker locker(m_mutex);
+            m_packets.append(move(packet));
+        }
+        m_condition.signal();
+    }
+
+    // Blocks until a packet is available, or until every participant has run out of work.
+    // Returns false in the latter case, which means marking is complete.
+    bool take_packet(Vector<Ref<Cell>>& work_queue)
+    {
+        VERIFY(work_queue.is_empty());
+
+        Sync::MutexLocker locker(m_mutex);
+        ++m_idle_participant_count;
+        while (true) {
+            if (!m_packets.is_empty()) {
+                work_queue = m_packets.take_last();
+                --m_idle_participant_count;
+                return true;
+            }
+            if (m_marking_is_complete)
+                return false;
+            if (m_idle_participant_count.load() == m_participant_count) {
+                m_marking_is_complete = true;
+                m_condition.broadcast();
+                return false;
+            }
+            m_condition.wait();
+        }
+    }
+
+private:
+    Sync::Mutex m_mutex;
+    Sync::ConditionVariable m_condition { m_mutex };
+    Vector<Vector<Ref<Cell>>> m_packets;
+    size_t const m_participant_count;
+    Atomic<size_t> m_idle_participant_count { 0 };
+    bool m_marking_is_complete { false };
+};
+
+// Process-wide set of threads that help the mutator thread drain the mark stack. Root gathering, including the
+// conservative stack scan, always happens on the mutator thread before the helpers are woken up.
+class ParallelMarkingHelpers {
+    AK_MAKE_NONCOPYABLE(ParallelMarkingHelpers);
+    AK_MAKE_NONMOVABLE(ParallelMarkingHelpers);
+
+public:
+    static ParallelMarkingHelpers& the()
+    {
+        static NeverDestroyed<ParallelMarkingHelpers> instance;
+        return *instance;
+    }
+
+    ParallelMarkingHelpers()
+    {
+        if (auto value = Core::Environment::get("LIBGC_MARKING_THREADS"sv); value.has_value()) {
+            if (auto count = AK::parse_number<size_t>(*value); count.has_value())
+                set_helper_count(*count);
+        }
+    }
+
+    size_t helper_count() const
+    {
+        Sync::MutexLocker locker(m_mutex);
+        return m_active_helper_count;
+    }
+
+    void set_helper_count(size_t count)
+    {
+        // NB: Holding the run mutex keeps the thread list and the helper count stable while a collection is running.
+        Sync::MutexLocker run_locker(m_run_mutex);
+
+        count = min(count, max_helper_count);
+        while (m_threads.size() < count) {
+            auto index = m_threads.size();
+            auto thread = Threading::Thread::construct(ByteString::formatted("GCMarker/{}", index), [this, index] {
+                helper_loop(index);
+                return static_cast<intptr_t>(0);
+            });
+            thread->start();
+            thread->detach();
+            m_threads.append(move(thread));
+        }
+
+        Sync::MutexLocker locker(m_mutex);
+        m_active_helper_count = count;
+    }
+
+    // Runs helper_task on helper_count helper threads and main_thread_task on the calling thread, and returns once all
+    // of them have finished. The count is passed in so that it matches the work pool even if set_helper_count() ran
+    // since the caller read it; helper threads are never torn down, so enough of them are always around.
+    void run(size_t helper_count, AK::Function<void()> const& helper_task, AK::Function<void()> const& main_thread_task)
+    {
+        // Heaps on different threads may collect at the same time; they take turns using the helpers.
+        Sync::MutexLocker run_locker(m_run_mutex);
+        VERIFY(helper_count <= m_threads.size());
+
+        {
+            Sync::MutexLocker locker(m_mutex);
+            m_task = &helper_task;
+            m_participating_helper_count = helper_count;
+            m_running_helper_count = m_participating_helper_count;
+            ++m_generation;
+        }
+        m_task_available.broadcast();
+
+        main_thread_task();
+
+        Sync::MutexLocker locker(m_mutex);
+        while (m_running_helper_count > 0)
+            m_task_finished.wait();
+        m_task = nullptr;
+    }
+
+private:
+    static constexpr size_t max_helper_count = 64;
+
+    void helper_loop(size_t index)
+    {
+        u64 last_seen_generation = 0;
+        while (true) {
+            AK::Function<void()> const* task = nullptr;
+            {
+                Sync::MutexLocker locker(m_mutex);
+                while (m_generation == last_seen_generation)
+                    m_task_available.wait();
+                last_seen_generation = m_generation;
+                if (index < m_participating_helper_count)
+                    task = m_task;
+            }
+
+            if (!task)
+                continue;
+
+            (*task)();
+
+            Sync::MutexLocker locker(m_mutex);
+            if (--m_running_helper_count == 0)
+                m_task_finished.signal();
+        }
+    }
+
+    Sync::Mutex m_run_mutex;
+    mutable Sync::Mutex m_mutex;
+    Sync::ConditionVariable m_task_available { m_mutex };
+    Sync::ConditionVariable m_task_finished { m_mutex };
+    Vector<NonnullRefPtr<Threading::Thread>> m_threads;
+    size_t m_active_helper_count { 0 };
+    AK::Function<void()> const* m_task { nullptr };
+    u64 m_generation { 0 };
+    size_t m_participating_helper_count { 0 };
+    size_t m_running_helper_count { 0 };
+};
+
 class MarkingVisitor final : public Cell::Visitor {
 public:
     // The domain is a set of heaps whose cells this mark phase is responsible for; cells outside the domain are not visited.
@@ -1028,6 +1237,17 @@ public:
         }
     }
 
+    // A helper thread's visitor, which starts out empty and takes its work from the shared pool.
+    MarkingVisitor(ReadonlySpan<Heap* const> domain, ParallelMarkingWorkPool& work_pool)
+        : m_domain(domain)
+        , m_work_pool(&work_pool)
+    {
+        m_heap_region_start = BlockAllocator::heap_region_start();
+        m_heap_region_end = BlockAllocator::heap_region_end();
+    }
+
+    void share_work_through(ParallelMarkingWorkPool& work_pool) { m_work_pool = &work_pool; }
+
     bool cell_is_in_domain(Cell const& cell) const
     {
         auto& heap = HeapBlockBase::from_cell(&cell)->heap();
@@ -1042,13 +1262,14 @@ public:
 
     virtual void visit_impl(Cell& cell) override
     {
-        if (cell.is_marked())
+        if (is_marked(cell))
             return;
         if (!cell_is_in_domain(cell))
             return;
+        if (!try_mark(cell))
+            return;
         dbgln_if(HEAP_DEBUG, "  ! {}", &cell);
 
-        cell.set_marked(true);
         m_work_queue.append(cell);
     }
 
@@ -1060,13 +1281,14 @@ public:
             if (!value.is_cell())
                 continue;
             auto& cell = value.as_cell();
-            if (cell.is_marked())
+            if (is_marked(cell))
                 continue;
             if (!cell_is_in_domain(cell))
                 continue;
+            if (!try_mark(cell))
+                continue;
             dbgln_if(HEAP_DEBUG, "  ! {}", &cell);
 
-            cell.set_marked(true);
             m_work_queue.unchecked_append(cell);
         }
     }
@@ -1081,11 +1303,12 @@ public:
 
         for (auto* heap : m_domain) {
             for_each_cell_among_possible_pointers(heap->m_live_heap_blocks, possible_pointers, [&](Cell* cell, FlatPtr) {
-                if (cell->is_marked())
+                if (is_marked(*cell))
                     return;
                 if (cell->state() != Cell::State::Live)
                     return;
-                cell->set_marked(true);
+                if (!try_mark(*cell))
+                    return;
                 m_work_queue.append(*cell);
             });
         }
@@ -1093,18 +1316,50 @@ public:
 
     void mark_all_live_cells()
     {
-        while (!m_work_queue.is_empty()) {
-            m_work_queue.take_last()->visit_edges(*this);
+        if (!m_work_pool) {
+            while (!m_work_queue.is_empty())
+                m_work_queue.take_last()->visit_edges(*this);
+            return;
         }
+
+        do {
+            while (!m_work_queue.is_empty()) {
+                m_work_queue.take_last()->visit_edges(*this);
+                if (m_work_queue.size() >= 2 * ParallelMarkingWorkPool::packet_size && m_work_pool->has_idle_participants())
+                    m_work_pool->donate_packet(m_work_queue);
+            }
+        } while (m_work_pool->take_packet(m_work_queue));
     }
 
 private:
+    ALWAYS_INLINE bool is_marked(Cell const& cell) const
+    {
+        if (m_work_pool)
+            return cell.is_marked_concurrently();
+        return cell.is_marked();
+    }
+
+    // Returns true if this visitor marked the cell and is therefore responsible for visiting its edges.
+    ALWAYS_INLINE bool try_mark(Cell& cell)
+    {
+        if (m_work_pool)
+            return cell.try_set_marked_concurrently();
+        cell.set_marked(true);
+        return true;
+    }
+
     ReadonlySpan<Heap* const> m_domain;
     Vector<Ref<Cell>> m_work_queue;
+    ParallelMarkingWorkPool* m_work_pool { nullptr };
     FlatPtr m_heap_region_start;
     FlatPtr m_heap_region_end;
 };
 
+void Heap::set_parallel_marking_helper_count(size_t count)
+{
+    ParallelMarkingHelpers::the().set_helper_count(count);
+}
+
 void Heap::mark_live_cells(HashMap<Cell*, HeapRoot> const& roots)
 {
     Heap* domain[] = { this };
@@ -1123,7 +1378,22 @@ void Heap::mark_live_cells_across(ReadonlySpan<Heap* const> heaps, HashMap<Cell*
 
     {
         ScopedPhaseTimer timer { g_recording_phase_timings, g_phase_timings.mark_bfs_us };
-        visitor->mark_all_live_cells();
+        auto& helpers = ParallelMarkingHelpers::the();
+        if (auto helper_count = helpers.helper_count(); helper_count == 0) {
+            visitor->mark_all_live_cells();
+        } else {
+            ParallelMarkingWorkPool work_pool { helper_count + 1 };
+            visitor->share_work_through(work_pool);
+            helpers.run(
+                helper_count,
+                [&] {
+                    MarkingVisitor helper_visitor { heaps, work_pool };
+                    helper_visitor.mark_all_live_cells();
+                },
+                [&] {
+                    visitor->mark_all_live_cells();
+                });
+        }
     }
 
     {
@@ -1177,6 +1447,8 @@ void Heap::sweep_dead_cells(bool print_report, Core::ElapsedTimer const& measure
     size_t collected_cell_bytes = 0;
     size_t live_cell_bytes = 0;
     size_t live_external_bytes = 0;
+    size_t young_collected_bytes = 0;
+    size_t young_surviving_bytes = 0;
 
     {
         ScopedPhaseTimer timer { g_recording_phase_timings, g_phase_timings.sweep_block_iteration_us };
@@ -1186,11 +1458,17 @@ void Heap::sweep_dead_cells(bool print_report, Core::ElapsedTimer const& measure
             block.template for_each_cell_in_state<Cell::State::Live>([&](Cell* cell) {
                 if (!cell->is_marked()) {
                     dbgln_if(HEAP_DEBUG, "  ~ {}", cell);
+                    if (cell->is_young())
+                        young_collected_bytes += block.cell_size();
                     block.deallocate(cell);
                     ++collected_cells;
                     collected_cell_bytes += block.cell_size();
                 } else {
                     cell->set_marked(false);
+                    if (cell->is_young()) {
+                        cell->set_young(false);
+                        young_surviving_bytes += block.cell_size();
+                    }
                     block_has_live_cells = true;
                     ++live_cells;
                     live_cell_bytes += block.cell_size();
@@ -1232,6 +1510,7 @@ void Heap::sweep_dead_cells(bool print_report, Core::ElapsedTimer const& measure
         ScopedPhaseTimer timer { g_recording_phase_timings, g_phase_timings.sweep_update_threshold_us };
         update_gc_bytes_threshold(live_cell_bytes, live_external_bytes);
     }
+    m_idle_collection_policy.did_sweep_young_cells(young_collected_bytes, young_surviving_bytes);
 
     if (print_report) {
         g_sweep_stats = {
@@ -1240,6 +1519,8 @@ void Heap::sweep_dead_cells(bool print_report, Core::ElapsedTimer const& measure
             .collected_cell_bytes = collected_cell_bytes,
             .live_cell_bytes = live_cell_bytes,
             .live_external_bytes = live_external_bytes,
+            .young_collected_bytes = young_collected_bytes,
+            .young_surviving_bytes = young_surviving_bytes,
             .freed_block_count = empty_blocks.size(),
         };
     }
@@ -1263,10 +1544,16 @@ void Heap::sweep_block(HeapBlock& block)
     block.for_each_cell_in_state<Cell::State::Live>([&](Cell* cell) {
         if (!cell->is_marked()) {
             dbgln_if(HEAP_DEBUG, "  ~ {}", cell);
+            if (cell->is_young())
+                m_sweep_young_collected_bytes += block.cell_size();
             block.deallocate(cell);
             ++collected_cells;
         } else {
             cell->set_marked(false);
+            if (cell->is_young()) {
+                cell->set_young(false);
+                m_sweep_young_surviving_bytes += block.cell_size();
+            }
             block_has_live_cells = true;
             m_sweep_live_cell_bytes += block.cell_size();
             auto cell_external_memory_size = cell->external_memory_size();
@@ -1293,6 +1580,171 @@ void Heap::sweep_block(HeapBlock& block)
     }
 }
 
+class ConcurrentSweeper {
+    AK_MAKE_NONCOPYABLE(ConcurrentSweeper);
+    AK_MAKE_NONMOVABLE(ConcurrentSweeper);
+
+public:
+    static ConcurrentSweeper& the()
+    {
+        static NeverDestroyed<ConcurrentSweeper> instance;
+        return *instance;
+    }
+
+    ConcurrentSweeper()
+    {
+        m_thread = Threading::Thread::construct("GCSweeper"sv, [this] {
+            run();
+            return static_cast<intptr_t>(0);
+        });
+        m_thread->start();
+        m_thread->detach();
+    }
+
+    void submit(ConcurrentSweepJob& job)
+    {
+        {
+            Sync::MutexLocker locker(m_mutex);
+            m_pending_jobs.append(&job);
+        }
+        m_job_available.signal();
+    }
+
+    bool is_done(ConcurrentSweepJob const& job)
+    {
+        Sync::MutexLocker locker(m_mutex);
+        return job.done;
+    }
+
+    void wait(ConcurrentSweepJob const& job)
+    {
+        Sync::MutexLocker locker(m_mutex);
+        while (!job.done)
+            m_job_finished.wait();
+    }
+
+private:
+    void run()
+    {
+        while (true) {
+            ConcurrentSweepJob* job = nullptr;
+            {
+                Sync::MutexLocker locker(m_mutex);
+                while (m_pending_jobs.is_empty())
+                    m_job_available.wait();
+                job = m_pending_jobs.take_first();
+            }
+
+            for (auto* block : job->blocks)
+                sweep(*block, *job);
+
+            {
+                Sync::MutexLocker locker(m_mutex);
+                job->done = true;
+            }
+            m_job_finished.broadcast();
+        }
+    }
+
+    static void sweep(HeapBlock& block, ConcurrentSweepJob& job)
+    {
+        bool block_has_live_cells = false;
+        block.for_each_cell_in_state<Cell::State::Live>([&](Cell* cell) {
+            if (!cell->is_marked()) {
+                if (cell->is_young())
+                    job.young_collected_bytes += block.cell_size();
+                block.deallocate(cell);
+            } else {
+                cell->set_marked(false);
+                if (cell->is_young()) {
+                    cell->set_young(false);
+                    job.young_surviving_bytes += block.cell_size();
+                }
+                block_has_live_cells = true;
+                job.live_cell_bytes += block.cell_size();
+            }
+        });
+        if (!block_has_live_cells)
+            job.empty_blocks.append(&block);
+    }
+
+    Sync::Mutex m_mutex;
+    Sync::ConditionVariable m_job_available { m_mutex };
+    Sync::ConditionVariable m_job_finished { m_mutex };
+    RefPtr<Threading::Thread> m_thread;
+    Vector<ConcurrentSweepJob*> m_pending_jobs;
+};
+
+void Heap::start_concurrent_sweep()
+{
+    VERIFY(!m_concurrent_sweep_job);
+
+    auto job = make<ConcurrentSweepJob>();
+    for (auto& allocator : m_all_cell_allocators) {
+        if (!allocator.sweeps_concurrently())
+            continue;
+        while (auto* block = allocator.m_full_blocks.take_first())
+            job->blocks.append(block);
+        while (auto* block = allocator.m_usable_blocks.take_first())
+            job->blocks.append(block);
+    }
+    if (job->blocks.is_empty())
+        return;
+
+    // NB: The mutator keeps running while the sweeper works, so nothing on the sweeper thread may look at live cells.
+    //     Their external memory is accounted for here, before the blocks are handed over.
+    for (auto* block : job->blocks) {
+        block->for_each_cell_in_state<Cell::State::Live>([&](Cell* cell) {
+            if (!cell->is_marked())
+                return;
+            auto cell_external_memory_size = cell->external_memory_size();
+            m_sweep_live_external_bytes = cell_external_memory_size > NumericLimits<size_t>::max() - m_sweep_live_external_bytes
+                ? NumericLimits<size_t>::max()
+                : m_sweep_live_external_bytes + cell_external_memory_size;
+        });
+    }
+
+    dbgln_if(INCREMENTAL_SWEEP_DEBUG, "[sweep] {} blocks handed to the background sweeper", job->blocks.size());
+    m_concurrent_sweep_job = move(job);
+    ConcurrentSweeper::the().submit(*m_concurrent_sweep_job);
+}
+
+bool Heap::try_finish_concurrent_sweep()
+{
+    if (!m_concurrent_sweep_job)
+        return true;
+    if (!ConcurrentSweeper::the().is_done(*m_concurrent_sweep_job))
+        return false;
+    finish_concurrent_sweep();
+    return true;
+}
+
+void Heap::finish_concurrent_sweep()
+{
+    if (!m_concurrent_sweep_job)
+        return;
+
+    auto job = m_concurrent_sweep_job.release_nonnull();
+    ConcurrentSweeper::the().wait(*job);
+
+    // Destructors already ran on the sweeper thread; all that is left is to give the blocks back to their allocators.
+    for (auto* block : job->blocks) {
+        auto& allocator = block->cell_allocator();
+        if (block->is_full())
+            allocator.m_full_blocks.append(*block);
+        else
+            allocator.m_usable_blocks.append(*block);
+    }
+    for (auto* block : job->empty_blocks)
+        block->cell_allocator().block_did_become_empty({}, *block);
+
+    m_sweep_live_cell_bytes += job->live_cell_bytes;
+    m_sweep_young_collected_bytes += job->young_collected_bytes;
+    m_sweep_young_surviving_bytes += job->young_surviving_bytes;
+
+    dbgln_if(INCREMENTAL_SWEEP_DEBUG, "[sweep] Background sweeper returned {} blocks ({} freed)", job->blocks.size(), job->empty_blocks.size());
+}
+
 bool Heap::sweep_next_block()
 {
     if (!m_incremental_sweep_active)
@@ -1323,6 +1775,8 @@ void Heap::start_incremental_sweep()
     m_incremental_sweep_active = true;
     m_sweep_live_cell_bytes = 0;
     m_sweep_live_external_bytes = 0;
+    m_sweep_young_collected_bytes = 0;
+    m_sweep_young_surviving_bytes = 0;
     incremental_sweep_stats().should_report = false;
     incremental_sweep_stats().total_blocks = 0;
     incremental_sweep_stats().batches.clear();
@@ -1331,6 +1785,8 @@ void Heap::start_incremental_sweep()
     if (incremental_sweep_stats().should_report)
         incremental_sweep_stats().timer.start();
 
+    start_concurrent_sweep();
+
     // Populate each allocator's pending sweep list with its current blocks.
     // Blocks allocated during incremental sweep won't be on these lists
     // and don't need sweeping.
@@ -1354,12 +1810,13 @@ void Heap::start_incremental_sweep()
 void Heap::finish_incremental_sweep()
 {
     update_gc_bytes_threshold(m_sweep_live_cell_bytes, m_sweep_live_external_bytes);
+    m_idle_collection_policy.did_sweep_young_cells(m_sweep_young_collected_bytes, m_sweep_young_surviving_bytes);
 
     dbgln_if(INCREMENTAL_SWEEP_DEBUG, "[sweep] === Sweep complete ===");
     dbgln_if(INCREMENTAL_SWEEP_DEBUG, "[sweep]     Live cell bytes: {} ({} KiB)", m_sweep_live_cell_bytes, m_sweep_live_cell_bytes / KiB);
     dbgln_if(INCREMENTAL_SWEEP_DEBUG, "[sweep]     Live external bytes: {} ({} KiB)", m_sweep_live_external_bytes, m_sweep_live_external_bytes / KiB);
     dbgln_if(INCREMENTAL_SWEEP_DEBUG, "[sweep]     Next GC threshold: {} ({} KiB)", m_gc_bytes_threshold, m_gc_bytes_threshold / KiB);
-    print_incremental_sweep_report(m_sweep_live_cell_bytes, m_sweep_live_external_bytes, m_gc_bytes_threshold);
+    print_incremental_sweep_report(m_sweep_live_cell_bytes, m_sweep_live_external_bytes, m_sweep_young_collected_bytes, m_sweep_young_surviving_bytes, m_gc_bytes_threshold);
 
     // Clear marks on cells allocated during sweep. Sweep already cleared
     // marks on cells it visited, so only these remain marked.
@@ -1377,6 +1834,10 @@ void Heap::finish_incremental_sweep()
 
 void Heap::finish_pending_incremental_sweep()
 {
+    // Joining the background sweeper never runs destructors on this thread, so it is safe even while GC is deferred,
+    // and it must happen before anyone walks the allocators' block lists again.
+    finish_concurrent_sweep();
+
     if (!m_incremental_sweep_active || is_gc_deferred())
         return;
 
@@ -1424,6 +1885,9 @@ void Heap::sweep_on_timer()
     auto deadline = start_time + AK::Duration::from_milliseconds(GC_INCREMENTAL_SWEEP_SLICE_MS);
     while (MonotonicTime::now() < deadline) {
         if (sweep_next_block()) {
+            // Don't block the event loop on the background sweeper; check back on the next tick instead.
+            if (!try_finish_concurrent_sweep())
+                break;
             auto elapsed = MonotonicTime::now() - start_time;
             record_incremental_sweep_batch(blocks_swept, elapsed.to_microseconds(), false);
             finish_incremental_sweep();
@@ -11,6 +11,7 @@
 #include <AK/HashTable.h>
 #include <AK/Noncopyable.h>
 #include <AK/NonnullOwnPtr.h>
+#include <AK/OwnPtr.h>
 #include <AK/RefPtr.h>
 #include <AK/StackInfo.h>
 #include <AK/String.h>
@@ -36,6 +37,8 @@
 
 namespace GC {
 
+struct ConcurrentSweepJob;
+
 struct StackFrameInfo {
     String label;
     size_t size_bytes { 0 };
@@ -92,6 +95,11 @@ public:
     void set_incremental_sweep_enabled(bool enabled) { m_incremental_sweep_enabled = enabled; }
     void set_should_collect_on_every_allocation(bool b) { m_should_collect_on_every_allocation = b; }
 
+    // Number of helper threads that drain the mark stack alongside the collecting thread. Zero (the default) marks
+    // serially. Process-wide; can also be set with the LIBGC_MARKING_THREADS environment variable. Every cell type's
+    // visit_edges() must be safe to run off the main thread for this to be enabled.
+    static void set_parallel_marking_helper_count(size_t);
+
     void did_create_root(Badge<RootImpl>, RootImpl&);
     void did_destroy_root(Badge<RootImpl>, RootImpl&);
 
@@ -180,6 +188,9 @@ private:
     void run_post_gc_tasks();
 
     bool sweep_next_block();
+    void start_concurrent_sweep();
+    bool try_finish_concurrent_sweep();
+    void finish_concurrent_sweep();
     void start_incremental_sweep();
     void finish_incremental_sweep();
     void finish_pending_incremental_sweep();
@@ -241,8 +252,11 @@ private:
     bool m_incremental_sweep_active { false };
     size_t m_sweep_live_cell_bytes { 0 };
     size_t m_sweep_live_external_bytes { 0 };
+    size_t m_sweep_young_collected_bytes { 0 };
+    size_t m_sweep_young_surviving_bytes { 0 };
     Vector<GC::Ptr<Cell>> m_cells_allocated_during_sweep;
     CellAllocator::SweepList m_allocators_to_sweep;
+    OwnPtr<ConcurrentSweepJob> m_concurrent_sweep_job;
     RefPtr<Core::Timer> m_incremental_sweep_timer;
 
     RefPtr<Core::Timer> m_idle_gc_timer;
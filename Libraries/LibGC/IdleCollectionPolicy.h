@@ -17,7 +17,8 @@ namespace GC {
 // small allocation trickle going even on an idle page. So instead of waiting for zero allocation, we watch for the
 // mutator transitioning out of an active phase: a tick whose allocation rate has dropped below 1/low_rate_divisor of
 // the peak rate seen so far this episode. The rate-drop trigger is gated on enough uncollected garbage having piled up
-// to be worth marking the whole live heap. The watchdog bounds how long garbage can sit when the rate-drop trigger
+// to be worth marking the whole live heap. Not everything allocated since the last collection is garbage, so the gate
+// discounts it by how much of the young generation survived the most recent sweep. The watchdog bounds how long garbage can sit when the rate-drop trigger
 // never fires, e.g. on a heap that allocates too steadily to show a drop or too slowly to clear the gate.
 class IdleCollectionPolicy {
 public:
@@ -35,11 +36,21 @@ public:
         m_tick_count = 0;
     }
 
-    // Evaluates one idle-timer tick. `total_allocated_bytes` is the monotonic allocation counter, `garbage_bytes` is
+    // Records how many bytes of young cells, i.e. cells allocated since the previous collection, a sweep collected
+    // and how many survived.
+    void did_sweep_young_cells(size_t collected_bytes, size_t surviving_bytes)
+    {
+        auto young_bytes = static_cast<u64>(collected_bytes) + surviving_bytes;
+        if (young_bytes == 0)
+            return;
+        m_young_survival_permille = static_cast<u32>(static_cast<u64>(surviving_bytes) * 1000 / young_bytes);
+    }
+
+    // Evaluates one idle-timer tick. `total_allocated_bytes` is the monotonic allocation counter, `allocated_bytes` is
     // the amount allocated since the last collection, and `gc_threshold` is the allocation-driven GC threshold.
-    Decision evaluate(u64 total_allocated_bytes, size_t garbage_bytes, size_t gc_threshold)
+    Decision evaluate(u64 total_allocated_bytes, size_t allocated_bytes, size_t gc_threshold)
     {
-        if (garbage_bytes == 0)
+        if (allocated_bytes == 0)
             return Decision::Park;
 
         auto delta = total_allocated_bytes - m_total_allocated_at_last_check;
@@ -48,7 +59,7 @@ public:
 
         bool rate_dropped = delta * low_rate_divisor < m_peak_delta;
         bool watchdog_elapsed = ++m_tick_count >= watchdog_ticks;
-        bool enough_garbage = garbage_bytes >= gc_threshold / min_garbage_divisor;
+        bool enough_garbage = expected_garbage_bytes(allocated_bytes) >= gc_threshold / min_garbage_divisor;
 
         if ((rate_dropped && enough_garbage) || watchdog_elapsed)
             return Decision::Collect;
@@ -63,9 +74,16 @@ public:
     static constexpr u32 watchdog_ticks = 15;
 
 private:
+    size_t expected_garbage_bytes(size_t allocated_bytes) const
+    {
+        return allocated_bytes / 1000 * (1000 - m_young_survival_permille);
+    }
+
     u64 m_total_allocated_at_last_check { 0 };
     u64 m_peak_delta { 0 };
     u32 m_tick_count { 0 };
+    // Until a sweep has measured it, all young cells are assumed to die.
+    u32 m_young_survival_permille { 0 };
 };
 
 }
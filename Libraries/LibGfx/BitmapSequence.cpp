@@ -80,6 +80,16 @@ ErrorOr<void> encode(Encoder& encoder, Gfx::BitmapSequence const& bitmap_sequenc
 
     TRY(encoder.encode(total_buffer_size.value()));
 
+    // A single bitmap whose backing buffer holds exactly its pixel data can be shared as is, without copying it. We only
+    // do that for buffers sealed read-only, so that the receiver can't change the pixels anyone else sees.
+    if (bitmaps.size() == 1 && bitmaps.first()) {
+        auto const& buffer = bitmaps.first()->anonymous_buffer();
+        if (buffer.is_sealed_read_only() && buffer.size() == total_buffer_size.value()) {
+            TRY(encoder.encode(buffer));
+            return {};
+        }
+    }
+
     if (total_buffer_size.value() > 0) {
         // collate all of the bitmap data into one contiguous buffer
         auto collated_buffer = TRY(Core::AnonymousBuffer::create_with_size(total_buffer_size.value()));
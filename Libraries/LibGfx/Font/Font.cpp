@@ -204,7 +204,6 @@ Font::ShapingCache::~ShapingCache() = default;
 
 void Font::ShapingCache::clear()
 {
-    map.clear();
     for (auto& slot : single_ascii_character_map)
         slot = nullptr;
 }
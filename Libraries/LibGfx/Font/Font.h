@@ -28,15 +28,6 @@ namespace Gfx {
 
 struct ShapedGlyphs;
 
-struct ShapingCacheKey {
-    Utf16String text;
-    u8 text_type { 0 };
-    u32 letter_spacing_bit_pattern { 0 };
-    u32 word_spacing_bit_pattern { 0 };
-
-    bool operator==(ShapingCacheKey const&) const = default;
-};
-
 struct FontPixelMetrics {
     float x_height { 0 };
     float advance_of_ascii_zero { 0 };
@@ -107,7 +98,6 @@ public:
     ShapeFeatures const& features() const { return m_shape_features; }
 
     struct ShapingCache {
-        HashMap<ShapingCacheKey, OwnPtr<ShapedGlyphs>> map;
         OwnPtr<ShapedGlyphs> single_ascii_character_map[128];
 
         ~ShapingCache();
@@ -148,15 +138,3 @@ private:
 };
 
 }
-
-namespace AK {
-
-template<>
-struct Traits<Gfx::ShapingCacheKey> : public DefaultTraits<Gfx::ShapingCacheKey> {
-    static unsigned hash(Gfx::ShapingCacheKey const& key)
-    {
-        return pair_int_hash(key.text.hash(), pair_int_hash(key.text_type, pair_int_hash(key.letter_spacing_bit_pattern, key.word_spacing_bit_pattern)));
-    }
-};
-
-}
@@ -4,14 +4,18 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <harfbuzz/hb-aat.h>
+#include <harfbuzz/hb-ot.h>
 #include <harfbuzz/hb.h>
 
+#include <AK/ScopeGuard.h>
 #include <LibGfx/Font/Font.h>
 #include <LibGfx/Font/FontVariationSettings.h>
 #include <LibGfx/Font/Typeface.h>
 #include <LibGfx/Font/TypefaceSkia.h>
 #include <LibIPC/Decoder.h>
 #include <LibIPC/Encoder.h>
+#include <LibSync/Once.h>
 
 namespace Gfx {
 
@@ -79,8 +83,9 @@ NonnullRefPtr<Font> Typeface::font(float point_size, FontVariationSettings const
 
 hb_face_t* Typeface::harfbuzz_typeface() const
 {
-    if (!m_harfbuzz_face)
+    Sync::call_once(m_harfbuzz_face_once, [&] {
         m_harfbuzz_face = create_harfbuzz_face();
+    });
     return m_harfbuzz_face;
 }
 
@@ -114,6 +119,59 @@ Typeface::BoundingBoxInFontUnits Typeface::bounding_box_in_font_units() const
     return bounding_box;
 }
 
+static bool face_has_table(hb_face_t* face, hb_tag_t tag)
+{
+    auto* blob = hb_face_reference_table(face, tag);
+    auto length = hb_blob_get_length(blob);
+    hb_blob_destroy(blob);
+    return length > 0;
+}
+
+static bool lookups_involve_glyph(hb_face_t* face, hb_tag_t table_tag, hb_codepoint_t glyph_id)
+{
+    auto* lookups = hb_set_create();
+    auto* glyphs = hb_set_create();
+    ScopeGuard guard = [&] {
+        hb_set_destroy(lookups);
+        hb_set_destroy(glyphs);
+    };
+
+    hb_ot_layout_collect_lookups(face, table_tag, nullptr, nullptr, nullptr, lookups);
+
+    hb_codepoint_t lookup_index = HB_SET_VALUE_INVALID;
+    while (hb_set_next(lookups, &lookup_index)) {
+        hb_ot_layout_lookup_collect_glyphs(face, table_tag, lookup_index, glyphs, glyphs, glyphs, nullptr);
+        if (hb_set_has(glyphs, glyph_id))
+            return true;
+    }
+    return false;
+}
+
+bool Typeface::can_shape_words_separately() const
+{
+    // Text may be shaped on more than one thread, so this is computed exactly once.
+    Sync::call_once(m_can_shape_words_separately_once, [&] {
+        m_can_shape_words_separately = [&] {
+            auto space_glyph_id = glyph_id_for_code_point(' ');
+            if (space_glyph_id == 0)
+                return false;
+
+            auto* face = harfbuzz_typeface();
+
+            // AAT tables and the legacy kern table can't be inspected like the OpenType layout tables, so we have to
+            // assume that they involve the space glyph. HarfBuzz only applies the kern table to fonts without GPOS.
+            if (hb_aat_layout_has_substitution(face) || hb_aat_layout_has_positioning(face))
+                return false;
+            if (!hb_ot_layout_has_positioning(face) && face_has_table(face, HB_TAG('k', 'e', 'r', 'n')))
+                return false;
+
+            return !lookups_involve_glyph(face, HB_OT_TAG_GSUB, space_glyph_id)
+                && !lookups_involve_glyph(face, HB_OT_TAG_GPOS, space_glyph_id);
+        }();
+    });
+    return m_can_shape_words_separately;
+}
+
 hb_face_t* Typeface::create_harfbuzz_face() const
 {
     if (!m_harfbuzz_blob)
@@ -18,6 +18,7 @@
 #include <LibGfx/Forward.h>
 #include <LibGfx/ShapeFeature.h>
 #include <LibIPC/Forward.h>
+#include <LibSync/Once.h>
 
 #define POINTS_PER_INCH 72.0f
 #define DEFAULT_DPI 96
@@ -84,6 +85,10 @@ public:
     };
     BoundingBoxInFontUnits bounding_box_in_font_units() const;
 
+    // Whether text set in this typeface can be shaped one word at a time, with the same result as shaping it all at
+    // once. That is the case unless the space glyph takes part in a ligature, kerning pair or other contextual lookup.
+    bool can_shape_words_separately() const;
+
     template<typename T>
     bool fast_is() const = delete;
 
@@ -121,7 +126,10 @@ private:
     mutable HashMap<FontCacheKey, NonnullRefPtr<Font>> m_fonts;
     mutable hb_blob_t* m_harfbuzz_blob { nullptr };
     mutable hb_face_t* m_harfbuzz_face { nullptr };
+    mutable Sync::OnceFlag m_harfbuzz_face_once;
     mutable Optional<BoundingBoxInFontUnits> m_bounding_box_in_font_units;
+    mutable bool m_can_shape_words_separately { false };
+    mutable Sync::OnceFlag m_can_shape_words_separately_once;
 };
 
 }
@@ -4,6 +4,8 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Math.h>
+#include <AK/Vector.h>
 #include <LibGfx/ImageFormats/AVIFLoader.h>
 #include <LibGfx/ImageFormats/BMPLoader.h>
 #include <LibGfx/ImageFormats/GIFLoader.h>
@@ -43,6 +45,95 @@ static ErrorOr<OwnPtr<ImageDecoderPlugin>> probe_and_sniff_for_appropriate_plugi
     return OwnPtr<ImageDecoderPlugin> {};
 }
 
+int downscale_factor_for_ideal_size(IntSize size, Optional<IntSize> ideal_size, int maximum_factor)
+{
+    if (!ideal_size.has_value() || ideal_size->is_empty())
+        return 1;
+
+    int factor = 1;
+    while (factor * 2 <= maximum_factor
+        && ceil_div(size.width(), factor * 2) >= ideal_size->width()
+        && ceil_div(size.height(), factor * 2) >= ideal_size->height()) {
+        factor *= 2;
+    }
+    return factor;
+}
+
+IntSize downscaled_size_for_ideal_size(IntSize size, Optional<IntSize> ideal_size)
+{
+    if (!ideal_size.has_value() || ideal_size->is_empty() || size.is_empty())
+        return size;
+
+    auto scale = max(static_cast<double>(ideal_size->width()) / size.width(), static_cast<double>(ideal_size->height()) / size.height());
+    if (scale >= 1)
+        return size;
+
+    return {
+        min(size.width(), static_cast<int>(AK::ceil(size.width() * scale))),
+        min(size.height(), static_cast<int>(AK::ceil(size.height() * scale))),
+    };
+}
+
+// A larger factor would let the sums below overflow.
+static constexpr int MAXIMUM_BOX_FILTER_FACTOR = 64;
+
+// Averages each factor x factor block of pixels into one. This is much cheaper than proper resampling, which we don't
+// need, since the result is still at least as large as it will be drawn.
+static ErrorOr<NonnullRefPtr<Bitmap>> downscale_with_box_filter(Bitmap const& bitmap, int factor)
+{
+    IntSize scaled_size { ceil_div(bitmap.width(), factor), ceil_div(bitmap.height(), factor) };
+    auto scaled_bitmap = TRY(Bitmap::create(bitmap.format(), bitmap.alpha_type(), scaled_size));
+
+    // Unpremultiplied colors have to be weighed by their alpha, so that transparent pixels don't bleed into the
+    // opaque pixels next to them.
+    bool weigh_by_alpha = bitmap.has_alpha_channel() && bitmap.alpha_type() == AlphaType::Unpremultiplied;
+
+    Vector<u32> sums;
+    TRY(sums.try_resize(scaled_size.width() * 4));
+
+    for (int y = 0; y < scaled_size.height(); ++y) {
+        sums.fill(0);
+
+        auto first_source_y = y * factor;
+        auto end_source_y = min(bitmap.height(), first_source_y + factor);
+        for (int source_y = first_source_y; source_y < end_source_y; ++source_y) {
+            auto const* source_row = bitmap.scanline_u8(source_y);
+            for (int source_x = 0; source_x < bitmap.width(); ++source_x) {
+                auto const* pixel = source_row + source_x * 4;
+                auto* sum = &sums[(source_x / factor) * 4];
+                u32 weight = weigh_by_alpha ? pixel[3] : 1;
+                sum[0] += pixel[0] * weight;
+                sum[1] += pixel[1] * weight;
+                sum[2] += pixel[2] * weight;
+                sum[3] += pixel[3];
+            }
+        }
+
+        auto* scaled_row = scaled_bitmap->scanline_u8(y);
+        for (int x = 0; x < scaled_size.width(); ++x) {
+            auto const* sum = &sums[x * 4];
+            u32 pixel_count = (end_source_y - first_source_y) * (min(bitmap.width(), (x + 1) * factor) - x * factor);
+            u32 color_divisor = weigh_by_alpha ? sum[3] : pixel_count;
+            auto* pixel = scaled_row + x * 4;
+            for (size_t channel = 0; channel < 3; ++channel)
+                pixel[channel] = color_divisor == 0 ? 0 : sum[channel] / color_divisor;
+            pixel[3] = sum[3] / pixel_count;
+        }
+    }
+
+    return scaled_bitmap;
+}
+
+ErrorOr<ImageFrameDescriptor> ImageDecoder::frame(size_t index, Optional<IntSize> ideal_size) const
+{
+    auto frame = TRY(m_plugin->frame(index, ideal_size));
+
+    auto factor = downscale_factor_for_ideal_size(frame.image->size(), ideal_size, MAXIMUM_BOX_FILTER_FACTOR);
+    if (factor > 1)
+        frame.image = TRY(downscale_with_box_filter(*frame.image, factor));
+    return frame;
+}
+
 ErrorOr<ColorSpace> ImageDecoder::color_space()
 {
     auto maybe_cicp = TRY(m_plugin->cicp());
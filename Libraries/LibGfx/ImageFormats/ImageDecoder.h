@@ -81,6 +81,8 @@ public:
     virtual size_t frame_count() { return 1; }
     virtual size_t first_animated_frame_index() { return 0; }
 
+    // If ideal_size is given, the image will be drawn at about that size, so the plugin may decode the frame at a lower
+    // resolution than size(). The frame is never smaller than ideal_size in either dimension, though.
     virtual ErrorOr<ImageFrameDescriptor> frame(size_t index, Optional<IntSize> ideal_size = {}) = 0;
 
     // Returns the duration of a frame in milliseconds without decoding pixel data.
@@ -104,6 +106,14 @@ protected:
     ImageDecoderPlugin() = default;
 };
 
+// Returns the largest power of two up to maximum_factor that the dimensions of an image of the given size can be
+// divided by (rounding up), while staying at least as large as ideal_size.
+int downscale_factor_for_ideal_size(IntSize, Optional<IntSize> ideal_size, int maximum_factor);
+
+// Returns the smallest size with the aspect ratio of the given size that is at least as large as ideal_size, without
+// ever growing the given size.
+IntSize downscaled_size_for_ideal_size(IntSize, Optional<IntSize> ideal_size);
+
 class ImageDecoder : public RefCounted<ImageDecoder> {
 public:
     static ErrorOr<RefPtr<ImageDecoder>> try_create_for_raw_bytes(ReadonlyBytes, Optional<ByteString> mime_type = {});
@@ -117,7 +127,8 @@ public:
     size_t frame_count() const { return m_plugin->frame_count(); }
     size_t first_animated_frame_index() const { return m_plugin->first_animated_frame_index(); }
 
-    ErrorOr<ImageFrameDescriptor> frame(size_t index, Optional<IntSize> ideal_size = {}) const { return m_plugin->frame(index, ideal_size); }
+    // Frames that the plugin could not decode at a reduced resolution are downscaled towards ideal_size here.
+    ErrorOr<ImageFrameDescriptor> frame(size_t index, Optional<IntSize> ideal_size = {}) const;
     int frame_duration(size_t index) const { return m_plugin->frame_duration(index); }
 
     Optional<Metadata const&> metadata() const { return m_plugin->metadata(); }
@@ -15,14 +15,22 @@ struct JPEGLoadingContext {
     enum class State {
         NotDecoded,
         Error,
+        HeaderDecoded,
         Decoded,
     };
 
     State state { State::NotDecoded };
 
+    IntSize size;
+    bool is_cmyk { false };
+
     RefPtr<Gfx::Bitmap> rgb_bitmap;
     RefPtr<Gfx::CMYKBitmap> cmyk_bitmap;
 
+    // libjpeg can decode at 1/2, 1/4 or 1/8 of the full resolution, which skips most of the IDCT work.
+    static constexpr int maximum_scale_denominator = 8;
+    int decoded_scale_denominator { 1 };
+
     ReadonlyBytes data;
     Vector<u8> icc_data;
 
@@ -31,35 +39,28 @@ struct JPEGLoadingContext {
     {
     }
 
-    ErrorOr<void> decode();
+    ErrorOr<void> decode_header();
+    ErrorOr<void> decode(int scale_denominator);
+    ErrorOr<void> ensure_decoded(int scale_denominator);
 };
 
 struct JPEGErrorManager : jpeg_error_mgr {
     jmp_buf setjmp_buffer {};
 };
 
-ErrorOr<void> JPEGLoadingContext::decode()
+static void initialize_error_manager(jpeg_decompress_struct& cinfo, JPEGErrorManager& jerr)
 {
-    struct jpeg_decompress_struct cinfo;
-    ScopeGuard guard { [&]() { jpeg_destroy_decompress(&cinfo); } };
-
-    struct JPEGErrorManager jerr;
     cinfo.err = jpeg_std_error(&jerr);
-
-    jpeg_source_mgr source_manager {};
-
-    if (setjmp(jerr.setjmp_buffer))
-        return Error::from_string_literal("Failed to decode JPEG");
-
     jerr.error_exit = [](j_common_ptr cinfo) {
         char buffer[JMSG_LENGTH_MAX];
         (*cinfo->err->format_message)(cinfo, buffer);
         dbgln("JPEG error: {}", buffer);
         longjmp(static_cast<JPEGErrorManager*>(cinfo->err)->setjmp_buffer, 1);
     };
+}
 
-    jpeg_create_decompress(&cinfo);
-
+static void initialize_source_manager(jpeg_decompress_struct& cinfo, jpeg_source_mgr& source_manager, ReadonlyBytes data)
+{
     source_manager.next_input_byte = data.data();
     source_manager.bytes_in_buffer = data.size();
     source_manager.init_source = [](j_decompress_ptr) { };
@@ -76,11 +77,66 @@ ErrorOr<void> JPEGLoadingContext::decode()
     source_manager.term_source = [](j_decompress_ptr) { };
 
     cinfo.src = &source_manager;
+}
+
+ErrorOr<void> JPEGLoadingContext::decode_header()
+{
+    struct jpeg_decompress_struct cinfo;
+    ScopeGuard guard { [&]() { jpeg_destroy_decompress(&cinfo); } };
+
+    struct JPEGErrorManager jerr;
+    initialize_error_manager(cinfo, jerr);
+
+    jpeg_source_mgr source_manager {};
+
+    if (setjmp(jerr.setjmp_buffer))
+        return Error::from_string_literal("Failed to read JPEG header");
+
+    jpeg_create_decompress(&cinfo);
+    initialize_source_manager(cinfo, source_manager, data);
 
     jpeg_save_markers(&cinfo, JPEG_APP0 + 2, 0xFFFF);
     if (jpeg_read_header(&cinfo, TRUE) != JPEG_HEADER_OK)
         return Error::from_string_literal("Failed to read JPEG header");
 
+    size = { static_cast<int>(cinfo.image_width), static_cast<int>(cinfo.image_height) };
+    is_cmyk = cinfo.jpeg_color_space == JCS_CMYK || cinfo.jpeg_color_space == JCS_YCCK;
+
+    JOCTET* icc_data_ptr = nullptr;
+    unsigned int icc_data_length = 0;
+    if (jpeg_read_icc_profile(&cinfo, &icc_data_ptr, &icc_data_length)) {
+        icc_data.resize(icc_data_length);
+        memcpy(icc_data.data(), icc_data_ptr, icc_data_length);
+        free(icc_data_ptr);
+    }
+
+    return {};
+}
+
+ErrorOr<void> JPEGLoadingContext::decode(int scale_denominator)
+{
+    struct jpeg_decompress_struct cinfo;
+    ScopeGuard guard { [&]() { jpeg_destroy_decompress(&cinfo); } };
+
+    struct JPEGErrorManager jerr;
+    initialize_error_manager(cinfo, jerr);
+
+    jpeg_source_mgr source_manager {};
+
+    if (setjmp(jerr.setjmp_buffer))
+        return Error::from_string_literal("Failed to decode JPEG");
+
+    jpeg_create_decompress(&cinfo);
+    initialize_source_manager(cinfo, source_manager, data);
+
+    if (jpeg_read_header(&cinfo, TRUE) != JPEG_HEADER_OK)
+        return Error::from_string_literal("Failed to read JPEG header");
+
+    cinfo.scale_num = 1;
+    cinfo.scale_denom = scale_denominator;
+    rgb_bitmap = nullptr;
+    cmyk_bitmap = nullptr;
+
     if (cinfo.jpeg_color_space == JCS_CMYK) {
         cinfo.out_color_space = JCS_CMYK;
     } else if (cinfo.jpeg_color_space == JCS_YCCK) {
@@ -89,7 +145,26 @@ ErrorOr<void> JPEGLoadingContext::decode()
         cinfo.out_color_space = JCS_EXT_BGRX;
     }
 
+    // Progressive JPEGs are decoded in buffered-image mode, so that a truncated file still yields the scans that have
+    // arrived so far instead of nothing at all.
+    cinfo.buffered_image = jpeg_has_multiple_scans(&cinfo);
+
     jpeg_start_decompress(&cinfo);
+
+    if (cinfo.buffered_image) {
+        int status = JPEG_SUSPENDED;
+        do {
+            status = jpeg_consume_input(&cinfo);
+        } while (status != JPEG_SUSPENDED && status != JPEG_REACHED_EOI);
+
+        // If the data ends partway through a scan, output the scan before it. That only reads coefficients we already
+        // have (including those of the partial scan), so every row of the image gets something to show.
+        auto scan_number = cinfo.input_scan_number;
+        if (!jpeg_input_complete(&cinfo) && scan_number > 1)
+            --scan_number;
+        jpeg_start_output(&cinfo, max(scan_number, 1));
+    }
+
     bool could_read_all_scanlines = true;
 
     if (cinfo.out_color_space == JCS_EXT_BGRX) {
@@ -168,22 +243,44 @@ ErrorOr<void> JPEGLoadingContext::decode()
         }
     }
 
-    JOCTET* icc_data_ptr = nullptr;
-    unsigned int icc_data_length = 0;
-    if (jpeg_read_icc_profile(&cinfo, &icc_data_ptr, &icc_data_length)) {
-        icc_data.resize(icc_data_length);
-        memcpy(icc_data.data(), icc_data_ptr, icc_data_length);
-        free(icc_data_ptr);
+    if (!could_read_all_scanlines && rgb_bitmap) {
+        // The rows that haven't arrived yet should be see-through, not black.
+        auto partial_bitmap = TRY(Gfx::Bitmap::create(Gfx::BitmapFormat::BGRA8888, Gfx::AlphaType::Premultiplied, rgb_bitmap->size()));
+        for (int y = 0; y < static_cast<int>(cinfo.output_scanline); ++y)
+            memcpy(partial_bitmap->scanline_u8(y), rgb_bitmap->scanline_u8(y), rgb_bitmap->width() * sizeof(ARGB32));
+        rgb_bitmap = move(partial_bitmap);
     }
 
-    if (could_read_all_scanlines)
+    if (could_read_all_scanlines && (!cinfo.buffered_image || jpeg_input_complete(&cinfo))) {
+        if (cinfo.buffered_image)
+            jpeg_finish_output(&cinfo);
         jpeg_finish_decompress(&cinfo);
-    else
+    } else {
         jpeg_abort_decompress(&cinfo);
+    }
 
     if (cmyk_bitmap && !rgb_bitmap)
         rgb_bitmap = TRY(cmyk_bitmap->to_low_quality_rgb());
 
+    decoded_scale_denominator = scale_denominator;
+    return {};
+}
+
+ErrorOr<void> JPEGLoadingContext::ensure_decoded(int scale_denominator)
+{
+    if (state == State::Error)
+        return Error::from_string_literal("JPEGImageDecoderPlugin: Decoding failed");
+
+    // A frame decoded at a higher resolution than we need is just as good.
+    if (state == State::Decoded && decoded_scale_denominator <= scale_denominator)
+        return {};
+
+    if (auto result = decode(scale_denominator); result.is_error()) {
+        state = State::Error;
+        return result.release_error();
+    }
+
+    state = State::Decoded;
     return {};
 }
 
@@ -196,16 +293,7 @@ JPEGImageDecoderPlugin::~JPEGImageDecoderPlugin() = default;
 
 IntSize JPEGImageDecoderPlugin::size()
 {
-    if (m_context->state == JPEGLoadingContext::State::NotDecoded)
-        (void)frame(0);
-
-    if (m_context->state == JPEGLoadingContext::State::Error)
-        return {};
-    if (m_context->rgb_bitmap)
-        return m_context->rgb_bitmap->size();
-    if (m_context->cmyk_bitmap)
-        return m_context->cmyk_bitmap->size();
-    return {};
+    return m_context->size;
 }
 
 bool JPEGImageDecoderPlugin::sniff(ReadonlyBytes data)
@@ -218,25 +306,22 @@ bool JPEGImageDecoderPlugin::sniff(ReadonlyBytes data)
 
 ErrorOr<NonnullOwnPtr<ImageDecoderPlugin>> JPEGImageDecoderPlugin::create(ReadonlyBytes data)
 {
-    return adopt_own(*new JPEGImageDecoderPlugin(make<JPEGLoadingContext>(data)));
+    auto plugin = adopt_own(*new JPEGImageDecoderPlugin(make<JPEGLoadingContext>(data)));
+    // NOTE: A malformed header is only reported once a frame is requested.
+    if (plugin->m_context->decode_header().is_error())
+        plugin->m_context->state = JPEGLoadingContext::State::Error;
+    else
+        plugin->m_context->state = JPEGLoadingContext::State::HeaderDecoded;
+    return plugin;
 }
 
-ErrorOr<ImageFrameDescriptor> JPEGImageDecoderPlugin::frame(size_t index, Optional<IntSize>)
+ErrorOr<ImageFrameDescriptor> JPEGImageDecoderPlugin::frame(size_t index, Optional<IntSize> ideal_size)
 {
     if (index > 0)
         return Error::from_string_literal("JPEGImageDecoderPlugin: Invalid frame index");
 
-    if (m_context->state == JPEGLoadingContext::State::Error)
-        return Error::from_string_literal("JPEGImageDecoderPlugin: Decoding failed");
-
-    if (m_context->state < JPEGLoadingContext::State::Decoded) {
-        if (auto result = m_context->decode(); result.is_error()) {
-            m_context->state = JPEGLoadingContext::State::Error;
-            return result.release_error();
-        }
-
-        m_context->state = JPEGLoadingContext::State::Decoded;
-    }
+    auto scale_denominator = downscale_factor_for_ideal_size(m_context->size, ideal_size, JPEGLoadingContext::maximum_scale_denominator);
+    TRY(m_context->ensure_decoded(scale_denominator));
 
     return ImageFrameDescriptor { *m_context->rgb_bitmap, 0 };
 }
@@ -248,9 +333,6 @@ Optional<Metadata const&> JPEGImageDecoderPlugin::metadata()
 
 ErrorOr<Optional<ReadonlyBytes>> JPEGImageDecoderPlugin::icc_data()
 {
-    if (m_context->state == JPEGLoadingContext::State::NotDecoded)
-        (void)frame(0);
-
     if (!m_context->icc_data.is_empty())
         return m_context->icc_data;
     return OptionalNone {};
@@ -258,21 +340,14 @@ ErrorOr<Optional<ReadonlyBytes>> JPEGImageDecoderPlugin::icc_data()
 
 NaturalFrameFormat JPEGImageDecoderPlugin::natural_frame_format() const
 {
-    if (m_context->state == JPEGLoadingContext::State::NotDecoded)
-        (void)const_cast<JPEGImageDecoderPlugin&>(*this).frame(0);
-
-    if (m_context->cmyk_bitmap)
+    if (m_context->is_cmyk)
         return NaturalFrameFormat::CMYK;
     return NaturalFrameFormat::RGB;
 }
 
 ErrorOr<NonnullRefPtr<CMYKBitmap>> JPEGImageDecoderPlugin::cmyk_frame()
 {
-    if (m_context->state == JPEGLoadingContext::State::NotDecoded)
-        (void)frame(0);
-
-    if (m_context->state == JPEGLoadingContext::State::Error)
-        return Error::from_string_literal("JPEGImageDecoderPlugin: Decoding failed");
+    TRY(m_context->ensure_decoded(1));
     if (!m_context->cmyk_bitmap)
         return Error::from_string_literal("JPEGImageDecoderPlugin: No CMYK data available");
     return *m_context->cmyk_bitmap;
@@ -29,6 +29,7 @@ struct PNGLoadingContext {
     IntSize size;
     u32 frame_count { 0 };
     u32 loop_count { 0 };
+    int interlace_pass_count { 1 };
     Vector<ImageFrameDescriptor> frame_descriptors;
     Optional<Media::CodingIndependentCodePoints> cicp;
     Optional<ByteBuffer> icc_profile;
@@ -42,6 +43,9 @@ struct PNGLoadingContext {
     RefPtr<Bitmap> output_buffer;
     OwnPtr<Painter> painter;
 
+    // The rows of a still image that were decoded before libpng gave up, e.g. because the data is truncated.
+    RefPtr<Bitmap> partially_decoded_bitmap;
+
     void clear_read_frames_working_state()
     {
         row_pointers.clear();
@@ -59,6 +63,8 @@ struct PNGLoadingContext {
         if (auto error_value = setjmp(png_jmpbuf(png_ptr)); error_value) {
             // longjmp() bypassed the C++ destructors for any stack-locals in read_frames(); release the working-state
             // members explicitly here — so their heap storage doesn't sit around until ~PNGLoadingContext().
+            if (in_flight_bitmap && !output_buffer && frame_descriptors.is_empty())
+                partially_decoded_bitmap = in_flight_bitmap;
             clear_read_frames_working_state();
             return Error::from_errno(error_value);
         }
@@ -81,10 +87,13 @@ ErrorOr<NonnullOwnPtr<ImageDecoderPlugin>> PNGImageDecoderPlugin::create(Readonl
     auto result = decoder->m_context->read_all_frames();
     if (result.is_error()) {
         // NOTE: If we didn't fail in initialize(), that means we have size information.
-        //       We can create a single-frame bitmap with that size and return it.
-        //       This is weird, but kinda matches the behavior of other browsers.
-        auto bitmap = TRY(Bitmap::create(BitmapFormat::BGRA8888, AlphaType::Premultiplied, decoder->m_context->size));
-        decoder->m_context->frame_descriptors.append({ move(bitmap), 0 });
+        //       We can create a single-frame bitmap with that size and return it, along with any rows we managed to
+        //       decode. This is weird, but kinda matches the behavior of other browsers, and lets a partially
+        //       downloaded image show what has arrived so far.
+        RefPtr<Bitmap> bitmap = move(decoder->m_context->partially_decoded_bitmap);
+        if (!bitmap)
+            bitmap = TRY(Bitmap::create(BitmapFormat::BGRA8888, AlphaType::Premultiplied, decoder->m_context->size));
+        decoder->m_context->frame_descriptors.append({ bitmap.release_nonnull(), 0 });
         decoder->m_context->frame_count = 1;
         return decoder;
     }
@@ -214,7 +223,7 @@ ErrorOr<void> PNGImageDecoderPlugin::initialize()
         png_set_gray_to_rgb(m_context->png_ptr);
 
     if (interlace_type != PNG_INTERLACE_NONE)
-        png_set_interlace_handling(m_context->png_ptr);
+        m_context->interlace_pass_count = png_set_interlace_handling(m_context->png_ptr);
 
     png_set_filler(m_context->png_ptr, 0xFF, PNG_FILLER_AFTER);
     png_set_bgr(m_context->png_ptr);
@@ -283,7 +292,15 @@ ErrorOr<size_t> PNGLoadingContext::read_frames(png_structp png_ptr, png_infop in
         for (auto i = 0; i < frame_size.height(); ++i)
             row_pointers[i] = in_flight_bitmap->scanline_u8(i);
 
-        png_read_image(png_ptr, row_pointers.data());
+        if (interlace_pass_count > 1) {
+            // Passing the rows as display rows makes libpng fill in the pixels of the later passes with the nearest
+            // pixel we already have. The final image is the same, but a truncated one shows a blocky preview of the
+            // whole frame rather than a sparse grid of dots.
+            for (int pass = 0; pass < interlace_pass_count; ++pass)
+                png_read_rows(png_ptr, nullptr, row_pointers.data(), frame_size.height());
+        } else {
+            png_read_image(png_ptr, row_pointers.data());
+        }
         // Past the longjmp window; hand the bitmap to the caller, and clear the member.
         return in_flight_bitmap.release_nonnull();
     };
@@ -178,18 +178,37 @@ static ErrorOr<ImageFrameDescriptor> decode_next_webp_animation_frame(WebPLoadin
     return ImageFrameDescriptor { bitmap, duration };
 }
 
-static ErrorOr<void> decode_webp_image(WebPLoadingContext& context)
+static ErrorOr<void> decode_webp_image(WebPLoadingContext& context, IntSize decoded_size)
 {
     VERIFY(context.state >= WebPLoadingContext::State::HeaderDecoded);
     VERIFY(!context.has_animation);
 
     auto bitmap_format = context.has_alpha ? BitmapFormat::BGRA8888 : BitmapFormat::BGRx8888;
-    auto bitmap = TRY(Bitmap::create(bitmap_format, Gfx::AlphaType::Unpremultiplied, context.size));
+    auto bitmap = TRY(Bitmap::create(bitmap_format, Gfx::AlphaType::Unpremultiplied, decoded_size));
+
+    WebPDecoderConfig config {};
+    if (!WebPInitDecoderConfig(&config))
+        return Error::from_string_literal("Failed to initialize webp decoder config");
+
+    // libwebp scales the image while it decodes it, so we never need a bitmap at the full size.
+    if (decoded_size != context.size) {
+        config.options.use_scaling = 1;
+        config.options.scaled_width = decoded_size.width();
+        config.options.scaled_height = decoded_size.height();
+    }
+
+    config.output.colorspace = MODE_BGRA;
+    config.output.is_external_memory = 1;
+    config.output.u.RGBA.rgba = bitmap->scanline_u8(0);
+    config.output.u.RGBA.stride = bitmap->pitch();
+    config.output.u.RGBA.size = bitmap->data_size();
 
-    auto image_data = WebPDecodeBGRAInto(context.data.data(), context.data.size(), bitmap->scanline_u8(0), bitmap->data_size(), bitmap->pitch());
-    if (image_data == nullptr)
+    auto status = WebPDecode(context.data.data(), context.data.size(), &config);
+    WebPFreeDecBuffer(&config.output);
+    if (status != VP8_STATUS_OK)
         return Error::from_string_literal("Failed to decode webp image into bitmap");
 
+    context.frame_descriptors.clear();
     context.frame_descriptors.append(ImageFrameDescriptor { bitmap, 0 });
 
     return {};
@@ -236,7 +255,7 @@ size_t WebPImageDecoderPlugin::first_animated_frame_index()
     return 0;
 }
 
-ErrorOr<ImageFrameDescriptor> WebPImageDecoderPlugin::frame(size_t index, Optional<IntSize>)
+ErrorOr<ImageFrameDescriptor> WebPImageDecoderPlugin::frame(size_t index, Optional<IntSize> ideal_size)
 {
     if (index >= frame_count())
         return Error::from_string_literal("WebPImageDecoderPlugin: Invalid frame index");
@@ -262,8 +281,10 @@ ErrorOr<ImageFrameDescriptor> WebPImageDecoderPlugin::frame(size_t index, Option
         return TRY(decode_next_webp_animation_frame(*m_context));
     }
 
-    if (m_context->state < WebPLoadingContext::State::BitmapDecoded) {
-        TRY(decode_webp_image(*m_context));
+    // A frame decoded at a higher resolution than we need is just as good.
+    auto decoded_size = downscaled_size_for_ideal_size(m_context->size, ideal_size);
+    if (m_context->state < WebPLoadingContext::State::BitmapDecoded || m_context->frame_descriptors.first().image->width() < decoded_size.width()) {
+        TRY(decode_webp_image(*m_context, decoded_size));
         m_context->state = WebPLoadingContext::State::BitmapDecoded;
     }
 
@@ -10,7 +10,10 @@
 #include <AK/Array.h>
 #include <AK/BitCast.h>
 #include <AK/HashFunctions.h>
+#include <AK/HashTable.h>
+#include <AK/IntrusiveList.h>
 #include <AK/Math.h>
+#include <AK/NonnullOwnPtr.h>
 #include <AK/NumericLimits.h>
 #include <AK/Utf16String.h>
 #include <AK/Utf16View.h>
@@ -18,6 +21,7 @@
 #include <LibGfx/Font/Typeface.h>
 #include <LibGfx/Point.h>
 #include <LibGfx/TextLayout.h>
+#include <LibSync/Mutex.h>
 #include <LibUnicode/CharacterTypes.h>
 #include <RustFFI.h>
 #include <harfbuzz/hb.h>
@@ -579,51 +583,236 @@ static NonnullOwnPtr<ShapedGlyphs> build_origin_relative_shape(Utf16View const&
     return make<ShapedGlyphs>(move(glyphs), point.x(), trailing_whitespace);
 }
 
-NonnullRefPtr<GlyphRun> shape_text(FloatPoint baseline_start, float letter_spacing, float word_spacing, Utf16View const& string, Font const& font, GlyphRun::TextType text_type, TrailingWhitespace* out_trailing_whitespace)
+// Shaped text, shared by all fonts, with a fixed memory budget. The least recently used shapes are evicted first.
+//
+// Entries are keyed by the font they were shaped with, so each size of a typeface has its own. HarfBuzz rounds the
+// positions it computes at each size, so scaling the shape of another size would not give the same glyph positions.
+class ShapingCache {
+public:
+    struct Key {
+        u64 font_id { 0 };
+        Utf16View text;
+        u8 text_type { 0 };
+        u32 letter_spacing_bit_pattern { 0 };
+        u32 word_spacing_bit_pattern { 0 };
+
+        unsigned hash() const
+        {
+            return pair_int_hash(pair_int_hash(u64_hash(font_id), text.hash()), pair_int_hash(text_type, pair_int_hash(letter_spacing_bit_pattern, word_spacing_bit_pattern)));
+        }
+    };
+
+    static ShapingCache& the()
+    {
+        static ShapingCache cache;
+        return cache;
+    }
+
+    // Appends the cached shape for the key to the given shape, and returns whether there was one.
+    bool append_to(ShapedGlyphs&, Key const&);
+
+    void set(Key const&, ShapedGlyphs const&);
+
+    bool contains(Key const&);
+    ShapingCacheState state();
+    void set_memory_budget(size_t);
+
+    static constexpr size_t DEFAULT_MEMORY_BUDGET = 16 * MiB;
+
+private:
+
+    struct Entry {
+        u64 font_id { 0 };
+        Utf16String text;
+        u8 text_type { 0 };
+        u32 letter_spacing_bit_pattern { 0 };
+        u32 word_spacing_bit_pattern { 0 };
+        ShapedGlyphs shape;
+        size_t size_in_bytes { 0 };
+        IntrusiveListNode<Entry> list_node;
+
+        Key key() const { return { font_id, text, text_type, letter_spacing_bit_pattern, word_spacing_bit_pattern }; }
+
+        bool matches(Key const& key) const
+        {
+            return font_id == key.font_id
+                && text_type == key.text_type
+                && letter_spacing_bit_pattern == key.letter_spacing_bit_pattern
+                && word_spacing_bit_pattern == key.word_spacing_bit_pattern
+                && text == key.text;
+        }
+    };
+
+    struct EntryTraits : public DefaultTraits<NonnullOwnPtr<Entry>> {
+        static unsigned hash(NonnullOwnPtr<Entry> const& entry)
+        {
+            return entry->key().hash();
+        }
+        static bool equals(NonnullOwnPtr<Entry> const& a, NonnullOwnPtr<Entry> const& b) { return a.ptr() == b.ptr(); }
+    };
+
+    ShapingCache() = default;
+
+    void evict_until_within(size_t size_in_bytes);
+
+    Sync::Mutex m_mutex;
+    HashTable<NonnullOwnPtr<Entry>, EntryTraits> m_entries;
+    IntrusiveList<&Entry::list_node> m_entries_by_last_use; // The least recently used entry comes first.
+    size_t m_size_in_bytes { 0 };
+    size_t m_memory_budget { DEFAULT_MEMORY_BUDGET };
+};
+
+// Appends the glyphs of source, which was shaped from text of the given length, after those already in destination.
+static void append_shape(ShapedGlyphs& destination, ShapedGlyphs const& source, size_t source_length_in_code_units)
+{
+    auto offset = destination.width;
+    destination.glyphs.ensure_capacity(destination.glyphs.size() + source.glyphs.size());
+    for (auto glyph : source.glyphs) {
+        glyph.position.translate_by(offset, 0);
+        destination.glyphs.unchecked_append(glyph);
+    }
+    destination.width += source.width;
+
+    // The trailing whitespace of destination only carries over if source is all whitespace.
+    if (source.trailing_whitespace.length_in_code_units == source_length_in_code_units) {
+        destination.trailing_whitespace.length_in_code_units += source.trailing_whitespace.length_in_code_units;
+        destination.trailing_whitespace.advance += source.trailing_whitespace.advance;
+    } else {
+        destination.trailing_whitespace = source.trailing_whitespace;
+    }
+}
+
+bool ShapingCache::append_to(ShapedGlyphs& shape, Key const& key)
+{
+    Sync::MutexLocker locker { m_mutex };
+
+    auto it = m_entries.find(key.hash(), [&](auto const& entry) { return entry->matches(key); });
+    if (it == m_entries.end())
+        return false;
+
+    auto& entry = **it;
+    m_entries_by_last_use.remove(entry);
+    m_entries_by_last_use.append(entry);
+
+    append_shape(shape, entry.shape, key.text.length_in_code_units());
+    return true;
+}
+
+void ShapingCache::set(Key const& key, ShapedGlyphs const& shape)
+{
+    auto entry = make<Entry>(key.font_id, Utf16String::from_utf16(key.text), key.text_type, key.letter_spacing_bit_pattern, key.word_spacing_bit_pattern, shape);
+    entry->size_in_bytes = sizeof(Entry) + entry->shape.glyphs.size() * sizeof(DrawGlyph) + key.text.length_in_code_units() * sizeof(char16_t);
+
+    Sync::MutexLocker locker { m_mutex };
+
+    // Another thread may have shaped the same text in the meantime.
+    if (m_entries.find(key.hash(), [&](auto const& other) { return other->matches(key); }) != m_entries.end())
+        return;
+
+    // An entry that does not fit the budget on its own is not worth evicting everything else for.
+    if (entry->size_in_bytes > m_memory_budget)
+        return;
+
+    evict_until_within(m_memory_budget - entry->size_in_bytes);
+
+    m_size_in_bytes += entry->size_in_bytes;
+    m_entries_by_last_use.append(*entry);
+    m_entries.set(move(entry));
+}
+
+void ShapingCache::evict_until_within(size_t size_in_bytes)
 {
-    auto& shaping_cache = font.shaping_cache();
+    while (!m_entries_by_last_use.is_empty() && m_size_in_bytes > size_in_bytes) {
+        auto& evicted_entry = *m_entries_by_last_use.first();
+        m_entries_by_last_use.remove(evicted_entry);
+        m_size_in_bytes -= evicted_entry.size_in_bytes;
+        auto it = m_entries.find(evicted_entry.key().hash(), [&](auto const& candidate) { return candidate.ptr() == &evicted_entry; });
+        m_entries.remove(it);
+    }
+}
 
-    auto build_glyph_run = [&](ShapedGlyphs const& shape) -> NonnullRefPtr<GlyphRun> {
+bool ShapingCache::contains(Key const& key)
+{
+    Sync::MutexLocker locker { m_mutex };
+    return m_entries.find(key.hash(), [&](auto const& entry) { return entry->matches(key); }) != m_entries.end();
+}
+
+ShapingCacheState ShapingCache::state()
+{
+    Sync::MutexLocker locker { m_mutex };
+    return { .entry_count = m_entries.size(), .size_in_bytes = m_size_in_bytes, .memory_budget = m_memory_budget };
+}
+
+void ShapingCache::set_memory_budget(size_t memory_budget)
+{
+    Sync::MutexLocker locker { m_mutex };
+    m_memory_budget = memory_budget;
+    evict_until_within(m_memory_budget);
+}
+
+static ShapedGlyphs shape_with_cache(Utf16View const& string, Font const& font, GlyphRun::TextType text_type, float letter_spacing, float word_spacing)
+{
+    ShapingCache::Key key { font.id(), string, static_cast<u8>(to_underlying(text_type)), bit_cast<u32>(letter_spacing), bit_cast<u32>(word_spacing) };
+
+    ShapedGlyphs shape;
+    if (ShapingCache::the().append_to(shape, key))
+        return shape;
+
+    auto new_shape = build_origin_relative_shape(string, font, text_type, letter_spacing, word_spacing);
+    ShapingCache::the().set(key, *new_shape);
+    return move(*new_shape);
+}
+
+// Returns the length of the word at the start of the string, along with the spaces that follow it.
+static size_t length_of_first_word(Utf16View const& string)
+{
+    size_t length = 0;
+    while (length < string.length_in_code_units() && string.code_unit_at(length) != ' ')
+        ++length;
+    while (length < string.length_in_code_units() && string.code_unit_at(length) == ' ')
+        ++length;
+    return length;
+}
+
+NonnullRefPtr<GlyphRun> shape_text(FloatPoint baseline_start, float letter_spacing, float word_spacing, Utf16View const& string, Font const& font, GlyphRun::TextType text_type, TrailingWhitespace* out_trailing_whitespace)
+{
+    auto build_glyph_run = [&](Vector<DrawGlyph> glyphs, float width, TrailingWhitespace trailing_whitespace) -> NonnullRefPtr<GlyphRun> {
         if (out_trailing_whitespace)
-            *out_trailing_whitespace = shape.trailing_whitespace;
-        Vector<DrawGlyph> glyphs = shape.glyphs;
+            *out_trailing_whitespace = trailing_whitespace;
         if (!baseline_start.is_zero()) {
             for (auto& glyph : glyphs)
                 glyph.position.translate_by(baseline_start);
         }
-        return adopt_ref(*new GlyphRun(move(glyphs), font, text_type, shape.width));
+        return adopt_ref(*new GlyphRun(move(glyphs), font, text_type, width));
     };
 
-    // FIXME: The cache currently grows unbounded. We should have some limit and LRU mechanism.
     if (string.length_in_code_units() == 1 && letter_spacing == 0.f && word_spacing == 0.f && text_type == GlyphRun::TextType::Common) {
         auto code_unit = string.code_unit_at(0);
         if (code_unit < 128) {
-            auto& cache_slot = shaping_cache.single_ascii_character_map[code_unit];
+            auto& cache_slot = font.shaping_cache().single_ascii_character_map[code_unit];
             if (!cache_slot)
                 cache_slot = build_origin_relative_shape(string, font, text_type, letter_spacing, word_spacing);
-            return build_glyph_run(*cache_slot);
+            return build_glyph_run(cache_slot->glyphs, cache_slot->width, cache_slot->trailing_whitespace);
         }
     }
 
-    auto text_type_bits = static_cast<u8>(to_underlying(text_type));
-    auto letter_spacing_bit_pattern = bit_cast<u32>(letter_spacing);
-    auto word_spacing_bit_pattern = bit_cast<u32>(word_spacing);
-    auto key_hash = pair_int_hash(string.hash(), pair_int_hash(text_type_bits, pair_int_hash(letter_spacing_bit_pattern, word_spacing_bit_pattern)));
-
-    if (auto it = shaping_cache.map.find(key_hash, [&](auto const& candidate) {
-            return candidate.key.text_type == text_type_bits
-                && candidate.key.letter_spacing_bit_pattern == letter_spacing_bit_pattern
-                && candidate.key.word_spacing_bit_pattern == word_spacing_bit_pattern
-                && candidate.key.text == string;
-        });
-        it != shaping_cache.map.end()) {
-        return build_glyph_run(*it->value);
+    // Long runs of text rarely repeat as a whole, but their words do. So if shaping a word does not depend on the words
+    // around it, we shape and cache each word on its own, and stitch their glyphs together.
+    // NOTE: ASCII text is always shaped as left-to-right Latin, and spacing is only exact to stitch while it is zero.
+    if (string.has_ascii_storage() && letter_spacing == 0.f && word_spacing == 0.f
+        && length_of_first_word(string) < string.length_in_code_units()
+        && font.typeface().can_shape_words_separately()) {
+        ShapedGlyphs shape;
+        for (auto remaining = string; !remaining.is_empty();) {
+            auto word = remaining.substring_view(0, length_of_first_word(remaining));
+            append_shape(shape, shape_with_cache(word, font, GlyphRun::TextType::Common, 0, 0), word.length_in_code_units());
+            remaining = remaining.substring_view(word.length_in_code_units());
+        }
+        return build_glyph_run(move(shape.glyphs), shape.width, shape.trailing_whitespace);
     }
 
-    auto shape = build_origin_relative_shape(string, font, text_type, letter_spacing, word_spacing);
-    auto run = build_glyph_run(*shape);
-    shaping_cache.map.set({ Utf16String::from_utf16(string), text_type_bits, letter_spacing_bit_pattern, word_spacing_bit_pattern }, move(shape));
-    return run;
+    auto shape = shape_with_cache(string, font, text_type, letter_spacing, word_spacing);
+    return build_glyph_run(move(shape.glyphs), shape.width, shape.trailing_whitespace);
 }
 
 float measure_text_width(Utf16View const& string, Font const& font, float letter_spacing)
@@ -641,6 +830,21 @@ float measure_text_width(Utf16View const& string, Font const& font, float letter
     return static_cast<float>(point_x / text_shaping_resolution + glyph_count * letter_spacing);
 }
 
+ShapingCacheState shaping_cache_state_for_testing()
+{
+    return ShapingCache::the().state();
+}
+
+bool shaping_cache_contains_for_testing(Utf16View const& string, Font const& font)
+{
+    return ShapingCache::the().contains({ font.id(), string, static_cast<u8>(to_underlying(GlyphRun::TextType::Common)), 0, 0 });
+}
+
+void set_shaping_cache_memory_budget_for_testing(Optional<size_t> memory_budget)
+{
+    ShapingCache::the().set_memory_budget(memory_budget.value_or(ShapingCache::DEFAULT_MEMORY_BUDGET));
+}
+
 }
 
 static_assert(to_underlying(Gfx::FFI::TextType::Common) == to_underlying(Gfx::GlyphRun::TextType::Common));
@@ -81,4 +81,14 @@ NonnullRefPtr<GlyphRun> shape_text(FloatPoint baseline_start, float letter_spaci
 Vector<NonnullRefPtr<GlyphRun>> shape_text(FloatPoint baseline_start, Utf16View const&, FontCascadeList const&, float letter_spacing = 0.f);
 float measure_text_width(Utf16View const&, Font const& font, float letter_spacing = 0.f);
 
+struct ShapingCacheState {
+    size_t entry_count { 0 };
+    size_t size_in_bytes { 0 };
+    size_t memory_budget { 0 };
+};
+
+ShapingCacheState shaping_cache_state_for_testing();
+bool shaping_cache_contains_for_testing(Utf16View const&, Font const&);
+void set_shaping_cache_memory_budget_for_testing(Optional<size_t>);
+
 }
@@ -21,6 +21,11 @@ namespace HTTP {
 
 static constexpr u32 INDEX_SCHEMA_BASELINE_VERSION = 1u;
 
+// Access time and associated data size updates are written in a single transaction once this many entries have pending
+// writes, or once the oldest pending write is this old.
+static constexpr size_t MAXIMUM_PENDING_WRITE_COUNT = 128;
+static constexpr auto MAXIMUM_PENDING_WRITE_AGE = AK::Duration::from_seconds(5);
+
 // Persist full-range hashes as signed bit patterns; keys are only compared for equality.
 static i64 encode_cache_key_for_database(u64 key)
 {
@@ -166,8 +171,8 @@ ErrorOr<CacheIndex> CacheIndex::create(Database::Database& database, LexicalPath
     )#"sv));
     statements.select_entries = TRY(database.prepare_statement("SELECT vary_key, url, request_headers, response_headers, data_size, associated_data_size, request_time, response_time, last_access_time FROM CacheIndex WHERE cache_key = ?;"sv));
     statements.update_response_headers = TRY(database.prepare_statement("UPDATE CacheIndex SET response_headers = ? WHERE cache_key = ? AND vary_key = ?;"sv));
-    statements.update_associated_data_size = TRY(database.prepare_statement("UPDATE CacheIndex SET associated_data_size = ? WHERE cache_key = ? AND vary_key = ?;"sv));
-    statements.update_last_access_time = TRY(database.prepare_statement("UPDATE CacheIndex SET last_access_time = ? WHERE cache_key = ? AND vary_key = ?;"sv));
+    statements.select_cache_keys = TRY(database.prepare_statement("SELECT DISTINCT cache_key FROM CacheIndex;"sv));
+    statements.update_access_time_and_associated_data_size = TRY(database.prepare_statement("UPDATE CacheIndex SET last_access_time = ?, associated_data_size = ? WHERE cache_key = ? AND vary_key = ?;"sv));
 
     statements.remove_entries_exceeding_cache_limit = TRY(database.prepare_statement(R"#(
         WITH RankedCacheIndex AS (
@@ -213,17 +218,50 @@ ErrorOr<CacheIndex> CacheIndex::create(Database::Database& database, LexicalPath
         statements.select_total_estimated_size,
         [&](auto statement_id) -> ErrorOr<void> { total_estimated_size = database.result_column<i64>(statement_id, 0); return {}; });
 
-    return CacheIndex { database, statements, limits, total_estimated_size };
+    HashTable<u64, IdentityHashTraits<u64>> cache_keys;
+    database.execute_statement(
+        statements.select_cache_keys,
+        [&](auto statement_id) -> ErrorOr<void> {
+            cache_keys.set(decode_cache_key_from_database(database.result_column<i64>(statement_id, 0)));
+            return {};
+        });
+
+    return CacheIndex { database, statements, limits, total_estimated_size, move(cache_keys) };
 }
 
-CacheIndex::CacheIndex(Database::Database& database, Statements statements, Limits limits, i64 total_estimated_size)
+CacheIndex::CacheIndex(Database::Database& database, Statements statements, Limits limits, i64 total_estimated_size, HashTable<u64, IdentityHashTraits<u64>> cache_keys)
     : m_database(database)
     , m_statements(statements)
+    , m_cache_keys(move(cache_keys))
     , m_limits(limits)
     , m_total_estimated_size(total_estimated_size)
 {
 }
 
+CacheIndex& CacheIndex::operator=(CacheIndex&& other)
+{
+    if (this == &other)
+        return *this;
+
+    // Pending writes only live in memory, so they must reach this index's database before the index is replaced.
+    flush_pending_writes();
+
+    m_database = other.m_database;
+    m_statements = other.m_statements;
+    m_entries = move(other.m_entries);
+    m_cache_keys = move(other.m_cache_keys);
+    m_entries_pending_write = move(other.m_entries_pending_write);
+    m_oldest_pending_write_time = exchange(other.m_oldest_pending_write_time, {});
+    m_limits = other.m_limits;
+    m_total_estimated_size = other.m_total_estimated_size;
+    return *this;
+}
+
+CacheIndex::~CacheIndex()
+{
+    flush_pending_writes();
+}
+
 ErrorOr<void> CacheIndex::create_entry(u64 cache_key, u64 vary_key, String url, NonnullRefPtr<HeaderList> request_headers, NonnullRefPtr<HeaderList> response_headers, u64 data_size, UnixDateTime request_time, UnixDateTime response_time)
 {
     auto now = UnixDateTime::now();
@@ -262,6 +300,10 @@ ErrorOr<void> CacheIndex::create_entry(u64 cache_key, u64 vary_key, String url,
         return Error::from_string_literal("Cache entry size exceeds allowed maximum");
     auto entry_size = checked_entry_size.value();
 
+    // Make sure the index holds every entry for this cache key before we replace one of them.
+    (void)get_entries(cache_key);
+    write_pending_entry(cache_key, vary_key);
+
     m_database->execute_statement(
         m_statements.remove_entry,
         [&](auto statement_id) -> ErrorOr<void> {
@@ -284,6 +326,8 @@ ErrorOr<void> CacheIndex::create_entry(u64 cache_key, u64 vary_key, String url,
     else
         entries.append(move(entry));
 
+    m_cache_keys.set(cache_key);
+    m_entries_pending_write.remove({ cache_key, vary_key });
     adjust_total_estimated_size(static_cast<i64>(entry_size));
 
     return {};
@@ -291,6 +335,9 @@ ErrorOr<void> CacheIndex::create_entry(u64 cache_key, u64 vary_key, String url,
 
 void CacheIndex::remove_entry(u64 cache_key, u64 vary_key)
 {
+    // The removed size is computed by the database, so it must see the entry's current associated data size.
+    write_pending_entry(cache_key, vary_key);
+
     m_database->execute_statement(
         m_statements.remove_entry,
         [&](auto statement_id) -> ErrorOr<void> {
@@ -309,6 +356,8 @@ void CacheIndex::remove_entries_exceeding_cache_limit(Function<void(u64 cache_ke
     if (m_total_estimated_size <= m_limits.maximum_disk_cache_size)
         return;
 
+    flush_pending_writes();
+
     m_database->execute_statement(
         m_statements.remove_entries_exceeding_cache_limit,
         [&](auto statement_id) -> ErrorOr<void> {
@@ -327,6 +376,8 @@ void CacheIndex::remove_entries_exceeding_cache_limit(Function<void(u64 cache_ke
 
 void CacheIndex::remove_entries_accessed_since(UnixDateTime since, Function<void(u64 cache_key, u64 vary_key)> on_entry_removed)
 {
+    flush_pending_writes();
+
     m_database->execute_statement(
         m_statements.remove_entries_accessed_since,
         [&](auto statement_id) -> ErrorOr<void> {
@@ -369,11 +420,11 @@ ErrorOr<void> CacheIndex::update_associated_data_size(u64 cache_key, u64 vary_ke
     if (associated_data_size > static_cast<u64>(NumericLimits<i64>::max()))
         return Error::from_string_literal("Associated data size exceeds the representable maximum");
 
-    m_database->execute_statement(m_statements.update_associated_data_size, {}, static_cast<i64>(associated_data_size), encode_cache_key_for_database(cache_key), encode_cache_key_for_database(vary_key));
-
     adjust_total_estimated_size(-static_cast<i64>(entry->associated_data_size));
     adjust_total_estimated_size(static_cast<i64>(associated_data_size));
     entry->associated_data_size = associated_data_size;
+
+    mark_entry_for_write(cache_key, vary_key);
     return {};
 }
 
@@ -383,44 +434,17 @@ void CacheIndex::update_last_access_time(u64 cache_key, u64 vary_key)
     if (!entry.has_value())
         return;
 
-    auto now = UnixDateTime::now();
-
-    m_database->execute_statement(m_statements.update_last_access_time, {}, now, encode_cache_key_for_database(cache_key), encode_cache_key_for_database(vary_key));
-    entry->last_access_time = now;
+    entry->last_access_time = UnixDateTime::now();
+    mark_entry_for_write(cache_key, vary_key);
 }
 
 Optional<CacheIndex::Entry const&> CacheIndex::find_entry(u64 cache_key, HeaderList const& request_headers)
 {
-    auto& entries = m_entries.ensure(cache_key, [&]() {
-        Vector<Entry> entries;
-
-        m_database->execute_statement(
-            m_statements.select_entries,
-            [&](auto statement_id) -> ErrorOr<void> {
-                int column = 0;
-
-                auto vary_key = decode_cache_key_from_database(m_database->result_column<i64>(statement_id, column++));
-                auto url = m_database->result_column<String>(statement_id, column++);
-                auto request_headers = m_database->result_column<ByteString>(statement_id, column++);
-                auto response_headers = m_database->result_column<ByteString>(statement_id, column++);
-                auto data_size = m_database->result_column<i64>(statement_id, column++);
-                auto associated_data_size = m_database->result_column<i64>(statement_id, column++);
-                auto request_time = m_database->result_column<UnixDateTime>(statement_id, column++);
-                auto response_time = m_database->result_column<UnixDateTime>(statement_id, column++);
-                auto last_access_time = m_database->result_column<UnixDateTime>(statement_id, column++);
-
-                if (data_size < 0 || associated_data_size < 0)
-                    return {};
-
-                entries.empend(vary_key, move(url), deserialize_headers(request_headers), deserialize_headers(response_headers), static_cast<u64>(data_size), static_cast<u64>(associated_data_size), request_headers.length(), response_headers.length(), request_time, response_time, last_access_time);
-                return {};
-            },
-            encode_cache_key_for_database(cache_key));
-
-        return entries;
-    });
+    auto entries = get_entries(cache_key);
+    if (!entries.has_value())
+        return {};
 
-    return find_value(entries, [&](auto const& entry) {
+    return find_value(*entries, [&](auto const& entry) {
         return create_vary_key(request_headers, entry.response_headers) == entry.vary_key;
     });
 }
@@ -430,9 +454,49 @@ bool CacheIndex::has_entry(u64 cache_key, u64 vary_key)
     return get_entry(cache_key, vary_key).has_value();
 }
 
+Optional<Vector<CacheIndex::Entry>&> CacheIndex::get_entries(u64 cache_key)
+{
+    if (auto entries = m_entries.get(cache_key); entries.has_value())
+        return entries;
+    if (!m_cache_keys.contains(cache_key))
+        return {};
+
+    Vector<Entry> entries;
+
+    m_database->execute_statement(
+        m_statements.select_entries,
+        [&](auto statement_id) -> ErrorOr<void> {
+            int column = 0;
+
+            auto vary_key = decode_cache_key_from_database(m_database->result_column<i64>(statement_id, column++));
+            auto url = m_database->result_column<String>(statement_id, column++);
+            auto request_headers = m_database->result_column<ByteString>(statement_id, column++);
+            auto response_headers = m_database->result_column<ByteString>(statement_id, column++);
+            auto data_size = m_database->result_column<i64>(statement_id, column++);
+            auto associated_data_size = m_database->result_column<i64>(statement_id, column++);
+            auto request_time = m_database->result_column<UnixDateTime>(statement_id, column++);
+            auto response_time = m_database->result_column<UnixDateTime>(statement_id, column++);
+            auto last_access_time = m_database->result_column<UnixDateTime>(statement_id, column++);
+
+            if (data_size < 0 || associated_data_size < 0)
+                return {};
+
+            entries.empend(vary_key, move(url), deserialize_headers(request_headers), deserialize_headers(response_headers), static_cast<u64>(data_size), static_cast<u64>(associated_data_size), request_headers.length(), response_headers.length(), request_time, response_time, last_access_time);
+            return {};
+        },
+        encode_cache_key_for_database(cache_key));
+
+    if (entries.is_empty()) {
+        m_cache_keys.remove(cache_key);
+        return {};
+    }
+
+    return m_entries.ensure(cache_key, [&]() { return move(entries); });
+}
+
 Optional<CacheIndex::Entry&> CacheIndex::get_entry(u64 cache_key, u64 vary_key)
 {
-    auto entries = m_entries.get(cache_key);
+    auto entries = get_entries(cache_key);
     if (!entries.has_value())
         return {};
 
@@ -451,20 +515,75 @@ void CacheIndex::adjust_total_estimated_size(i64 delta)
 
 void CacheIndex::delete_entry(u64 cache_key, u64 vary_key)
 {
+    m_entries_pending_write.remove({ cache_key, vary_key });
+
+    // If the entries for this cache key were never loaded, other rows may remain for it. Keep the cache key around; the
+    // next lookup will find out.
     auto entries = m_entries.get(cache_key);
     if (!entries.has_value())
         return;
 
     entries->remove_first_matching([&](auto const& entry) { return entry.vary_key == vary_key; });
 
-    if (entries->is_empty())
+    if (entries->is_empty()) {
         m_entries.remove(cache_key);
+        m_cache_keys.remove(cache_key);
+    }
+}
+
+void CacheIndex::mark_entry_for_write(u64 cache_key, u64 vary_key)
+{
+    auto now = MonotonicTime::now_coarse();
+    if (!m_oldest_pending_write_time.has_value())
+        m_oldest_pending_write_time = now;
+
+    m_entries_pending_write.set({ cache_key, vary_key });
+
+    if (m_entries_pending_write.size() >= MAXIMUM_PENDING_WRITE_COUNT || now - *m_oldest_pending_write_time >= MAXIMUM_PENDING_WRITE_AGE)
+        flush_pending_writes();
+}
+
+void CacheIndex::write_entry(EntryKey key, Entry const& entry)
+{
+    m_database->execute_statement(m_statements.update_access_time_and_associated_data_size, {}, entry.last_access_time, static_cast<i64>(entry.associated_data_size), encode_cache_key_for_database(key.cache_key), encode_cache_key_for_database(key.vary_key));
+}
+
+void CacheIndex::write_pending_entry(u64 cache_key, u64 vary_key)
+{
+    if (!m_entries_pending_write.remove({ cache_key, vary_key }))
+        return;
+
+    if (auto entry = get_entry(cache_key, vary_key); entry.has_value())
+        write_entry({ cache_key, vary_key }, *entry);
+    if (m_entries_pending_write.is_empty())
+        m_oldest_pending_write_time.clear();
+}
+
+void CacheIndex::flush_pending_writes()
+{
+    if (m_entries_pending_write.is_empty())
+        return;
+
+    auto result = m_database->transaction([&]() -> ErrorOr<void> {
+        for (auto key : m_entries_pending_write) {
+            if (auto entry = get_entry(key.cache_key, key.vary_key); entry.has_value())
+                write_entry(key, *entry);
+        }
+        return {};
+    });
+    if (result.is_error())
+        dbgln("Unable to write pending cache index updates: {}", result.error());
+
+    m_entries_pending_write.clear();
+    m_oldest_pending_write_time.clear();
 }
 
 Requests::CacheSizes CacheIndex::estimate_cache_size_accessed_since(UnixDateTime since)
 {
     Requests::CacheSizes sizes;
 
+    flush_pending_writes();
+
     m_database->execute_statement(
         m_statements.estimate_cache_size_accessed_since,
         [&](auto statement_id) -> ErrorOr<void> { sizes.since_requested_time = static_cast<u64>(m_database->result_column<i64>(statement_id, 0)); return {}; },
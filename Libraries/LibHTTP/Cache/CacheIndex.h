@@ -8,6 +8,7 @@
 
 #include <AK/Error.h>
 #include <AK/HashMap.h>
+#include <AK/HashTable.h>
 #include <AK/NonnullRawPtr.h>
 #include <AK/Time.h>
 #include <AK/Types.h>
@@ -19,6 +20,10 @@ namespace HTTP {
 
 // The cache index is a SQL database containing metadata about each cache entry. An entry in the index is created once
 // the entire cache entry has been successfully written to disk.
+//
+// Lookups are served from memory: the set of cache keys in the index is loaded up front, and the entries for a cache
+// key are loaded the first time that key is requested. Updates to an entry's last access time and associated data size
+// are applied in memory immediately, and written to the database in batched transactions.
 class CacheIndex {
     struct Entry {
         u64 vary_key { 0 };
@@ -46,6 +51,10 @@ public:
 
     static ErrorOr<CacheIndex> create(Database::Database&, LexicalPath const& cache_directory);
 
+    CacheIndex(CacheIndex&&) = default;
+    CacheIndex& operator=(CacheIndex&&);
+    ~CacheIndex();
+
     ErrorOr<void> create_entry(u64 cache_key, u64 vary_key, String url, NonnullRefPtr<HeaderList> request_headers, NonnullRefPtr<HeaderList> response_headers, u64 data_size, UnixDateTime request_time, UnixDateTime response_time);
     void remove_entry(u64 cache_key, u64 vary_key);
     void remove_entries_exceeding_cache_limit(Function<void(u64 cache_key, u64 vary_key)> on_entry_removed);
@@ -62,6 +71,8 @@ public:
 
     void set_maximum_disk_cache_size(u64 maximum_disk_cache_size);
 
+    void flush_pending_writes();
+
 private:
     struct Statements {
         Database::StatementID insert_entry { 0 };
@@ -69,9 +80,9 @@ private:
         Database::StatementID remove_entries_exceeding_cache_limit { 0 };
         Database::StatementID remove_entries_accessed_since { 0 };
         Database::StatementID select_entries { 0 };
+        Database::StatementID select_cache_keys { 0 };
         Database::StatementID update_response_headers { 0 };
-        Database::StatementID update_associated_data_size { 0 };
-        Database::StatementID update_last_access_time { 0 };
+        Database::StatementID update_access_time_and_associated_data_size { 0 };
         Database::StatementID estimate_cache_size_accessed_since { 0 };
         Database::StatementID select_total_estimated_size { 0 };
     };
@@ -82,17 +93,40 @@ private:
         i64 maximum_disk_cache_entry_size { 0 };
     };
 
-    CacheIndex(Database::Database&, Statements, Limits, i64 total_estimated_size);
+    struct EntryKey {
+        u64 cache_key { 0 };
+        u64 vary_key { 0 };
+
+        bool operator==(EntryKey const&) const = default;
+    };
 
+    struct EntryKeyTraits : public DefaultTraits<EntryKey> {
+        static unsigned hash(EntryKey const& key) { return pair_int_hash(u64_hash(key.cache_key), u64_hash(key.vary_key)); }
+    };
+
+    CacheIndex(Database::Database&, Statements, Limits, i64 total_estimated_size, HashTable<u64, IdentityHashTraits<u64>> cache_keys);
+
+    Optional<Vector<Entry>&> get_entries(u64 cache_key);
     Optional<Entry&> get_entry(u64 cache_key, u64 vary_key);
     void delete_entry(u64 cache_key, u64 vary_key);
     void adjust_total_estimated_size(i64 delta);
 
+    void mark_entry_for_write(u64 cache_key, u64 vary_key);
+    void write_entry(EntryKey, Entry const&);
+    void write_pending_entry(u64 cache_key, u64 vary_key);
+
     NonnullRawPtr<Database::Database> m_database;
     Statements m_statements;
 
     HashMap<u64, Vector<Entry>, IdentityHashTraits<u64>> m_entries;
 
+    // Every cache key with at least one row in the database. A cache key that is absent here is known to be a miss.
+    HashTable<u64, IdentityHashTraits<u64>> m_cache_keys;
+
+    // Entries whose last access time or associated data size have changed since they were last written.
+    HashTable<EntryKey, EntryKeyTraits> m_entries_pending_write;
+    Optional<MonotonicTime> m_oldest_pending_write_time;
+
     Limits m_limits;
     i64 m_total_estimated_size { 0 };
 };
@@ -18,12 +18,14 @@ void Client::die()
 {
     verify_event_loop();
     auto pending_promises = move(m_token_promises);
+    m_partially_decoded_callbacks.clear();
+    m_pending_incremental_decode_data.clear();
 
     for (auto& promise : pending_promises)
         promise.value->reject(Error::from_string_literal("ImageDecoder disconnected"));
 }
 
-NonnullRefPtr<Core::Promise<DecodedImage>> Client::decode_image(ReadonlyBytes encoded_data, Function<ErrorOr<void>(DecodedImage&)> on_resolved, Function<void(Error&)> on_rejected, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> mime_type)
+NonnullRefPtr<Core::Promise<DecodedImage>> Client::decode_image(ReadonlyBytes encoded_data, Function<ErrorOr<void>(DecodedImage&)> on_resolved, Function<void(Error&)> on_rejected, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> mime_type, Optional<String> cache_partition)
 {
     verify_event_loop();
     auto promise = Core::Promise<DecodedImage>::construct();
@@ -50,17 +52,127 @@ NonnullRefPtr<Core::Promise<DecodedImage>> Client::decode_image(ReadonlyBytes en
     i64 request_id = m_next_request_id++;
     m_token_promises.set(request_id, promise);
 
-    async_decode_image(encoded_buffer, ideal_size, mime_type, request_id);
+    async_decode_image(encoded_buffer, ideal_size, mime_type, cache_partition, request_id);
 
     return promise;
 }
 
-void Client::did_decode_image(i64 request_id, bool is_animated, u32 loop_count, Gfx::BitmapSequence bitmap_sequence, Vector<u32> durations, Gfx::FloatPoint scale, Gfx::ColorSpace color_space, i64 session_id)
+ErrorOr<DecodedImage> Client::decode_image_at_natural_size(ReadonlyBytes encoded_data, Optional<ByteString> mime_type, Optional<String> cache_partition)
+{
+    verify_event_loop();
+    if (encoded_data.is_empty())
+        return Error::from_string_literal("No encoded data");
+
+    auto encoded_buffer = TRY(Core::AnonymousBuffer::create_with_size(encoded_data.size()));
+    memcpy(encoded_buffer.data<void>(), encoded_data.data(), encoded_data.size());
+
+    auto response = send_sync_but_allow_failure<Messages::ImageDecoderServer::DecodeImageAtNaturalSize>(move(encoded_buffer), move(mime_type), move(cache_partition));
+    if (!response)
+        return Error::from_string_literal("ImageDecoder disconnected");
+
+    auto bitmaps = move(response->take_bitmaps().bitmaps);
+    if (bitmaps.is_empty() || !bitmaps.first())
+        return Error::from_string_literal("Image decoding failed");
+
+    DecodedImage image;
+    image.natural_size = bitmaps.first()->size();
+    image.frame_count = 1;
+    image.color_space = response->take_color_profile();
+    image.frames.empend(bitmaps.first().release_nonnull(), 0);
+    return image;
+}
+
+i64 Client::begin_incremental_decode(PartiallyDecodedCallback on_partially_decoded, Function<ErrorOr<void>(DecodedImage&)> on_resolved, Function<void(Error&)> on_rejected, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> mime_type, Optional<String> cache_partition)
+{
+    verify_event_loop();
+    auto promise = Core::Promise<DecodedImage>::construct();
+    if (on_resolved)
+        promise->on_resolution = move(on_resolved);
+    if (on_rejected)
+        promise->on_rejection = move(on_rejected);
+
+    i64 request_id = m_next_request_id++;
+    m_token_promises.set(request_id, move(promise));
+    if (on_partially_decoded)
+        m_partially_decoded_callbacks.set(request_id, move(on_partially_decoded));
+
+    async_begin_incremental_decode(request_id, ideal_size, mime_type, cache_partition);
+
+    return request_id;
+}
+
+void Client::append_incremental_decode_data(i64 request_id, ReadonlyBytes encoded_data)
+{
+    verify_event_loop();
+    if (encoded_data.is_empty() || !m_token_promises.contains(request_id))
+        return;
+
+    auto& pending_data = m_pending_incremental_decode_data.ensure(request_id);
+    if (auto result = pending_data.try_append(encoded_data); result.is_error()) {
+        auto promise = m_token_promises.take(request_id).release_value();
+        cancel_incremental_decode(request_id);
+        promise->reject(result.release_error());
+        return;
+    }
+
+    if (pending_data.size() >= INCREMENTAL_DECODE_CHUNK_SIZE)
+        send_pending_incremental_decode_data(request_id);
+}
+
+void Client::send_pending_incremental_decode_data(i64 request_id)
+{
+    auto pending_data = m_pending_incremental_decode_data.take(request_id);
+    if (!pending_data.has_value() || pending_data->is_empty())
+        return;
+
+    auto encoded_buffer_or_error = Core::AnonymousBuffer::create_with_size(pending_data->size());
+    if (encoded_buffer_or_error.is_error()) {
+        dbgln("Could not allocate encoded buffer: {}", encoded_buffer_or_error.error());
+        auto promise = m_token_promises.take(request_id).release_value();
+        cancel_incremental_decode(request_id);
+        promise->reject(encoded_buffer_or_error.release_error());
+        return;
+    }
+    auto encoded_buffer = encoded_buffer_or_error.release_value();
+
+    memcpy(encoded_buffer.data<void>(), pending_data->data(), pending_data->size());
+
+    async_append_incremental_decode_data(request_id, move(encoded_buffer));
+}
+
+void Client::finish_incremental_decode(i64 request_id)
+{
+    verify_event_loop();
+    if (!m_token_promises.contains(request_id))
+        return;
+
+    send_pending_incremental_decode_data(request_id);
+
+    // Sending the last chunk may have failed, which settles the decode.
+    if (!m_token_promises.contains(request_id))
+        return;
+
+    async_finish_incremental_decode(request_id);
+}
+
+void Client::cancel_incremental_decode(i64 request_id)
+{
+    verify_event_loop();
+    m_token_promises.remove(request_id);
+    m_partially_decoded_callbacks.remove(request_id);
+    m_pending_incremental_decode_data.remove(request_id);
+
+    async_cancel_decoding(request_id);
+}
+
+void Client::did_decode_image(i64 request_id, bool is_animated, u32 loop_count, Gfx::BitmapSequence bitmap_sequence, Gfx::IntSize natural_size, Vector<u32> durations, Gfx::FloatPoint scale, Gfx::ColorSpace color_space, i64 session_id)
 {
     verify_event_loop();
     auto bitmaps = move(bitmap_sequence.bitmaps);
     VERIFY(!bitmaps.is_empty());
 
+    m_partially_decoded_callbacks.remove(request_id);
+
     Optional<NonnullRefPtr<Core::Promise<DecodedImage>>> maybe_promise = m_token_promises.take(request_id);
 
     if (!maybe_promise.has_value()) {
@@ -73,6 +185,7 @@ void Client::did_decode_image(i64 request_id, bool is_animated, u32 loop_count,
     image.is_animated = is_animated;
     image.loop_count = loop_count;
     image.session_id = session_id;
+    image.natural_size = natural_size;
     image.scale = scale;
     image.frames.ensure_capacity(bitmaps.size());
     image.color_space = move(color_space);
@@ -101,6 +214,9 @@ void Client::did_decode_image(i64 request_id, bool is_animated, u32 loop_count,
 void Client::did_fail_to_decode_image(i64 request_id, String error_message)
 {
     verify_event_loop();
+    m_partially_decoded_callbacks.remove(request_id);
+    m_pending_incremental_decode_data.remove(request_id);
+
     Optional<NonnullRefPtr<Core::Promise<DecodedImage>>> maybe_promise = m_token_promises.take(request_id);
 
     if (!maybe_promise.has_value()) {
@@ -114,6 +230,26 @@ void Client::did_fail_to_decode_image(i64 request_id, String error_message)
     promise->reject(Error::from_string_literal("Image decoding failed or aborted"));
 }
 
+void Client::did_partially_decode_image(i64 request_id, Gfx::BitmapSequence bitmap_sequence, Gfx::IntSize natural_size, Gfx::ColorSpace color_space)
+{
+    verify_event_loop();
+    auto& bitmaps = bitmap_sequence.bitmaps;
+    if (bitmaps.is_empty() || !bitmaps.first()) {
+        dbgln("ImageDecoderClient: Invalid partial bitmap for request {}", request_id);
+        return;
+    }
+
+    // NB: The callback may cancel the decode, so we hold on to it while it runs.
+    auto callback = m_partially_decoded_callbacks.take(request_id);
+    if (!callback.has_value())
+        return;
+
+    (*callback)(bitmaps.first().release_nonnull(), natural_size, move(color_space));
+
+    if (m_token_promises.contains(request_id))
+        m_partially_decoded_callbacks.set(request_id, callback.release_value());
+}
+
 void Client::did_decode_animation_frames(i64 session_id, Gfx::BitmapSequence bitmap_sequence)
 {
     verify_event_loop();
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/ByteBuffer.h>
 #include <AK/HashMap.h>
 #include <ImageDecoder/ImageDecoderClientEndpoint.h>
 #include <ImageDecoder/ImageDecoderServerEndpoint.h>
@@ -23,6 +24,9 @@ struct Frame {
 
 struct DecodedImage {
     bool is_animated { false };
+
+    // The size of the image itself. Its frames are smaller if they were decoded for a smaller ideal size.
+    Gfx::IntSize natural_size;
     Gfx::FloatPoint scale { 1, 1 };
     u32 loop_count { 0 };
     u32 frame_count { 0 };
@@ -42,7 +46,25 @@ public:
 
     Client(NonnullOwnPtr<IPC::Transport>);
 
-    NonnullRefPtr<Core::Promise<DecodedImage>> decode_image(ReadonlyBytes, Function<ErrorOr<void>(DecodedImage&)> on_resolved, Function<void(Error&)> on_rejected, Optional<Gfx::IntSize> ideal_size = {}, Optional<ByteString> mime_type = {});
+    // Images decoded with the same cache partition may share one decoded copy in the image decoder's cache. Images
+    // decoded without a partition are not cached.
+    NonnullRefPtr<Core::Promise<DecodedImage>> decode_image(ReadonlyBytes, Function<ErrorOr<void>(DecodedImage&)> on_resolved, Function<void(Error&)> on_rejected, Optional<Gfx::IntSize> ideal_size = {}, Optional<ByteString> mime_type = {}, Optional<String> cache_partition = {});
+
+    // Decodes the first frame of an image at its natural size, and waits for the result. This is for reading the pixels
+    // of an image whose frames were decoded at a lower resolution, which can't wait for a decode to settle.
+    ErrorOr<DecodedImage> decode_image_at_natural_size(ReadonlyBytes, Optional<ByteString> mime_type = {}, Optional<String> cache_partition = {});
+
+    // Appended data is sent to ImageDecoder in chunks of at least this size. It only decodes a partial image again once
+    // the data grew by that much, so sending every small network chunk on its own would buy nothing.
+    static constexpr size_t INCREMENTAL_DECODE_CHUNK_SIZE = 16 * KiB;
+
+    // Decodes an image whose encoded data arrives in chunks. Whenever the data appended so far yields some pixels, they
+    // are passed to on_partially_decoded. The image is settled like with decode_image() once all data was appended.
+    using PartiallyDecodedCallback = Function<void(NonnullRefPtr<Gfx::Bitmap>, Gfx::IntSize natural_size, Gfx::ColorSpace)>;
+    i64 begin_incremental_decode(PartiallyDecodedCallback on_partially_decoded, Function<ErrorOr<void>(DecodedImage&)> on_resolved, Function<void(Error&)> on_rejected, Optional<Gfx::IntSize> ideal_size = {}, Optional<ByteString> mime_type = {}, Optional<String> cache_partition = {});
+    void append_incremental_decode_data(i64 request_id, ReadonlyBytes);
+    void finish_incremental_decode(i64 request_id);
+    void cancel_incremental_decode(i64 request_id);
 
     void request_animation_frames(i64 session_id, u32 start_frame_index, u32 count);
     void stop_animation_decode(i64 session_id);
@@ -55,8 +77,11 @@ private:
     void verify_event_loop() const;
     virtual void die() override;
 
-    virtual void did_decode_image(i64 request_id, bool is_animated, u32 loop_count, Gfx::BitmapSequence bitmap_sequence, Vector<u32> durations, Gfx::FloatPoint scale, Gfx::ColorSpace color_space, i64 session_id) override;
+    void send_pending_incremental_decode_data(i64 request_id);
+
+    virtual void did_decode_image(i64 request_id, bool is_animated, u32 loop_count, Gfx::BitmapSequence bitmap_sequence, Gfx::IntSize natural_size, Vector<u32> durations, Gfx::FloatPoint scale, Gfx::ColorSpace color_space, i64 session_id) override;
     virtual void did_fail_to_decode_image(i64 request_id, String error_message) override;
+    virtual void did_partially_decode_image(i64 request_id, Gfx::BitmapSequence bitmap_sequence, Gfx::IntSize natural_size, Gfx::ColorSpace color_space) override;
 
     virtual void did_decode_animation_frames(i64 session_id, Gfx::BitmapSequence bitmaps) override;
     virtual void did_fail_animation_decode(i64 session_id, String error_message) override;
@@ -64,6 +89,8 @@ private:
     Core::EventLoop* m_creation_event_loop { &Core::EventLoop::current() };
     i64 m_next_request_id { 0 };
     HashMap<i64, NonnullRefPtr<Core::Promise<DecodedImage>>> m_token_promises;
+    HashMap<i64, PartiallyDecodedCallback> m_partially_decoded_callbacks;
+    HashMap<i64, ByteBuffer> m_pending_incremental_decode_data;
 };
 
 }
@@ -13,5 +13,6 @@ namespace JS::Bytecode {
 JS_API extern bool g_dump_bytecode;
 JS_API bool should_dump_interpreter_assembly();
 JS_API bool should_dump_bytecode();
+JS_API bool should_log_hot_executables();
 
 }
@@ -10,6 +10,7 @@
 #include <AK/StdLibExtras.h>
 #include <LibGC/Heap.h>
 #include <LibGC/HeapBlock.h>
+#include <LibJS/Bytecode/Debug.h>
 #include <LibJS/Bytecode/Executable.h>
 #include <LibJS/Bytecode/Instruction.h>
 #include <LibJS/Bytecode/Op.h>
@@ -501,6 +502,13 @@ void Executable::dump() const
     warnln("{}", output.string_view());
 }
 
+void Executable::did_become_hot() const
+{
+    if (!should_log_hot_executables())
+        return;
+    dbgln("Executable became hot: '{}' in {} ({} bytes of bytecode)", name, source_code->filename(), bytecode.size());
+}
+
 void Executable::visit_edges(Visitor& visitor)
 {
     Base::visit_edges(visitor);
@@ -386,6 +386,21 @@ public:
 
     u32 registers_and_locals_count { 0 };
     u32 registers_and_locals_and_constants_count { 0 };
+
+    // Number of times this executable has been entered, saturating once it crosses the hot threshold. The Call
+    // handler in interpreter.flap bumps it directly for the frames it builds itself.
+    // This is the tier-up signal for a future baseline compiler; see Documentation/LibJSBaselineTier.md.
+    static constexpr u32 hot_entry_count_threshold = 1000;
+    u32 entry_count { 0 };
+    [[nodiscard]] bool is_hot() const { return entry_count >= hot_entry_count_threshold; }
+    ALWAYS_INLINE void did_enter()
+    {
+        if (entry_count < hot_entry_count_threshold) [[likely]] {
+            if (++entry_count == hot_entry_count_threshold)
+                did_become_hot();
+        }
+    }
+
     size_t asm_constants_size { 0 };
     Value const* asm_constants_data { nullptr };
 
@@ -438,6 +453,8 @@ private:
     virtual void visit_edges(Visitor&) override;
     virtual size_t external_memory_size() const override;
 
+    COLD void did_become_hot() const;
+
     struct DebuggerBreakpointSite {
         Vector<BreakpointID> breakpoint_ids;
     };
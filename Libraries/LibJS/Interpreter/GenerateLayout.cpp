@@ -172,6 +172,8 @@ int main()
     EMIT_PAIRED_FIELD(EXECUTABLE_REGISTERS_AND_LOCALS_AND_CONSTANTS_COUNT, Executable, registers_and_locals_and_constants_count, u32, Executable, registers_and_locals_and_constants_count, 4, scalar, slot_counts);
     EMIT_PAIRED_FIELD(EXECUTABLE_ASM_CONSTANTS_SIZE, Executable, asm_constants_size, u64, Executable, asm_constants_size, 8, scalar, constants);
     EMIT_PAIRED_FIELD(EXECUTABLE_ASM_CONSTANTS_DATA, Executable, asm_constants_data, Sequence<Value>, Executable, asm_constants_data, 8, scalar, constants);
+    EMIT_FIELD(EXECUTABLE_ENTRY_COUNT, Executable, entry_count, u32, Executable, entry_count, 4, nullable, scalar);
+    outln("const EXECUTABLE_HOT_ENTRY_COUNT_THRESHOLD = {}", Executable::hot_entry_count_threshold);
 
     // ExecutionContext layout
     outln("\n# ExecutionContext layout");
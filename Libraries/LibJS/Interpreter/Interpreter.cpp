@@ -54,6 +54,15 @@ bool Bytecode::should_dump_bytecode()
     return g_dump_bytecode || should_dump_interpreter_assembly();
 }
 
+bool Bytecode::should_log_hot_executables()
+{
+    static bool const should_log = [] {
+        auto value = Core::Environment::get("LADYBIRD_JS_LOG_HOT_EXECUTABLES"sv);
+        return value.has_value() && value != "0"sv;
+    }();
+    return should_log;
+}
+
 // 16.1.6 ScriptEvaluation ( scriptRecord ), https://tc39.es/ecma262/#sec-runtime-semantics-scriptevaluation
 ThrowCompletionOr<Value> VM::run(Script& script_record, GC::Ptr<Environment> lexical_environment_override)
 {
@@ -228,6 +237,8 @@ ExecutionContext* VM::push_inline_frame(
     callee_context->caller_return_pc = return_pc;
     callee_context->caller_is_construct = is_construct;
 
+    callee_executable.did_enter();
+
     // Inlined PrepareForOrdinaryCall (avoids function call overhead on hot path).
     callee_context->function = &callee_function;
     callee_context->realm = callee_function.realm();
@@ -306,6 +317,10 @@ ThrowCompletionOr<Value> VM::run_executable(ExecutionContext& context, Executabl
 
     context.executable = executable;
 
+    // Only count fresh entries, not generator/async resumptions.
+    if (entry_point == 0)
+        executable.did_enter();
+
     VERIFY(executable.registers_and_locals_count + executable.constants.size() == executable.registers_and_locals_and_constants_count);
     VERIFY(executable.registers_and_locals_and_constants_count <= context.registers_and_constants_and_locals_and_arguments_span().size());
 
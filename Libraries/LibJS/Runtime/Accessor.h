@@ -19,6 +19,9 @@ class Accessor final : public Cell {
     GC_DECLARE_ALLOCATOR(Accessor);
 
 public:
+    // Only holds GC pointers, so there is nothing in the destructor that needs the main thread.
+    static constexpr bool SWEEPS_CONCURRENTLY = true;
+
     static GC::Ref<Accessor> create(VM& vm, GC::Ptr<FunctionObject> getter, GC::Ptr<FunctionObject> setter, GC::Ptr<Symbol> cached_value_key = nullptr)
     {
         return vm.heap().allocate<Accessor>(getter, setter, cached_value_key);
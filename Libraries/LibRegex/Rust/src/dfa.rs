@@ -0,0 +1,765 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+//! Lazily built DFA for patterns that do not need backtracking.
+//!
+//! Patterns without backreferences, lookaround, assertions or large counted
+//! loops describe a regular language, so whether (and where) they match can be
+//! decided in a single left-to-right pass over the input. The DFA states are
+//! ordered sets of bytecode threads and are only built when the input first
+//! reaches them, so the automaton never grows beyond what the input needs.
+//!
+//! Threads are kept in backtracking priority order, and a state drops every
+//! thread of lower priority than one that has reached `Match`. This gives the
+//! same leftmost-first match bounds as the backtracking VM, which is still used
+//! to extract capture groups.
+//!
+//! The forward scan finds where the leftmost match ends. Its start is found by
+//! a second DFA, built from the pattern with every alternative reversed, that
+//! walks back from that end. Both scans are linear in the input.
+//!
+//! ASCII code units that every instruction treats alike share one equivalence
+//! class, and states only store a transition per class.
+//!
+//! Spec:
+//! - <https://tc39.es/ecma262/#sec-pattern-semantics>
+
+use crate::bytecode::*;
+use crate::vm::{Input, case_fold_eq, is_line_terminator, match_builtin_class, match_char_class};
+use std::collections::{HashMap, HashSet};
+
+/// Number of states a DFA may build before giving up on it for good.
+const MAX_STATE_COUNT: usize = 4096;
+
+/// Largest loop bound that is tracked per thread. Larger bounds would multiply
+/// the number of states.
+const MAX_TRACKED_LOOP_COUNT: u32 = 64;
+
+/// Number of `RepeatStart` counters a thread can carry, one byte each.
+const MAX_COUNTER_COUNT: usize = 8;
+
+type StateId = u32;
+
+const DEAD_STATE: StateId = 0;
+const UNKNOWN_STATE: StateId = StateId::MAX;
+
+/// A position in the bytecode, plus the iteration count when it is a
+/// `GreedyLoop`/`LazyLoop`, and the values of the `RepeatStart` counters.
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Hash)]
+struct Thread {
+    pc: u32,
+    loop_count: u32,
+    counters: u64,
+}
+
+const START_THREAD: Thread = Thread {
+    pc: 0,
+    loop_count: 0,
+    counters: 0,
+};
+
+const MATCH_THREAD: Thread = Thread {
+    pc: u32::MAX,
+    loop_count: 0,
+    counters: 0,
+};
+
+impl Thread {
+    fn goto(self, pc: u32) -> Self {
+        Self {
+            pc,
+            loop_count: 0,
+            counters: self.counters,
+        }
+    }
+
+    fn counter(self, slot: usize) -> u32 {
+        ((self.counters >> (slot * 8)) & 0xff) as u32
+    }
+
+    fn with_counter(self, slot: usize, value: u32) -> Self {
+        let shift = slot * 8;
+        Self {
+            counters: (self.counters & !(0xff << shift)) | ((value as u64) << shift),
+            ..self
+        }
+    }
+}
+
+struct State {
+    /// Threads waiting to consume a character, in priority order, optionally
+    /// followed by `MATCH_THREAD`.
+    threads: Box<[Thread]>,
+    is_match: bool,
+    /// Indexed by the equivalence class of an ASCII code unit.
+    ascii_transitions: Box<[StateId]>,
+}
+
+/// The states reachable from one kind of start state.
+///
+/// In the unanchored cache a new match attempt begins at every position, with
+/// the lowest priority. In the anchored cache it only begins at the search
+/// start.
+struct StateCache {
+    states: Vec<State>,
+    state_ids: HashMap<Box<[Thread]>, StateId>,
+    non_ascii_transitions: HashMap<(StateId, u16), StateId>,
+    start_state: StateId,
+}
+
+/// The DFA gave up because the pattern needs too many states. Callers fall
+/// back to the backtracking VM.
+#[derive(Debug)]
+pub struct CacheExhausted;
+
+/// Bounds of the leftmost match found by the DFA.
+pub struct DfaMatch {
+    pub start: usize,
+    /// The match end, unless the pattern contains quantifiers whose body can
+    /// match the empty string. ECMA-262 rejects empty iterations in a way that
+    /// thread priorities do not model exactly, so only the start is reported.
+    pub end: Option<usize>,
+}
+
+pub struct LazyDfa {
+    anchored: StateCache,
+    unanchored: StateCache,
+    /// Counter registers used by `RepeatStart`, indexed by their slot in
+    /// `Thread::counters`.
+    counter_registers: Vec<u32>,
+    ascii_classes: [u8; 128],
+    ascii_class_count: usize,
+    /// Whether threads of lower priority than a match are dropped. The reverse
+    /// DFA keeps them, since it looks for the longest match rather than the
+    /// one the backtracking VM would prefer.
+    prunes_lower_priority_threads: bool,
+    reports_match_end: bool,
+    exhausted: bool,
+    visited: HashSet<Thread>,
+    work_stack: Vec<ClosureStep>,
+    reverse: Option<Box<ReverseDfa>>,
+}
+
+/// DFA for the reversed pattern, which walks back from the end of a match to
+/// find where it starts.
+struct ReverseDfa {
+    program: Program,
+    dfa: LazyDfa,
+}
+
+enum ClosureStep {
+    Explore(Thread),
+    Emit(Thread),
+}
+
+/// What the DFA needs to know about a program before building any states.
+struct ProgramShape {
+    reports_match_end: bool,
+    counter_registers: Vec<u32>,
+}
+
+impl ProgramShape {
+    /// Returns `None` if the program uses anything that a DFA cannot model.
+    fn of(program: &Program) -> Option<Self> {
+        // Unicode mode would need surrogate pairs decoded into code points,
+        // which the code-unit transitions can't represent.
+        if program.unicode || program.unicode_sets {
+            return None;
+        }
+
+        let mut reports_match_end = true;
+        let mut counter_registers = Vec::new();
+        for instruction in &program.instructions {
+            match instruction {
+                Instruction::Char(_)
+                | Instruction::CharNoCase(_, _)
+                | Instruction::AnyChar { .. }
+                | Instruction::CharClass { .. }
+                | Instruction::BuiltinClass(_)
+                | Instruction::Jump(_)
+                | Instruction::Split { .. }
+                | Instruction::Save(_)
+                | Instruction::ClearRegister(_)
+                | Instruction::Match
+                | Instruction::Fail
+                | Instruction::Nop => {}
+                Instruction::ProgressCheck { .. } => reports_match_end = false,
+                Instruction::GreedyLoop { matcher, min, max } | Instruction::LazyLoop { matcher, min, max } => {
+                    if *min > MAX_TRACKED_LOOP_COUNT
+                        || max.is_some_and(|max| max > MAX_TRACKED_LOOP_COUNT)
+                        || !is_supported_simple_match(matcher)
+                    {
+                        return None;
+                    }
+                }
+                Instruction::RepeatStart { counter_reg } => {
+                    if !counter_registers.contains(counter_reg) {
+                        counter_registers.push(*counter_reg);
+                    }
+                }
+                Instruction::RepeatCheck { min, max, .. } => {
+                    if *min > MAX_TRACKED_LOOP_COUNT || max.is_none_or(|max| max > MAX_TRACKED_LOOP_COUNT) {
+                        return None;
+                    }
+                }
+                _ => return None,
+            }
+        }
+        if counter_registers.len() > MAX_COUNTER_COUNT {
+            return None;
+        }
+        Some(Self {
+            reports_match_end,
+            counter_registers,
+        })
+    }
+}
+
+/// Whether a DFA can model `program`, and which match bounds it reports. This
+/// only scans the instructions, so it can be asked when a pattern is compiled
+/// while building the DFA waits until it is first used.
+pub fn supports(program: &Program) -> Option<MatchBounds> {
+    ProgramShape::of(program).map(|shape| {
+        if shape.reports_match_end {
+            MatchBounds::StartAndEnd
+        } else {
+            MatchBounds::StartOnly
+        }
+    })
+}
+
+/// Which bounds of a match the DFA for a program reports.
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub enum MatchBounds {
+    StartAndEnd,
+    /// See `DfaMatch::end`.
+    StartOnly,
+}
+
+impl LazyDfa {
+    /// Returns `None` if the program uses anything that a DFA cannot model.
+    /// `reverse_program` must be compiled from the same pattern with the terms
+    /// of every alternative in reverse order.
+    pub fn new(program: &Program, reverse_program: Program) -> Option<Self> {
+        let reverse = Self::for_program(&reverse_program, false)?;
+        let mut dfa = Self::for_program(program, true)?;
+        dfa.reverse = Some(Box::new(ReverseDfa {
+            program: reverse_program,
+            dfa: reverse,
+        }));
+        Some(dfa)
+    }
+
+    fn for_program(program: &Program, prunes_lower_priority_threads: bool) -> Option<Self> {
+        let ProgramShape {
+            reports_match_end,
+            counter_registers,
+        } = ProgramShape::of(program)?;
+        let (ascii_classes, ascii_class_count) = compute_ascii_classes(program);
+        let mut dfa = Self {
+            anchored: StateCache::new(ascii_class_count),
+            unanchored: StateCache::new(ascii_class_count),
+            counter_registers,
+            ascii_classes,
+            ascii_class_count,
+            prunes_lower_priority_threads,
+            reports_match_end,
+            exhausted: false,
+            visited: HashSet::new(),
+            work_stack: Vec::new(),
+            reverse: None,
+        };
+        dfa.anchored.start_state = dfa.compute_start_state(program, false);
+        dfa.unanchored.start_state = dfa.compute_start_state(program, true);
+        Some(dfa)
+    }
+
+    fn cache(&self, unanchored: bool) -> &StateCache {
+        if unanchored { &self.unanchored } else { &self.anchored }
+    }
+
+    fn cache_mut(&mut self, unanchored: bool) -> &mut StateCache {
+        if unanchored {
+            &mut self.unanchored
+        } else {
+            &mut self.anchored
+        }
+    }
+
+    pub fn reports_match_end(&self) -> bool {
+        self.reports_match_end
+    }
+
+    /// Whether any match begins at or after `start`.
+    pub fn is_match<I: Input>(&mut self, program: &Program, input: I, start: usize) -> Result<bool, CacheExhausted> {
+        Ok(self.earliest_match_end(program, input, start)?.is_some())
+    }
+
+    /// Find the match the backtracking VM would find when scanning from `start`.
+    pub fn find<I: Input>(
+        &mut self,
+        program: &Program,
+        input: I,
+        start: usize,
+    ) -> Result<Option<DfaMatch>, CacheExhausted> {
+        let Some(end) = self.leftmost_first_match_end(program, input, start)? else {
+            return Ok(None);
+        };
+        let reverse = self.reverse.as_mut().expect("only the forward DFA looks for matches");
+        let match_start = reverse.dfa.longest_match_start(&reverse.program, input, start, end)?;
+        Ok(Some(DfaMatch {
+            start: match_start,
+            end: self.reports_match_end.then_some(end),
+        }))
+    }
+
+    /// Find all non-overlapping matches, with the same contract as
+    /// `vm::find_all_with_scratch`. Must only be used if `reports_match_end()`.
+    pub fn find_all<I: Input>(
+        &mut self,
+        program: &Program,
+        input: I,
+        start: usize,
+        result_buf: &mut [i32],
+    ) -> Result<i32, CacheExhausted> {
+        debug_assert!(self.reports_match_end);
+        let capacity = result_buf.len();
+        let mut count = 0i32;
+        let mut pos = start;
+        while pos <= input.len() {
+            let Some(found) = self.find(program, input, pos)? else {
+                break;
+            };
+            let match_end = found.end.unwrap_or(found.start);
+            let idx = count as usize * 2;
+            if idx + 1 >= capacity {
+                return Ok(-1);
+            }
+            result_buf[idx] = found.start as i32;
+            result_buf[idx + 1] = match_end as i32;
+            count += 1;
+            pos = if match_end == found.start {
+                match_end + 1
+            } else {
+                match_end
+            };
+        }
+        Ok(count)
+    }
+
+    fn earliest_match_end<I: Input>(
+        &mut self,
+        program: &Program,
+        input: I,
+        start: usize,
+    ) -> Result<Option<usize>, CacheExhausted> {
+        if start > input.len() {
+            return Ok(None);
+        }
+        let mut state = self.unanchored.start_state;
+        if self.unanchored.states[state as usize].is_match {
+            return Ok(Some(start));
+        }
+        for pos in start..input.len() {
+            state = self.next_state(program, true, state, input.code_unit(pos))?;
+            if self.unanchored.states[state as usize].is_match {
+                return Ok(Some(pos + 1));
+            }
+        }
+        Ok(None)
+    }
+
+    /// Scan for the first match to end, and then keep going until the threads
+    /// of higher priority than it have either matched or died.
+    ///
+    /// Match attempts begin in priority order, so every thread that is left
+    /// once a match is found belongs to an attempt that began no later than
+    /// the matching one. The one that began first wins, and since attempts are
+    /// no longer added, the rest of the scan continues in the anchored cache.
+    fn leftmost_first_match_end<I: Input>(
+        &mut self,
+        program: &Program,
+        input: I,
+        start: usize,
+    ) -> Result<Option<usize>, CacheExhausted> {
+        if start > input.len() {
+            return Ok(None);
+        }
+        let mut pos = start;
+        let mut state = self.unanchored.start_state;
+        while !self.unanchored.states[state as usize].is_match {
+            if pos == input.len() {
+                return Ok(None);
+            }
+            state = self.next_state(program, true, state, input.code_unit(pos))?;
+            pos += 1;
+        }
+
+        let threads = self.unanchored.states[state as usize].threads.to_vec();
+        let mut state = self.intern_state(false, threads)?;
+        let mut match_end = pos;
+        while pos < input.len() {
+            state = self.next_state(program, false, state, input.code_unit(pos))?;
+            if state == DEAD_STATE {
+                break;
+            }
+            pos += 1;
+            if self.anchored.states[state as usize].is_match {
+                match_end = pos;
+            }
+        }
+        Ok(Some(match_end))
+    }
+
+    /// Run the reverse DFA backwards from `end`, and return the earliest
+    /// position at or after `start` where a match ending at `end` can begin.
+    fn longest_match_start<I: Input>(
+        &mut self,
+        program: &Program,
+        input: I,
+        start: usize,
+        end: usize,
+    ) -> Result<usize, CacheExhausted> {
+        let mut state = self.anchored.start_state;
+        let mut match_start = self.anchored.states[state as usize].is_match.then_some(end);
+        for pos in (start..end).rev() {
+            state = self.next_state(program, false, state, input.code_unit(pos))?;
+            if state == DEAD_STATE {
+                break;
+            }
+            if self.anchored.states[state as usize].is_match {
+                match_start = Some(pos);
+            }
+        }
+        Ok(match_start.expect("the forward DFA found a match that ends here"))
+    }
+
+    #[inline(always)]
+    fn next_state(
+        &mut self,
+        program: &Program,
+        unanchored: bool,
+        state: StateId,
+        code_unit: u16,
+    ) -> Result<StateId, CacheExhausted> {
+        let cache = self.cache(unanchored);
+        let cached = if code_unit < 128 {
+            cache.states[state as usize].ascii_transitions[self.ascii_classes[code_unit as usize] as usize]
+        } else {
+            cache
+                .non_ascii_transitions
+                .get(&(state, code_unit))
+                .copied()
+                .unwrap_or(UNKNOWN_STATE)
+        };
+        if cached != UNKNOWN_STATE {
+            return Ok(cached);
+        }
+        self.compute_next_state(program, unanchored, state, code_unit)
+    }
+
+    #[cold]
+    fn compute_next_state(
+        &mut self,
+        program: &Program,
+        unanchored: bool,
+        state: StateId,
+        code_unit: u16,
+    ) -> Result<StateId, CacheExhausted> {
+        if self.exhausted {
+            return Err(CacheExhausted);
+        }
+
+        let cache = self.cache(unanchored);
+        let threads = cache.states[state as usize].threads.clone();
+
+        let mut next_threads = Vec::new();
+        self.visited.clear();
+        let mut reached_match = false;
+        for thread in &threads {
+            if *thread == MATCH_THREAD {
+                break;
+            }
+            let Some(successor) = step_thread(program, *thread, code_unit as u32) else {
+                continue;
+            };
+            if self.add_closure(program, successor, &mut next_threads) {
+                reached_match = true;
+                if self.prunes_lower_priority_threads {
+                    break;
+                }
+            }
+        }
+        if unanchored && !reached_match {
+            self.add_closure(program, START_THREAD, &mut next_threads);
+        }
+        if reached_match && !self.prunes_lower_priority_threads {
+            next_threads.push(MATCH_THREAD);
+        }
+
+        let next_state = self.intern_state(unanchored, next_threads)?;
+        let ascii_classes = self.ascii_classes;
+        let cache = self.cache_mut(unanchored);
+        if code_unit < 128 {
+            cache.states[state as usize].ascii_transitions[ascii_classes[code_unit as usize] as usize] = next_state;
+        } else {
+            cache.non_ascii_transitions.insert((state, code_unit), next_state);
+        }
+        Ok(next_state)
+    }
+
+    fn compute_start_state(&mut self, program: &Program, unanchored: bool) -> StateId {
+        let mut threads = Vec::new();
+        self.visited.clear();
+        if self.add_closure(program, START_THREAD, &mut threads) && !self.prunes_lower_priority_threads {
+            threads.push(MATCH_THREAD);
+        }
+        // There is only the dead state so far, so this can't exhaust the cache.
+        self.intern_state(unanchored, threads).unwrap_or(DEAD_STATE)
+    }
+
+    fn intern_state(&mut self, unanchored: bool, threads: Vec<Thread>) -> Result<StateId, CacheExhausted> {
+        let ascii_class_count = self.ascii_class_count;
+        let cache = self.cache_mut(unanchored);
+        if threads.is_empty() {
+            return Ok(DEAD_STATE);
+        }
+        let threads = threads.into_boxed_slice();
+        if let Some(id) = cache.state_ids.get(&threads) {
+            return Ok(*id);
+        }
+        if cache.states.len() >= MAX_STATE_COUNT {
+            self.exhausted = true;
+            return Err(CacheExhausted);
+        }
+        let id = cache.states.len() as StateId;
+        cache.states.push(State::new(threads.clone(), ascii_class_count));
+        cache.state_ids.insert(threads, id);
+        Ok(id)
+    }
+
+    /// Append the threads reachable from `start` without consuming input, in
+    /// priority order. Returns true once `Match` is reached. Unless the DFA
+    /// keeps lower priority threads, this appends `MATCH_THREAD` and stops,
+    /// since no thread of lower priority can win after that. Otherwise the
+    /// caller appends it after all other threads.
+    fn add_closure(&mut self, program: &Program, start: Thread, out: &mut Vec<Thread>) -> bool {
+        let mut reached_match = false;
+        self.work_stack.clear();
+        self.work_stack.push(ClosureStep::Explore(start));
+        while let Some(step) = self.work_stack.pop() {
+            let thread = match step {
+                ClosureStep::Emit(thread) => {
+                    out.push(thread);
+                    continue;
+                }
+                ClosureStep::Explore(thread) => thread,
+            };
+            if !self.visited.insert(thread) {
+                continue;
+            }
+            let Some(instruction) = program.instructions.get(thread.pc as usize) else {
+                continue;
+            };
+            let next = thread.goto(thread.pc + 1);
+            // The work stack is LIFO, so lower priority work is pushed first.
+            match instruction {
+                Instruction::Char(_)
+                | Instruction::CharNoCase(_, _)
+                | Instruction::AnyChar { .. }
+                | Instruction::CharClass { .. }
+                | Instruction::BuiltinClass(_) => out.push(thread),
+                Instruction::Jump(target) => self.work_stack.push(ClosureStep::Explore(thread.goto(*target))),
+                Instruction::Split { prefer, other } => {
+                    self.work_stack.push(ClosureStep::Explore(thread.goto(*other)));
+                    self.work_stack.push(ClosureStep::Explore(thread.goto(*prefer)));
+                }
+                Instruction::Save(_)
+                | Instruction::ClearRegister(_)
+                | Instruction::Nop
+                | Instruction::ProgressCheck { .. } => self.work_stack.push(ClosureStep::Explore(next)),
+                Instruction::Match => {
+                    if !self.prunes_lower_priority_threads {
+                        reached_match = true;
+                        continue;
+                    }
+                    out.push(MATCH_THREAD);
+                    return true;
+                }
+                Instruction::GreedyLoop { min, max, .. } => {
+                    if thread.loop_count >= *min {
+                        self.work_stack.push(ClosureStep::Explore(next));
+                    }
+                    if max.is_none_or(|max| thread.loop_count < max) {
+                        self.work_stack.push(ClosureStep::Emit(thread));
+                    }
+                }
+                Instruction::LazyLoop { min, max, .. } => {
+                    if max.is_none_or(|max| thread.loop_count < max) {
+                        self.work_stack.push(ClosureStep::Emit(thread));
+                    }
+                    if thread.loop_count >= *min {
+                        self.work_stack.push(ClosureStep::Explore(next));
+                    }
+                }
+                Instruction::RepeatStart { counter_reg } => {
+                    let slot = self.counter_slot(*counter_reg);
+                    self.work_stack.push(ClosureStep::Explore(next.with_counter(slot, 0)));
+                }
+                Instruction::RepeatCheck {
+                    counter_reg,
+                    min,
+                    max,
+                    body,
+                    greedy,
+                } => {
+                    let slot = self.counter_slot(*counter_reg);
+                    let count = thread.counter(slot);
+                    let repeat = thread.goto(*body).with_counter(slot, count + 1);
+                    if count < *min {
+                        self.work_stack.push(ClosureStep::Explore(repeat));
+                    } else if max.is_some_and(|max| count >= max) {
+                        self.work_stack.push(ClosureStep::Explore(next));
+                    } else if *greedy {
+                        self.work_stack.push(ClosureStep::Explore(next));
+                        self.work_stack.push(ClosureStep::Explore(repeat));
+                    } else {
+                        self.work_stack.push(ClosureStep::Explore(repeat));
+                        self.work_stack.push(ClosureStep::Explore(next));
+                    }
+                }
+                _ => {}
+            }
+        }
+        reached_match
+    }
+
+    fn counter_slot(&self, counter_register: u32) -> usize {
+        self.counter_registers
+            .iter()
+            .position(|register| *register == counter_register)
+            .expect("RepeatStart counters are collected up front")
+    }
+}
+
+impl StateCache {
+    fn new(ascii_class_count: usize) -> Self {
+        Self {
+            states: vec![State::new(Box::new([]), ascii_class_count)],
+            state_ids: HashMap::new(),
+            non_ascii_transitions: HashMap::new(),
+            start_state: DEAD_STATE,
+        }
+    }
+}
+
+impl State {
+    fn new(threads: Box<[Thread]>, ascii_class_count: usize) -> Self {
+        let is_match = threads.last() == Some(&MATCH_THREAD);
+        // Nothing can follow the dead state, so its transitions are known up front.
+        let initial_transition = if threads.is_empty() { DEAD_STATE } else { UNKNOWN_STATE };
+        Self {
+            threads,
+            is_match,
+            ascii_transitions: vec![initial_transition; ascii_class_count].into_boxed_slice(),
+        }
+    }
+}
+
+/// Consume `cp` on a thread that is waiting for input, returning the thread to
+/// continue from.
+fn step_thread(program: &Program, thread: Thread, cp: u32) -> Option<Thread> {
+    let instruction = &program.instructions[thread.pc as usize];
+    if !instruction_accepts(program, instruction, cp)? {
+        return None;
+    }
+    match instruction {
+        Instruction::GreedyLoop { min, max, .. } | Instruction::LazyLoop { min, max, .. } => {
+            // Once the minimum is reached, an unbounded loop behaves the same
+            // regardless of how many more iterations it has done.
+            let saturation = max.unwrap_or(*min);
+            Some(Thread {
+                loop_count: (thread.loop_count + 1).min(saturation),
+                ..thread
+            })
+        }
+        _ => Some(thread.goto(thread.pc + 1)),
+    }
+}
+
+/// Whether an instruction that consumes input accepts `cp`, or `None` if it
+/// doesn't consume input.
+fn instruction_accepts(program: &Program, instruction: &Instruction, cp: u32) -> Option<bool> {
+    let ignore_case = program.ignore_case;
+    let accepts = match instruction {
+        Instruction::Char(c) => {
+            if ignore_case {
+                case_fold_eq(cp, *c, false)
+            } else {
+                cp == *c
+            }
+        }
+        Instruction::CharNoCase(lo, _hi) => case_fold_eq(cp, *lo, false),
+        Instruction::AnyChar { dot_all } => *dot_all || program.dot_all || !is_line_terminator(cp),
+        Instruction::CharClass { ranges, negated } => {
+            match_char_class(cp, ranges, ignore_case, false, false) != *negated
+        }
+        Instruction::BuiltinClass(class) => match_builtin_class(cp, *class, false),
+        Instruction::GreedyLoop { matcher, .. } | Instruction::LazyLoop { matcher, .. } => {
+            simple_match_matches(program, matcher, cp)
+        }
+        _ => return None,
+    };
+    Some(accepts)
+}
+
+/// Group the ASCII code units into classes whose members are accepted by the
+/// same instructions, and so always lead to the same state.
+fn compute_ascii_classes(program: &Program) -> ([u8; 128], usize) {
+    let mut classes = [0u8; 128];
+    let mut class_ids: HashMap<Vec<bool>, u8> = HashMap::new();
+    for cp in 0..128u32 {
+        let signature: Vec<bool> = program
+            .instructions
+            .iter()
+            .filter_map(|instruction| instruction_accepts(program, instruction, cp))
+            .collect();
+        let next_id = class_ids.len() as u8;
+        classes[cp as usize] = *class_ids.entry(signature).or_insert(next_id);
+    }
+    (classes, class_ids.len())
+}
+
+fn is_supported_simple_match(matcher: &SimpleMatch) -> bool {
+    match matcher {
+        SimpleMatch::UnicodeProperty(_) => false,
+        SimpleMatch::Union(lhs, rhs) => is_supported_simple_match(lhs) && is_supported_simple_match(rhs),
+        _ => true,
+    }
+}
+
+fn simple_match_matches(program: &Program, matcher: &SimpleMatch, cp: u32) -> bool {
+    let ignore_case = program.ignore_case;
+    match matcher {
+        SimpleMatch::AnyChar { dot_all } => *dot_all || program.dot_all || !is_line_terminator(cp),
+        SimpleMatch::Char(c) => {
+            if ignore_case {
+                case_fold_eq(cp, *c, false)
+            } else {
+                cp == *c
+            }
+        }
+        SimpleMatch::CharNoCase(lo, _hi) => case_fold_eq(cp, *lo, false),
+        SimpleMatch::CharClass { ranges, negated } => {
+            match_char_class(cp, ranges, ignore_case, false, false) != *negated
+        }
+        SimpleMatch::BuiltinClass(class) => match_builtin_class(cp, *class, false),
+        SimpleMatch::UnicodeProperty(_) => false,
+        SimpleMatch::Union(lhs, rhs) => {
+            simple_match_matches(program, lhs, cp) || simple_match_matches(program, rhs, cp)
+        }
+    }
+}
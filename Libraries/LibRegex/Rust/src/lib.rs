@@ -11,6 +11,7 @@ mod rust_allocator;
 pub mod ast;
 pub mod bytecode;
 pub mod compiler;
+pub mod dfa;
 pub mod ffi;
 pub mod parser;
 pub mod regex;
@@ -11,15 +11,20 @@ use crate::ast::Alternative;
 use crate::ast::Atom;
 use crate::ast::Disjunction;
 use crate::ast::Flags;
+use crate::ast::Group;
+use crate::ast::ModifierGroup;
+use crate::ast::NonCapturingGroup;
 use crate::ast::Pattern;
 use crate::ast::Term;
 use crate::bytecode::Instruction;
 use crate::bytecode::NamedGroupEntry;
 use crate::bytecode::append_code_point_wtf16;
 use crate::compiler;
+use crate::dfa;
 use crate::parser;
 use crate::vm;
 use std::cell::RefCell;
+use std::cell::RefMut;
 use std::collections::HashSet;
 
 /// A compiled regular expression.
@@ -37,6 +42,32 @@ pub struct Regex {
     literal_alt_u16: Option<Vec<Vec<u16>>>,
     /// Cached VM scratch space for reuse across exec calls.
     scratch: RefCell<vm::VmScratch>,
+    /// DFA that locates matches without backtracking, for patterns that
+    /// have no backreferences, lookaround or assertions.
+    dfa: Option<RefCell<DfaSlot>>,
+}
+
+/// The DFA of a pattern that can use one. It is built on the first exec that
+/// uses it, since that compiles the reversed pattern, and most `RegExp`
+/// objects are executed rarely or never.
+enum DfaSlot {
+    Unbuilt {
+        parsed: Box<Pattern>,
+        bounds: dfa::MatchBounds,
+    },
+    Built(dfa::LazyDfa),
+    /// The reversed pattern turned out to need something the DFA cannot model.
+    Unavailable,
+}
+
+impl DfaSlot {
+    fn reports_match_end(&self) -> bool {
+        match self {
+            Self::Unbuilt { bounds, .. } => *bounds == dfa::MatchBounds::StartAndEnd,
+            Self::Built(dfa) => dfa.reports_match_end(),
+            Self::Unavailable => false,
+        }
+    }
 }
 
 impl Regex {
@@ -61,6 +92,19 @@ impl Regex {
         let word_boundary_literal_u16 = extract_word_boundary_literal_u16(&parsed, flags);
         let literal_alt_u16 = extract_literal_alternatives_u16(&parsed, flags);
 
+        // Sticky patterns only match at one position, and simple scans are
+        // linear already.
+        let dfa = if flags.sticky || hints.uses_simple_scan() {
+            None
+        } else {
+            dfa::supports(&program).map(|bounds| {
+                RefCell::new(DfaSlot::Unbuilt {
+                    parsed: Box::new(parsed),
+                    bounds,
+                })
+            })
+        };
+
         Ok(Self {
             program,
             flags,
@@ -69,9 +113,29 @@ impl Regex {
             word_boundary_literal_u16,
             literal_alt_u16,
             scratch: RefCell::new(vm::VmScratch::new()),
+            dfa,
         })
     }
 
+    /// The DFA, built now if this is the first exec to use it. Returns `None`
+    /// if the pattern cannot use one.
+    fn lazy_dfa(&self) -> Option<RefMut<'_, dfa::LazyDfa>> {
+        let mut slot = self.dfa.as_ref()?.borrow_mut();
+        if let DfaSlot::Unbuilt { parsed, .. } = &*slot {
+            let mut reverse_program = compiler::compile(&reverse_pattern(parsed));
+            Self::resolve_properties(&mut reverse_program);
+            *slot = match dfa::LazyDfa::new(&self.program, reverse_program) {
+                Some(dfa) => DfaSlot::Built(dfa),
+                None => DfaSlot::Unavailable,
+            };
+        }
+        RefMut::filter_map(slot, |slot| match slot {
+            DfaSlot::Built(dfa) => Some(dfa),
+            DfaSlot::Unbuilt { .. } | DfaSlot::Unavailable => None,
+        })
+        .ok()
+    }
+
     /// Execute the regex, writing captures directly into a provided buffer.
     /// Returns a VmResult indicating match, no-match, or limit exceeded.
     /// The buffer should have `(capture_count + 1) * 2` i32 slots.
@@ -114,10 +178,44 @@ impl Regex {
                 vm::VmResult::NoMatch
             };
         }
+        if let Some(result) = self.exec_into_with_dfa(input, start, out) {
+            return result;
+        }
         let scratch = &mut *self.scratch.borrow_mut();
         vm::execute_into_with_scratch(&self.program, input, start, &self.hints, out, scratch)
     }
 
+    /// Locate the match with the DFA, and only run the VM at its start to fill
+    /// in capture groups. Returns `None` if there is no DFA or it gave up.
+    fn exec_into_with_dfa<I: vm::Input>(&self, input: I, start: usize, out: &mut [i32]) -> Option<vm::VmResult> {
+        if self.dfa.is_none() {
+            return None;
+        }
+        if vm::fails_literal_hints(input, start, &self.hints) {
+            return Some(vm::VmResult::NoMatch);
+        }
+        let Some(found) = self.lazy_dfa()?.find(&self.program, input, start).ok()? else {
+            return Some(vm::VmResult::NoMatch);
+        };
+        if let Some(end) = found.end
+            && self.program.capture_count == 0
+            && out.len() >= 2
+        {
+            out[0] = found.start as i32;
+            out[1] = end as i32;
+            return Some(vm::VmResult::Match);
+        }
+        let scratch = &mut *self.scratch.borrow_mut();
+        Some(vm::execute_anchored_into_with_scratch(
+            &self.program,
+            input,
+            found.start,
+            &self.hints,
+            out,
+            scratch,
+        ))
+    }
+
     /// Test whether the regex matches anywhere in the input.
     pub fn test(&self, input: &[u16], start: usize) -> vm::VmResult {
         self.test_input(input, start)
@@ -156,6 +254,18 @@ impl Regex {
                 vm::VmResult::NoMatch
             };
         }
+        if self.dfa.is_some() {
+            if vm::fails_literal_hints(input, start, &self.hints) {
+                return vm::VmResult::NoMatch;
+            }
+            if let Some(Ok(matched)) = self.lazy_dfa().map(|mut dfa| dfa.is_match(&self.program, input, start)) {
+                return if matched {
+                    vm::VmResult::Match
+                } else {
+                    vm::VmResult::NoMatch
+                };
+            }
+        }
         // Reuse cached scratch space for the VM. Only need group 0 for test().
         let mut out = [-1i32; 2];
         let scratch = &mut *self.scratch.borrow_mut();
@@ -556,6 +666,19 @@ impl Regex {
         if let Some(ref alts) = self.literal_alt_u16 {
             return Self::literal_alt_find_all(input, start, alts, &self.flags, result_buf);
         }
+        if let Some(dfa) = &self.dfa
+            && dfa.borrow().reports_match_end()
+        {
+            if vm::fails_literal_hints(input, start, &self.hints) {
+                return 0;
+            }
+            if let Some(Ok(count)) = self
+                .lazy_dfa()
+                .map(|mut dfa| dfa.find_all(&self.program, input, start, result_buf))
+            {
+                return count;
+            }
+        }
         // Use the VM-internal find_all loop which reuses a single VM across matches.
         let scratch = &mut *self.scratch.borrow_mut();
         vm::find_all_with_scratch(&self.program, input, start, &self.hints, result_buf, scratch)
@@ -960,6 +1083,54 @@ fn atom_can_match_empty(atom: &Atom) -> bool {
     }
 }
 
+/// The pattern that matches the reverse of every string the given pattern
+/// matches, for the DFA that finds where a match starts. Lookbehind would
+/// become lookahead and the other way around, but patterns with lookaround
+/// never use the DFA.
+fn reverse_pattern(pattern: &Pattern) -> Pattern {
+    Pattern {
+        disjunction: reverse_disjunction(&pattern.disjunction),
+        ..pattern.clone()
+    }
+}
+
+fn reverse_disjunction(disjunction: &Disjunction) -> Disjunction {
+    Disjunction {
+        alternatives: disjunction.alternatives.iter().map(reverse_alternative).collect(),
+    }
+}
+
+fn reverse_alternative(alternative: &Alternative) -> Alternative {
+    Alternative {
+        terms: alternative
+            .terms
+            .iter()
+            .rev()
+            .map(|term| Term {
+                atom: reverse_atom(&term.atom),
+                quantifier: term.quantifier.clone(),
+            })
+            .collect(),
+    }
+}
+
+fn reverse_atom(atom: &Atom) -> Atom {
+    match atom {
+        Atom::Group(group) => Atom::Group(Group {
+            body: reverse_disjunction(&group.body),
+            ..group.clone()
+        }),
+        Atom::NonCapturingGroup(group) => Atom::NonCapturingGroup(NonCapturingGroup {
+            body: reverse_disjunction(&group.body),
+        }),
+        Atom::ModifierGroup(group) => Atom::ModifierGroup(ModifierGroup {
+            body: reverse_disjunction(&group.body),
+            ..group.clone()
+        }),
+        _ => atom.clone(),
+    }
+}
+
 fn extract_literal_u16(pattern: &Pattern, flags: Flags) -> Option<Vec<u16>> {
     if flags.ignore_case && (flags.unicode || flags.unicode_sets) {
         return None;
@@ -380,6 +380,12 @@ fn fails_required_literal_hint<I: Input>(input: I, start: usize, hints: &Pattern
     !matched
 }
 
+/// Whether the literal hints alone rule out a match at or after `start`.
+#[inline(always)]
+pub(crate) fn fails_literal_hints<I: Input>(input: I, start: usize, hints: &PatternHints) -> bool {
+    fails_trailing_literal_hint(input, hints) || fails_required_literal_hint(input, start, hints)
+}
+
 // Detect a leading input-start assertion even when it is wrapped in the
 // non-consuming setup instructions emitted for captures or lookahead.
 #[inline(always)]
@@ -989,6 +995,13 @@ pub struct PatternHints {
     can_match_empty: bool,
 }
 
+impl PatternHints {
+    /// Whether the pattern is a single matcher that is scanned without the VM.
+    pub(crate) fn uses_simple_scan(&self) -> bool {
+        self.simple_scan.is_some()
+    }
+}
+
 pub(crate) struct RequiredLiteralHint {
     pub literal: Vec<u16>,
     pub ascii_case_insensitive: bool,
@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Array.h>
 #include <AK/Checked.h>
 #include <AK/ScopeGuard.h>
 #include <LibCore/EventLoop.h>
@@ -35,20 +36,76 @@ static Optional<Core::ImmutableBytes> map_body_file(int fd, u64 offset, u64 size
     return payload.release_value();
 }
 
-ErrorOr<NonnullOwnPtr<ReadStream>> ReadStream::create(int reader_fd)
+ErrorOr<NonnullOwnPtr<ReadStream>> ReadStream::create(int reader_fd, Optional<Core::SharedByteRing> body_ring)
 {
 #if defined(AK_OS_WINDOWS)
     auto local_socket = TRY(Core::LocalSocket::adopt_fd(reader_fd));
     auto notifier = local_socket->notifier();
     VERIFY(notifier);
-    return adopt_own(*new ReadStream(move(local_socket), notifier.release_nonnull()));
+    return adopt_own(*new ReadStream(reader_fd, move(local_socket), notifier.release_nonnull(), move(body_ring)));
 #else
     auto file = TRY(Core::File::adopt_fd(reader_fd, Core::File::OpenMode::Read));
     auto notifier = Core::Notifier::construct(reader_fd, Core::Notifier::Type::Read);
-    return adopt_own(*new ReadStream(move(file), move(notifier)));
+    return adopt_own(*new ReadStream(reader_fd, move(file), move(notifier), move(body_ring)));
 #endif
 }
 
+bool ReadStream::is_eof() const
+{
+    // RequestServer closes its end as soon as it has written the whole body, which may still be waiting in the ring.
+    return m_stream->is_eof() && !has_unread_bytes_in_body_ring();
+}
+
+ErrorOr<ReadonlyBytes> ReadStream::read_some(Bytes bytes)
+{
+    if (!m_body_ring.has_value()) {
+        ReadonlyBytes read_bytes = TRY(m_stream->read_some(bytes));
+        return read_bytes;
+    }
+
+    auto unread_bytes = TRY(m_body_ring->peek_some_contiguous());
+    if (unread_bytes.is_empty()) {
+        // We've caught up with RequestServer, so have it wake us up when it writes more. Anything it wrote before
+        // seeing that is picked up right away.
+        TRY(discard_wake_ups());
+        m_body_ring->did_wake_reader();
+        unread_bytes = TRY(m_body_ring->peek_some_contiguous());
+    }
+
+    return unread_bytes.trim(bytes.size());
+}
+
+void ReadStream::consume(size_t byte_count)
+{
+    if (!m_body_ring.has_value() || !m_body_ring->consume(byte_count))
+        return;
+
+    // RequestServer ran out of space in the ring, and is waiting for us to make some. If it went away in the meantime,
+    // there is nobody left to wake up.
+    static constexpr u8 wake_up = 0;
+    (void)Core::System::send(m_fd, { &wake_up, sizeof(wake_up) }, MSG_NOSIGNAL);
+}
+
+ErrorOr<void> ReadStream::discard_wake_ups()
+{
+    Array<u8, 64> wake_ups;
+
+    while (!m_stream->is_eof()) {
+        auto result = m_stream->read_some(wake_ups);
+        if (result.is_error()) {
+            if (result.error().is_errno() && result.error().code() == EINTR)
+                continue;
+            if (result.error().is_errno() && first_is_one_of(result.error().code(), EAGAIN, EWOULDBLOCK))
+                return {};
+            return result.release_error();
+        }
+        if (result.value().size() < wake_ups.size())
+            return {};
+    }
+
+    return {};
+}
+
 Request::Request(RequestClient& client, u64 request_id)
     : m_client(client)
     , m_request_id(request_id)
@@ -86,8 +143,20 @@ bool Request::stop()
 void Request::set_body_delivery_paused(bool paused)
 {
     m_body_delivery_paused = paused;
-    if (m_internal_stream_data && m_internal_stream_data->read_notifier)
-        m_internal_stream_data->read_notifier->set_enabled(!m_body_delivery_paused);
+    if (!m_internal_stream_data || !m_internal_stream_data->read_notifier)
+        return;
+
+    m_internal_stream_data->read_notifier->set_enabled(!m_body_delivery_paused);
+
+    if (!paused && m_internal_stream_data->read_stream && m_internal_stream_data->read_stream->has_unread_bytes_in_body_ring()) {
+        Core::deferred_invoke([weak_this = make_weak_ptr()] {
+            auto self = weak_this.strong_ref();
+            if (!self || self->m_body_delivery_paused || !self->m_internal_stream_data)
+                return;
+            if (auto& on_activation = self->m_internal_stream_data->read_notifier->on_activation)
+                on_activation();
+        });
+    }
 }
 
 void Request::resume_body_delivery()
@@ -117,11 +186,19 @@ bool Request::has_file_backed_response_body() const
     return m_internal_stream_data && m_internal_stream_data->file_backed_payload.has_value();
 }
 
-void Request::set_request_fd(Badge<Requests::RequestClient>, int fd)
+void Request::set_request_fd(Badge<Requests::RequestClient>, int fd, Core::AnonymousBuffer body_ring)
 {
     VERIFY(m_fd == -1);
     m_fd = fd;
 
+    if (body_ring.is_valid()) {
+        auto ring = Core::SharedByteRing::adopt(move(body_ring));
+        if (ring.is_error())
+            dbgln("Request: Received invalid response body ring: {}", ring.error());
+        else
+            m_body_ring = ring.release_value();
+    }
+
     if (m_internal_stream_data)
         attach_read_stream();
 }
@@ -132,7 +209,7 @@ void Request::attach_read_stream()
     if (m_fd == -1 || m_fd_is_owned_by_read_stream)
         return;
 
-    auto read_stream = MUST(ReadStream::create(m_fd));
+    auto read_stream = MUST(ReadStream::create(m_fd, move(m_body_ring)));
     m_fd_is_owned_by_read_stream = true;
     auto notifier = read_stream->notifier();
     notifier->on_activation = move(m_internal_stream_data->read_notifier->on_activation);
@@ -362,6 +439,7 @@ void Request::set_up_internal_stream_data(DataReceived on_data_available)
             m_internal_stream_data->on_data_available(ResponseData::from_bytes(read_bytes));
             if (!m_internal_stream_data)
                 return;
+            m_internal_stream_data->read_stream->consume(read_bytes.size());
 
             if (m_internal_stream_data->body_delivery_remaining_byte_count.has_value()) {
                 if (read_bytes.size() >= *m_internal_stream_data->body_delivery_remaining_byte_count) {
@@ -15,6 +15,7 @@
 #include <AK/WeakPtr.h>
 #include <LibCore/ImmutableBytes.h>
 #include <LibCore/Notifier.h>
+#include <LibCore/SharedByteRing.h>
 #include <LibHTTP/HeaderList.h>
 #include <LibRequests/CameFromCache.h>
 #include <LibRequests/NetworkError.h>
@@ -52,25 +53,40 @@ private:
     Optional<Core::ImmutableBytes> m_immutable_bytes;
 };
 
+// Reads a response body from RequestServer. The body either arrives through the reader fd itself, or through a ring in
+// shared memory, in which case the reader fd only carries wake-ups.
 class ReadStream {
 public:
-    static ErrorOr<NonnullOwnPtr<ReadStream>> create(int reader_fd);
+    static ErrorOr<NonnullOwnPtr<ReadStream>> create(int reader_fd, Optional<Core::SharedByteRing> body_ring = {});
 
     NonnullRefPtr<Core::Notifier> const& notifier() const { return m_notifier; }
 
-    bool is_eof() const { return m_stream->is_eof(); }
+    bool is_eof() const;
 
-    ErrorOr<Bytes> read_some(Bytes bytes) { return m_stream->read_some(bytes); }
+    // Bytes from the body ring are not copied into the buffer. The returned bytes point into the ring instead, and are
+    // only valid until they are consumed.
+    ErrorOr<ReadonlyBytes> read_some(Bytes);
+    void consume(size_t byte_count);
+
+    // Bytes may be left in the body ring without a wake-up on the reader fd to tell us about them, e.g. after body
+    // delivery was paused.
+    bool has_unread_bytes_in_body_ring() const { return m_body_ring.has_value() && !m_body_ring->is_empty(); }
 
 private:
-    ReadStream(NonnullOwnPtr<Stream> stream, NonnullRefPtr<Core::Notifier> notifier)
-        : m_stream(move(stream))
+    ReadStream(int fd, NonnullOwnPtr<Stream> stream, NonnullRefPtr<Core::Notifier> notifier, Optional<Core::SharedByteRing> body_ring)
+        : m_fd(fd)
+        , m_stream(move(stream))
         , m_notifier(move(notifier))
+        , m_body_ring(move(body_ring))
     {
     }
 
+    ErrorOr<void> discard_wake_ups();
+
+    int m_fd { -1 };
     NonnullOwnPtr<Stream> m_stream;
     NonnullRefPtr<Core::Notifier> m_notifier;
+    Optional<Core::SharedByteRing> m_body_ring;
 };
 
 class Request : public RefCounted<Request>
@@ -123,7 +139,7 @@ public:
     void did_transfer(Badge<RequestClient>);
 
     RefPtr<Core::Notifier>& write_notifier(Badge<RequestClient>) { return m_write_notifier; }
-    void set_request_fd(Badge<RequestClient>, int fd);
+    void set_request_fd(Badge<RequestClient>, int fd, Core::AnonymousBuffer body_ring);
     void set_request_body_file(Badge<RequestClient>, int fd, u64 offset, u64 size);
     void set_request_cached_body_file(Badge<RequestClient>, int fd, u64 offset, u64 size);
 
@@ -138,6 +154,7 @@ private:
     u64 m_request_id { 0 };
     RefPtr<Core::Notifier> m_write_notifier;
     int m_fd { -1 };
+    Optional<Core::SharedByteRing> m_body_ring;
     bool m_fd_is_owned_by_read_stream { false };
 
     enum class Mode {
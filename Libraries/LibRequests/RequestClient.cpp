@@ -187,7 +187,7 @@ void RequestClient::removed_cache_entries(u64 clear_cache_request_id)
         (*promise)->resolve({});
 }
 
-void RequestClient::request_started(u64 request_id, IPC::File response_file)
+void RequestClient::request_started(u64 request_id, IPC::File response_file, Core::AnonymousBuffer body_ring)
 {
     auto request = m_requests.get(request_id);
     if (!request.has_value()) {
@@ -196,7 +196,7 @@ void RequestClient::request_started(u64 request_id, IPC::File response_file)
     }
 
     auto response_fd = response_file.take_fd();
-    request.value()->set_request_fd({}, response_fd);
+    request.value()->set_request_fd({}, response_fd, move(body_ring));
 }
 
 void RequestClient::request_body_file_available(u64 request_id, IPC::File response_file, u64 offset, u64 size)
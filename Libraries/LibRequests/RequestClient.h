@@ -68,7 +68,7 @@ public:
 private:
     virtual void die() override;
 
-    virtual void request_started(u64 request_id, IPC::File) override;
+    virtual void request_started(u64 request_id, IPC::File, Core::AnonymousBuffer) override;
     virtual void request_body_file_available(u64 request_id, IPC::File, u64 offset, u64 size) override;
     virtual void request_cached_body_file_available(u64 request_id, IPC::File, u64 offset, u64 size) override;
     virtual void request_finished(u64 request_id, u64, RequestTimingInfo, Optional<NetworkError>) override;
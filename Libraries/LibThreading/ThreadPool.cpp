@@ -4,16 +4,31 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Optional.h>
 #include <AK/Time.h>
 #include <AK/kmalloc.h>
+#include <LibCore/System.h>
 #include <LibThreading/ThreadPool.h>
 
-static constexpr size_t THREAD_COUNT = 4;
+static constexpr size_t MIN_THREAD_COUNT = 2;
+static constexpr size_t MAX_THREAD_COUNT = 16;
 static constexpr size_t THREAD_STACK_SIZE = 8 * MiB;
 static constexpr auto THREAD_IDLE_MEMORY_COLLECTION_DELAY = AK::Duration::from_seconds(1);
 
 namespace Threading {
 
+static thread_local Optional<size_t> s_current_worker_index;
+
+bool ThreadPool::Task::cancel()
+{
+    auto expected = State::Queued;
+    if (!m_state.compare_exchange_strong(expected, State::Cancelled))
+        return false;
+    // The worker that dequeues us will see the Cancelled state and never touch the function.
+    m_function = nullptr;
+    return true;
+}
+
 ThreadPool& ThreadPool::the()
 {
     static ThreadPool* instance = new ThreadPool;
@@ -22,56 +37,114 @@ ThreadPool& ThreadPool::the()
 
 ThreadPool::ThreadPool()
 {
-    for (size_t i = 0; i < THREAD_COUNT; ++i) {
+    // Leave a core for the thread that is submitting work.
+    auto hardware_concurrency = static_cast<size_t>(Core::System::hardware_concurrency());
+    auto thread_count = clamp(hardware_concurrency > 1 ? hardware_concurrency - 1 : 1, MIN_THREAD_COUNT, MAX_THREAD_COUNT);
+
+    for (size_t i = 0; i < thread_count; ++i)
+        m_workers.append(make<Worker>());
+
+    for (size_t i = 0; i < thread_count; ++i) {
         auto name = ByteString::formatted("Pool/{}", i);
-        auto thread = Thread::construct(name, [this]() -> intptr_t {
-            return worker_thread_func();
+        auto thread = Thread::construct(name, [this, i]() -> intptr_t {
+            return worker_thread_func(i);
         });
         thread->set_stack_size(THREAD_STACK_SIZE);
         thread->start();
-        m_threads.append(move(thread));
+        m_workers[i]->thread = move(thread);
+    }
+}
+
+RefPtr<ThreadPool::Task> ThreadPool::take_task_from(Worker& worker, size_t priority)
+{
+    Sync::MutexLocker locker(worker.mutex);
+    auto& queue = worker.queues[priority];
+    if (queue.is_empty())
+        return nullptr;
+    m_queued_task_counts[priority].fetch_sub(1);
+    return queue.dequeue();
+}
+
+RefPtr<ThreadPool::Task> ThreadPool::take_task(size_t worker_index)
+{
+    for (size_t priority = 0; priority < priority_count; ++priority) {
+        if (m_queued_task_counts[priority].load() == 0)
+            continue;
+        for (size_t i = 0; i < m_workers.size(); ++i) {
+            auto& worker = *m_workers[(worker_index + i) % m_workers.size()];
+            if (auto task = take_task_from(worker, priority))
+                return task;
+        }
     }
+    return nullptr;
 }
 
-intptr_t ThreadPool::worker_thread_func()
+intptr_t ThreadPool::worker_thread_func(size_t worker_index)
 {
+    s_current_worker_index = worker_index;
     bool collected_since_last_work = false;
 
+    auto has_queued_tasks = [this] {
+        for (auto const& count : m_queued_task_counts) {
+            if (count.load() > 0)
+                return true;
+        }
+        return false;
+    };
+
     while (true) {
-        Function<void()> work;
-        bool should_collect = false;
-        {
-            Sync::MutexLocker locker(m_mutex);
-
-            while (m_work_queue.is_empty()) {
-                if (collected_since_last_work) {
-                    m_condition.wait();
-                } else if (!m_condition.wait_for(THREAD_IDLE_MEMORY_COLLECTION_DELAY) && m_work_queue.is_empty()) {
-                    should_collect = true;
-                    break;
+        auto task = take_task(worker_index);
+        if (!task) {
+            bool should_collect = false;
+            {
+                Sync::MutexLocker locker(m_park_mutex);
+                while (!has_queued_tasks()) {
+                    if (collected_since_last_work) {
+                        m_park_condition.wait();
+                    } else if (!m_park_condition.wait_for(THREAD_IDLE_MEMORY_COLLECTION_DELAY) && !has_queued_tasks()) {
+                        should_collect = true;
+                        break;
+                    }
                 }
             }
 
-            if (!should_collect)
-                work = m_work_queue.dequeue();
+            if (should_collect) {
+                ak_kmalloc_collect();
+                collected_since_last_work = true;
+            }
+            continue;
         }
 
-        if (should_collect) {
-            ak_kmalloc_collect();
-            collected_since_last_work = true;
+        auto expected = Task::State::Queued;
+        if (!task->m_state.compare_exchange_strong(expected, Task::State::Running))
             continue;
-        }
 
         collected_since_last_work = false;
-        work();
+        task->m_function();
+        task->m_function = nullptr;
     }
 }
 
-void ThreadPool::submit(Function<void()> work)
+NonnullRefPtr<ThreadPool::Task> ThreadPool::submit(Function<void()> work, Priority priority)
 {
-    Sync::MutexLocker locker(m_mutex);
-    m_work_queue.enqueue(move(work));
-    m_condition.signal();
+    auto task = adopt_ref(*new Task(move(work)));
+    auto priority_index = to_underlying(priority);
+
+    // Work submitted from a pool thread stays on that thread's queues; everything else is spread round-robin.
+    auto worker_index = s_current_worker_index.has_value()
+        ? s_current_worker_index.value()
+        : m_next_worker_for_external_submit.fetch_add(1) % m_workers.size();
+
+    {
+        auto& worker = *m_workers[worker_index];
+        Sync::MutexLocker locker(worker.mutex);
+        worker.queues[priority_index].enqueue(task);
+        m_queued_task_counts[priority_index].fetch_add(1);
+    }
+
+    Sync::MutexLocker locker(m_park_mutex);
+    m_park_condition.signal();
+    return task;
 }
 
 }
@@ -6,7 +6,11 @@
 
 #pragma once
 
+#include <AK/Array.h>
+#include <AK/Atomic.h>
+#include <AK/AtomicRefCounted.h>
 #include <AK/Function.h>
+#include <AK/NonnullOwnPtr.h>
 #include <AK/Queue.h>
 #include <AK/Vector.h>
 #include <LibSync/ConditionVariable.h>
@@ -17,19 +21,71 @@ namespace Threading {
 
 class ThreadPool {
 public:
+    // Tasks of a higher priority class always run before queued tasks of a lower one, on any worker.
+    enum class Priority : u8 {
+        // Something the user is waiting on right now, e.g. a font that blocks rendering.
+        UserBlocking,
+        // Work whose result will be visible soon, e.g. compiling a script for a page that is loading.
+        UserVisible,
+        // Work nobody is waiting on, e.g. optimizing a Wasm module that can already run.
+        Background,
+    };
+    static constexpr size_t priority_count = 3;
+
+    class Task : public AtomicRefCounted<Task> {
+    public:
+        // Returns true if the task had not started yet and now never will. Its function is destroyed on the calling
+        // thread in that case.
+        bool cancel();
+
+        bool is_cancelled() const { return m_state.load() == State::Cancelled; }
+
+    private:
+        friend class ThreadPool;
+
+        enum class State : u8 {
+            Queued,
+            Running,
+            Cancelled,
+        };
+
+        explicit Task(Function<void()> function)
+            : m_function(move(function))
+        {
+        }
+
+        Function<void()> m_function;
+        Atomic<State> m_state { State::Queued };
+    };
+
     static ThreadPool& the();
 
-    void submit(Function<void()>);
+    size_t thread_count() const { return m_workers.size(); }
+
+    NonnullRefPtr<Task> submit(Function<void()>, Priority = Priority::UserVisible);
 
 private:
     ThreadPool();
 
-    intptr_t worker_thread_func();
+    // Each worker owns one queue per priority class. Workers take from their own queues first and steal from the
+    // other workers' queues when those are empty.
+    struct Worker {
+        Sync::Mutex mutex;
+        Array<Queue<NonnullRefPtr<Task>>, priority_count> queues;
+        RefPtr<Thread> thread;
+    };
+
+    intptr_t worker_thread_func(size_t worker_index);
+    RefPtr<Task> take_task(size_t worker_index);
+    RefPtr<Task> take_task_from(Worker&, size_t priority);
+
+    Vector<NonnullOwnPtr<Worker>> m_workers;
+    Array<Atomic<size_t>, priority_count> m_queued_task_counts {};
+    Atomic<size_t> m_next_worker_for_external_submit { 0 };
 
-    Sync::Mutex m_mutex;
-    Sync::ConditionVariable m_condition { m_mutex };
-    Queue<Function<void()>> m_work_queue;
-    Vector<NonnullRefPtr<Thread>> m_threads;
+    // Idle workers park here until a task is submitted.
+    Sync::Mutex m_park_mutex;
+    Sync::ConditionVariable m_park_condition { m_park_mutex };
 };
 
 }
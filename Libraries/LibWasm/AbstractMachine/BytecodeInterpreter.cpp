@@ -6969,6 +6969,13 @@ CompiledInstructions try_compile_instructions(Expression const& expression, Span
             // we can't zero reference-typed locals without potentially dropping a live reference, so reject those callees.
             if (local.type().is_reference())
                 return nullptr;
+            // Inlined locals are all typed as i64 for the compiled tier, which can't hold a v128.
+            if (local.type().kind() == ValueType::V128)
+                return nullptr;
+        }
+        for (auto const& parameter : functions[func_index].parameters()) {
+            if (parameter.kind() == ValueType::V128)
+                return nullptr;
         }
         for (auto& gi : callee->body().instructions()) {
             if (first_is_one_of(gi.opcode(),
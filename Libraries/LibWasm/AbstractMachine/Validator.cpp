@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/AnyOf.h>
 #include <AK/GenericShorthands.h>
 #include <AK/HashTable.h>
 #include <AK/SourceLocation.h>
@@ -5121,14 +5122,14 @@ ErrorOr<Validator::ExpressionTypeResult, ValidationError> Validator::validate(Ex
     if (expression.compiled_instructions.direct && !is_constant_expression) {
         bool has_unsupported_types = false;
         for (auto& type : m_context.locals) {
-            if (type.is_reference() || type.kind() == ValueType::V128) {
+            if (type.is_reference()) {
                 has_unsupported_types = true;
                 break;
             }
         }
         if (!has_unsupported_types) {
             for (auto& type : result_types) {
-                if (type.is_reference() || type.kind() == ValueType::V128) {
+                if (type.is_reference()) {
                     has_unsupported_types = true;
                     break;
                 }
@@ -5143,12 +5144,15 @@ ErrorOr<Validator::ExpressionTypeResult, ValidationError> Validator::validate(Ex
                 }
             }
         }
-        // Also skip if any call targets a function with multi-value returns.
+        // Also skip if any call targets a function with multi-value returns, or with v128 parameters (direct calls pass their arguments as i64s).
         if (!has_unsupported_types) {
             for (auto& insn : expression.instructions()) {
                 if (insn.opcode() == Instructions::call) {
                     auto func_idx = insn.arguments().get<FunctionIndex>().value();
-                    if (func_idx < m_context.functions.size() && m_context.functions[func_idx].results().size() > 1) {
+                    if (func_idx >= m_context.functions.size())
+                        continue;
+                    auto const& function = m_context.functions[func_idx];
+                    if (function.results().size() > 1 || any_of(function.parameters(), [](auto& type) { return type.kind() == ValueType::V128; })) {
                         has_unsupported_types = true;
                         break;
                     }
@@ -5164,6 +5168,35 @@ ErrorOr<Validator::ExpressionTypeResult, ValidationError> Validator::validate(Ex
             expression.compiled_instructions.cranelift_local_types.ensure_capacity(m_context.locals.size());
             for (auto& type : m_context.locals)
                 expression.compiled_instructions.cranelift_local_types.unchecked_append(to_underlying(type.kind()));
+
+            // Calls that didn't become a synthetic call or a call with record can still have their arguments passed in
+            // registers, as long as they fit in the direct call helpers: at most three scalar arguments and one result.
+            auto& compiled = expression.compiled_instructions;
+            for (size_t i = 0; i < compiled.dispatches.size(); ++i) {
+                auto const& instruction = *compiled.dispatches[i].instruction;
+                FunctionType const* callee_type = nullptr;
+                if (instruction.opcode() == Instructions::call) {
+                    auto function_index = instruction.arguments().get<FunctionIndex>().value();
+                    if (function_index < m_context.functions.size())
+                        callee_type = &m_context.functions[function_index];
+                } else if (instruction.opcode() == Instructions::call_indirect) {
+                    auto type_index = instruction.arguments().get<Instruction::IndirectCallArgs>().type.value();
+                    if (type_index < m_context.types.size() && m_context.types[type_index].is_function())
+                        callee_type = &m_context.types[type_index].function();
+                }
+                if (!callee_type || callee_type->parameters().size() > 3 || callee_type->results().size() > 1)
+                    continue;
+                if (any_of(callee_type->parameters(), [](auto& type) { return type.kind() == ValueType::V128; }))
+                    continue;
+
+                if (compiled.cranelift_register_calls.is_empty())
+                    compiled.cranelift_register_calls.resize(compiled.dispatches.size());
+                compiled.cranelift_register_calls[i] = {
+                    .parameter_count = static_cast<u8>(callee_type->parameters().size()),
+                    .result_count = static_cast<u8>(callee_type->results().size()),
+                    .is_register_call = true,
+                };
+            }
         }
     }
 
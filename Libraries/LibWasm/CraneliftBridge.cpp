@@ -259,7 +259,7 @@ static u64 compute_layout_hash(RuntimeLayout const& layout)
 }
 
 using RuntimeHelperAddresses = Array<size_t, HELPER_COUNT>;
-static_assert(HELPER_COUNT == 13);
+static_assert(HELPER_COUNT == 17);
 
 static bool apply_helper_relocs(u8* code_bytes, size_t code_size, HelperReloc const* relocs, size_t reloc_count, RuntimeHelperAddresses const& helper_addresses)
 {
@@ -535,32 +535,51 @@ i32 wasm_cl_memory_grow(void* config_ptr, u32 mem_idx, i32 pages)
     return static_cast<i32>(old_pages);
 }
 
-i32 wasm_cl_call_indirect(void* interp_ptr, void* config_ptr, i32 table_idx, i32 type_idx, i32 element_index);
-i32 wasm_cl_call_indirect(void* interp_ptr, void* config_ptr, i32 table_idx, i32 type_idx, i32 element_index)
+// Looks up the callee of a call_indirect and checks its type. Returns null after setting a trap.
+static ALWAYS_INLINE FunctionInstance* wasm_cl_resolve_indirect_callee(BytecodeInterpreter& interpreter, Configuration& config, i32 table_idx, i32 type_idx, i32 element_index, FunctionAddress& address)
 {
-    auto& interpreter = *static_cast<BytecodeInterpreter*>(interp_ptr);
-    auto& config = *static_cast<Configuration*>(config_ptr);
-
     auto const& module = config.frame().module();
     auto table_address = module.tables()[table_idx];
     auto* table_instance = config.store().get(table_address);
-    if (!table_instance || element_index < 0 || static_cast<size_t>(element_index) >= table_instance->elements().size())
-        return interpreter.set_trap(Trap::from_string("Table index out of bounds"));
+    if (!table_instance || element_index < 0 || static_cast<size_t>(element_index) >= table_instance->elements().size()) {
+        interpreter.set_trap(Trap::from_string("Table index out of bounds"));
+        return nullptr;
+    }
 
     auto& element = table_instance->elements()[element_index];
-    if (!element.ref().has<Reference::Func>())
-        return interpreter.set_trap(Trap::from_string("Table element is not a function reference"));
+    if (!element.ref().has<Reference::Func>()) {
+        interpreter.set_trap(Trap::from_string("Table element is not a function reference"));
+        return nullptr;
+    }
 
-    auto address = element.ref().get<Reference::Func>().address;
+    address = element.ref().get<Reference::Func>().address;
     auto* function = config.store().get(address);
-    if (!function)
-        return interpreter.set_trap(Trap::from_string("Indirect call to freed function"));
+    if (!function) {
+        interpreter.set_trap(Trap::from_string("Indirect call to freed function"));
+        return nullptr;
+    }
     // https://webassembly.github.io/spec/core/exec/instructions.html#xref-syntax-instructions-syntax-instr-control-mathsf-call-indirect-x-y
     // call_indirect's runtime check is a defined-type match (a downcast), not structural equality.
+    // Defined types are canonicalized, so the common case of an exact match is a pointer comparison.
     auto const* type_actual = function->visit([](auto& f) { return f.defined_type(); });
     auto const* type_expected = module.canonical_types()[type_idx];
-    if (!type_actual || !matches_defined_type(*type_actual, *type_expected))
-        return interpreter.set_trap(Trap::from_string("Indirect call type mismatch"));
+    if (type_actual != type_expected && (!type_actual || !matches_defined_type(*type_actual, *type_expected))) {
+        interpreter.set_trap(Trap::from_string("Indirect call type mismatch"));
+        return nullptr;
+    }
+    return function;
+}
+
+i32 wasm_cl_call_indirect(void* interp_ptr, void* config_ptr, i32 table_idx, i32 type_idx, i32 element_index);
+i32 wasm_cl_call_indirect(void* interp_ptr, void* config_ptr, i32 table_idx, i32 type_idx, i32 element_index)
+{
+    auto& interpreter = *static_cast<BytecodeInterpreter*>(interp_ptr);
+    auto& config = *static_cast<Configuration*>(config_ptr);
+
+    FunctionAddress address;
+    auto* function = wasm_cl_resolve_indirect_callee(interpreter, config, table_idx, type_idx, element_index, address);
+    if (!function)
+        return 1;
 
     auto const& function_type = function->visit([](auto const& value) -> FunctionType const& { return value.type(); });
     if (function_type.results().size() <= 1) {
@@ -711,6 +730,51 @@ i32 wasm_cl_direct_call_3(void* interp_ptr, void* config_ptr, i32 func_index, i6
     return wasm_cl_direct_call_impl(interpreter, config, func_index, args, 3);
 }
 
+// Indirect register calls: the arguments arrive in registers and the result leaves through the scratch slot, as for
+// the direct calls above. Once the callee's type matches the expected one, it takes exactly these arguments.
+static ALWAYS_INLINE i32 wasm_cl_call_indirect_impl(BytecodeInterpreter& interpreter, Configuration& config, i32 table_idx, i32 type_idx, i32 element_index, Value const* args, size_t arg_count)
+{
+    FunctionAddress address;
+    if (!wasm_cl_resolve_indirect_callee(interpreter, config, table_idx, type_idx, element_index, address))
+        return 1;
+    return wasm_cl_finish_call(interpreter, config, address, args, arg_count);
+}
+
+i32 wasm_cl_call_indirect_0(void* interp_ptr, void* config_ptr, i32 table_idx, i32 type_idx, i32 element_index);
+i32 wasm_cl_call_indirect_0(void* interp_ptr, void* config_ptr, i32 table_idx, i32 type_idx, i32 element_index)
+{
+    auto& interpreter = *static_cast<BytecodeInterpreter*>(interp_ptr);
+    auto& config = *static_cast<Configuration*>(config_ptr);
+    return wasm_cl_call_indirect_impl(interpreter, config, table_idx, type_idx, element_index, nullptr, 0);
+}
+
+i32 wasm_cl_call_indirect_1(void* interp_ptr, void* config_ptr, i32 table_idx, i32 type_idx, i32 element_index, i64 arg0);
+i32 wasm_cl_call_indirect_1(void* interp_ptr, void* config_ptr, i32 table_idx, i32 type_idx, i32 element_index, i64 arg0)
+{
+    auto& interpreter = *static_cast<BytecodeInterpreter*>(interp_ptr);
+    auto& config = *static_cast<Configuration*>(config_ptr);
+    Value args[] = { Value(arg0) };
+    return wasm_cl_call_indirect_impl(interpreter, config, table_idx, type_idx, element_index, args, 1);
+}
+
+i32 wasm_cl_call_indirect_2(void* interp_ptr, void* config_ptr, i32 table_idx, i32 type_idx, i32 element_index, i64 arg0, i64 arg1);
+i32 wasm_cl_call_indirect_2(void* interp_ptr, void* config_ptr, i32 table_idx, i32 type_idx, i32 element_index, i64 arg0, i64 arg1)
+{
+    auto& interpreter = *static_cast<BytecodeInterpreter*>(interp_ptr);
+    auto& config = *static_cast<Configuration*>(config_ptr);
+    Value args[] = { Value(arg0), Value(arg1) };
+    return wasm_cl_call_indirect_impl(interpreter, config, table_idx, type_idx, element_index, args, 2);
+}
+
+i32 wasm_cl_call_indirect_3(void* interp_ptr, void* config_ptr, i32 table_idx, i32 type_idx, i32 element_index, i64 arg0, i64 arg1, i64 arg2);
+i32 wasm_cl_call_indirect_3(void* interp_ptr, void* config_ptr, i32 table_idx, i32 type_idx, i32 element_index, i64 arg0, i64 arg1, i64 arg2)
+{
+    auto& interpreter = *static_cast<BytecodeInterpreter*>(interp_ptr);
+    auto& config = *static_cast<Configuration*>(config_ptr);
+    Value args[] = { Value(arg0), Value(arg1), Value(arg2) };
+    return wasm_cl_call_indirect_impl(interpreter, config, table_idx, type_idx, element_index, args, 3);
+}
+
 // Thin frame push for direct compiled-to-compiled calls. Returns 1 on trap, 0 on success.
 i32 wasm_cl_push_frame(void* interp_ptr, void* config_ptr, Value* locals_ptr, u32, void const* module_ptr, void const* expression_ptr, u32 arity, u32 max_call_rec_size);
 i32 wasm_cl_push_frame(void* interp_ptr, void* config_ptr, Value* locals_ptr, u32 /* total_locals */, void const* module_ptr, void const* expression_ptr, u32 arity, u32 max_call_rec_size)
@@ -759,6 +823,10 @@ static RuntimeHelperAddresses make_runtime_helper_addresses()
     addresses[to_underlying(HelperId::memory_copy)] = bit_cast<uintptr_t>(&wasm_cl_memory_copy);
     addresses[to_underlying(HelperId::memory_fill)] = bit_cast<uintptr_t>(&wasm_cl_memory_fill);
     addresses[to_underlying(HelperId::primitive_storage_cage_base)] = bit_cast<uintptr_t>(&js_primitive_storage_cage_base);
+    addresses[to_underlying(HelperId::call_indirect_0)] = bit_cast<uintptr_t>(&wasm_cl_call_indirect_0);
+    addresses[to_underlying(HelperId::call_indirect_1)] = bit_cast<uintptr_t>(&wasm_cl_call_indirect_1);
+    addresses[to_underlying(HelperId::call_indirect_2)] = bit_cast<uintptr_t>(&wasm_cl_call_indirect_2);
+    addresses[to_underlying(HelperId::call_indirect_3)] = bit_cast<uintptr_t>(&wasm_cl_call_indirect_3);
     return addresses;
 }
 
@@ -879,6 +947,33 @@ static CraneliftInsn serialize_insn(Dispatch const& dispatch, SourcesAndDestinat
         || opc == Instructions::memory_grow.value()) {
         auto const& mem_idx_arg = args.get<Instruction::MemoryIndexArgument>();
         out.imm1 = static_cast<i64>(mem_idx_arg.memory_index.value());
+    } else if ((opc >= Instructions::v128_load.value() && opc <= Instructions::v128_store.value())
+        || opc == Instructions::v128_load32_zero.value()
+        || opc == Instructions::v128_load64_zero.value()) {
+        auto const& mem_arg = args.get<Instruction::MemoryArgument>();
+        out.imm1 = static_cast<i64>(mem_arg.offset);
+        out.imm3 = static_cast<u32>(mem_arg.memory_index.value());
+    } else if (opc >= Instructions::v128_load8_lane.value() && opc <= Instructions::v128_store64_lane.value()) {
+        auto const& lane_arg = args.get<Instruction::MemoryAndLaneArgument>();
+        out.imm1 = static_cast<i64>(lane_arg.memory.offset);
+        out.imm2 = static_cast<i64>(lane_arg.lane);
+        out.imm3 = static_cast<u32>(lane_arg.memory.memory_index.value());
+    } else if (opc >= Instructions::i8x16_extract_lane_s.value() && opc <= Instructions::f64x2_replace_lane.value()) {
+        out.imm1 = static_cast<i64>(args.get<Instruction::LaneIndex>().lane);
+    } else if (opc == Instructions::v128_const.value()) {
+        auto const& value = args.get<u128>();
+        out.imm1 = static_cast<i64>(value.low());
+        out.imm2 = static_cast<i64>(value.high());
+    } else if (opc == Instructions::i8x16_shuffle.value()) {
+        // Pack lanes 0-7 into imm1 and lanes 8-15 into imm2, one byte per lane, lowest lane first.
+        auto const& shuffle_args = args.get<Instruction::ShuffleArgument>();
+        for (size_t i = 0; i < 16; ++i) {
+            auto const encoded = static_cast<u64>(shuffle_args.lanes[i]) << ((i % 8) * 8);
+            if (i < 8)
+                out.imm1 |= static_cast<i64>(encoded);
+            else
+                out.imm2 |= static_cast<i64>(encoded);
+        }
     }
 
     auto is_syn = [opc](OpCode op) { return opc == op.value(); };
@@ -1419,6 +1514,11 @@ bool try_cranelift_compile(CompiledInstructions& compiled, u32 result_arity)
         if (dispatches[i].instruction->opcode().value() == Instructions::synthetic_tier_up.value())
             flat.last().imm1 = static_cast<i64>(i);
 
+        if (!compiled.cranelift_register_calls.is_empty() && compiled.cranelift_register_calls[i].is_register_call) {
+            auto const& call = compiled.cranelift_register_calls[i];
+            flat.last().imm3 = REGISTER_CALL_FLAG | call.parameter_count | (static_cast<u32>(call.result_count) << 8);
+        }
+
         if (dispatches[i].instruction->opcode().value() == Instructions::br_table.value()) {
             auto const& table_args = dispatches[i].instruction->arguments().get<Instruction::TableBranchArgs>();
             auto const total = table_args.labels.size();
@@ -13,6 +13,7 @@ class Validator;
 struct ValidationError;
 struct Interpreter;
 class MemoryBuffer;
+class StreamingModuleParser;
 
 namespace Wasi {
 
@@ -1752,7 +1752,7 @@ ParseResult<SectionId> SectionId::parse(Stream& stream)
     }
 }
 
-ParseResult<NonnullRefPtr<Module>> Module::parse(Stream& stream)
+ParseResult<NonnullRefPtr<Module>> Module::parse(Stream& stream, Optional<CodeSection> parsed_code_section)
 {
     ScopeLogger<WASM_BINPARSER_DEBUG> logger("Module"sv);
     u8 buf[4];
@@ -1815,7 +1815,13 @@ ParseResult<NonnullRefPtr<Module>> Module::parse(Stream& stream)
             module.element_section() = TRY(ElementSection::parse(section_stream));
             break;
         case SectionId::SectionIdKind::Code:
-            module.code_section() = TRY(CodeSection::parse(section_stream));
+            if (parsed_code_section.has_value()) {
+                if (section_stream.discard(section_size).is_error())
+                    return with_eof_check(stream, ParseError::UnexpectedEof);
+                module.code_section() = parsed_code_section.release_value();
+            } else {
+                module.code_section() = TRY(CodeSection::parse(section_stream));
+            }
             break;
         case SectionId::SectionIdKind::Data:
             module.data_section() = TRY(DataSection::parse(section_stream));
@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/ConstrainedStream.h>
+#include <AK/LEB128.h>
+#include <AK/MemoryStream.h>
+#include <AK/ScopeGuard.h>
+#include <LibWasm/Parser/StreamingModuleParser.h>
+
+namespace Wasm {
+
+static constexpr size_t module_header_size = Module::wasm_magic.size() + Module::wasm_version.size();
+static constexpr size_t maximum_u32_leb128_size = 5;
+static constexpr u8 code_section_id = 0x0a;
+
+enum class ReadResult : u8 {
+    Read,
+    NeedMoreBytes,
+    Malformed,
+};
+
+static ReadResult read_u32(ReadonlyBytes bytes, size_t& offset, u32& value)
+{
+    FixedMemoryStream stream { bytes.slice(offset) };
+    auto value_or_error = stream.read_value<LEB128<u32>>();
+    if (value_or_error.is_error())
+        return bytes.size() - offset >= maximum_u32_leb128_size ? ReadResult::Malformed : ReadResult::NeedMoreBytes;
+
+    value = value_or_error.release_value();
+    offset += MUST(stream.tell());
+    return ReadResult::Read;
+}
+
+NonnullRefPtr<StreamingModuleParser> StreamingModuleParser::create()
+{
+    return adopt_ref(*new StreamingModuleParser);
+}
+
+NonnullRefPtr<StreamingModuleParser> StreamingModuleParser::create_from_bytes(ByteBuffer bytes)
+{
+    auto parser = adopt_ref(*new StreamingModuleParser);
+    parser->m_bytes = move(bytes);
+    parser->m_state = State::Stopped;
+    return parser;
+}
+
+ErrorOr<void> StreamingModuleParser::append(ReadonlyBytes bytes)
+{
+    TRY(m_bytes.try_append(bytes));
+    parse_available_bytes();
+    return {};
+}
+
+void StreamingModuleParser::parse_available_bytes()
+{
+    auto start = MonotonicTime::now();
+    ScopeGuard update_parse_time = [&] { m_parse_time += MonotonicTime::now() - start; };
+
+    while (true) {
+        auto available = m_bytes.bytes().slice(m_cursor);
+
+        switch (m_state) {
+        case State::Header:
+            if (available.size() < module_header_size)
+                return;
+            if (available.slice(0, 4) != Module::wasm_magic.span() || available.slice(4, 4) != Module::wasm_version.span()) {
+                m_state = State::Stopped;
+                return;
+            }
+            m_cursor += module_header_size;
+            m_state = State::SectionHeader;
+            break;
+
+        case State::SectionHeader: {
+            if (available.is_empty())
+                return;
+
+            size_t offset = 1;
+            u32 section_size = 0;
+            if (auto result = read_u32(available, offset, section_size); result != ReadResult::Read) {
+                if (result == ReadResult::Malformed)
+                    m_state = State::Stopped;
+                return;
+            }
+
+            m_cursor += offset;
+            m_section_end = m_cursor + section_size;
+            m_state = available[0] == code_section_id ? State::CodeEntryCount : State::SkippingSection;
+            break;
+        }
+
+        case State::SkippingSection:
+            if (m_bytes.size() < m_section_end)
+                return;
+            m_cursor = m_section_end;
+            m_state = State::SectionHeader;
+            break;
+
+        case State::CodeEntryCount: {
+            size_t offset = 0;
+            if (auto result = read_u32(available, offset, m_code_entry_count); result != ReadResult::Read) {
+                if (result == ReadResult::Malformed)
+                    m_state = State::Stopped;
+                return;
+            }
+
+            m_cursor += offset;
+            m_state = State::CodeEntry;
+            break;
+        }
+
+        case State::CodeEntry: {
+            if (m_code.size() == m_code_entry_count) {
+                m_state = m_cursor == m_section_end ? State::ParsedCodeSection : State::Stopped;
+                return;
+            }
+
+            size_t offset = 0;
+            u32 entry_size = 0;
+            if (auto result = read_u32(available, offset, entry_size); result != ReadResult::Read) {
+                if (result == ReadResult::Malformed)
+                    m_state = State::Stopped;
+                return;
+            }
+
+            auto entry_end = offset + entry_size;
+            if (m_cursor + entry_end > m_section_end) {
+                m_state = State::Stopped;
+                return;
+            }
+            if (available.size() < entry_end)
+                return;
+
+            FixedMemoryStream stream { available.slice(0, entry_end) };
+            ConstrainedStream entry_stream { MaybeOwned<Stream>(stream), entry_end };
+            auto code = CodeSection::Code::parse(entry_stream);
+            if (code.is_error()) {
+                m_state = State::Stopped;
+                return;
+            }
+
+            m_code.append(code.release_value());
+            m_cursor += entry_end;
+            break;
+        }
+
+        case State::ParsedCodeSection:
+        case State::Stopped:
+            return;
+        }
+    }
+}
+
+ParseResult<NonnullRefPtr<Module>> StreamingModuleParser::finish()
+{
+    auto start = MonotonicTime::now();
+    ScopeGuard update_parse_time = [&] { m_parse_time += MonotonicTime::now() - start; };
+
+    FixedMemoryStream stream { m_bytes.bytes() };
+    if (m_state == State::ParsedCodeSection)
+        return Module::parse(stream, CodeSection { move(m_code) });
+    return Module::parse(stream);
+}
+
+}
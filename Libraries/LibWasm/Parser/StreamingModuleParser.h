@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteBuffer.h>
+#include <AK/NonnullRefPtr.h>
+#include <AK/RefCounted.h>
+#include <AK/Time.h>
+#include <LibWasm/Export.h>
+#include <LibWasm/Types.h>
+
+namespace Wasm {
+
+// Parses a module whose bytes arrive in chunks, e.g. from the network. Function bodies make up most of a large module,
+// so they are parsed as soon as each of them has arrived in full. The remaining sections are parsed by finish().
+//
+// Parsing ahead is opportunistic: if the bytes look malformed, we stop and leave it to finish() to report the error.
+class WASM_API StreamingModuleParser : public RefCounted<StreamingModuleParser> {
+public:
+    static NonnullRefPtr<StreamingModuleParser> create();
+
+    // For bytes that are all available up front, which finish() parses in one go.
+    static NonnullRefPtr<StreamingModuleParser> create_from_bytes(ByteBuffer);
+
+    ErrorOr<void> append(ReadonlyBytes);
+    ParseResult<NonnullRefPtr<Module>> finish();
+
+    ReadonlyBytes bytes() const LIFETIME_BOUND { return m_bytes; }
+    AK::Duration parse_time() const { return m_parse_time; }
+
+private:
+    enum class State : u8 {
+        Header,
+        SectionHeader,
+        SkippingSection,
+        CodeEntryCount,
+        CodeEntry,
+        ParsedCodeSection,
+        Stopped,
+    };
+
+    StreamingModuleParser() = default;
+
+    void parse_available_bytes();
+
+    ByteBuffer m_bytes;
+    State m_state { State::Header };
+    size_t m_cursor { 0 };
+    size_t m_section_end { 0 };
+    u32 m_code_entry_count { 0 };
+    Vector<CodeSection::Code> m_code;
+    AK::Duration m_parse_time;
+};
+
+}
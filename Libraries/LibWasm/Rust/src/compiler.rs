@@ -9,6 +9,7 @@ use crate::CraneliftInsn;
 use crate::CraneliftTrap;
 use crate::HelperId;
 use crate::HelperReloc;
+use crate::REGISTER_CALL_FLAG;
 use crate::RuntimeLayout;
 
 use cranelift_codegen::Context;
@@ -16,6 +17,8 @@ use cranelift_codegen::FinalizedRelocTarget;
 use cranelift_codegen::binemit::Reloc;
 use cranelift_codegen::ir::AbiParam;
 use cranelift_codegen::ir::Block;
+use cranelift_codegen::ir::ConstantData;
+use cranelift_codegen::ir::Endianness;
 use cranelift_codegen::ir::ExtFuncData;
 use cranelift_codegen::ir::ExternalName;
 use cranelift_codegen::ir::Function;
@@ -49,13 +52,14 @@ const REG_COUNT: usize = 8;
 const STACK_MARKER: u8 = 8;
 const CALLREC_BASE: u8 = 9;
 
-/// The `Int` bank is always defined.
-/// The `F64` bank is trusted only until the next control-flow merge, where it may be undefined on an incoming edge.
+/// The `Int` bank is always defined, along with the upper halves that only v128 values use.
+/// The `F32`, `F64` and `V128` banks are trusted only until the next control-flow merge, where they may be undefined on an incoming edge.
 #[derive(Debug, Clone, Copy, PartialEq, Eq)]
 enum Bank {
     Int,
     F32,
     F64,
+    V128,
 }
 
 /// Control flow frame tracking for structured control flow.
@@ -164,6 +168,9 @@ impl CraneliftCompiler {
                 .load(types::I64, MemFlags::trusted(), configuration_val, offset);
             builder.def_var(*var, val);
         }
+        // The upper 8 bytes of a value are only non-zero for v128 values. Every scalar shares this one zero, so that
+        // merges of scalar values don't grow block parameters for their upper halves.
+        let zero_hi = builder.ins().iconst(types::I64, 0);
 
         let epilogue_block = builder.create_block();
         let trap_block = builder.create_block();
@@ -197,6 +204,9 @@ impl CraneliftCompiler {
             call_fn2_sig:      i32 fn(ptr, ptr, i32, i64, i64);
             call_fn3_sig:      i32 fn(ptr, ptr, i32, i64, i64, i64);
             call_indirect_sig: i32 fn(ptr, ptr, i32, i32, i32);
+            call_ind1_sig:     i32 fn(ptr, ptr, i32, i32, i32, i64);
+            call_ind2_sig:     i32 fn(ptr, ptr, i32, i32, i32, i64, i64);
+            call_ind3_sig:     i32 fn(ptr, ptr, i32, i32, i32, i64, i64, i64);
             memory_copy_sig:   i32 fn(ptr, ptr, i32, i32, i32, i32, i32);
             memory_fill_sig:   i32 fn(ptr, ptr, i32, i32, i32, i32);
             cage_base_sig:     i64 fn();
@@ -233,6 +243,10 @@ impl CraneliftCompiler {
         let h_mem_grow = decl_helper!(mem_grow_sig, HelperId::memory_grow);
         let h_call_wr = decl_helper!(call_wr_sig, HelperId::call_with_record);
         let h_call_indirect = decl_helper!(call_indirect_sig, HelperId::call_indirect);
+        let h_call_indirect_0 = decl_helper!(call_indirect_sig, HelperId::call_indirect_0);
+        let h_call_indirect_1 = decl_helper!(call_ind1_sig, HelperId::call_indirect_1);
+        let h_call_indirect_2 = decl_helper!(call_ind2_sig, HelperId::call_indirect_2);
+        let h_call_indirect_3 = decl_helper!(call_ind3_sig, HelperId::call_indirect_3);
         let h_memory_copy = decl_helper!(memory_copy_sig, HelperId::memory_copy);
         let h_memory_fill = decl_helper!(memory_fill_sig, HelperId::memory_fill);
         let h_primitive_storage_cage_base = decl_helper!(cage_base_sig, HelperId::primitive_storage_cage_base);
@@ -249,6 +263,10 @@ impl CraneliftCompiler {
         // Accesses to memory32 are unchecked and may fault; the fault handler turns
         // faults inside a memory's guarded reservation into wasm traps.
         let wasm_memory_flags = MemFlags::new();
+        // Vector accesses to value slots must not be folded into instructions that require 16-byte alignment.
+        let vector_slot_flags = MemFlags::new().with_notrap();
+        // Bitcasts between vector types of different lane counts must spell out the lane order.
+        let vector_flags = MemFlags::new().with_endianness(Endianness::Little);
         let interp_var = Variable::from_u32(8);
         builder.declare_var(interp_var, ptr_type);
         builder.def_var(interp_var, interpreter_val);
@@ -262,7 +280,7 @@ impl CraneliftCompiler {
                 .ins()
                 .load(ptr_type, MemFlags::trusted(), configuration_val, locals_base_offset);
         builder.def_var(locals_base_var, initial_locals_base);
-        let is_scalar_memory_access = |opcode: u64| {
+        let is_memory_access = |opcode: u64| {
             matches!(
                 opcode,
                 op::I32_LOAD
@@ -290,11 +308,13 @@ impl CraneliftCompiler {
                     | op::I64_STORE32
                     | op::SYNTHETIC_I32_STORELOCAL
                     | op::SYNTHETIC_I64_STORELOCAL
+                    | op::V128_LOAD..=op::V128_STORE
+                    | op::V128_LOAD8_LANE..=op::V128_LOAD64_ZERO
             )
         };
         let mut used_memory_indices: Vec<u32> = insns
             .iter()
-            .filter(|insn| is_scalar_memory_access(insn.opcode))
+            .filter(|insn| is_memory_access(insn.opcode))
             .map(|insn| insn.imm3)
             .collect();
         used_memory_indices.sort_unstable();
@@ -367,9 +387,11 @@ impl CraneliftCompiler {
         let mut control_stack: Vec<ControlFrame> = Vec::new();
 
         // Virtual stack, to avoid touching the interpreter-side stack as much as possible.
+        // Register calls pop their arguments like any other instruction, so only calls through the value stack disable it.
+        let is_register_call = |insn: &CraneliftInsn| insn.imm3 & REGISTER_CALL_FLAG != 0;
         let has_raw_call = insns
             .iter()
-            .any(|i| i.opcode == op::CALL || i.opcode == op::CALL_INDIRECT);
+            .any(|i| (i.opcode == op::CALL || i.opcode == op::CALL_INDIRECT) && !is_register_call(i));
         let max_stack_depth = match has_raw_call {
             true => 0,
             // We can't easily track across control flow merges, so count dests instead.
@@ -422,11 +444,42 @@ impl CraneliftCompiler {
                 v
             })
             .collect();
+        let reg_vars_hi: [Variable; REG_COUNT] = std::array::from_fn(|_| {
+            let v = Variable::from_u32(next_var_id);
+            next_var_id += 1;
+            builder.declare_var(v, types::I64);
+            builder.def_var(v, zero_hi);
+            v
+        });
+        let stack_vars_hi: Vec<Variable> = (0..max_stack_depth)
+            .map(|_| {
+                let v = Variable::from_u32(next_var_id);
+                next_var_id += 1;
+                builder.declare_var(v, types::I64);
+                builder.def_var(v, zero_hi);
+                v
+            })
+            .collect();
+        let reg_vars_v128: [Variable; REG_COUNT] = std::array::from_fn(|_| {
+            let v = Variable::from_u32(next_var_id);
+            next_var_id += 1;
+            builder.declare_var(v, types::I8X16);
+            v
+        });
+        let stack_vars_v128: Vec<Variable> = (0..max_stack_depth)
+            .map(|_| {
+                let v = Variable::from_u32(next_var_id);
+                next_var_id += 1;
+                builder.declare_var(v, types::I8X16);
+                v
+            })
+            .collect();
         let mut reg_ty = [Bank::Int; REG_COUNT];
         let mut stack_ty = vec![Bank::Int; max_stack_depth];
 
         const F32_KIND: u8 = 2;
         const F64_KIND: u8 = 3;
+        const V128_KIND: u8 = 4;
         let num_locals = num_locals as usize;
         let num_params = num_params as usize;
         let local_is_f64: Vec<bool> = (0..num_locals)
@@ -435,6 +488,9 @@ impl CraneliftCompiler {
         let local_is_f32: Vec<bool> = (0..num_locals)
             .map(|i| local_types.get(i).copied() == Some(F32_KIND))
             .collect();
+        let local_is_v128: Vec<bool> = (0..num_locals)
+            .map(|i| local_types.get(i).copied() == Some(V128_KIND))
+            .collect();
 
         // Promoting wasm locals to SSA variables keeps them in registers, which is a win only
         // as long as they actually fit. Functions with more locals than the machine has usable
@@ -466,6 +522,8 @@ impl CraneliftCompiler {
                 types::F64
             } else if local_is_f32[i] {
                 types::F32
+            } else if local_is_v128[i] {
+                types::I8X16
             } else {
                 types::I64
             };
@@ -474,15 +532,15 @@ impl CraneliftCompiler {
 
         // set_frame_lightweight verifies the stack-usage hint before these unchecked operations.
         macro_rules! emit_stack_push {
-            ($builder:expr, $val:expr) => {{
+            ($builder:expr, $val:expr, $hi:expr) => {{
                 let v = $val;
+                let hi = $hi;
                 let cfg = $builder.use_var(config_var);
                 let top = $builder
                     .ins()
                     .load(ptr_type, MemFlags::trusted(), cfg, value_stack_top_offset);
                 $builder.ins().store(MemFlags::trusted(), v, top, 0);
-                let zero_tag = $builder.ins().iconst(types::I64, 0);
-                $builder.ins().store(MemFlags::trusted(), zero_tag, top, 8);
+                $builder.ins().store(MemFlags::trusted(), hi, top, 8);
                 let new_top = $builder.ins().iadd_imm(top, i64::from(value_size));
                 $builder
                     .ins()
@@ -502,6 +560,48 @@ impl CraneliftCompiler {
                 $builder.ins().load(types::I64, MemFlags::trusted(), new_top, 0)
             }};
         }
+        macro_rules! emit_stack_pop_wide {
+            ($builder:expr) => {{
+                let cfg = $builder.use_var(config_var);
+                let top = $builder
+                    .ins()
+                    .load(ptr_type, MemFlags::trusted(), cfg, value_stack_top_offset);
+                let new_top = $builder.ins().iadd_imm(top, -i64::from(value_size));
+                $builder
+                    .ins()
+                    .store(MemFlags::trusted(), new_top, cfg, value_stack_top_offset);
+                let lo = $builder.ins().load(types::I64, MemFlags::trusted(), new_top, 0);
+                let hi = $builder.ins().load(types::I64, MemFlags::trusted(), new_top, 8);
+                (lo, hi)
+            }};
+        }
+        macro_rules! emit_stack_push_v128 {
+            ($builder:expr, $val:expr) => {{
+                let v = $val;
+                let cfg = $builder.use_var(config_var);
+                let top = $builder
+                    .ins()
+                    .load(ptr_type, MemFlags::trusted(), cfg, value_stack_top_offset);
+                $builder.ins().store(vector_slot_flags, v, top, 0);
+                let new_top = $builder.ins().iadd_imm(top, i64::from(value_size));
+                $builder
+                    .ins()
+                    .store(MemFlags::trusted(), new_top, cfg, value_stack_top_offset);
+            }};
+        }
+        macro_rules! emit_stack_pop_v128 {
+            ($builder:expr) => {{
+                let cfg = $builder.use_var(config_var);
+                let top = $builder
+                    .ins()
+                    .load(ptr_type, MemFlags::trusted(), cfg, value_stack_top_offset);
+                let new_top = $builder.ins().iadd_imm(top, -i64::from(value_size));
+                $builder
+                    .ins()
+                    .store(MemFlags::trusted(), new_top, cfg, value_stack_top_offset);
+                $builder.ins().load(types::I8X16, vector_slot_flags, new_top, 0)
+            }};
+        }
         macro_rules! emit_stack_size {
             ($builder:expr) => {{
                 let cfg = $builder.use_var(config_var);
@@ -591,14 +691,12 @@ impl CraneliftCompiler {
                     let top = $builder
                         .ins()
                         .load(ptr_type, MemFlags::trusted(), cfg, value_stack_top_offset);
-                    let zero_tag = $builder.ins().iconst(types::I64, 0);
                     for i in 0..sp {
                         let val = $builder.use_var(stack_vars[i]);
+                        let hi = $builder.use_var(stack_vars_hi[i]);
                         let offset = (i as i32) * value_size;
                         $builder.ins().store(MemFlags::trusted(), val, top, offset);
-                        $builder
-                            .ins()
-                            .store(MemFlags::trusted(), zero_tag, top, offset + 8);
+                        $builder.ins().store(MemFlags::trusted(), hi, top, offset + 8);
                     }
                     let new_top = $builder.ins().iadd_imm(top, i64::from(sp as i32 * value_size));
                     $builder
@@ -617,14 +715,12 @@ impl CraneliftCompiler {
                     let top = $builder
                         .ins()
                         .load(ptr_type, MemFlags::trusted(), cfg, value_stack_top_offset);
-                    let zero_tag = $builder.ins().iconst(types::I64, 0);
                     for i in 0..n {
                         let val = $builder.use_var(stack_vars[sp - n + i]);
+                        let hi = $builder.use_var(stack_vars_hi[sp - n + i]);
                         let offset = (i as i32) * value_size;
                         $builder.ins().store(MemFlags::trusted(), val, top, offset);
-                        $builder
-                            .ins()
-                            .store(MemFlags::trusted(), zero_tag, top, offset + 8);
+                        $builder.ins().store(MemFlags::trusted(), hi, top, offset + 8);
                     }
                     let new_top = $builder.ins().iadd_imm(top, i64::from(n as i32 * value_size));
                     $builder
@@ -634,21 +730,59 @@ impl CraneliftCompiler {
             }};
         }
 
-        macro_rules! write_dst {
-            ($builder:expr, $dst:expr, $val:expr) => {{
+        // Read both halves of a value, for consumers that only move it around (and so don't know its type).
+        macro_rules! read_src_wide {
+            ($builder:expr, $src:expr) => {{
+                let src = $src;
+                if src < STACK_MARKER {
+                    (
+                        $builder.use_var(reg_vars[src as usize]),
+                        $builder.use_var(reg_vars_hi[src as usize]),
+                    )
+                } else if src == STACK_MARKER {
+                    if max_stack_depth > 0 && sp > 0 {
+                        sp -= 1;
+                        (
+                            $builder.use_var(stack_vars[sp]),
+                            $builder.use_var(stack_vars_hi[sp]),
+                        )
+                    } else {
+                        emit_stack_pop_wide!($builder)
+                    }
+                } else {
+                    let cfg = $builder.use_var(config_var);
+                    let base = $builder
+                        .ins()
+                        .load(ptr_type, MemFlags::trusted(), cfg, call_record_base_offset);
+                    let off = i32::from(src - CALLREC_BASE) * value_size;
+                    (
+                        $builder.ins().load(types::I64, MemFlags::trusted(), base, off),
+                        $builder
+                            .ins()
+                            .load(types::I64, MemFlags::trusted(), base, off + 8),
+                    )
+                }
+            }};
+        }
+
+        macro_rules! write_dst_wide {
+            ($builder:expr, $dst:expr, $val:expr, $hi:expr) => {{
                 let dst = $dst;
                 let val = $val;
+                let hi = $hi;
                 if dst < STACK_MARKER {
                     $builder.def_var(reg_vars[dst as usize], val);
+                    $builder.def_var(reg_vars_hi[dst as usize], hi);
                     reg_ty[dst as usize] = Bank::Int;
                     dirty_regs[dst as usize] = true;
                 } else if dst == STACK_MARKER {
                     if max_stack_depth > 0 {
                         $builder.def_var(stack_vars[sp], val);
+                        $builder.def_var(stack_vars_hi[sp], hi);
                         stack_ty[sp] = Bank::Int;
                         sp += 1;
                     } else {
-                        emit_stack_push!($builder, val);
+                        emit_stack_push!($builder, val, hi);
                     }
                 } else {
                     // Frame entry allocated the record eagerly, so the write is two plain stores.
@@ -658,11 +792,15 @@ impl CraneliftCompiler {
                         .load(ptr_type, MemFlags::trusted(), cfg, call_record_base_offset);
                     let off = i32::from(dst - CALLREC_BASE) * value_size;
                     $builder.ins().store(MemFlags::trusted(), val, base, off);
-                    let zero_tag = $builder.ins().iconst(types::I64, 0);
-                    $builder.ins().store(MemFlags::trusted(), zero_tag, base, off + 8);
+                    $builder.ins().store(MemFlags::trusted(), hi, base, off + 8);
                 }
             }};
         }
+        macro_rules! write_dst {
+            ($builder:expr, $dst:expr, $val:expr) => {
+                write_dst_wide!($builder, $dst, $val, zero_hi)
+            };
+        }
 
         macro_rules! read_src_f64 {
             ($builder:expr, $src:expr) => {{
@@ -706,16 +844,18 @@ impl CraneliftCompiler {
                 if dst < STACK_MARKER {
                     $builder.def_var(reg_vars_f64[dst as usize], val);
                     $builder.def_var(reg_vars[dst as usize], bits);
+                    $builder.def_var(reg_vars_hi[dst as usize], zero_hi);
                     reg_ty[dst as usize] = Bank::F64;
                     dirty_regs[dst as usize] = true;
                 } else if dst == STACK_MARKER {
                     if max_stack_depth > 0 {
                         $builder.def_var(stack_vars_f64[sp], val);
                         $builder.def_var(stack_vars[sp], bits);
+                        $builder.def_var(stack_vars_hi[sp], zero_hi);
                         stack_ty[sp] = Bank::F64;
                         sp += 1;
                     } else {
-                        emit_stack_push!($builder, bits);
+                        emit_stack_push!($builder, bits, zero_hi);
                     }
                 } else {
                     let cfg = $builder.use_var(config_var);
@@ -724,8 +864,7 @@ impl CraneliftCompiler {
                         .load(ptr_type, MemFlags::trusted(), cfg, call_record_base_offset);
                     let off = i32::from(dst - CALLREC_BASE) * value_size;
                     $builder.ins().store(MemFlags::trusted(), bits, base, off);
-                    let zero_tag = $builder.ins().iconst(types::I64, 0);
-                    $builder.ins().store(MemFlags::trusted(), zero_tag, base, off + 8);
+                    $builder.ins().store(MemFlags::trusted(), zero_hi, base, off + 8);
                 }
             }};
         }
@@ -778,16 +917,18 @@ impl CraneliftCompiler {
                 if dst < STACK_MARKER {
                     $builder.def_var(reg_vars_f32[dst as usize], val);
                     $builder.def_var(reg_vars[dst as usize], bits);
+                    $builder.def_var(reg_vars_hi[dst as usize], zero_hi);
                     reg_ty[dst as usize] = Bank::F32;
                     dirty_regs[dst as usize] = true;
                 } else if dst == STACK_MARKER {
                     if max_stack_depth > 0 {
                         $builder.def_var(stack_vars_f32[sp], val);
                         $builder.def_var(stack_vars[sp], bits);
+                        $builder.def_var(stack_vars_hi[sp], zero_hi);
                         stack_ty[sp] = Bank::F32;
                         sp += 1;
                     } else {
-                        emit_stack_push!($builder, bits);
+                        emit_stack_push!($builder, bits, zero_hi);
                     }
                 } else {
                     let cfg = $builder.use_var(config_var);
@@ -796,8 +937,108 @@ impl CraneliftCompiler {
                         .load(ptr_type, MemFlags::trusted(), cfg, call_record_base_offset);
                     let off = i32::from(dst - CALLREC_BASE) * value_size;
                     $builder.ins().store(MemFlags::trusted(), bits, base, off);
-                    let zero_tag = $builder.ins().iconst(types::I64, 0);
-                    $builder.ins().store(MemFlags::trusted(), zero_tag, base, off + 8);
+                    $builder.ins().store(MemFlags::trusted(), zero_hi, base, off + 8);
+                }
+            }};
+        }
+
+        // v128 values live in I8X16 variables, and are bitcast to the lane type each operation works on. Their two
+        // halves are kept in the always-valid i64 banks for bank-agnostic consumers; cranelift drops the extraction
+        // when nothing reads them.
+        macro_rules! v128_as {
+            ($builder:expr, $val:expr, $ty:expr) => {{
+                let val = $val;
+                if $builder.func.dfg.value_type(val) == $ty {
+                    val
+                } else {
+                    $builder.ins().bitcast($ty, vector_flags, val)
+                }
+            }};
+        }
+        macro_rules! v128_const {
+            ($builder:expr, $bytes:expr) => {{
+                let constant = $builder
+                    .func
+                    .dfg
+                    .constants
+                    .insert(ConstantData::from(&$bytes[..]));
+                $builder.ins().vconst(types::I8X16, constant)
+            }};
+        }
+        macro_rules! v128_from_halves {
+            ($builder:expr, $lo:expr, $hi:expr) => {{
+                let v = $builder.ins().scalar_to_vector(types::I64X2, $lo);
+                let v = $builder.ins().insertlane(v, $hi, 1);
+                $builder.ins().bitcast(types::I8X16, vector_flags, v)
+            }};
+        }
+
+        macro_rules! read_src_v128 {
+            ($builder:expr, $src:expr) => {{
+                let src = $src;
+                if src < STACK_MARKER {
+                    if reg_ty[src as usize] == Bank::V128 {
+                        $builder.use_var(reg_vars_v128[src as usize])
+                    } else {
+                        let lo = $builder.use_var(reg_vars[src as usize]);
+                        let hi = $builder.use_var(reg_vars_hi[src as usize]);
+                        v128_from_halves!($builder, lo, hi)
+                    }
+                } else if src == STACK_MARKER {
+                    if max_stack_depth > 0 && sp > 0 {
+                        sp -= 1;
+                        if stack_ty[sp] == Bank::V128 {
+                            $builder.use_var(stack_vars_v128[sp])
+                        } else {
+                            let lo = $builder.use_var(stack_vars[sp]);
+                            let hi = $builder.use_var(stack_vars_hi[sp]);
+                            v128_from_halves!($builder, lo, hi)
+                        }
+                    } else {
+                        emit_stack_pop_v128!($builder)
+                    }
+                } else {
+                    let cfg = $builder.use_var(config_var);
+                    let base = $builder
+                        .ins()
+                        .load(ptr_type, MemFlags::trusted(), cfg, call_record_base_offset);
+                    let off = i32::from(src - CALLREC_BASE) * value_size;
+                    $builder.ins().load(types::I8X16, vector_slot_flags, base, off)
+                }
+            }};
+        }
+
+        // Accepts any 128-bit vector type.
+        macro_rules! write_dst_v128 {
+            ($builder:expr, $dst:expr, $val:expr) => {{
+                let dst = $dst;
+                let val = v128_as!($builder, $val, types::I8X16);
+                if dst < STACK_MARKER || (dst == STACK_MARKER && max_stack_depth > 0) {
+                    let halves = $builder.ins().bitcast(types::I64X2, vector_flags, val);
+                    let lo = $builder.ins().extractlane(halves, 0);
+                    let hi = $builder.ins().extractlane(halves, 1);
+                    if dst < STACK_MARKER {
+                        $builder.def_var(reg_vars_v128[dst as usize], val);
+                        $builder.def_var(reg_vars[dst as usize], lo);
+                        $builder.def_var(reg_vars_hi[dst as usize], hi);
+                        reg_ty[dst as usize] = Bank::V128;
+                        dirty_regs[dst as usize] = true;
+                    } else {
+                        $builder.def_var(stack_vars_v128[sp], val);
+                        $builder.def_var(stack_vars[sp], lo);
+                        $builder.def_var(stack_vars_hi[sp], hi);
+                        stack_ty[sp] = Bank::V128;
+                        sp += 1;
+                    }
+                } else if dst == STACK_MARKER {
+                    emit_stack_push_v128!($builder, val);
+                } else {
+                    let cfg = $builder.use_var(config_var);
+                    let base = $builder
+                        .ins()
+                        .load(ptr_type, MemFlags::trusted(), cfg, call_record_base_offset);
+                    let off = i32::from(dst - CALLREC_BASE) * value_size;
+                    $builder.ins().store(vector_slot_flags, val, base, off);
                 }
             }};
         }
@@ -917,6 +1158,139 @@ impl CraneliftCompiler {
                 write_dst!($builder, $insn.destination, result);
             }};
         }
+        macro_rules! v128_binop {
+            ($builder:expr, $insn:expr, $ty:expr, $op:ident) => {{
+                let rhs = read_src_v128!($builder, $insn.sources[0]);
+                let lhs = read_src_v128!($builder, $insn.sources[1]);
+                let rhs = v128_as!($builder, rhs, $ty);
+                let lhs = v128_as!($builder, lhs, $ty);
+                let result = $builder.ins().$op(lhs, rhs);
+                write_dst_v128!($builder, $insn.destination, result);
+            }};
+        }
+        macro_rules! v128_unop {
+            ($builder:expr, $insn:expr, $ty:expr, $op:ident) => {{
+                let src = read_src_v128!($builder, $insn.sources[0]);
+                let src = v128_as!($builder, src, $ty);
+                let result = $builder.ins().$op(src);
+                write_dst_v128!($builder, $insn.destination, result);
+            }};
+        }
+        macro_rules! v128_convert {
+            ($builder:expr, $insn:expr, $ty:expr, $op:ident, $result_ty:expr) => {{
+                let src = read_src_v128!($builder, $insn.sources[0]);
+                let src = v128_as!($builder, src, $ty);
+                let result = $builder.ins().$op($result_ty, src);
+                write_dst_v128!($builder, $insn.destination, result);
+            }};
+        }
+        macro_rules! v128_icmp {
+            ($builder:expr, $insn:expr, $ty:expr, $cc:expr) => {{
+                let rhs = read_src_v128!($builder, $insn.sources[0]);
+                let lhs = read_src_v128!($builder, $insn.sources[1]);
+                let rhs = v128_as!($builder, rhs, $ty);
+                let lhs = v128_as!($builder, lhs, $ty);
+                let result = $builder.ins().icmp($cc, lhs, rhs);
+                write_dst_v128!($builder, $insn.destination, result);
+            }};
+        }
+        macro_rules! v128_fcmp {
+            ($builder:expr, $insn:expr, $ty:expr, $cc:expr) => {{
+                let rhs = read_src_v128!($builder, $insn.sources[0]);
+                let lhs = read_src_v128!($builder, $insn.sources[1]);
+                let rhs = v128_as!($builder, rhs, $ty);
+                let lhs = v128_as!($builder, lhs, $ty);
+                let result = $builder.ins().fcmp($cc, lhs, rhs);
+                write_dst_v128!($builder, $insn.destination, result);
+            }};
+        }
+        // Shift amounts are taken modulo the lane width, which is also what cranelift does.
+        macro_rules! v128_shift {
+            ($builder:expr, $insn:expr, $ty:expr, $op:ident) => {{
+                let amount = read_src!($builder, $insn.sources[0]);
+                let amount = $builder.ins().ireduce(types::I32, amount);
+                let src = read_src_v128!($builder, $insn.sources[1]);
+                let src = v128_as!($builder, src, $ty);
+                let result = $builder.ins().$op(src, amount);
+                write_dst_v128!($builder, $insn.destination, result);
+            }};
+        }
+        macro_rules! v128_all_true {
+            ($builder:expr, $insn:expr, $ty:expr) => {{
+                let src = read_src_v128!($builder, $insn.sources[0]);
+                let src = v128_as!($builder, src, $ty);
+                let all_true = $builder.ins().vall_true(src);
+                let result = $builder.ins().uextend(types::I64, all_true);
+                write_dst!($builder, $insn.destination, result);
+            }};
+        }
+        macro_rules! v128_bitmask {
+            ($builder:expr, $insn:expr, $ty:expr) => {{
+                let src = read_src_v128!($builder, $insn.sources[0]);
+                let src = v128_as!($builder, src, $ty);
+                let bits = $builder.ins().vhigh_bits(types::I32, src);
+                let result = $builder.ins().uextend(types::I64, bits);
+                write_dst!($builder, $insn.destination, result);
+            }};
+        }
+        macro_rules! v128_extmul {
+            ($builder:expr, $insn:expr, $ty:expr, $widen:ident) => {{
+                let rhs = read_src_v128!($builder, $insn.sources[0]);
+                let lhs = read_src_v128!($builder, $insn.sources[1]);
+                let rhs = v128_as!($builder, rhs, $ty);
+                let lhs = v128_as!($builder, lhs, $ty);
+                let rhs = $builder.ins().$widen(rhs);
+                let lhs = $builder.ins().$widen(lhs);
+                let result = $builder.ins().imul(lhs, rhs);
+                write_dst_v128!($builder, $insn.destination, result);
+            }};
+        }
+        macro_rules! v128_extadd_pairwise {
+            ($builder:expr, $insn:expr, $ty:expr, $widen_low:ident, $widen_high:ident) => {{
+                let src = read_src_v128!($builder, $insn.sources[0]);
+                let src = v128_as!($builder, src, $ty);
+                let low = $builder.ins().$widen_low(src);
+                let high = $builder.ins().$widen_high(src);
+                let result = $builder.ins().iadd_pairwise(low, high);
+                write_dst_v128!($builder, $insn.destination, result);
+            }};
+        }
+        // pmin is `rhs < lhs ? rhs : lhs` and pmax is `lhs < rhs ? rhs : lhs`, lane-wise, which (unlike fmin/fmax)
+        // passes NaNs and signed zeros through as-is.
+        macro_rules! v128_pseudo_min_max {
+            ($builder:expr, $insn:expr, $ty:expr, $is_max:expr) => {{
+                let rhs_bits = read_src_v128!($builder, $insn.sources[0]);
+                let lhs_bits = read_src_v128!($builder, $insn.sources[1]);
+                let rhs = v128_as!($builder, rhs_bits, $ty);
+                let lhs = v128_as!($builder, lhs_bits, $ty);
+                let picks_rhs = if $is_max {
+                    $builder.ins().fcmp(FloatCC::LessThan, lhs, rhs)
+                } else {
+                    $builder.ins().fcmp(FloatCC::LessThan, rhs, lhs)
+                };
+                let picks_rhs = v128_as!($builder, picks_rhs, types::I8X16);
+                let result = $builder.ins().bitselect(picks_rhs, rhs_bits, lhs_bits);
+                write_dst_v128!($builder, $insn.destination, result);
+            }};
+        }
+        // imm1 = offset, imm3 = memory index.
+        macro_rules! v128_memory_address {
+            ($builder:expr, $insn:expr, $src:expr) => {{
+                let base_raw = read_src!($builder, $src);
+                let base_u32 = $builder.ins().ireduce(types::I32, base_raw);
+                let base_u64 = $builder.ins().uextend(types::I64, base_u32);
+                let offset = $builder.ins().iconst(types::I64, $insn.imm1);
+                let addr = $builder.ins().iadd(base_u64, offset);
+                inline_memory_address!($builder, $insn.imm3, addr)
+            }};
+        }
+        macro_rules! v128_extending_load {
+            ($builder:expr, $insn:expr, $op:ident) => {{
+                let address = v128_memory_address!($builder, $insn, $insn.sources[0]);
+                let result = $builder.ins().$op(wasm_memory_flags, address, 0);
+                write_dst_v128!($builder, $insn.destination, result);
+            }};
+        }
 
         macro_rules! read_local_inline {
             ($builder:expr, $idx_imm:expr) => {{
@@ -1030,10 +1404,43 @@ impl CraneliftCompiler {
                 }
             }};
         }
+        // Unlike the scalar locals, v128 locals have to be told apart even when they aren't promoted, since the i64 paths
+        // only move their lower half.
+        macro_rules! read_local_v128 {
+            ($builder:expr, $idx_imm:expr) => {{
+                let idx = ($idx_imm) as usize;
+                if idx < local_vars.len() {
+                    $builder.use_var(local_vars[idx])
+                } else {
+                    let lb = $builder.use_var(locals_base_var);
+                    $builder
+                        .ins()
+                        .load(types::I8X16, vector_slot_flags, lb, (idx as i32) * value_size)
+                }
+            }};
+        }
+        macro_rules! write_local_v128 {
+            ($builder:expr, $idx_imm:expr, $val:expr) => {{
+                let idx = ($idx_imm) as usize;
+                let v = $val;
+                if idx < local_vars.len() {
+                    $builder.def_var(local_vars[idx], v);
+                    dirty_locals[idx] = true;
+                } else {
+                    let lb = $builder.use_var(locals_base_var);
+                    $builder
+                        .ins()
+                        .store(vector_slot_flags, v, lb, (idx as i32) * value_size);
+                }
+            }};
+        }
         macro_rules! local_get {
             ($builder:expr, $idx_imm:expr, $dst:expr) => {{
                 let idx = ($idx_imm) as usize;
-                if idx < local_vars.len() && local_is_f64[idx] {
+                if idx < num_locals && local_is_v128[idx] {
+                    let result = read_local_v128!($builder, $idx_imm);
+                    write_dst_v128!($builder, $dst, result);
+                } else if idx < local_vars.len() && local_is_f64[idx] {
                     let result = read_local_f64!($builder, $idx_imm);
                     write_dst_f64!($builder, $dst, result);
                 } else if idx < local_vars.len() && local_is_f32[idx] {
@@ -1048,7 +1455,10 @@ impl CraneliftCompiler {
         macro_rules! local_set {
             ($builder:expr, $idx_imm:expr, $src:expr) => {{
                 let idx = ($idx_imm) as usize;
-                if idx < local_vars.len() && local_is_f64[idx] {
+                if idx < num_locals && local_is_v128[idx] {
+                    let val = read_src_v128!($builder, $src);
+                    write_local_v128!($builder, $idx_imm, val);
+                } else if idx < local_vars.len() && local_is_f64[idx] {
                     let val = read_src_f64!($builder, $src);
                     write_local_f64!($builder, $idx_imm, val);
                 } else if idx < local_vars.len() && local_is_f32[idx] {
@@ -1068,6 +1478,13 @@ impl CraneliftCompiler {
                         if !dirty_locals[i] {
                             continue;
                         }
+                        if local_is_v128[i] {
+                            let v = $builder.use_var(local_vars[i]);
+                            $builder
+                                .ins()
+                                .store(vector_slot_flags, v, lb, (i as i32) * value_size);
+                            continue;
+                        }
                         let v = $builder.use_var(local_vars[i]);
                         let stored = if local_is_f32[i] {
                             let bits32 = $builder.ins().bitcast(types::I32, MemFlags::new(), v);
@@ -1166,16 +1583,21 @@ impl CraneliftCompiler {
                     let lb = $builder.use_var(locals_base_var);
                     for (i, var) in local_vars.iter().enumerate() {
                         if i < num_params {
-                            let ty = if local_is_f64[i] {
-                                types::F64
+                            let (ty, flags) = if local_is_f64[i] {
+                                (types::F64, MemFlags::trusted())
                             } else if local_is_f32[i] {
-                                types::F32
+                                (types::F32, MemFlags::trusted())
+                            } else if local_is_v128[i] {
+                                (types::I8X16, vector_slot_flags)
                             } else {
-                                types::I64
+                                (types::I64, MemFlags::trusted())
                             };
                             let offset = (i as i32) * value_size;
-                            let val = $builder.ins().load(ty, MemFlags::trusted(), lb, offset);
+                            let val = $builder.ins().load(ty, flags, lb, offset);
                             $builder.def_var(*var, val);
+                        } else if local_is_v128[i] {
+                            let zero = v128_const!($builder, [0u8; 16]);
+                            $builder.def_var(*var, zero);
                         } else if local_is_f64[i] {
                             let zero = $builder.ins().f64const(0.0);
                             $builder.def_var(*var, zero);
@@ -1195,15 +1617,17 @@ impl CraneliftCompiler {
                 if !local_vars.is_empty() {
                     let lb = $builder.use_var(locals_base_var);
                     for (i, var) in local_vars.iter().enumerate() {
-                        let ty = if local_is_f64[i] {
-                            types::F64
+                        let (ty, flags) = if local_is_f64[i] {
+                            (types::F64, MemFlags::trusted())
                         } else if local_is_f32[i] {
-                            types::F32
+                            (types::F32, MemFlags::trusted())
+                        } else if local_is_v128[i] {
+                            (types::I8X16, vector_slot_flags)
                         } else {
-                            types::I64
+                            (types::I64, MemFlags::trusted())
                         };
                         let offset = (i as i32) * value_size;
-                        let val = $builder.ins().load(ty, MemFlags::trusted(), lb, offset);
+                        let val = $builder.ins().load(ty, flags, lb, offset);
                         $builder.def_var(*var, val);
                     }
                 }
@@ -1225,6 +1649,14 @@ impl CraneliftCompiler {
 
             builder.switch_to_block(resume);
             builder.seal_block(resume);
+            // Resuming mid-function, registers may hold live v128 values.
+            for (i, var) in reg_vars_hi.iter().enumerate() {
+                let offset = regs_offset + (i as i32) * value_size + 8;
+                let val = builder
+                    .ins()
+                    .load(types::I64, MemFlags::trusted(), configuration_val, offset);
+                builder.def_var(*var, val);
+            }
             init_locals_resume!(builder);
             builder.ins().jump(dispatch, &[]);
 
@@ -1253,6 +1685,7 @@ impl CraneliftCompiler {
                     Self::sync_regs_to_config(
                         &mut builder,
                         &reg_vars,
+                        &reg_vars_hi,
                         config_var,
                         regs_offset,
                         value_size,
@@ -1436,12 +1869,16 @@ impl CraneliftCompiler {
                         if max_stack_depth > 0 {
                             // vstack enabled: move top arity values to entry position.
                             if arity > 0 {
-                                let result = if sp > 0 {
-                                    builder.use_var(stack_vars[sp - 1])
+                                let (result, result_hi) = if sp > 0 {
+                                    (
+                                        builder.use_var(stack_vars[sp - 1]),
+                                        builder.use_var(stack_vars_hi[sp - 1]),
+                                    )
                                 } else {
-                                    emit_stack_pop!(builder)
+                                    emit_stack_pop_wide!(builder)
                                 };
                                 builder.def_var(stack_vars[entry], result);
+                                builder.def_var(stack_vars_hi[entry], result_hi);
                             }
                         } else {
                             // vstack disabled: trim the real value stack down to the target label's entry depth + arity, preserving the top arity values.
@@ -1504,7 +1941,9 @@ impl CraneliftCompiler {
                             builder.seal_block(taken_block);
                             if arity > 0 {
                                 let result = builder.use_var(stack_vars[sp - 1]);
+                                let result_hi = builder.use_var(stack_vars_hi[sp - 1]);
                                 builder.def_var(stack_vars[entry], result);
+                                builder.def_var(stack_vars_hi[entry], result_hi);
                             }
                             // Note: we don't change sp here since fallthrough needs the original sp.
                             builder.ins().jump(target, &[]);
@@ -1567,7 +2006,11 @@ impl CraneliftCompiler {
                 }
                 op::LOCAL_TEE | op::SYNTHETIC_ARGUMENT_TEE => {
                     let idx = insn.imm1 as usize;
-                    if idx < local_vars.len() && local_is_f64[idx] {
+                    if idx < num_locals && local_is_v128[idx] {
+                        let val = read_src_v128!(builder, insn.sources[0]);
+                        write_local_v128!(builder, insn.imm1, val);
+                        write_dst_v128!(builder, insn.destination, val);
+                    } else if idx < local_vars.len() && local_is_f64[idx] {
                         let val = read_src_f64!(builder, insn.sources[0]);
                         write_local_f64!(builder, insn.imm1, val);
                         write_dst_f64!(builder, insn.destination, val);
@@ -1591,8 +2034,14 @@ impl CraneliftCompiler {
                     local_set!(builder, local_idx, insn.sources[0]);
                 }
                 op::SYNTHETIC_LOCAL_COPY => {
-                    let val = read_local_inline!(builder, insn.imm1);
-                    write_local_inline!(builder, insn.imm2, val);
+                    let idx = insn.imm1 as usize;
+                    if idx < num_locals && local_is_v128[idx] {
+                        let val = read_local_v128!(builder, insn.imm1);
+                        write_local_v128!(builder, insn.imm2, val);
+                    } else {
+                        let val = read_local_inline!(builder, insn.imm1);
+                        write_local_inline!(builder, insn.imm2, val);
+                    }
                 }
 
                 op::GLOBAL_GET => {
@@ -1601,18 +2050,23 @@ impl CraneliftCompiler {
                         builder
                             .ins()
                             .load(types::I64, MemFlags::trusted(), global, global_instance_value_offset);
-                    write_dst!(builder, insn.destination, result);
+                    let result_hi = builder.ins().load(
+                        types::I64,
+                        MemFlags::trusted(),
+                        global,
+                        global_instance_value_offset + 8,
+                    );
+                    write_dst_wide!(builder, insn.destination, result, result_hi);
                 }
                 op::GLOBAL_SET => {
-                    let val = read_src!(builder, insn.sources[0]);
+                    let (val, val_hi) = read_src_wide!(builder, insn.sources[0]);
                     let global = inline_global_instance!(insn.imm1 as u32);
                     builder
                         .ins()
                         .store(MemFlags::trusted(), val, global, global_instance_value_offset);
-                    let zero = builder.ins().iconst(types::I64, 0);
                     builder
                         .ins()
-                        .store(MemFlags::trusted(), zero, global, global_instance_value_offset + 8);
+                        .store(MemFlags::trusted(), val_hi, global, global_instance_value_offset + 8);
                 }
 
                 op::DROP => {
@@ -1624,11 +2078,12 @@ impl CraneliftCompiler {
 
                 op::SELECT | op::SELECT_TYPED => {
                     let cond_raw = read_src!(builder, insn.sources[0]);
-                    let rhs = read_src!(builder, insn.sources[1]);
-                    let lhs = read_src!(builder, insn.sources[2]);
+                    let (rhs, rhs_hi) = read_src_wide!(builder, insn.sources[1]);
+                    let (lhs, lhs_hi) = read_src_wide!(builder, insn.sources[2]);
                     let cond = builder.ins().icmp_imm(IntCC::NotEqual, cond_raw, 0);
                     let result = builder.ins().select(cond, lhs, rhs);
-                    write_dst!(builder, insn.destination, result);
+                    let result_hi = builder.ins().select(cond, lhs_hi, rhs_hi);
+                    write_dst_wide!(builder, insn.destination, result, result_hi);
                 }
 
                 op::BR_TABLE => {
@@ -1670,12 +2125,16 @@ impl CraneliftCompiler {
                             };
                             let entry = frame.stack_depth_at_entry as usize;
                             if max_stack_depth > 0 && arity > 0 {
-                                let result = if sp > 0 {
-                                    builder.use_var(stack_vars[sp - 1])
+                                let (result, result_hi) = if sp > 0 {
+                                    (
+                                        builder.use_var(stack_vars[sp - 1]),
+                                        builder.use_var(stack_vars_hi[sp - 1]),
+                                    )
                                 } else {
-                                    emit_stack_pop!(builder)
+                                    emit_stack_pop_wide!(builder)
                                 };
                                 builder.def_var(stack_vars[entry], result);
+                                builder.def_var(stack_vars_hi[entry], result_hi);
                             } else if max_stack_depth == 0 {
                                 let entry_depth_var = frame
                                     .entry_real_depth_var
@@ -2210,7 +2669,506 @@ impl CraneliftCompiler {
                     );
                 }
 
-                // For CALL and CALL_INDIRECT, we have no extra information and have to use the interpreter stack for args and returns.
+                // Fixed-width SIMD. v128 loads and stores take the same immediates as the scalar ones, with imm2 = lane for the lane variants.
+                op::V128_LOAD => {
+                    let address = v128_memory_address!(builder, insn, insn.sources[0]);
+                    let result = builder.ins().load(types::I8X16, wasm_memory_flags, address, 0);
+                    write_dst_v128!(builder, insn.destination, result);
+                }
+                op::V128_LOAD8X8_S => v128_extending_load!(builder, insn, sload8x8),
+                op::V128_LOAD8X8_U => v128_extending_load!(builder, insn, uload8x8),
+                op::V128_LOAD16X4_S => v128_extending_load!(builder, insn, sload16x4),
+                op::V128_LOAD16X4_U => v128_extending_load!(builder, insn, uload16x4),
+                op::V128_LOAD32X2_S => v128_extending_load!(builder, insn, sload32x2),
+                op::V128_LOAD32X2_U => v128_extending_load!(builder, insn, uload32x2),
+                op::V128_LOAD8_SPLAT | op::V128_LOAD16_SPLAT | op::V128_LOAD32_SPLAT | op::V128_LOAD64_SPLAT => {
+                    let (lane_type, vector_type) = match opc {
+                        op::V128_LOAD8_SPLAT => (types::I8, types::I8X16),
+                        op::V128_LOAD16_SPLAT => (types::I16, types::I16X8),
+                        op::V128_LOAD32_SPLAT => (types::I32, types::I32X4),
+                        _ => (types::I64, types::I64X2),
+                    };
+                    let address = v128_memory_address!(builder, insn, insn.sources[0]);
+                    let lane = builder.ins().load(lane_type, wasm_memory_flags, address, 0);
+                    let result = builder.ins().splat(vector_type, lane);
+                    write_dst_v128!(builder, insn.destination, result);
+                }
+                op::V128_LOAD32_ZERO | op::V128_LOAD64_ZERO => {
+                    let (lane_type, vector_type) = if opc == op::V128_LOAD32_ZERO {
+                        (types::I32, types::I32X4)
+                    } else {
+                        (types::I64, types::I64X2)
+                    };
+                    let address = v128_memory_address!(builder, insn, insn.sources[0]);
+                    let lane = builder.ins().load(lane_type, wasm_memory_flags, address, 0);
+                    let result = builder.ins().scalar_to_vector(vector_type, lane);
+                    write_dst_v128!(builder, insn.destination, result);
+                }
+                op::V128_STORE => {
+                    let val = read_src_v128!(builder, insn.sources[0]);
+                    let address = v128_memory_address!(builder, insn, insn.sources[1]);
+                    builder.ins().store(wasm_memory_flags, val, address, 0);
+                }
+                op::V128_LOAD8_LANE..=op::V128_STORE64_LANE => {
+                    let (lane_type, vector_type) = match opc {
+                        op::V128_LOAD8_LANE | op::V128_STORE8_LANE => (types::I8, types::I8X16),
+                        op::V128_LOAD16_LANE | op::V128_STORE16_LANE => (types::I16, types::I16X8),
+                        op::V128_LOAD32_LANE | op::V128_STORE32_LANE => (types::I32, types::I32X4),
+                        _ => (types::I64, types::I64X2),
+                    };
+                    let lane_index = insn.imm2 as u8;
+                    let vector = read_src_v128!(builder, insn.sources[0]);
+                    let vector = v128_as!(builder, vector, vector_type);
+                    let address = v128_memory_address!(builder, insn, insn.sources[1]);
+                    if opc <= op::V128_LOAD64_LANE {
+                        let lane = builder.ins().load(lane_type, wasm_memory_flags, address, 0);
+                        let result = builder.ins().insertlane(vector, lane, lane_index);
+                        write_dst_v128!(builder, insn.destination, result);
+                    } else {
+                        let lane = builder.ins().extractlane(vector, lane_index);
+                        builder.ins().store(wasm_memory_flags, lane, address, 0);
+                    }
+                }
+
+                op::V128_CONST => {
+                    let mut bytes = [0u8; 16];
+                    bytes[..8].copy_from_slice(&insn.imm1.to_le_bytes());
+                    bytes[8..].copy_from_slice(&insn.imm2.to_le_bytes());
+                    let result = v128_const!(builder, bytes);
+                    write_dst_v128!(builder, insn.destination, result);
+                }
+                op::I8X16_SHUFFLE => {
+                    // imm1 = lanes 0-7, imm2 = lanes 8-15, one byte per lane.
+                    let rhs = read_src_v128!(builder, insn.sources[0]);
+                    let lhs = read_src_v128!(builder, insn.sources[1]);
+                    let mut lanes = [0u8; 16];
+                    lanes[..8].copy_from_slice(&insn.imm1.to_le_bytes());
+                    lanes[8..].copy_from_slice(&insn.imm2.to_le_bytes());
+                    let mask = builder.func.dfg.immediates.push(ConstantData::from(&lanes[..]));
+                    let result = builder.ins().shuffle(lhs, rhs, mask);
+                    write_dst_v128!(builder, insn.destination, result);
+                }
+                op::I8X16_SWIZZLE => v128_binop!(builder, insn, types::I8X16, swizzle),
+
+                op::I8X16_SPLAT | op::I16X8_SPLAT | op::I32X4_SPLAT | op::I64X2_SPLAT => {
+                    let (lane_type, vector_type) = match opc {
+                        op::I8X16_SPLAT => (types::I8, types::I8X16),
+                        op::I16X8_SPLAT => (types::I16, types::I16X8),
+                        op::I32X4_SPLAT => (types::I32, types::I32X4),
+                        _ => (types::I64, types::I64X2),
+                    };
+                    let src = read_src!(builder, insn.sources[0]);
+                    let lane = if lane_type == types::I64 {
+                        src
+                    } else {
+                        builder.ins().ireduce(lane_type, src)
+                    };
+                    let result = builder.ins().splat(vector_type, lane);
+                    write_dst_v128!(builder, insn.destination, result);
+                }
+                op::F32X4_SPLAT => {
+                    let src = read_src_f32!(builder, insn.sources[0]);
+                    let result = builder.ins().splat(types::F32X4, src);
+                    write_dst_v128!(builder, insn.destination, result);
+                }
+                op::F64X2_SPLAT => {
+                    let src = read_src_f64!(builder, insn.sources[0]);
+                    let result = builder.ins().splat(types::F64X2, src);
+                    write_dst_v128!(builder, insn.destination, result);
+                }
+
+                // imm1 = lane
+                op::I8X16_EXTRACT_LANE_S
+                | op::I8X16_EXTRACT_LANE_U
+                | op::I16X8_EXTRACT_LANE_S
+                | op::I16X8_EXTRACT_LANE_U
+                | op::I32X4_EXTRACT_LANE
+                | op::I64X2_EXTRACT_LANE => {
+                    let vector_type = match opc {
+                        op::I8X16_EXTRACT_LANE_S | op::I8X16_EXTRACT_LANE_U => types::I8X16,
+                        op::I16X8_EXTRACT_LANE_S | op::I16X8_EXTRACT_LANE_U => types::I16X8,
+                        op::I32X4_EXTRACT_LANE => types::I32X4,
+                        _ => types::I64X2,
+                    };
+                    let vector = read_src_v128!(builder, insn.sources[0]);
+                    let vector = v128_as!(builder, vector, vector_type);
+                    let lane = builder.ins().extractlane(vector, insn.imm1 as u8);
+                    let result = match opc {
+                        op::I8X16_EXTRACT_LANE_U | op::I16X8_EXTRACT_LANE_U => builder.ins().uextend(types::I64, lane),
+                        op::I64X2_EXTRACT_LANE => lane,
+                        _ => builder.ins().sextend(types::I64, lane),
+                    };
+                    write_dst!(builder, insn.destination, result);
+                }
+                op::F32X4_EXTRACT_LANE => {
+                    let vector = read_src_v128!(builder, insn.sources[0]);
+                    let vector = v128_as!(builder, vector, types::F32X4);
+                    let result = builder.ins().extractlane(vector, insn.imm1 as u8);
+                    write_dst_f32!(builder, insn.destination, result);
+                }
+                op::F64X2_EXTRACT_LANE => {
+                    let vector = read_src_v128!(builder, insn.sources[0]);
+                    let vector = v128_as!(builder, vector, types::F64X2);
+                    let result = builder.ins().extractlane(vector, insn.imm1 as u8);
+                    write_dst_f64!(builder, insn.destination, result);
+                }
+                op::I8X16_REPLACE_LANE | op::I16X8_REPLACE_LANE | op::I32X4_REPLACE_LANE | op::I64X2_REPLACE_LANE => {
+                    let (lane_type, vector_type) = match opc {
+                        op::I8X16_REPLACE_LANE => (types::I8, types::I8X16),
+                        op::I16X8_REPLACE_LANE => (types::I16, types::I16X8),
+                        op::I32X4_REPLACE_LANE => (types::I32, types::I32X4),
+                        _ => (types::I64, types::I64X2),
+                    };
+                    let src = read_src!(builder, insn.sources[0]);
+                    let lane = if lane_type == types::I64 {
+                        src
+                    } else {
+                        builder.ins().ireduce(lane_type, src)
+                    };
+                    let vector = read_src_v128!(builder, insn.sources[1]);
+                    let vector = v128_as!(builder, vector, vector_type);
+                    let result = builder.ins().insertlane(vector, lane, insn.imm1 as u8);
+                    write_dst_v128!(builder, insn.destination, result);
+                }
+                op::F32X4_REPLACE_LANE => {
+                    let lane = read_src_f32!(builder, insn.sources[0]);
+                    let vector = read_src_v128!(builder, insn.sources[1]);
+                    let vector = v128_as!(builder, vector, types::F32X4);
+                    let result = builder.ins().insertlane(vector, lane, insn.imm1 as u8);
+                    write_dst_v128!(builder, insn.destination, result);
+                }
+                op::F64X2_REPLACE_LANE => {
+                    let lane = read_src_f64!(builder, insn.sources[0]);
+                    let vector = read_src_v128!(builder, insn.sources[1]);
+                    let vector = v128_as!(builder, vector, types::F64X2);
+                    let result = builder.ins().insertlane(vector, lane, insn.imm1 as u8);
+                    write_dst_v128!(builder, insn.destination, result);
+                }
+
+                op::I8X16_EQ => v128_icmp!(builder, insn, types::I8X16, IntCC::Equal),
+                op::I8X16_NE => v128_icmp!(builder, insn, types::I8X16, IntCC::NotEqual),
+                op::I8X16_LT_S => v128_icmp!(builder, insn, types::I8X16, IntCC::SignedLessThan),
+                op::I8X16_LT_U => v128_icmp!(builder, insn, types::I8X16, IntCC::UnsignedLessThan),
+                op::I8X16_GT_S => v128_icmp!(builder, insn, types::I8X16, IntCC::SignedGreaterThan),
+                op::I8X16_GT_U => v128_icmp!(builder, insn, types::I8X16, IntCC::UnsignedGreaterThan),
+                op::I8X16_LE_S => v128_icmp!(builder, insn, types::I8X16, IntCC::SignedLessThanOrEqual),
+                op::I8X16_LE_U => v128_icmp!(builder, insn, types::I8X16, IntCC::UnsignedLessThanOrEqual),
+                op::I8X16_GE_S => v128_icmp!(builder, insn, types::I8X16, IntCC::SignedGreaterThanOrEqual),
+                op::I8X16_GE_U => v128_icmp!(builder, insn, types::I8X16, IntCC::UnsignedGreaterThanOrEqual),
+                op::I16X8_EQ => v128_icmp!(builder, insn, types::I16X8, IntCC::Equal),
+                op::I16X8_NE => v128_icmp!(builder, insn, types::I16X8, IntCC::NotEqual),
+                op::I16X8_LT_S => v128_icmp!(builder, insn, types::I16X8, IntCC::SignedLessThan),
+                op::I16X8_LT_U => v128_icmp!(builder, insn, types::I16X8, IntCC::UnsignedLessThan),
+                op::I16X8_GT_S => v128_icmp!(builder, insn, types::I16X8, IntCC::SignedGreaterThan),
+                op::I16X8_GT_U => v128_icmp!(builder, insn, types::I16X8, IntCC::UnsignedGreaterThan),
+                op::I16X8_LE_S => v128_icmp!(builder, insn, types::I16X8, IntCC::SignedLessThanOrEqual),
+                op::I16X8_LE_U => v128_icmp!(builder, insn, types::I16X8, IntCC::UnsignedLessThanOrEqual),
+                op::I16X8_GE_S => v128_icmp!(builder, insn, types::I16X8, IntCC::SignedGreaterThanOrEqual),
+                op::I16X8_GE_U => v128_icmp!(builder, insn, types::I16X8, IntCC::UnsignedGreaterThanOrEqual),
+                op::I32X4_EQ => v128_icmp!(builder, insn, types::I32X4, IntCC::Equal),
+                op::I32X4_NE => v128_icmp!(builder, insn, types::I32X4, IntCC::NotEqual),
+                op::I32X4_LT_S => v128_icmp!(builder, insn, types::I32X4, IntCC::SignedLessThan),
+                op::I32X4_LT_U => v128_icmp!(builder, insn, types::I32X4, IntCC::UnsignedLessThan),
+                op::I32X4_GT_S => v128_icmp!(builder, insn, types::I32X4, IntCC::SignedGreaterThan),
+                op::I32X4_GT_U => v128_icmp!(builder, insn, types::I32X4, IntCC::UnsignedGreaterThan),
+                op::I32X4_LE_S => v128_icmp!(builder, insn, types::I32X4, IntCC::SignedLessThanOrEqual),
+                op::I32X4_LE_U => v128_icmp!(builder, insn, types::I32X4, IntCC::UnsignedLessThanOrEqual),
+                op::I32X4_GE_S => v128_icmp!(builder, insn, types::I32X4, IntCC::SignedGreaterThanOrEqual),
+                op::I32X4_GE_U => v128_icmp!(builder, insn, types::I32X4, IntCC::UnsignedGreaterThanOrEqual),
+                op::I64X2_EQ => v128_icmp!(builder, insn, types::I64X2, IntCC::Equal),
+                op::I64X2_NE => v128_icmp!(builder, insn, types::I64X2, IntCC::NotEqual),
+                op::I64X2_LT_S => v128_icmp!(builder, insn, types::I64X2, IntCC::SignedLessThan),
+                op::I64X2_GT_S => v128_icmp!(builder, insn, types::I64X2, IntCC::SignedGreaterThan),
+                op::I64X2_LE_S => v128_icmp!(builder, insn, types::I64X2, IntCC::SignedLessThanOrEqual),
+                op::I64X2_GE_S => v128_icmp!(builder, insn, types::I64X2, IntCC::SignedGreaterThanOrEqual),
+                op::F32X4_EQ => v128_fcmp!(builder, insn, types::F32X4, FloatCC::Equal),
+                op::F32X4_NE => v128_fcmp!(builder, insn, types::F32X4, FloatCC::NotEqual),
+                op::F32X4_LT => v128_fcmp!(builder, insn, types::F32X4, FloatCC::LessThan),
+                op::F32X4_GT => v128_fcmp!(builder, insn, types::F32X4, FloatCC::GreaterThan),
+                op::F32X4_LE => v128_fcmp!(builder, insn, types::F32X4, FloatCC::LessThanOrEqual),
+                op::F32X4_GE => v128_fcmp!(builder, insn, types::F32X4, FloatCC::GreaterThanOrEqual),
+                op::F64X2_EQ => v128_fcmp!(builder, insn, types::F64X2, FloatCC::Equal),
+                op::F64X2_NE => v128_fcmp!(builder, insn, types::F64X2, FloatCC::NotEqual),
+                op::F64X2_LT => v128_fcmp!(builder, insn, types::F64X2, FloatCC::LessThan),
+                op::F64X2_GT => v128_fcmp!(builder, insn, types::F64X2, FloatCC::GreaterThan),
+                op::F64X2_LE => v128_fcmp!(builder, insn, types::F64X2, FloatCC::LessThanOrEqual),
+                op::F64X2_GE => v128_fcmp!(builder, insn, types::F64X2, FloatCC::GreaterThanOrEqual),
+
+                op::V128_NOT => v128_unop!(builder, insn, types::I8X16, bnot),
+                op::V128_AND => v128_binop!(builder, insn, types::I8X16, band),
+                op::V128_ANDNOT => v128_binop!(builder, insn, types::I8X16, band_not),
+                op::V128_OR => v128_binop!(builder, insn, types::I8X16, bor),
+                op::V128_XOR => v128_binop!(builder, insn, types::I8X16, bxor),
+                op::V128_BITSELECT => {
+                    let mask = read_src_v128!(builder, insn.sources[0]);
+                    let rhs = read_src_v128!(builder, insn.sources[1]);
+                    let lhs = read_src_v128!(builder, insn.sources[2]);
+                    let result = builder.ins().bitselect(mask, lhs, rhs);
+                    write_dst_v128!(builder, insn.destination, result);
+                }
+                op::V128_ANY_TRUE => {
+                    let src = read_src_v128!(builder, insn.sources[0]);
+                    let any_true = builder.ins().vany_true(src);
+                    let result = builder.ins().uextend(types::I64, any_true);
+                    write_dst!(builder, insn.destination, result);
+                }
+
+                op::I8X16_ABS => v128_unop!(builder, insn, types::I8X16, iabs),
+                op::I8X16_NEG => v128_unop!(builder, insn, types::I8X16, ineg),
+                op::I8X16_POPCNT => v128_unop!(builder, insn, types::I8X16, popcnt),
+                op::I8X16_ALL_TRUE => v128_all_true!(builder, insn, types::I8X16),
+                op::I8X16_BITMASK => v128_bitmask!(builder, insn, types::I8X16),
+                op::I8X16_NARROW_I16X8_S => v128_binop!(builder, insn, types::I16X8, snarrow),
+                op::I8X16_NARROW_I16X8_U => v128_binop!(builder, insn, types::I16X8, unarrow),
+                op::I8X16_SHL => v128_shift!(builder, insn, types::I8X16, ishl),
+                op::I8X16_SHR_S => v128_shift!(builder, insn, types::I8X16, sshr),
+                op::I8X16_SHR_U => v128_shift!(builder, insn, types::I8X16, ushr),
+                op::I8X16_ADD => v128_binop!(builder, insn, types::I8X16, iadd),
+                op::I8X16_ADD_SAT_S => v128_binop!(builder, insn, types::I8X16, sadd_sat),
+                op::I8X16_ADD_SAT_U => v128_binop!(builder, insn, types::I8X16, uadd_sat),
+                op::I8X16_SUB => v128_binop!(builder, insn, types::I8X16, isub),
+                op::I8X16_SUB_SAT_S => v128_binop!(builder, insn, types::I8X16, ssub_sat),
+                op::I8X16_SUB_SAT_U => v128_binop!(builder, insn, types::I8X16, usub_sat),
+                op::I8X16_MIN_S => v128_binop!(builder, insn, types::I8X16, smin),
+                op::I8X16_MIN_U => v128_binop!(builder, insn, types::I8X16, umin),
+                op::I8X16_MAX_S => v128_binop!(builder, insn, types::I8X16, smax),
+                op::I8X16_MAX_U => v128_binop!(builder, insn, types::I8X16, umax),
+                op::I8X16_AVGR_U => v128_binop!(builder, insn, types::I8X16, avg_round),
+
+                op::I16X8_EXTADD_PAIRWISE_I8X16_S => {
+                    v128_extadd_pairwise!(builder, insn, types::I8X16, swiden_low, swiden_high)
+                }
+                op::I16X8_EXTADD_PAIRWISE_I8X16_U => {
+                    v128_extadd_pairwise!(builder, insn, types::I8X16, uwiden_low, uwiden_high)
+                }
+                op::I32X4_EXTADD_PAIRWISE_I16X8_S => {
+                    v128_extadd_pairwise!(builder, insn, types::I16X8, swiden_low, swiden_high)
+                }
+                op::I32X4_EXTADD_PAIRWISE_I16X8_U => {
+                    v128_extadd_pairwise!(builder, insn, types::I16X8, uwiden_low, uwiden_high)
+                }
+
+                op::I16X8_ABS => v128_unop!(builder, insn, types::I16X8, iabs),
+                op::I16X8_NEG => v128_unop!(builder, insn, types::I16X8, ineg),
+                op::I16X8_Q15MULR_SAT_S => v128_binop!(builder, insn, types::I16X8, sqmul_round_sat),
+                op::I16X8_ALL_TRUE => v128_all_true!(builder, insn, types::I16X8),
+                op::I16X8_BITMASK => v128_bitmask!(builder, insn, types::I16X8),
+                op::I16X8_NARROW_I32X4_S => v128_binop!(builder, insn, types::I32X4, snarrow),
+                op::I16X8_NARROW_I32X4_U => v128_binop!(builder, insn, types::I32X4, unarrow),
+                op::I16X8_EXTEND_LOW_I8X16_S => v128_unop!(builder, insn, types::I8X16, swiden_low),
+                op::I16X8_EXTEND_HIGH_I8X16_S => v128_unop!(builder, insn, types::I8X16, swiden_high),
+                op::I16X8_EXTEND_LOW_I8X16_U => v128_unop!(builder, insn, types::I8X16, uwiden_low),
+                op::I16X8_EXTEND_HIGH_I8X16_U => v128_unop!(builder, insn, types::I8X16, uwiden_high),
+                op::I16X8_SHL => v128_shift!(builder, insn, types::I16X8, ishl),
+                op::I16X8_SHR_S => v128_shift!(builder, insn, types::I16X8, sshr),
+                op::I16X8_SHR_U => v128_shift!(builder, insn, types::I16X8, ushr),
+                op::I16X8_ADD => v128_binop!(builder, insn, types::I16X8, iadd),
+                op::I16X8_ADD_SAT_S => v128_binop!(builder, insn, types::I16X8, sadd_sat),
+                op::I16X8_ADD_SAT_U => v128_binop!(builder, insn, types::I16X8, uadd_sat),
+                op::I16X8_SUB => v128_binop!(builder, insn, types::I16X8, isub),
+                op::I16X8_SUB_SAT_S => v128_binop!(builder, insn, types::I16X8, ssub_sat),
+                op::I16X8_SUB_SAT_U => v128_binop!(builder, insn, types::I16X8, usub_sat),
+                op::I16X8_MUL => v128_binop!(builder, insn, types::I16X8, imul),
+                op::I16X8_MIN_S => v128_binop!(builder, insn, types::I16X8, smin),
+                op::I16X8_MIN_U => v128_binop!(builder, insn, types::I16X8, umin),
+                op::I16X8_MAX_S => v128_binop!(builder, insn, types::I16X8, smax),
+                op::I16X8_MAX_U => v128_binop!(builder, insn, types::I16X8, umax),
+                op::I16X8_AVGR_U => v128_binop!(builder, insn, types::I16X8, avg_round),
+                op::I16X8_EXTMUL_LOW_I8X16_S => v128_extmul!(builder, insn, types::I8X16, swiden_low),
+                op::I16X8_EXTMUL_HIGH_I8X16_S => v128_extmul!(builder, insn, types::I8X16, swiden_high),
+                op::I16X8_EXTMUL_LOW_I8X16_U => v128_extmul!(builder, insn, types::I8X16, uwiden_low),
+                op::I16X8_EXTMUL_HIGH_I8X16_U => v128_extmul!(builder, insn, types::I8X16, uwiden_high),
+
+                op::I32X4_ABS => v128_unop!(builder, insn, types::I32X4, iabs),
+                op::I32X4_NEG => v128_unop!(builder, insn, types::I32X4, ineg),
+                op::I32X4_ALL_TRUE => v128_all_true!(builder, insn, types::I32X4),
+                op::I32X4_BITMASK => v128_bitmask!(builder, insn, types::I32X4),
+                op::I32X4_EXTEND_LOW_I16X8_S => v128_unop!(builder, insn, types::I16X8, swiden_low),
+                op::I32X4_EXTEND_HIGH_I16X8_S => v128_unop!(builder, insn, types::I16X8, swiden_high),
+                op::I32X4_EXTEND_LOW_I16X8_U => v128_unop!(builder, insn, types::I16X8, uwiden_low),
+                op::I32X4_EXTEND_HIGH_I16X8_U => v128_unop!(builder, insn, types::I16X8, uwiden_high),
+                op::I32X4_SHL => v128_shift!(builder, insn, types::I32X4, ishl),
+                op::I32X4_SHR_S => v128_shift!(builder, insn, types::I32X4, sshr),
+                op::I32X4_SHR_U => v128_shift!(builder, insn, types::I32X4, ushr),
+                op::I32X4_ADD => v128_binop!(builder, insn, types::I32X4, iadd),
+                op::I32X4_SUB => v128_binop!(builder, insn, types::I32X4, isub),
+                op::I32X4_MUL => v128_binop!(builder, insn, types::I32X4, imul),
+                op::I32X4_MIN_S => v128_binop!(builder, insn, types::I32X4, smin),
+                op::I32X4_MIN_U => v128_binop!(builder, insn, types::I32X4, umin),
+                op::I32X4_MAX_S => v128_binop!(builder, insn, types::I32X4, smax),
+                op::I32X4_MAX_U => v128_binop!(builder, insn, types::I32X4, umax),
+                op::I32X4_DOT_I16X8_S => {
+                    let rhs = read_src_v128!(builder, insn.sources[0]);
+                    let lhs = read_src_v128!(builder, insn.sources[1]);
+                    let rhs = v128_as!(builder, rhs, types::I16X8);
+                    let lhs = v128_as!(builder, lhs, types::I16X8);
+                    let lhs_low = builder.ins().swiden_low(lhs);
+                    let rhs_low = builder.ins().swiden_low(rhs);
+                    let low = builder.ins().imul(lhs_low, rhs_low);
+                    let lhs_high = builder.ins().swiden_high(lhs);
+                    let rhs_high = builder.ins().swiden_high(rhs);
+                    let high = builder.ins().imul(lhs_high, rhs_high);
+                    let result = builder.ins().iadd_pairwise(low, high);
+                    write_dst_v128!(builder, insn.destination, result);
+                }
+                op::I32X4_EXTMUL_LOW_I16X8_S => v128_extmul!(builder, insn, types::I16X8, swiden_low),
+                op::I32X4_EXTMUL_HIGH_I16X8_S => v128_extmul!(builder, insn, types::I16X8, swiden_high),
+                op::I32X4_EXTMUL_LOW_I16X8_U => v128_extmul!(builder, insn, types::I16X8, uwiden_low),
+                op::I32X4_EXTMUL_HIGH_I16X8_U => v128_extmul!(builder, insn, types::I16X8, uwiden_high),
+
+                op::I64X2_ABS => v128_unop!(builder, insn, types::I64X2, iabs),
+                op::I64X2_NEG => v128_unop!(builder, insn, types::I64X2, ineg),
+                op::I64X2_ALL_TRUE => v128_all_true!(builder, insn, types::I64X2),
+                op::I64X2_BITMASK => v128_bitmask!(builder, insn, types::I64X2),
+                op::I64X2_EXTEND_LOW_I32X4_S => v128_unop!(builder, insn, types::I32X4, swiden_low),
+                op::I64X2_EXTEND_HIGH_I32X4_S => v128_unop!(builder, insn, types::I32X4, swiden_high),
+                op::I64X2_EXTEND_LOW_I32X4_U => v128_unop!(builder, insn, types::I32X4, uwiden_low),
+                op::I64X2_EXTEND_HIGH_I32X4_U => v128_unop!(builder, insn, types::I32X4, uwiden_high),
+                op::I64X2_SHL => v128_shift!(builder, insn, types::I64X2, ishl),
+                op::I64X2_SHR_S => v128_shift!(builder, insn, types::I64X2, sshr),
+                op::I64X2_SHR_U => v128_shift!(builder, insn, types::I64X2, ushr),
+                op::I64X2_ADD => v128_binop!(builder, insn, types::I64X2, iadd),
+                op::I64X2_SUB => v128_binop!(builder, insn, types::I64X2, isub),
+                op::I64X2_MUL => v128_binop!(builder, insn, types::I64X2, imul),
+                op::I64X2_EXTMUL_LOW_I32X4_S => v128_extmul!(builder, insn, types::I32X4, swiden_low),
+                op::I64X2_EXTMUL_HIGH_I32X4_S => v128_extmul!(builder, insn, types::I32X4, swiden_high),
+                op::I64X2_EXTMUL_LOW_I32X4_U => v128_extmul!(builder, insn, types::I32X4, uwiden_low),
+                op::I64X2_EXTMUL_HIGH_I32X4_U => v128_extmul!(builder, insn, types::I32X4, uwiden_high),
+
+                op::F32X4_ABS => v128_unop!(builder, insn, types::F32X4, fabs),
+                op::F32X4_NEG => v128_unop!(builder, insn, types::F32X4, fneg),
+                op::F32X4_SQRT => v128_unop!(builder, insn, types::F32X4, sqrt),
+                op::F32X4_CEIL => v128_unop!(builder, insn, types::F32X4, ceil),
+                op::F32X4_FLOOR => v128_unop!(builder, insn, types::F32X4, floor),
+                op::F32X4_TRUNC => v128_unop!(builder, insn, types::F32X4, trunc),
+                op::F32X4_NEAREST => v128_unop!(builder, insn, types::F32X4, nearest),
+                op::F32X4_ADD => v128_binop!(builder, insn, types::F32X4, fadd),
+                op::F32X4_SUB => v128_binop!(builder, insn, types::F32X4, fsub),
+                op::F32X4_MUL => v128_binop!(builder, insn, types::F32X4, fmul),
+                op::F32X4_DIV => v128_binop!(builder, insn, types::F32X4, fdiv),
+                op::F32X4_MIN => v128_binop!(builder, insn, types::F32X4, fmin),
+                op::F32X4_MAX => v128_binop!(builder, insn, types::F32X4, fmax),
+                op::F32X4_PMIN => v128_pseudo_min_max!(builder, insn, types::F32X4, false),
+                op::F32X4_PMAX => v128_pseudo_min_max!(builder, insn, types::F32X4, true),
+                op::F64X2_ABS => v128_unop!(builder, insn, types::F64X2, fabs),
+                op::F64X2_NEG => v128_unop!(builder, insn, types::F64X2, fneg),
+                op::F64X2_SQRT => v128_unop!(builder, insn, types::F64X2, sqrt),
+                op::F64X2_CEIL => v128_unop!(builder, insn, types::F64X2, ceil),
+                op::F64X2_FLOOR => v128_unop!(builder, insn, types::F64X2, floor),
+                op::F64X2_TRUNC => v128_unop!(builder, insn, types::F64X2, trunc),
+                op::F64X2_NEAREST => v128_unop!(builder, insn, types::F64X2, nearest),
+                op::F64X2_ADD => v128_binop!(builder, insn, types::F64X2, fadd),
+                op::F64X2_SUB => v128_binop!(builder, insn, types::F64X2, fsub),
+                op::F64X2_MUL => v128_binop!(builder, insn, types::F64X2, fmul),
+                op::F64X2_DIV => v128_binop!(builder, insn, types::F64X2, fdiv),
+                op::F64X2_MIN => v128_binop!(builder, insn, types::F64X2, fmin),
+                op::F64X2_MAX => v128_binop!(builder, insn, types::F64X2, fmax),
+                op::F64X2_PMIN => v128_pseudo_min_max!(builder, insn, types::F64X2, false),
+                op::F64X2_PMAX => v128_pseudo_min_max!(builder, insn, types::F64X2, true),
+
+                op::F32X4_DEMOTE_F64X2_ZERO => v128_unop!(builder, insn, types::F64X2, fvdemote),
+                op::F64X2_PROMOTE_LOW_F32X4 => v128_unop!(builder, insn, types::F32X4, fvpromote_low),
+                op::I32X4_TRUNC_SAT_F32X4_S => {
+                    v128_convert!(builder, insn, types::F32X4, fcvt_to_sint_sat, types::I32X4)
+                }
+                op::I32X4_TRUNC_SAT_F32X4_U => {
+                    v128_convert!(builder, insn, types::F32X4, fcvt_to_uint_sat, types::I32X4)
+                }
+                op::F32X4_CONVERT_I32X4_S => v128_convert!(builder, insn, types::I32X4, fcvt_from_sint, types::F32X4),
+                op::F32X4_CONVERT_I32X4_U => v128_convert!(builder, insn, types::I32X4, fcvt_from_uint, types::F32X4),
+                op::I32X4_TRUNC_SAT_F64X2_S_ZERO | op::I32X4_TRUNC_SAT_F64X2_U_ZERO => {
+                    // Saturate to 64-bit lanes, then narrow (saturating again) into the low half next to zeroes.
+                    let src = read_src_v128!(builder, insn.sources[0]);
+                    let src = v128_as!(builder, src, types::F64X2);
+                    let zero = v128_const!(builder, [0u8; 16]);
+                    let zero = v128_as!(builder, zero, types::I64X2);
+                    let result = if opc == op::I32X4_TRUNC_SAT_F64X2_S_ZERO {
+                        let converted = builder.ins().fcvt_to_sint_sat(types::I64X2, src);
+                        builder.ins().snarrow(converted, zero)
+                    } else {
+                        let converted = builder.ins().fcvt_to_uint_sat(types::I64X2, src);
+                        builder.ins().uunarrow(converted, zero)
+                    };
+                    write_dst_v128!(builder, insn.destination, result);
+                }
+                op::F64X2_CONVERT_LOW_I32X4_S | op::F64X2_CONVERT_LOW_I32X4_U => {
+                    let src = read_src_v128!(builder, insn.sources[0]);
+                    let src = v128_as!(builder, src, types::I32X4);
+                    let result = if opc == op::F64X2_CONVERT_LOW_I32X4_S {
+                        let widened = builder.ins().swiden_low(src);
+                        builder.ins().fcvt_from_sint(types::F64X2, widened)
+                    } else {
+                        let widened = builder.ins().uwiden_low(src);
+                        builder.ins().fcvt_from_uint(types::F64X2, widened)
+                    };
+                    write_dst_v128!(builder, insn.destination, result);
+                }
+
+                // Register calls pass up to three arguments in registers, like the synthetic calls below. The compiled
+                // callee is entered directly, and only host functions and callees that aren't compiled yet go through the
+                // interpreter.
+                op::CALL | op::CALL_INDIRECT if is_register_call(insn) => {
+                    let param_count = (insn.imm3 & 0xff) as usize;
+                    let result_count = (insn.imm3 >> 8) & 0xff;
+                    let element_index = if opc == op::CALL_INDIRECT {
+                        let element_index = read_src!(builder, insn.sources[0]);
+                        Some(builder.ins().ireduce(types::I32, element_index))
+                    } else {
+                        None
+                    };
+                    // The last argument is on top of the stack.
+                    let mut call_args = Vec::with_capacity(param_count);
+                    for _ in 0..param_count {
+                        call_args.push(read_src!(builder, STACK_MARKER));
+                    }
+                    call_args.reverse();
+                    let iv = builder.use_var(interp_var);
+                    let cv = builder.use_var(config_var);
+                    let mut args = vec![iv, cv];
+                    let (sig, helper) = if let Some(element_index) = element_index {
+                        args.push(builder.ins().iconst(types::I32, insn.imm2));
+                        args.push(builder.ins().iconst(types::I32, insn.imm1));
+                        args.push(element_index);
+                        match param_count {
+                            0 => (call_indirect_sig, h_call_indirect_0),
+                            1 => (call_ind1_sig, h_call_indirect_1),
+                            2 => (call_ind2_sig, h_call_indirect_2),
+                            3 => (call_ind3_sig, h_call_indirect_3),
+                            _ => unreachable!(),
+                        }
+                    } else {
+                        args.push(builder.ins().iconst(types::I32, insn.imm1));
+                        match param_count {
+                            0 => (call_fn_sig, h_direct_call_0),
+                            1 => (call_fn1_sig, h_direct_call_1),
+                            2 => (call_fn2_sig, h_direct_call_2),
+                            3 => (call_fn3_sig, h_direct_call_3),
+                            _ => unreachable!(),
+                        }
+                    };
+                    args.extend(call_args);
+                    let cfp = builder.ins().func_addr(ptr_type, helper);
+                    do_call_and_check!(builder, sig, cfp, &args);
+
+                    if result_count > 0 {
+                        let cv = builder.use_var(config_var);
+                        let result = builder.ins().load(
+                            types::I64,
+                            MemFlags::trusted(),
+                            cv,
+                            compiled_call_result_scratch_offset,
+                        );
+                        let result_hi = builder.ins().load(
+                            types::I64,
+                            MemFlags::trusted(),
+                            cv,
+                            compiled_call_result_scratch_offset + 8,
+                        );
+                        write_dst_wide!(builder, insn.destination, result, result_hi);
+                    }
+                }
+
+                // For other CALL and CALL_INDIRECT, we have no extra information and have to use the interpreter stack for args and returns.
                 op::CALL => {
                     // Flush virtual stack, args are already on it from previous instructions.
                     flush_vstack_to_real!(builder);
@@ -2221,8 +3179,8 @@ impl CraneliftCompiler {
                     do_call_and_check!(builder, call_fn_sig, cfp, &[iv, cv, func_idx]);
                     // The helper pushes results to value_stack; pop to the actual destination.
                     if insn.destination != STACK_MARKER {
-                        let result = emit_stack_pop!(builder);
-                        write_dst!(builder, insn.destination, result);
+                        let (result, result_hi) = emit_stack_pop_wide!(builder);
+                        write_dst_wide!(builder, insn.destination, result, result_hi);
                     }
                 }
 
@@ -2242,8 +3200,8 @@ impl CraneliftCompiler {
                         &[iv, cv, table_idx, type_idx, element_index]
                     );
                     if insn.destination != STACK_MARKER {
-                        let result = emit_stack_pop!(builder);
-                        write_dst!(builder, insn.destination, result);
+                        let (result, result_hi) = emit_stack_pop_wide!(builder);
+                        write_dst_wide!(builder, insn.destination, result, result_hi);
                     }
                 }
 
@@ -2288,7 +3246,13 @@ impl CraneliftCompiler {
                             cv,
                             compiled_call_result_scratch_offset,
                         );
-                        write_dst!(builder, insn.destination, result);
+                        let result_hi = builder.ins().load(
+                            types::I64,
+                            MemFlags::trusted(),
+                            cv,
+                            compiled_call_result_scratch_offset + 8,
+                        );
+                        write_dst_wide!(builder, insn.destination, result, result_hi);
                     }
                 }
 
@@ -2306,7 +3270,13 @@ impl CraneliftCompiler {
                             cv2,
                             compiled_call_result_scratch_offset,
                         );
-                        write_dst!(builder, insn.destination, result);
+                        let result_hi = builder.ins().load(
+                            types::I64,
+                            MemFlags::trusted(),
+                            cv2,
+                            compiled_call_result_scratch_offset + 8,
+                        );
+                        write_dst_wide!(builder, insn.destination, result, result_hi);
                     }
                 }
 
@@ -2473,6 +3443,7 @@ impl CraneliftCompiler {
         Self::sync_regs_to_config(
             &mut builder,
             &reg_vars,
+            &reg_vars_hi,
             config_var,
             regs_offset,
             value_size,
@@ -2599,12 +3570,15 @@ impl CraneliftCompiler {
                 | op::SYNTHETIC_I64_ADD2LOCAL..=op::SYNTHETIC_LOCAL_SETI64_CONST
                 | op::SYNTHETIC_BR_TABLE_CONT
                 | op::SYNTHETIC_TIER_UP
+                // Fixed-width SIMD; relaxed SIMD is left to the interpreter.
+                | op::V128_LOAD..=op::F64X2_CONVERT_LOW_I32X4_U
         )
     }
 
     fn sync_regs_to_config(
         builder: &mut FunctionBuilder,
         reg_vars: &[Variable; REG_COUNT],
+        reg_vars_hi: &[Variable; REG_COUNT],
         config_var: Variable,
         regs_offset: i32,
         value_size: i32,
@@ -2616,10 +3590,10 @@ impl CraneliftCompiler {
                 continue;
             }
             let val = builder.use_var(reg_vars[i]);
+            let hi = builder.use_var(reg_vars_hi[i]);
             let offset = regs_offset + (i as i32) * value_size;
             builder.ins().store(MemFlags::trusted(), val, config, offset);
-            let zero = builder.ins().iconst(types::I64, 0);
-            builder.ins().store(MemFlags::trusted(), zero, config, offset + 8);
+            builder.ins().store(MemFlags::trusted(), hi, config, offset + 8);
         }
     }
 }
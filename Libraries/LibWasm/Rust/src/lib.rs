@@ -15,8 +15,13 @@ use compiler::CraneliftCompiler;
 ///   global ops:   imm1 = global index
 ///   branch:       imm1 = label index (from control stack)
 ///   block/loop:   imm1 = end_ip, imm2 = else_ip (-1 if none), imm3 = arity | (param_count << 16)
-///   call:         imm1 = function index
+///   call:         imm1 = function index, imm3 = register call (see below)
+///   call_indirect: imm1 = type index, imm2 = table index, imm3 = register call (see below)
 ///   memory ops:   imm1 = offset, imm3 = memory index
+///
+/// A register call has REGISTER_CALL_FLAG | param_count | (result_count << 8) in imm3: the callee takes at most three
+/// scalar arguments and returns at most one value, so they are passed in registers instead of on the value stack.
+/// Otherwise imm3 is zero, and the arguments and result go through the value stack.
 #[repr(C)]
 #[derive(Clone, Copy, Debug)]
 pub struct CraneliftInsn {
@@ -66,9 +71,14 @@ pub enum HelperId {
     memory_copy = 10,
     memory_fill = 11,
     primitive_storage_cage_base = 12,
+    call_indirect_0 = 13,
+    call_indirect_1 = 14,
+    call_indirect_2 = 15,
+    call_indirect_3 = 16,
 }
 
-pub const HELPER_COUNT: u32 = 13;
+pub const HELPER_COUNT: u32 = 17;
+pub const REGISTER_CALL_FLAG: u32 = 1 << 31;
 pub const SERIALIZED_CODE_ALIGNMENT: usize = 16;
 
 /// One relocation slot in the generated machine code. `code_offset` is the byte offset
@@ -14,6 +14,8 @@ use crate::compile_to_bytes;
 use std::mem::align_of;
 use std::mem::size_of;
 use std::mem::size_of_val;
+use std::sync::atomic::AtomicUsize;
+use std::sync::atomic::Ordering;
 
 #[repr(C)]
 #[derive(Clone, Copy)]
@@ -165,10 +167,15 @@ fn select_compiled_functions(
     code_base_offset: usize,
     output_size: usize,
 ) -> (Vec<(usize, CompiledFunction)>, usize, usize) {
-    let mut compiled_functions = Vec::new();
+    // Workers finish functions in whatever order they picked them up, so restore function order first. That keeps
+    // which functions fit in the output independent of scheduling.
+    let mut candidates = compiled_chunks.into_iter().flatten().collect::<Vec<_>>();
+    candidates.sort_unstable_by_key(|(index, _)| *index);
+
+    let mut compiled_functions = Vec::with_capacity(candidates.len());
     let mut code_size = 0usize;
     let mut reloc_size = 0usize;
-    for (index, compiled) in compiled_chunks.into_iter().flatten() {
+    for (index, compiled) in candidates {
         let Some(aligned_code_size) = align_up(compiled.code.len(), SERIALIZED_CODE_ALIGNMENT).ok() else {
             continue;
         };
@@ -215,30 +222,36 @@ pub fn compile_serialized_buffer(input: &[u8], output: &mut [u8]) -> Result<usiz
     let (header, entries, layout) = parse_input(input, output.len())?;
     let func_count = usize::try_from(header.function_count).map_err(|_| "function_count overflow")?;
 
+    // Function sizes in real modules are very uneven, so fixed ranges per worker would leave most workers idle
+    // while one of them works through a few huge functions. Instead, workers pick up the next function from a shared
+    // queue, largest first, so the long compilations start early and the small ones fill in the gaps.
+    let mut compile_order = (0..func_count).collect::<Vec<_>>();
+    compile_order.sort_unstable_by_key(|&i| std::cmp::Reverse(entries[i].insn_count));
+    let next_function = AtomicUsize::new(0);
+
     let thread_count = std::thread::available_parallelism()
         .map(|n| n.get())
         .unwrap_or(1)
-        .max(1);
-    let chunk_size = func_count.div_ceil(thread_count.max(1));
+        .clamp(1, func_count.max(1));
     let mapped_ref: &[u8] = input;
     let layout_ref = &layout;
+    let entries_ref = &entries;
+    let compile_order_ref = &compile_order;
+    let next_function_ref = &next_function;
     let outcome_return = header.outcome_return;
 
     // Compile into temporary per-function allocations first so the serialized
     // output contains only bytes that Cranelift actually produced.
     let compiled_chunks = std::thread::scope(|scope| {
         let mut handles = Vec::with_capacity(thread_count);
-        for chunk_idx in 0..thread_count {
-            let start = chunk_idx * chunk_size;
-            if start >= func_count {
-                break;
-            }
-            let end = (start + chunk_size).min(func_count);
-            let chunk_entries = &entries[start..end];
+        for _ in 0..thread_count {
             handles.push(scope.spawn(move || {
-                let mut out: Vec<(usize, CompiledFunction)> = Vec::with_capacity(end - start);
-                for (offset_in_chunk, entry) in chunk_entries.iter().enumerate() {
-                    let i = start + offset_in_chunk;
+                let mut out: Vec<(usize, CompiledFunction)> = Vec::new();
+                loop {
+                    let Some(&i) = compile_order_ref.get(next_function_ref.fetch_add(1, Ordering::Relaxed)) else {
+                        break;
+                    };
+                    let entry = &entries_ref[i];
                     if entry.insn_count == 0 {
                         continue;
                     }
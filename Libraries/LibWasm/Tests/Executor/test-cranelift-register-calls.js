@@ -0,0 +1,55 @@
+test("compiled calls and indirect calls pass their arguments in registers", () => {
+    const calleeBinary = readBinaryWasmFile("Fixtures/Modules/cranelift-register-calls-callee.wasm");
+    const callerBinary = readBinaryWasmFile("Fixtures/Modules/cranelift-register-calls-caller.wasm");
+
+    const callee = parseWebAssemblyModule(calleeBinary);
+    const caller = parseWebAssemblyModule(callerBinary, { callee });
+    const functions = [
+        ["answer", callee.getExport("answer")],
+        ["combine", callee.getExport("combine")],
+        ["negate", callee.getExport("negate")],
+        ["direct_calls", caller.getExport("direct_calls")],
+        ["direct_call_i64", caller.getExport("direct_call_i64")],
+        ["indirect_0", caller.getExport("indirect_0")],
+        ["indirect_1", caller.getExport("indirect_1")],
+        ["indirect_2", caller.getExport("indirect_2")],
+        ["indirect_3", caller.getExport("indirect_3")],
+    ];
+
+    if (functions.every(([, fn]) => !isCraneliftEligible(fn))) return;
+
+    for (const [name, fn] of functions) {
+        if (!isCraneliftEligible(fn)) throw new Error(`${name} is not Cranelift-eligible`);
+        if (!isCraneliftCompiled(fn)) throw new Error(`${name} did not compile with Cranelift`);
+    }
+
+    const [, , , directCalls, directCallI64, indirect0, indirect1, indirect2, indirect3] = functions.map(([, fn]) => fn);
+
+    expect(caller.invoke(directCalls, 1, 2, 3)).toBe(12723);
+    expect(caller.invoke(directCalls, -4, 5, 6)).toBe(-33974);
+    expect(caller.invoke(directCallI64, 0x123456789n)).toBe(-0x123456788n);
+
+    // Table entries: answer, double, subtract, combine, and an increment that stays in the interpreter.
+    expect(caller.invoke(indirect0, 0)).toBe(42);
+    expect(caller.invoke(indirect1, 1, 21)).toBe(42);
+    expect(caller.invoke(indirect1, 4, 41)).toBe(42);
+    expect(caller.invoke(indirect2, 2, 50, 8)).toBe(42);
+    expect(caller.invoke(indirect3, 3, 1, 2, 3)).toBe(123);
+
+    expect(() => caller.invoke(indirect1, 2, 1)).toThrowWithMessage(
+        TypeError,
+        "Execution trapped: Indirect call type mismatch"
+    );
+    expect(() => caller.invoke(indirect0, 1)).toThrowWithMessage(
+        TypeError,
+        "Execution trapped: Indirect call type mismatch"
+    );
+    expect(() => caller.invoke(indirect3, 4, 1, 2, 3)).toThrowWithMessage(
+        TypeError,
+        "Execution trapped: Indirect call type mismatch"
+    );
+
+    // A trap must not leave anything behind that breaks the next call.
+    expect(caller.invoke(indirect2, 2, 50, 8)).toBe(42);
+    expect(caller.invoke(directCalls, 1, 2, 3)).toBe(12723);
+});
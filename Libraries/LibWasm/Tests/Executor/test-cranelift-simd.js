@@ -0,0 +1,95 @@
+test("compiled SIMD instructions produce the same lanes as the interpreter", () => {
+    const binary = readBinaryWasmFile("Fixtures/Modules/cranelift-simd.wasm");
+    const module = parseWebAssemblyModule(binary);
+
+    const names = ["swizzle", "narrow_s", "narrow_u", "bitmask", "pmin", "pmax", "q15mulr_sat", "demote", "promote"];
+    const compiled = {};
+    const interpreted = {};
+    for (const name of names) {
+        compiled[name] = module.getExport(name);
+        interpreted[name] = module.getExport(`${name}_interpreted`);
+    }
+
+    if (names.every(name => !isCraneliftEligible(compiled[name]))) return;
+
+    for (const name of names) {
+        if (!isCraneliftEligible(compiled[name])) throw new Error(`${name} is not Cranelift-eligible`);
+        if (!isCraneliftCompiled(compiled[name])) throw new Error(`${name} did not compile with Cranelift`);
+        if (isCraneliftCompiled(interpreted[name])) throw new Error(`${name}_interpreted compiled with Cranelift`);
+    }
+
+    const invokeBoth = (name, ...args) => {
+        const compiledResult = module.invoke(compiled[name], ...args);
+        const interpretedResult = module.invoke(interpreted[name], ...args);
+        if (typeof compiledResult === "number") {
+            expect(compiledResult).toBe(interpretedResult);
+            return compiledResult;
+        }
+        expect(compareTypedArrays(new Uint8Array(compiledResult), new Uint8Array(interpretedResult))).toBe(true);
+        return compiledResult;
+    };
+
+    // Indices of 16 and above select zero.
+    const swizzled = invokeBoth(
+        "swizzle",
+        Uint8Array.from({ length: 16 }, (_, i) => 0x10 + i),
+        new Uint8Array([0, 15, 1, 14, 16, 0x80, 0xff, 3, 7, 7, 2, 31, 8, 9, 10, 11])
+    );
+    expect(
+        compareTypedArrays(
+            new Uint8Array(swizzled),
+            new Uint8Array([0x10, 0x1f, 0x11, 0x1e, 0, 0, 0, 0x13, 0x17, 0x17, 0x12, 0, 0x18, 0x19, 0x1a, 0x1b])
+        )
+    ).toBe(true);
+
+    const wide = new Int16Array([-32768, -129, -128, -1, 0, 127, 128, 32767]);
+    const wideHigh = new Int16Array([255, 256, -200, 1, 2, -3, 100, -100]);
+    const narrowedSigned = invokeBoth("narrow_s", wide, wideHigh);
+    expect(
+        compareTypedArrays(
+            new Int8Array(narrowedSigned),
+            new Int8Array([-128, -128, -128, -1, 0, 127, 127, 127, 127, 127, -128, 1, 2, -3, 100, -100])
+        )
+    ).toBe(true);
+    const narrowedUnsigned = invokeBoth("narrow_u", wide, wideHigh);
+    expect(
+        compareTypedArrays(
+            new Uint8Array(narrowedUnsigned),
+            new Uint8Array([0, 0, 0, 0, 0, 127, 128, 255, 255, 255, 0, 1, 2, 0, 100, 0])
+        )
+    ).toBe(true);
+
+    expect(invokeBoth("bitmask", new Int8Array([-1, 0, -128, 1, 0, -5, 0, 0, 127, -1, 0, 0, 0, 0, 0, -2]))).toBe(
+        0b1000_0010_0010_0101
+    );
+    expect(invokeBoth("bitmask", new Int8Array(16))).toBe(0);
+
+    // pmin and pmax pick an operand with a plain comparison, so NaN and signed zero pass through unchanged.
+    const floats = new Float32Array([NaN, -0, 1, -Infinity]);
+    const otherFloats = new Float32Array([1, 0, NaN, 2]);
+    const pmin = new Float32Array(invokeBoth("pmin", floats, otherFloats));
+    expect(pmin[0]).toBeNaN();
+    expect(Object.is(pmin[1], -0)).toBe(true);
+    expect(pmin[2]).toBe(1);
+    expect(pmin[3]).toBe(-Infinity);
+    const pmax = new Float32Array(invokeBoth("pmax", floats, otherFloats));
+    expect(pmax[0]).toBeNaN();
+    expect(Object.is(pmax[1], -0)).toBe(true);
+    expect(pmax[2]).toBe(1);
+    expect(pmax[3]).toBe(2);
+
+    const q15 = new Int16Array(
+        invokeBoth(
+            "q15mulr_sat",
+            new Int16Array([-32768, -32768, 16384, 100, -1, 32767, -16384, 12345]),
+            new Int16Array([-32768, 32767, 16384, 200, 1, 32767, 16384, -23456])
+        )
+    );
+    expect(compareTypedArrays(q15, new Int16Array([32767, -32767, 8192, 1, 0, 32766, -8192, -8837]))).toBe(true);
+
+    const demoted = new Float32Array(invokeBoth("demote", new Float64Array([1.5, 1e300])));
+    expect(compareTypedArrays(demoted, new Float32Array([1.5, Infinity, 0, 0]))).toBe(true);
+
+    const promoted = new Float64Array(invokeBoth("promote", new Float32Array([0.1, -2.5, 7, 8])));
+    expect(compareTypedArrays(promoted, new Float64Array([Math.fround(0.1), -2.5]))).toBe(true);
+});
@@ -0,0 +1,24 @@
+(module
+  (func (export "answer") (result i32)
+    i32.const 42
+  )
+
+  ;; Weighs each argument differently so that swapped arguments show up in the result.
+  (func (export "combine") (param i32 i32 i32) (result i32)
+    local.get 0
+    i32.const 100
+    i32.mul
+    local.get 1
+    i32.const 10
+    i32.mul
+    i32.add
+    local.get 2
+    i32.add
+  )
+
+  (func (export "negate") (param i64) (result i64)
+    i64.const 0
+    local.get 0
+    i64.sub
+  )
+)
@@ -0,0 +1,78 @@
+(module
+  (type $nullary (func (result i32)))
+  (type $unary (func (param i32) (result i32)))
+  (type $binary (func (param i32 i32) (result i32)))
+  (type $ternary (func (param i32 i32 i32) (result i32)))
+
+  (import "callee" "answer" (func $answer (type $nullary)))
+  (import "callee" "combine" (func $combine (type $ternary)))
+  (import "callee" "negate" (func $negate (param i64) (result i64)))
+
+  (table 5 funcref)
+  (elem (i32.const 0) $answer $double $subtract $combine $interpreted_increment)
+
+  (func $double (type $unary)
+    local.get 0
+    i32.const 2
+    i32.mul
+  )
+
+  (func $subtract (type $binary)
+    local.get 0
+    local.get 1
+    i32.sub
+  )
+
+  ;; The externref local keeps this callee in the interpreter.
+  (func $interpreted_increment (type $unary)
+    (local externref)
+    local.get 0
+    i32.const 1
+    i32.add
+  )
+
+  ;; Calls into another module aren't turned into synthetic calls, and the nested calls overlap, so they can't all
+  ;; use a call record either.
+  (func (export "direct_calls") (param i32 i32 i32) (result i32)
+    local.get 0
+    local.get 1
+    local.get 2
+    call $combine
+    call $answer
+    local.get 2
+    call $combine
+  )
+
+  (func (export "direct_call_i64") (param i64) (result i64)
+    local.get 0
+    call $negate
+    i64.const 1
+    i64.add
+  )
+
+  (func (export "indirect_0") (param i32) (result i32)
+    local.get 0
+    call_indirect (type $nullary)
+  )
+
+  (func (export "indirect_1") (param i32 i32) (result i32)
+    local.get 1
+    local.get 0
+    call_indirect (type $unary)
+  )
+
+  (func (export "indirect_2") (param i32 i32 i32) (result i32)
+    local.get 1
+    local.get 2
+    local.get 0
+    call_indirect (type $binary)
+  )
+
+  (func (export "indirect_3") (param i32 i32 i32 i32) (result i32)
+    local.get 1
+    local.get 2
+    local.get 3
+    local.get 0
+    call_indirect (type $ternary)
+  )
+)
@@ -0,0 +1,115 @@
+(module
+  ;; Every operation is exported twice. The "_interpreted" copy has an externref local, which keeps it out of the
+  ;; Cranelift tier, so the tests can compare the compiled lanes against the interpreter.
+
+  (func (export "swizzle") (param v128 v128) (result v128)
+    local.get 0
+    local.get 1
+    i8x16.swizzle
+  )
+
+  (func (export "swizzle_interpreted") (param v128 v128) (result v128)
+    (local externref)
+    local.get 0
+    local.get 1
+    i8x16.swizzle
+  )
+
+  (func (export "narrow_s") (param v128 v128) (result v128)
+    local.get 0
+    local.get 1
+    i8x16.narrow_i16x8_s
+  )
+
+  (func (export "narrow_s_interpreted") (param v128 v128) (result v128)
+    (local externref)
+    local.get 0
+    local.get 1
+    i8x16.narrow_i16x8_s
+  )
+
+  (func (export "narrow_u") (param v128 v128) (result v128)
+    local.get 0
+    local.get 1
+    i8x16.narrow_i16x8_u
+  )
+
+  (func (export "narrow_u_interpreted") (param v128 v128) (result v128)
+    (local externref)
+    local.get 0
+    local.get 1
+    i8x16.narrow_i16x8_u
+  )
+
+  (func (export "bitmask") (param v128) (result i32)
+    local.get 0
+    i8x16.bitmask
+  )
+
+  (func (export "bitmask_interpreted") (param v128) (result i32)
+    (local externref)
+    local.get 0
+    i8x16.bitmask
+  )
+
+  (func (export "pmin") (param v128 v128) (result v128)
+    local.get 0
+    local.get 1
+    f32x4.pmin
+  )
+
+  (func (export "pmin_interpreted") (param v128 v128) (result v128)
+    (local externref)
+    local.get 0
+    local.get 1
+    f32x4.pmin
+  )
+
+  (func (export "pmax") (param v128 v128) (result v128)
+    local.get 0
+    local.get 1
+    f32x4.pmax
+  )
+
+  (func (export "pmax_interpreted") (param v128 v128) (result v128)
+    (local externref)
+    local.get 0
+    local.get 1
+    f32x4.pmax
+  )
+
+  (func (export "q15mulr_sat") (param v128 v128) (result v128)
+    local.get 0
+    local.get 1
+    i16x8.q15mulr_sat_s
+  )
+
+  (func (export "q15mulr_sat_interpreted") (param v128 v128) (result v128)
+    (local externref)
+    local.get 0
+    local.get 1
+    i16x8.q15mulr_sat_s
+  )
+
+  (func (export "demote") (param v128) (result v128)
+    local.get 0
+    f32x4.demote_f64x2_zero
+  )
+
+  (func (export "demote_interpreted") (param v128) (result v128)
+    (local externref)
+    local.get 0
+    f32x4.demote_f64x2_zero
+  )
+
+  (func (export "promote") (param v128) (result v128)
+    local.get 0
+    f64x2.promote_low_f32x4
+  )
+
+  (func (export "promote_interpreted") (param v128) (result v128)
+    (local externref)
+    local.get 0
+    f64x2.promote_low_f32x4
+  )
+)
@@ -990,6 +990,14 @@ struct CompiledInstructions {
 
     Vector<u8> cranelift_local_types;
 
+    // A call or call_indirect whose arguments and result compiled code can pass in registers rather than on the value stack.
+    struct CraneliftRegisterCall {
+        u8 parameter_count { 0 };
+        u8 result_count { 0 };
+        bool is_register_call { false };
+    };
+    Vector<CraneliftRegisterCall> cranelift_register_calls; // Parallel to dispatches if any of them is a register call, empty otherwise.
+
     // Pointer/size_t-sized members first, then the u32, then the bools, so the trailing scalars pack
     // into one word instead of scattering padding between them.
 
@@ -1749,7 +1757,8 @@ public:
     void set_compile_stats(ModuleStats stats) { m_compile_stats = move(stats); }
     Optional<ModuleStats> take_compile_stats() { return move(m_compile_stats); }
 
-    static ParseResult<NonnullRefPtr<Module>> parse(Stream& stream);
+    // If the code section was already parsed, e.g. while the module was still being received, its bytes are skipped.
+    static ParseResult<NonnullRefPtr<Module>> parse(Stream& stream, Optional<CodeSection> parsed_code_section = {});
 
     size_t minimum_call_record_allocation_size() const { return m_minimum_call_record_allocation_size; }
     void set_minimum_call_record_allocation_size(size_t size) { m_minimum_call_record_allocation_size = size; }
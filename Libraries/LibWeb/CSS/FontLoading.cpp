@@ -74,7 +74,8 @@ void prepare_vector_font_data_off_thread(ByteBuffer data, Function<void(ErrorOr<
                 (*callback)(move(result));
                 delete callback;
             });
-        });
+        },
+        Threading::ThreadPool::Priority::UserBlocking);
 }
 
 }
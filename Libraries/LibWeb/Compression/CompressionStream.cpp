@@ -10,15 +10,13 @@
 #include <LibCompress/Gzip.h>
 #include <LibCompress/Zlib.h>
 #include <LibGC/Heap.h>
-#include <LibJS/Runtime/ArrayBuffer.h>
-#include <LibJS/Runtime/TypedArray.h>
 #include <LibWeb/Bindings/CompressionStream.h>
 #include <LibWeb/Bindings/Wrappable.h>
 #include <LibWeb/Compression/CompressionStream.h>
+#include <LibWeb/Compression/ParallelStep.h>
 #include <LibWeb/HTML/Scripting/Environments.h>
 #include <LibWeb/Streams/ReadableStream.h>
 #include <LibWeb/Streams/TransformStream.h>
-#include <LibWeb/Streams/TransformStreamOperations.h>
 #include <LibWeb/Streams/WritableStream.h>
 #include <LibWeb/WebIDL/AbstractOperations.h>
 
@@ -68,18 +66,16 @@ WebIDL::ExceptionOr<GC::Ref<CompressionStream>> CompressionStream::create(JS::Ob
     // 3. Let transformAlgorithm be an algorithm which takes a chunk argument and runs the compress and enqueue a chunk
     //    algorithm with this and chunk.
     auto transform_algorithm = GC::create_function(GC::Heap::the(), [stream, realm = GC::Ref(realm)](JS::Value chunk) -> GC::Ref<WebIDL::Promise> {
-        if (auto result = stream->compress_and_enqueue_chunk(realm, chunk); result.is_error())
+        auto result = stream->compress_and_enqueue_chunk(realm, chunk);
+        if (result.is_error())
             return WebIDL::create_rejected_promise_from_exception(realm, result.release_error());
 
-        return WebIDL::create_resolved_promise(realm, JS::js_undefined());
+        return result.release_value();
     });
 
     // 4. Let flushAlgorithm be an algorithm which takes no argument and runs the compress flush and enqueue algorithm with this.
     auto flush_algorithm = GC::create_function(GC::Heap::the(), [stream, realm = GC::Ref(realm)]() -> GC::Ref<WebIDL::Promise> {
-        if (auto result = stream->compress_flush_and_enqueue(realm); result.is_error())
-            return WebIDL::create_rejected_promise_from_exception(realm, result.release_error());
-
-        return WebIDL::create_resolved_promise(realm, JS::js_undefined());
+        return stream->compress_flush_and_enqueue(realm);
     });
 
     // 6. Set up this's transform with transformAlgorithm set to transformAlgorithm and flushAlgorithm set to flushAlgorithm.
@@ -104,56 +100,33 @@ void CompressionStream::visit_edges(GC::Cell::Visitor& visitor)
 }
 
 // https://compression.spec.whatwg.org/#compress-and-enqueue-a-chunk
-WebIDL::ExceptionOr<void> CompressionStream::compress_and_enqueue_chunk(JS::Realm& realm, JS::Value chunk)
+WebIDL::ExceptionOr<GC::Ref<WebIDL::Promise>> CompressionStream::compress_and_enqueue_chunk(JS::Realm& realm, JS::Value chunk)
 {
     // 1. If chunk is not a BufferSource type, then throw a TypeError.
     if (!WebIDL::is_buffer_source_type(chunk))
         return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, "Chunk is not a BufferSource type"_utf16 };
 
+    auto chunk_buffer = WebIDL::get_buffer_source_copy(chunk.as_object());
+    if (chunk_buffer.is_error())
+        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, Utf16String::formatted("Unable to compress chunk: {}", chunk_buffer.error()) };
+
     // 2. Let buffer be the result of compressing chunk with cs's format and context.
-    auto maybe_buffer = [&]() -> ErrorOr<ByteBuffer> {
-        auto chunk_buffer = TRY(WebIDL::get_buffer_source_copy(chunk.as_object()));
+    // 3-5. NOTE: perform_step_in_parallel() splits buffer into Uint8Arrays and enqueues them in cs's transform.
+    auto input_size = chunk_buffer.value().size();
+    return perform_step_in_parallel(realm, *this, m_transform, input_size, "Unable to compress chunk"sv, [this, chunk_buffer = chunk_buffer.release_value()]() {
         return compress(chunk_buffer, Finish::No);
-    }();
-    if (maybe_buffer.is_error())
-        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, Utf16String::formatted("Unable to compress chunk: {}", maybe_buffer.error()) };
-
-    auto buffer = maybe_buffer.release_value();
-
-    // 3. If buffer is empty, return.
-    if (buffer.is_empty())
-        return {};
-
-    // 4. Split buffer into one or more non-empty pieces and convert them into Uint8Arrays.
-    auto array_buffer = JS::ArrayBuffer::create(realm, move(buffer));
-    auto array = JS::Uint8Array::create(realm, array_buffer->byte_length(), *array_buffer);
-
-    // 5. For each Uint8Array array, enqueue array in cs's transform.
-    TRY(Streams::transform_stream_default_controller_enqueue(*m_transform->controller(), array));
-    return {};
+    });
 }
 
 // https://compression.spec.whatwg.org/#compress-flush-and-enqueue
-WebIDL::ExceptionOr<void> CompressionStream::compress_flush_and_enqueue(JS::Realm& realm)
+GC::Ref<WebIDL::Promise> CompressionStream::compress_flush_and_enqueue(JS::Realm& realm)
 {
     // 1. Let buffer be the result of compressing an empty input with cs's format and context, with the finish flag.
-    auto maybe_buffer = compress({}, Finish::Yes);
-    if (maybe_buffer.is_error())
-        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, Utf16String::formatted("Unable to compress flush: {}", maybe_buffer.error()) };
-
-    auto buffer = maybe_buffer.release_value();
-
-    // 2. If buffer is empty, return.
-    if (buffer.is_empty())
-        return {};
-
-    // 3. Split buffer into one or more non-empty pieces and convert them into Uint8Arrays.
-    auto array_buffer = JS::ArrayBuffer::create(realm, move(buffer));
-    auto array = JS::Uint8Array::create(realm, array_buffer->byte_length(), *array_buffer);
-
-    // 4. For each Uint8Array array, enqueue array in cs's transform.
-    TRY(Streams::transform_stream_default_controller_enqueue(*m_transform->controller(), array));
-    return {};
+    // 2-4. NOTE: perform_step_in_parallel() splits buffer into Uint8Arrays and enqueues them in cs's transform.
+    // NOTE: The compressor has already consumed all earlier input, so this only finishes its output.
+    return perform_step_in_parallel(realm, *this, m_transform, 0, "Unable to compress flush"sv, [this]() {
+        return compress({}, Finish::Yes);
+    });
 }
 
 ErrorOr<ByteBuffer> CompressionStream::compress(ReadonlyBytes bytes, Finish finish)
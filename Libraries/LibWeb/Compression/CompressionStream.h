@@ -47,8 +47,8 @@ private:
 
     virtual void visit_edges(GC::Cell::Visitor&) override;
 
-    WebIDL::ExceptionOr<void> compress_and_enqueue_chunk(JS::Realm&, JS::Value);
-    WebIDL::ExceptionOr<void> compress_flush_and_enqueue(JS::Realm&);
+    WebIDL::ExceptionOr<GC::Ref<WebIDL::Promise>> compress_and_enqueue_chunk(JS::Realm&, JS::Value);
+    GC::Ref<WebIDL::Promise> compress_flush_and_enqueue(JS::Realm&);
 
     enum class Finish {
         No,
@@ -10,11 +10,10 @@
 #include <LibCompress/Gzip.h>
 #include <LibCompress/Zlib.h>
 #include <LibGC/Heap.h>
-#include <LibJS/Runtime/ArrayBuffer.h>
-#include <LibJS/Runtime/TypedArray.h>
 #include <LibWeb/Bindings/CompressionStream.h>
 #include <LibWeb/Bindings/Wrappable.h>
 #include <LibWeb/Compression/DecompressionStream.h>
+#include <LibWeb/Compression/ParallelStep.h>
 #include <LibWeb/HTML/Scripting/Environments.h>
 #include <LibWeb/Streams/ReadableStream.h>
 #include <LibWeb/Streams/TransformStream.h>
@@ -67,18 +66,16 @@ WebIDL::ExceptionOr<GC::Ref<DecompressionStream>> DecompressionStream::create(JS
     // 3. Let transformAlgorithm be an algorithm which takes a chunk argument and runs the decompress and enqueue a chunk
     //    algorithm with this and chunk.
     auto transform_algorithm = GC::create_function(GC::Heap::the(), [stream, realm = GC::Ref(realm)](JS::Value chunk) -> GC::Ref<WebIDL::Promise> {
-        if (auto result = stream->decompress_and_enqueue_chunk(realm, chunk); result.is_error())
+        auto result = stream->decompress_and_enqueue_chunk(realm, chunk);
+        if (result.is_error())
             return WebIDL::create_rejected_promise_from_exception(realm, result.release_error());
 
-        return WebIDL::create_resolved_promise(realm, JS::js_undefined());
+        return result.release_value();
     });
 
     // 4. Let flushAlgorithm be an algorithm which takes no argument and runs the decompress flush and enqueue algorithm with this.
     auto flush_algorithm = GC::create_function(GC::Heap::the(), [stream, realm = GC::Ref(realm)]() -> GC::Ref<WebIDL::Promise> {
-        if (auto result = stream->decompress_flush_and_enqueue(realm); result.is_error())
-            return WebIDL::create_rejected_promise_from_exception(realm, result.release_error());
-
-        return WebIDL::create_resolved_promise(realm, JS::js_undefined());
+        return stream->decompress_flush_and_enqueue(realm);
     });
 
     // 6. Set up this's transform with transformAlgorithm set to transformAlgorithm and flushAlgorithm set to flushAlgorithm.
@@ -103,16 +100,21 @@ void DecompressionStream::visit_edges(GC::Cell::Visitor& visitor)
 }
 
 // https://compression.spec.whatwg.org/#decompress-and-enqueue-a-chunk
-WebIDL::ExceptionOr<void> DecompressionStream::decompress_and_enqueue_chunk(JS::Realm& realm, JS::Value chunk)
+WebIDL::ExceptionOr<GC::Ref<WebIDL::Promise>> DecompressionStream::decompress_and_enqueue_chunk(JS::Realm& realm, JS::Value chunk)
 {
     // 1. If chunk is not a BufferSource type, then throw a TypeError.
     if (!WebIDL::is_buffer_source_type(chunk))
         return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, "Chunk is not a BufferSource type"_utf16 };
 
+    auto chunk_buffer = WebIDL::get_buffer_source_copy(chunk.as_object());
+    if (chunk_buffer.is_error())
+        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, Utf16String::formatted("Unable to decompress chunk: {}", chunk_buffer.error()) };
+
     // 2. Let buffer be the result of decompressing chunk with ds's format and context. If this results in an error,
     //    then throw a TypeError.
-    auto maybe_buffer = [&]() -> ErrorOr<ByteBuffer> {
-        auto chunk_buffer = TRY(WebIDL::get_buffer_source_copy(chunk.as_object()));
+    // 3-5. NOTE: perform_step_in_parallel() splits buffer into Uint8Arrays and enqueues them in ds's transform.
+    auto input_size = chunk_buffer.value().size();
+    return perform_step_in_parallel(realm, *this, m_transform, input_size, "Unable to decompress chunk"sv, [this, chunk_buffer = chunk_buffer.release_value()]() mutable -> ErrorOr<ByteBuffer> {
         TRY(m_input_stream->write_until_depleted(move(chunk_buffer)));
 
         auto decompressed = TRY(ByteBuffer::create_uninitialized(4096));
@@ -120,52 +122,26 @@ WebIDL::ExceptionOr<void> DecompressionStream::decompress_and_enqueue_chunk(JS::
             return TRY(decompressor->read_some(decompressed.bytes())).size();
         }));
         return decompressed.slice(0, size);
-    }();
-    if (maybe_buffer.is_error())
-        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, Utf16String::formatted("Unable to decompress chunk: {}", maybe_buffer.error()) };
-
-    auto buffer = maybe_buffer.release_value();
-
-    // 3. If buffer is empty, return.
-    if (buffer.is_empty())
-        return {};
-
-    // 4. Split buffer into one or more non-empty pieces and convert them into Uint8Arrays.
-    auto array_buffer = JS::ArrayBuffer::create(realm, move(buffer));
-    auto array = JS::Uint8Array::create(realm, array_buffer->byte_length(), *array_buffer);
-
-    // 5. For each Uint8Array array, enqueue array in ds's transform.
-    m_transform->enqueue(array);
-    return {};
+    });
 }
 
 // https://compression.spec.whatwg.org/#decompress-flush-and-enqueue
-WebIDL::ExceptionOr<void> DecompressionStream::decompress_flush_and_enqueue(JS::Realm& realm)
+GC::Ref<WebIDL::Promise> DecompressionStream::decompress_flush_and_enqueue(JS::Realm& realm)
 {
     // 1. Let buffer be the result of decompressing an empty input with ds's format and context, with the finish flag.
-    auto maybe_buffer = m_decompressor.visit([&](auto const& decompressor) -> ErrorOr<ByteBuffer> {
-        return TRY(decompressor->read_until_eof());
-    });
-    if (maybe_buffer.is_error())
-        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, Utf16String::formatted("Unable to decompress flush: {}", maybe_buffer.error()) };
-
-    auto buffer = maybe_buffer.release_value();
-
-    // Note: LibCompress already throws an error if we call read_until_eof and no more progress can be made
-    // 2. If the end of the compressed input has not been reached, then throw a TypeError.
-    VERIFY(m_decompressor.visit([](auto const& decompressor) { return decompressor->is_eof(); }));
-
-    // 3. If buffer is empty, return.
-    if (buffer.is_empty())
-        return {};
+    // 3-5. NOTE: perform_step_in_parallel() splits buffer into Uint8Arrays and enqueues them in ds's transform.
+    // NOTE: Each chunk only decompresses a bounded amount of output, so this decompresses all of the input left over.
+    return perform_step_in_parallel(realm, *this, m_transform, m_input_stream->used_buffer_size(), "Unable to decompress flush"sv, [this]() -> ErrorOr<ByteBuffer> {
+        auto buffer = TRY(m_decompressor.visit([&](auto const& decompressor) -> ErrorOr<ByteBuffer> {
+            return TRY(decompressor->read_until_eof());
+        }));
 
-    // 4. Split buffer into one or more non-empty pieces and convert them into Uint8Arrays.
-    auto array_buffer = JS::ArrayBuffer::create(realm, move(buffer));
-    auto array = JS::Uint8Array::create(realm, array_buffer->byte_length(), *array_buffer);
+        // Note: LibCompress already throws an error if we call read_until_eof and no more progress can be made
+        // 2. If the end of the compressed input has not been reached, then throw a TypeError.
+        VERIFY(m_decompressor.visit([](auto const& decompressor) { return decompressor->is_eof(); }));
 
-    // 5. For each Uint8Array array, enqueue array in ds's transform.
-    m_transform->enqueue(array);
-    return {};
+        return buffer;
+    });
 }
 
 }
@@ -42,8 +42,8 @@ private:
 
     virtual void visit_edges(GC::Cell::Visitor&) override;
 
-    WebIDL::ExceptionOr<void> decompress_and_enqueue_chunk(JS::Realm&, JS::Value);
-    WebIDL::ExceptionOr<void> decompress_flush_and_enqueue(JS::Realm&);
+    WebIDL::ExceptionOr<GC::Ref<WebIDL::Promise>> decompress_and_enqueue_chunk(JS::Realm&, JS::Value);
+    GC::Ref<WebIDL::Promise> decompress_flush_and_enqueue(JS::Realm&);
 
     Decompressor m_decompressor;
     NonnullOwnPtr<AllocatingMemoryStream> m_input_stream;
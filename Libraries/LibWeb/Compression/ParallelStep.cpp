@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibCore/EventLoop.h>
+#include <LibGC/Heap.h>
+#include <LibGC/Root.h>
+#include <LibJS/Runtime/ArrayBuffer.h>
+#include <LibJS/Runtime/TypedArray.h>
+#include <LibThreading/ThreadPool.h>
+#include <LibWeb/Compression/ParallelStep.h>
+#include <LibWeb/HTML/EventLoop/EventLoop.h>
+#include <LibWeb/HTML/Scripting/TemporaryExecutionContext.h>
+#include <LibWeb/Streams/TransformStream.h>
+#include <LibWeb/Streams/TransformStreamOperations.h>
+#include <LibWeb/WebIDL/Promise.h>
+
+namespace Web::Compression {
+
+static WebIDL::ExceptionOr<void> enqueue_step_output(JS::Realm& realm, Streams::TransformStream& transform, ErrorOr<ByteBuffer> output, StringView error_message)
+{
+    if (output.is_error())
+        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, Utf16String::formatted("{}: {}", error_message, output.error()) };
+
+    auto buffer = output.release_value();
+
+    // If buffer is empty, return.
+    if (buffer.is_empty())
+        return {};
+
+    // Split buffer into one or more non-empty pieces and convert them into Uint8Arrays.
+    auto array_buffer = JS::ArrayBuffer::create(realm, move(buffer));
+    auto array = JS::Uint8Array::create(realm, array_buffer->byte_length(), *array_buffer);
+
+    // For each Uint8Array array, enqueue array in the transform.
+    // NOTE: The stream may have been errored while the step was running, so this is allowed to fail.
+    TRY(Streams::transform_stream_default_controller_enqueue(*transform.controller(), array));
+    return {};
+}
+
+GC::Ref<WebIDL::Promise> perform_step_in_parallel(JS::Realm& realm, GC::Ref<GC::Cell> stream, GC::Ref<Streams::TransformStream> transform, size_t input_size, StringView error_message, Function<ErrorOr<ByteBuffer>()> step)
+{
+    if (input_size < parallel_step_minimum_input_size) {
+        if (auto result = enqueue_step_output(realm, transform, step(), error_message); result.is_error())
+            return WebIDL::create_rejected_promise_from_exception(realm, result.release_error());
+
+        return WebIDL::create_resolved_promise(realm, JS::js_undefined());
+    }
+
+    auto promise = WebIDL::create_promise(realm);
+    auto& origin_event_loop = Core::EventLoop::current();
+
+    // Keep the callback on the origin thread, so that the roots it holds are also destroyed there. It keeps the stream
+    // alive until the step is done with its codec state.
+    auto* callback = new Function<void(ErrorOr<ByteBuffer>)>([realm = GC::make_root(realm), stream = GC::make_root(stream), transform = GC::make_root(transform), promise = GC::make_root(promise), error_message](ErrorOr<ByteBuffer> output) mutable {
+        HTML::queue_global_task(HTML::Task::Source::Unspecified, realm->global_object(), GC::create_function(GC::Heap::the(), [realm = GC::Ref(*realm), transform = GC::Ref(*transform), promise = GC::Ref(*promise), output = move(output), error_message]() mutable {
+            HTML::TemporaryExecutionContext context(realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes);
+
+            if (auto result = enqueue_step_output(realm, transform, move(output), error_message); result.is_error()) {
+                WebIDL::reject_promise_with_exception(promise, result.release_error());
+                return;
+            }
+
+            WebIDL::resolve_promise(promise, JS::js_undefined());
+        }));
+    });
+
+    Threading::ThreadPool::the().submit([step = move(step), callback, &origin_event_loop]() mutable {
+        auto output = step();
+
+        origin_event_loop.deferred_invoke([callback, output = move(output)]() mutable {
+            (*callback)(move(output));
+            delete callback;
+        });
+    });
+
+    return promise;
+}
+
+}
@@ -0,0 +1,29 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteBuffer.h>
+#include <AK/Function.h>
+#include <AK/StringView.h>
+#include <LibGC/Ptr.h>
+#include <LibJS/Forward.h>
+#include <LibWeb/Forward.h>
+
+namespace Web::Compression {
+
+// Steps over less input than this are cheaper to run right away than to hand over to the thread pool.
+static constexpr size_t parallel_step_minimum_input_size = 64 * KiB;
+
+// Performs the byte crunching of a compression or decompression step on the thread pool, so that large chunks do not
+// block the event loop. Once it is done, its output is enqueued in transform on this thread, and the returned promise
+// is settled. A step over less than parallel_step_minimum_input_size bytes of input runs synchronously instead.
+//
+// The step may use the codec state of stream, which is kept alive until then. TransformStream does not run another
+// transform or flush algorithm until the returned promise is settled, so only one step uses that state at a time.
+GC::Ref<WebIDL::Promise> perform_step_in_parallel(JS::Realm&, GC::Ref<GC::Cell> stream, GC::Ref<Streams::TransformStream> transform, size_t input_size, StringView error_message, Function<ErrorOr<ByteBuffer>()> step);
+
+}
@@ -201,6 +201,18 @@ WebIDL::ExceptionOr<::Crypto::UnsignedBigInteger> base64_url_uint_decode(JS::Rea
     return ::Crypto::UnsignedBigInteger::import_data(base64_bytes_be);
 }
 
+WebIDL::ExceptionOr<ByteBuffer> result_of_parallel_operation(JS::VM& vm, ErrorOr<ByteBuffer> result)
+{
+    if (!result.is_error())
+        return result.release_value();
+
+    auto error = result.release_error();
+    if (error.is_errno() && error.code() == ENOMEM)
+        return vm.throw_completion<JS::InternalError>(vm.error_message(JS::VM::ErrorMessage::OutOfMemory));
+
+    return WebIDL::OperationError::create(Utf16String::from_utf8(error.string_literal()));
+}
+
 // https://w3c.github.io/webcrypto/#concept-parse-an-asn1-structure
 template<typename Structure>
 static WebIDL::ExceptionOr<Structure> parse_an_ASN1_structure(JS::Realm&, ReadonlyBytes data, bool exact_data = true)
@@ -2558,8 +2570,20 @@ WebIDL::ExceptionOr<ExportKeyResult> RSASSAPKCS1::export_key(JS::Realm& realm, K
     return result.release_value();
 }
 
+WebIDL::ExceptionOr<ByteBuffer> AesCbc::encrypt(JS::Realm& realm, AlgorithmParams const& params, GC::Ref<CryptoKey> key, ByteBuffer const& plaintext)
+{
+    auto operation = TRY(encrypt_in_parallel(realm, params, key));
+    return result_of_parallel_operation(realm.vm(), operation(plaintext));
+}
+
+WebIDL::ExceptionOr<ByteBuffer> AesCbc::decrypt(JS::Realm& realm, AlgorithmParams const& params, GC::Ref<CryptoKey> key, ByteBuffer const& ciphertext)
+{
+    auto operation = TRY(decrypt_in_parallel(realm, params, key));
+    return result_of_parallel_operation(realm.vm(), operation(ciphertext));
+}
+
 // https://w3c.github.io/webcrypto/#aes-cbc-operations-encrypt
-WebIDL::ExceptionOr<ByteBuffer> AesCbc::encrypt(JS::Realm&, AlgorithmParams const& params, GC::Ref<CryptoKey> key, ByteBuffer const& plaintext)
+WebIDL::ExceptionOr<AlgorithmMethods::ParallelOperation> AesCbc::encrypt_in_parallel(JS::Realm&, AlgorithmParams const& params, GC::Ref<CryptoKey> key)
 {
     auto const& normalized_algorithm = static_cast<AesCbcParams const&>(params);
 
@@ -2567,21 +2591,21 @@ WebIDL::ExceptionOr<ByteBuffer> AesCbc::encrypt(JS::Realm&, AlgorithmParams cons
     if (normalized_algorithm.iv.size() != 16)
         return WebIDL::OperationError::create("IV to AES-CBC must be exactly 16 bytes"_utf16);
 
-    // 2. Let paddedPlaintext be the result of adding padding octets to the contents of plaintext according to the procedure defined in Section 10.3 of [RFC2315], step 2, with a value of k of 16.
-    // 3. Let ciphertext be the result of performing the CBC Encryption operation described in Section 6.2 of [NIST-SP800-38A] using AES as the block cipher, the contents of the iv member of normalizedAlgorithm as the IV input parameter and paddedPlaintext as the input plaintext.
-    auto key_bytes = key->handle().get<ByteBuffer>();
-
-    ::Crypto::Cipher::AESCBCCipher cipher(key_bytes);
-    auto maybe_ciphertext = cipher.encrypt(plaintext, normalized_algorithm.iv);
-    if (maybe_ciphertext.is_error())
-        return WebIDL::OperationError::create("Failed to encrypt"_utf16);
+    return ParallelOperation { [key_bytes = key->handle().get<ByteBuffer>(), iv = normalized_algorithm.iv](ReadonlyBytes plaintext) -> ErrorOr<ByteBuffer> {
+        // 2. Let paddedPlaintext be the result of adding padding octets to the contents of plaintext according to the procedure defined in Section 10.3 of [RFC2315], step 2, with a value of k of 16.
+        // 3. Let ciphertext be the result of performing the CBC Encryption operation described in Section 6.2 of [NIST-SP800-38A] using AES as the block cipher, the contents of the iv member of normalizedAlgorithm as the IV input parameter and paddedPlaintext as the input plaintext.
+        ::Crypto::Cipher::AESCBCCipher cipher(key_bytes);
+        auto maybe_ciphertext = cipher.encrypt(plaintext, iv);
+        if (maybe_ciphertext.is_error())
+            return Error::from_string_literal("Failed to encrypt");
 
-    // 4. Return the result of creating an ArrayBuffer containing ciphertext.
-    return maybe_ciphertext.release_value();
+        // 4. Return the result of creating an ArrayBuffer containing ciphertext.
+        return maybe_ciphertext.release_value();
+    } };
 }
 
 // https://w3c.github.io/webcrypto/#aes-cbc-operations-decrypt
-WebIDL::ExceptionOr<ByteBuffer> AesCbc::decrypt(JS::Realm&, AlgorithmParams const& params, GC::Ref<CryptoKey> key, ByteBuffer const& ciphertext)
+WebIDL::ExceptionOr<AlgorithmMethods::ParallelOperation> AesCbc::decrypt_in_parallel(JS::Realm&, AlgorithmParams const& params, GC::Ref<CryptoKey> key)
 {
     auto const& normalized_algorithm = static_cast<AesCbcParams const&>(params);
 
@@ -2589,21 +2613,23 @@ WebIDL::ExceptionOr<ByteBuffer> AesCbc::decrypt(JS::Realm&, AlgorithmParams cons
     if (normalized_algorithm.iv.size() != 16)
         return WebIDL::OperationError::create("IV to AES-CBC must be exactly 16 bytes"_utf16);
 
-    // 2. If the length of ciphertext is zero or is not a multiple of 16 bytes, then throw an OperationError.
-    if (ciphertext.is_empty() || ciphertext.size() % 16 != 0)
-        return WebIDL::OperationError::create("Ciphertext length must be a multiple of 16 bytes"_utf16);
+    return ParallelOperation { [key_bytes = key->handle().get<ByteBuffer>(), iv = normalized_algorithm.iv](ReadonlyBytes ciphertext) -> ErrorOr<ByteBuffer> {
+        // 2. If the length of ciphertext is zero or is not a multiple of 16 bytes, then throw an OperationError.
+        if (ciphertext.is_empty() || ciphertext.size() % 16 != 0)
+            return Error::from_string_literal("Ciphertext length must be a multiple of 16 bytes");
 
-    // 3. Let paddedPlaintext be the result of performing the CBC Decryption operation described in Section 6.2 of [NIST-SP800-38A] using AES as the block cipher, the iv member of normalizedAlgorithm as the IV input parameter and ciphertext as the input ciphertext.
-    // 4. Let p be the value of the last octet of paddedPlaintext.
-    // 5. If p is zero or greater than 16, or if any of the last p octets of paddedPlaintext have a value which is not p, then throw an OperationError.
-    // 6. Let plaintext be the result of removing p octets from the end of paddedPlaintext.
-    ::Crypto::Cipher::AESCBCCipher cipher(key->handle().get<ByteBuffer>());
-    auto maybe_plaintext = cipher.decrypt(ciphertext, normalized_algorithm.iv);
-    if (maybe_plaintext.is_error())
-        return WebIDL::OperationError::create("Failed to decrypt"_utf16);
+        // 3. Let paddedPlaintext be the result of performing the CBC Decryption operation described in Section 6.2 of [NIST-SP800-38A] using AES as the block cipher, the iv member of normalizedAlgorithm as the IV input parameter and ciphertext as the input ciphertext.
+        // 4. Let p be the value of the last octet of paddedPlaintext.
+        // 5. If p is zero or greater than 16, or if any of the last p octets of paddedPlaintext have a value which is not p, then throw an OperationError.
+        // 6. Let plaintext be the result of removing p octets from the end of paddedPlaintext.
+        ::Crypto::Cipher::AESCBCCipher cipher(key_bytes);
+        auto maybe_plaintext = cipher.decrypt(ciphertext, iv);
+        if (maybe_plaintext.is_error())
+            return Error::from_string_literal("Failed to decrypt");
 
-    // 7. Return plaintext.
-    return maybe_plaintext.release_value();
+        // 7. Return plaintext.
+        return maybe_plaintext.release_value();
+    } };
 }
 
 // https://w3c.github.io/webcrypto/#aes-cbc-operations-import-key
@@ -3082,8 +3108,20 @@ WebIDL::ExceptionOr<Variant<GC::Ref<CryptoKey>, CryptoKeyPair>> AesCtr::generate
     return { key };
 }
 
+WebIDL::ExceptionOr<ByteBuffer> AesCtr::encrypt(JS::Realm& realm, AlgorithmParams const& params, GC::Ref<CryptoKey> key, ByteBuffer const& plaintext)
+{
+    auto operation = TRY(encrypt_in_parallel(realm, params, key));
+    return result_of_parallel_operation(realm.vm(), operation(plaintext));
+}
+
+WebIDL::ExceptionOr<ByteBuffer> AesCtr::decrypt(JS::Realm& realm, AlgorithmParams const& params, GC::Ref<CryptoKey> key, ByteBuffer const& ciphertext)
+{
+    auto operation = TRY(decrypt_in_parallel(realm, params, key));
+    return result_of_parallel_operation(realm.vm(), operation(ciphertext));
+}
+
 // https://w3c.github.io/webcrypto/#aes-ctr-operations-encrypt
-WebIDL::ExceptionOr<ByteBuffer> AesCtr::encrypt(JS::Realm&, AlgorithmParams const& params, GC::Ref<CryptoKey> key, ByteBuffer const& plaintext)
+WebIDL::ExceptionOr<AlgorithmMethods::ParallelOperation> AesCtr::encrypt_in_parallel(JS::Realm&, AlgorithmParams const& params, GC::Ref<CryptoKey> key)
 {
     // 1. If the counter member of normalizedAlgorithm does not have length 16 bytes, then throw an OperationError.
     auto const& normalized_algorithm = static_cast<AesCtrParams const&>(params);
@@ -3101,17 +3139,19 @@ WebIDL::ExceptionOr<ByteBuffer> AesCtr::encrypt(JS::Realm&, AlgorithmParams cons
     //    the contents of the counter member of normalizedAlgorithm as the initial value of the counter block,
     //    the length member of normalizedAlgorithm as the input parameter m to the standard counter block incrementing function defined in Appendix B.1 of [NIST-SP800-38A]
     //    and the contents of plaintext as the input plaintext.
-    ::Crypto::Cipher::AESCTRCipher cipher(key->handle().get<ByteBuffer>());
-    auto maybe_ciphertext = cipher.encrypt(plaintext, counter);
-    if (maybe_ciphertext.is_error())
-        return WebIDL::OperationError::create("Encryption failed"_utf16);
+    return ParallelOperation { [key_bytes = key->handle().get<ByteBuffer>(), counter](ReadonlyBytes plaintext) -> ErrorOr<ByteBuffer> {
+        ::Crypto::Cipher::AESCTRCipher cipher(key_bytes);
+        auto maybe_ciphertext = cipher.encrypt(plaintext, counter);
+        if (maybe_ciphertext.is_error())
+            return Error::from_string_literal("Encryption failed");
 
-    // 4. Return the result of creating an ArrayBuffer containing plaintext.
-    return maybe_ciphertext.release_value();
+        // 4. Return the result of creating an ArrayBuffer containing plaintext.
+        return maybe_ciphertext.release_value();
+    } };
 }
 
 // https://w3c.github.io/webcrypto/#aes-ctr-operations-decrypt
-WebIDL::ExceptionOr<ByteBuffer> AesCtr::decrypt(JS::Realm&, AlgorithmParams const& params, GC::Ref<CryptoKey> key, ByteBuffer const& ciphertext)
+WebIDL::ExceptionOr<AlgorithmMethods::ParallelOperation> AesCtr::decrypt_in_parallel(JS::Realm&, AlgorithmParams const& params, GC::Ref<CryptoKey> key)
 {
     // 1. If the counter member of normalizedAlgorithm does not have length 16 bytes, then throw an OperationError.
     auto const& normalized_algorithm = static_cast<AesCtrParams const&>(params);
@@ -3129,13 +3169,15 @@ WebIDL::ExceptionOr<ByteBuffer> AesCtr::decrypt(JS::Realm&, AlgorithmParams cons
     //    the contents of the counter member of normalizedAlgorithm as the initial value of the counter block,
     //    the length member of normalizedAlgorithm as the input parameter m to the standard counter block incrementing function defined in Appendix B.1 of [NIST-SP800-38A]
     //    and the contents of ciphertext as the input ciphertext.
-    ::Crypto::Cipher::AESCTRCipher cipher(key->handle().get<ByteBuffer>());
-    auto maybe_plaintext = cipher.decrypt(ciphertext, counter);
-    if (maybe_plaintext.is_error())
-        return WebIDL::OperationError::create("Decryption failed"_utf16);
+    return ParallelOperation { [key_bytes = key->handle().get<ByteBuffer>(), counter](ReadonlyBytes ciphertext) -> ErrorOr<ByteBuffer> {
+        ::Crypto::Cipher::AESCTRCipher cipher(key_bytes);
+        auto maybe_plaintext = cipher.decrypt(ciphertext, counter);
+        if (maybe_plaintext.is_error())
+            return Error::from_string_literal("Decryption failed");
 
-    // 4. Return the result of creating an ArrayBuffer containing plaintext.
-    return maybe_plaintext.release_value();
+        // 4. Return the result of creating an ArrayBuffer containing plaintext.
+        return maybe_plaintext.release_value();
+    } };
 }
 
 // https://w3c.github.io/webcrypto/#aes-gcm-operations-get-key-length
@@ -3336,14 +3378,24 @@ WebIDL::ExceptionOr<ExportKeyResult> AesGcm::export_key(JS::Realm& realm, KeyFor
     return result.release_value();
 }
 
-// https://w3c.github.io/webcrypto/#aes-gcm-operations-encrypt
 WebIDL::ExceptionOr<ByteBuffer> AesGcm::encrypt(JS::Realm& realm, AlgorithmParams const& params, GC::Ref<CryptoKey> key, ByteBuffer const& plaintext)
+{
+    auto operation = TRY(encrypt_in_parallel(realm, params, key));
+    return result_of_parallel_operation(realm.vm(), operation(plaintext));
+}
+
+WebIDL::ExceptionOr<ByteBuffer> AesGcm::decrypt(JS::Realm& realm, AlgorithmParams const& params, GC::Ref<CryptoKey> key, ByteBuffer const& ciphertext)
+{
+    auto operation = TRY(decrypt_in_parallel(realm, params, key));
+    return result_of_parallel_operation(realm.vm(), operation(ciphertext));
+}
+
+// https://w3c.github.io/webcrypto/#aes-gcm-operations-encrypt
+WebIDL::ExceptionOr<AlgorithmMethods::ParallelOperation> AesGcm::encrypt_in_parallel(JS::Realm&, AlgorithmParams const& params, GC::Ref<CryptoKey> key)
 {
     auto const& normalized_algorithm = static_cast<AesGcmParams const&>(params);
 
-    // 1. If plaintext has a length greater than 2^39 - 256 bytes, then throw an OperationError.
-    if (plaintext.size() > (1ULL << 39) - 256)
-        return WebIDL::OperationError::create("Invalid plaintext length"_utf16);
+    // NOTE: Step 1 depends on the plaintext, so we perform it in parallel below.
 
     // 2. If the iv member of normalizedAlgorithm has a length greater than 2^64 - 1 bytes, then throw an OperationError.
     // NOTE: This is not possible
@@ -3374,23 +3426,28 @@ WebIDL::ExceptionOr<ByteBuffer> AesGcm::encrypt(JS::Realm& realm, AlgorithmParam
     //    the contents of additionalData as the A input parameter,
     //    tagLength as the t pre-requisite
     //    and the contents of plaintext as the input plaintext.
-    ::Crypto::Cipher::AESGCMCipher cipher(key->handle().get<ByteBuffer>());
-    auto maybe_encrypted = cipher.encrypt(plaintext, normalized_algorithm.iv, additional_data, tag_length / 8);
-    if (maybe_encrypted.is_error()) {
-        return WebIDL::OperationError::create("Encryption failed"_utf16);
-    }
+    return ParallelOperation { [key_bytes = key->handle().get<ByteBuffer>(), iv = normalized_algorithm.iv, additional_data = move(additional_data), tag_length](ReadonlyBytes plaintext) -> ErrorOr<ByteBuffer> {
+        // 1. If plaintext has a length greater than 2^39 - 256 bytes, then throw an OperationError.
+        if (plaintext.size() > (1ULL << 39) - 256)
+            return Error::from_string_literal("Invalid plaintext length");
+
+        ::Crypto::Cipher::AESGCMCipher cipher(key_bytes);
+        auto maybe_encrypted = cipher.encrypt(plaintext, iv, additional_data, tag_length / 8);
+        if (maybe_encrypted.is_error())
+            return Error::from_string_literal("Encryption failed");
 
-    auto [ciphertext, tag] = maybe_encrypted.release_value();
+        auto [ciphertext, tag] = maybe_encrypted.release_value();
 
-    // 7. Let ciphertext be equal to C | T, where '|' denotes concatenation.
-    TRY_OR_THROW_OOM(realm.vm(), ciphertext.try_append(tag));
+        // 7. Let ciphertext be equal to C | T, where '|' denotes concatenation.
+        TRY(ciphertext.try_append(tag));
 
-    // 8. Return the result of creating an ArrayBuffer containing ciphertext.
-    return ciphertext;
+        // 8. Return the result of creating an ArrayBuffer containing ciphertext.
+        return ciphertext;
+    } };
 }
 
 // https://w3c.github.io/webcrypto/#aes-gcm-operations-decrypt
-WebIDL::ExceptionOr<ByteBuffer> AesGcm::decrypt(JS::Realm& realm, AlgorithmParams const& params, GC::Ref<CryptoKey> key, ByteBuffer const& ciphertext)
+WebIDL::ExceptionOr<AlgorithmMethods::ParallelOperation> AesGcm::decrypt_in_parallel(JS::Realm&, AlgorithmParams const& params, GC::Ref<CryptoKey> key)
 {
     auto const& normalized_algorithm = static_cast<AesGcmParams const&>(params);
 
@@ -3408,9 +3465,7 @@ WebIDL::ExceptionOr<ByteBuffer> AesGcm::decrypt(JS::Realm& realm, AlgorithmParam
     else
         return WebIDL::OperationError::create("Invalid tag length"_utf16);
 
-    // 2. If ciphertext has a length less than tagLength bits, then throw an OperationError.
-    if (ciphertext.size() < tag_length / 8)
-        return WebIDL::OperationError::create("Invalid ciphertext length"_utf16);
+    // NOTE: Step 2 depends on the ciphertext, so we perform it in parallel below.
 
     // 3. If the iv member of normalizedAlgorithm has a length greater than 2^64 - 1 bytes, then throw an OperationError.
     // NOTE: This is not possible
@@ -3418,34 +3473,40 @@ WebIDL::ExceptionOr<ByteBuffer> AesGcm::decrypt(JS::Realm& realm, AlgorithmParam
     // 4. If the additionalData member of normalizedAlgorithm is present and has a length greater than 2^64 - 1 bytes, then throw an OperationError.
     // NOTE: This is not possible
 
-    // 5. Let tag be the last tagLength bits of ciphertext.
-    auto tag_bytes = tag_length / 8;
-    auto tag = TRY_OR_THROW_OOM(realm.vm(), ciphertext.slice(ciphertext.size() - tag_bytes, tag_bytes));
-
-    // 6. Let actualCiphertext be the result of removing the last tagLength bits from ciphertext.
-    auto actual_ciphertext = TRY_OR_THROW_OOM(realm.vm(), ciphertext.slice(0, ciphertext.size() - tag_bytes));
-
     // 7. Let additionalData be the contents of the additionalData member of normalizedAlgorithm if present or the empty octet string otherwise.
     auto additional_data = normalized_algorithm.additional_data.value_or(ByteBuffer {});
 
-    // 8. Perform the Authenticated Decryption Function described in Section 7.2 of [NIST-SP800-38D] using
-    //    AES as the block cipher,
-    //    the contents of the iv member of normalizedAlgorithm as the IV input parameter,
-    //    the contents of additionalData as the A input parameter,
-    //    tagLength as the t pre-requisite,
-    //    the contents of actualCiphertext as the input ciphertext, C
-    //    and the contents of tag as the authentication tag, T.
-    // If the result of the algorithm is the indication of inauthenticity, "FAIL": throw an OperationError
-    ::Crypto::Cipher::AESGCMCipher cipher(key->handle().get<ByteBuffer>());
-    auto maybe_plaintext = cipher.decrypt(actual_ciphertext.bytes(), normalized_algorithm.iv, additional_data, tag);
-    if (maybe_plaintext.is_error()) {
-        dbgln("FAILED: {}", maybe_plaintext.error());
-        return WebIDL::OperationError::create("Decryption failed"_utf16);
-    }
-
-    // Otherwise: Let plaintext be the output P of the Authenticated Decryption Function.
-    // 9. Return the result of creating an ArrayBuffer containing plaintext.
-    return maybe_plaintext.release_value();
+    return ParallelOperation { [key_bytes = key->handle().get<ByteBuffer>(), iv = normalized_algorithm.iv, additional_data = move(additional_data), tag_length](ReadonlyBytes ciphertext) -> ErrorOr<ByteBuffer> {
+        // 2. If ciphertext has a length less than tagLength bits, then throw an OperationError.
+        if (ciphertext.size() < tag_length / 8)
+            return Error::from_string_literal("Invalid ciphertext length");
+
+        // 5. Let tag be the last tagLength bits of ciphertext.
+        auto tag_bytes = tag_length / 8;
+        auto tag = ciphertext.slice(ciphertext.size() - tag_bytes, tag_bytes);
+
+        // 6. Let actualCiphertext be the result of removing the last tagLength bits from ciphertext.
+        auto actual_ciphertext = ciphertext.slice(0, ciphertext.size() - tag_bytes);
+
+        // 8. Perform the Authenticated Decryption Function described in Section 7.2 of [NIST-SP800-38D] using
+        //    AES as the block cipher,
+        //    the contents of the iv member of normalizedAlgorithm as the IV input parameter,
+        //    the contents of additionalData as the A input parameter,
+        //    tagLength as the t pre-requisite,
+        //    the contents of actualCiphertext as the input ciphertext, C
+        //    and the contents of tag as the authentication tag, T.
+        // If the result of the algorithm is the indication of inauthenticity, "FAIL": throw an OperationError
+        ::Crypto::Cipher::AESGCMCipher cipher(key_bytes);
+        auto maybe_plaintext = cipher.decrypt(actual_ciphertext, iv, additional_data, tag);
+        if (maybe_plaintext.is_error()) {
+            dbgln("FAILED: {}", maybe_plaintext.error());
+            return Error::from_string_literal("Decryption failed");
+        }
+
+        // Otherwise: Let plaintext be the output P of the Authenticated Decryption Function.
+        // 9. Return the result of creating an ArrayBuffer containing plaintext.
+        return maybe_plaintext.release_value();
+    } };
 }
 
 // https://w3c.github.io/webcrypto/#aes-gcm-operations-generate-key
@@ -3808,8 +3869,14 @@ WebIDL::ExceptionOr<GC::Ref<CryptoKey>> HKDF::import_key(JS::Realm&, AlgorithmPa
     return key;
 }
 
+WebIDL::ExceptionOr<ByteBuffer> SHA::digest(JS::Realm& realm, AlgorithmParams const& algorithm, ByteBuffer const& data)
+{
+    auto operation = TRY(digest_in_parallel(realm, algorithm));
+    return result_of_parallel_operation(realm.vm(), operation(data));
+}
+
 // https://w3c.github.io/webcrypto/#sha-operations-digest
-WebIDL::ExceptionOr<ByteBuffer> SHA::digest(JS::Realm&, AlgorithmParams const& algorithm, ByteBuffer const& data)
+WebIDL::ExceptionOr<AlgorithmMethods::ParallelOperation> SHA::digest_in_parallel(JS::Realm&, AlgorithmParams const& algorithm)
 {
     auto& algorithm_name = algorithm.name;
 
@@ -3832,15 +3899,17 @@ WebIDL::ExceptionOr<ByteBuffer> SHA::digest(JS::Realm&, AlgorithmParams const& a
         return WebIDL::NotSupportedError::create(Utf16String::formatted("Invalid hash function '{}'", algorithm_name));
     }
 
-    ::Crypto::Hash::Manager hash { hash_kind };
-    hash.update(data);
+    return ParallelOperation { [hash_kind](ReadonlyBytes data) -> ErrorOr<ByteBuffer> {
+        ::Crypto::Hash::Manager hash { hash_kind };
+        hash.update(data);
 
-    auto digest = hash.digest();
-    auto result_buffer = ByteBuffer::copy(digest.immutable_data(), hash.digest_size());
-    if (result_buffer.is_error())
-        return WebIDL::OperationError::create("Failed to create result buffer"_utf16);
+        auto digest = hash.digest();
+        auto result_buffer = ByteBuffer::copy(digest.immutable_data(), hash.digest_size());
+        if (result_buffer.is_error())
+            return Error::from_string_literal("Failed to create result buffer");
 
-    return result_buffer.release_value();
+        return result_buffer.release_value();
+    } };
 }
 
 // https://w3c.github.io/webcrypto/#ecdsa-operations-generate-key
@@ -6839,8 +6908,14 @@ WebIDL::ExceptionOr<Optional<u32>> HKDF::get_key_length(JS::Realm&, AlgorithmPar
     return Optional<u32> {};
 }
 
-// https://w3c.github.io/webcrypto/#pbkdf2-operations-derive-bits
 WebIDL::ExceptionOr<ByteBuffer> PBKDF2::derive_bits(JS::Realm& realm, AlgorithmParams const& params, GC::Ref<CryptoKey> key, Optional<u32> length_optional)
+{
+    auto operation = TRY(derive_bits_in_parallel(realm, params, key, length_optional));
+    return result_of_parallel_operation(realm.vm(), operation({}));
+}
+
+// https://w3c.github.io/webcrypto/#pbkdf2-operations-derive-bits
+WebIDL::ExceptionOr<AlgorithmMethods::ParallelOperation> PBKDF2::derive_bits_in_parallel(JS::Realm& realm, AlgorithmParams const& params, GC::Ref<CryptoKey> key, Optional<u32> length_optional)
 {
     auto const& normalized_algorithm = static_cast<PBKDF2Params const&>(params);
 
@@ -6878,15 +6953,17 @@ WebIDL::ExceptionOr<ByteBuffer> PBKDF2::derive_bits(JS::Realm& realm, AlgorithmP
         return WebIDL::NotSupportedError::create(Utf16String::formatted("Invalid hash function '{}'", hash_algorithm));
     }());
 
-    ::Crypto::Hash::PBKDF2 pbkdf2(hash_kind);
-    auto maybe_result = pbkdf2.derive_key(password, salt, iterations, derived_key_length_bytes);
+    return ParallelOperation { [hash_kind, password = move(password), salt = move(salt), iterations, derived_key_length_bytes](ReadonlyBytes) -> ErrorOr<ByteBuffer> {
+        ::Crypto::Hash::PBKDF2 pbkdf2(hash_kind);
+        auto maybe_result = pbkdf2.derive_key(password, salt, iterations, derived_key_length_bytes);
 
-    // 5. If the key derivation operation fails, then throw an OperationError.
-    if (maybe_result.is_error())
-        return WebIDL::OperationError::create("Failed to derive key"_utf16);
+        // 5. If the key derivation operation fails, then throw an OperationError.
+        if (maybe_result.is_error())
+            return Error::from_string_literal("Failed to derive key");
 
-    // 6. Return result
-    return maybe_result.release_value();
+        // 6. Return result
+        return maybe_result.release_value();
+    } };
 }
 
 // https://w3c.github.io/webcrypto/#pbkdf2-operations-get-key-length
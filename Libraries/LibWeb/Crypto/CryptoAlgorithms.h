@@ -9,6 +9,7 @@
 #pragma once
 
 #include <AK/EnumBits.h>
+#include <AK/Function.h>
 #include <AK/String.h>
 #include <AK/Utf16String.h>
 #include <LibCrypto/BigInt/UnsignedBigInteger.h>
@@ -314,6 +315,17 @@ class AlgorithmMethods {
 public:
     virtual ~AlgorithmMethods();
 
+    // The CPU-heavy rest of an operation, which does not touch the JS heap and may therefore run on a background thread.
+    // It takes the data of the operation, if there is any. Any error it returns is reported as an OperationError.
+    using ParallelOperation = Function<ErrorOr<ByteBuffer>(ReadonlyBytes)>;
+
+    // Algorithms that support it perform all steps of an operation that do not depend on its data here, and return the
+    // rest of the operation. A null function means the operation has to run on the main thread instead.
+    virtual WebIDL::ExceptionOr<ParallelOperation> encrypt_in_parallel(JS::Realm&, AlgorithmParams const&, GC::Ref<CryptoKey>) { return ParallelOperation {}; }
+    virtual WebIDL::ExceptionOr<ParallelOperation> decrypt_in_parallel(JS::Realm&, AlgorithmParams const&, GC::Ref<CryptoKey>) { return ParallelOperation {}; }
+    virtual WebIDL::ExceptionOr<ParallelOperation> digest_in_parallel(JS::Realm&, AlgorithmParams const&) { return ParallelOperation {}; }
+    virtual WebIDL::ExceptionOr<ParallelOperation> derive_bits_in_parallel(JS::Realm&, AlgorithmParams const&, GC::Ref<CryptoKey>, Optional<u32>) { return ParallelOperation {}; }
+
     virtual WebIDL::ExceptionOr<ByteBuffer> encrypt(JS::Realm&, AlgorithmParams const&, GC::Ref<CryptoKey>, ByteBuffer const&)
     {
         return WebIDL::NotSupportedError::create("encrypt is not supported"_utf16);
@@ -442,6 +454,8 @@ class AesCbc : public AlgorithmMethods {
 public:
     virtual WebIDL::ExceptionOr<ByteBuffer> encrypt(JS::Realm& realm, AlgorithmParams const&, GC::Ref<CryptoKey>, ByteBuffer const&) override;
     virtual WebIDL::ExceptionOr<ByteBuffer> decrypt(JS::Realm& realm, AlgorithmParams const&, GC::Ref<CryptoKey>, ByteBuffer const&) override;
+    virtual WebIDL::ExceptionOr<ParallelOperation> encrypt_in_parallel(JS::Realm& realm, AlgorithmParams const&, GC::Ref<CryptoKey>) override;
+    virtual WebIDL::ExceptionOr<ParallelOperation> decrypt_in_parallel(JS::Realm& realm, AlgorithmParams const&, GC::Ref<CryptoKey>) override;
     virtual WebIDL::ExceptionOr<GC::Ref<CryptoKey>> import_key(JS::Realm& realm, AlgorithmParams const&, KeyFormat, CryptoKey::ImportKeyData, bool, Vector<KeyUsage> const&) override;
     virtual WebIDL::ExceptionOr<Variant<GC::Ref<CryptoKey>, CryptoKeyPair>> generate_key(JS::Realm& realm, AlgorithmParams const&, bool, Vector<KeyUsage> const&) override;
     virtual WebIDL::ExceptionOr<ExportKeyResult> export_key(JS::Realm& realm, KeyFormat, GC::Ref<CryptoKey>) override;
@@ -461,6 +475,8 @@ public:
     virtual WebIDL::ExceptionOr<Variant<GC::Ref<CryptoKey>, CryptoKeyPair>> generate_key(JS::Realm& realm, AlgorithmParams const&, bool, Vector<KeyUsage> const&) override;
     virtual WebIDL::ExceptionOr<ByteBuffer> encrypt(JS::Realm& realm, AlgorithmParams const&, GC::Ref<CryptoKey>, ByteBuffer const&) override;
     virtual WebIDL::ExceptionOr<ByteBuffer> decrypt(JS::Realm& realm, AlgorithmParams const&, GC::Ref<CryptoKey>, ByteBuffer const&) override;
+    virtual WebIDL::ExceptionOr<ParallelOperation> encrypt_in_parallel(JS::Realm& realm, AlgorithmParams const&, GC::Ref<CryptoKey>) override;
+    virtual WebIDL::ExceptionOr<ParallelOperation> decrypt_in_parallel(JS::Realm& realm, AlgorithmParams const&, GC::Ref<CryptoKey>) override;
 
     static NonnullOwnPtr<AlgorithmMethods> create() { return adopt_own(*new AesCtr); }
 
@@ -475,6 +491,8 @@ public:
     virtual WebIDL::ExceptionOr<ExportKeyResult> export_key(JS::Realm& realm, KeyFormat, GC::Ref<CryptoKey>) override;
     virtual WebIDL::ExceptionOr<ByteBuffer> encrypt(JS::Realm& realm, AlgorithmParams const&, GC::Ref<CryptoKey>, ByteBuffer const&) override;
     virtual WebIDL::ExceptionOr<ByteBuffer> decrypt(JS::Realm& realm, AlgorithmParams const&, GC::Ref<CryptoKey>, ByteBuffer const&) override;
+    virtual WebIDL::ExceptionOr<ParallelOperation> encrypt_in_parallel(JS::Realm& realm, AlgorithmParams const&, GC::Ref<CryptoKey>) override;
+    virtual WebIDL::ExceptionOr<ParallelOperation> decrypt_in_parallel(JS::Realm& realm, AlgorithmParams const&, GC::Ref<CryptoKey>) override;
     virtual WebIDL::ExceptionOr<Variant<GC::Ref<CryptoKey>, CryptoKeyPair>> generate_key(JS::Realm& realm, AlgorithmParams const&, bool, Vector<KeyUsage> const&) override;
 
     static NonnullOwnPtr<AlgorithmMethods> create() { return adopt_own(*new AesGcm); }
@@ -514,6 +532,7 @@ class PBKDF2 : public AlgorithmMethods {
 public:
     virtual WebIDL::ExceptionOr<GC::Ref<CryptoKey>> import_key(JS::Realm& realm, AlgorithmParams const&, KeyFormat, CryptoKey::ImportKeyData, bool, Vector<KeyUsage> const&) override;
     virtual WebIDL::ExceptionOr<ByteBuffer> derive_bits(JS::Realm& realm, AlgorithmParams const&, GC::Ref<CryptoKey>, Optional<u32>) override;
+    virtual WebIDL::ExceptionOr<ParallelOperation> derive_bits_in_parallel(JS::Realm& realm, AlgorithmParams const&, GC::Ref<CryptoKey>, Optional<u32>) override;
     virtual WebIDL::ExceptionOr<Optional<u32>> get_key_length(JS::Realm& realm, AlgorithmParams const&) override;
 
     static NonnullOwnPtr<AlgorithmMethods> create() { return adopt_own(*new PBKDF2); }
@@ -525,6 +544,7 @@ private:
 class SHA : public AlgorithmMethods {
 public:
     virtual WebIDL::ExceptionOr<ByteBuffer> digest(JS::Realm& realm, AlgorithmParams const&, ByteBuffer const&) override;
+    virtual WebIDL::ExceptionOr<ParallelOperation> digest_in_parallel(JS::Realm& realm, AlgorithmParams const&) override;
 
     static NonnullOwnPtr<AlgorithmMethods> create() { return adopt_own(*new SHA); }
 
@@ -878,5 +898,6 @@ private:
 ErrorOr<Utf16String> base64_url_uint_encode(::Crypto::UnsignedBigInteger);
 WebIDL::ExceptionOr<ByteBuffer> base64_url_bytes_decode(JS::Realm&, Utf16String const& base64_url_string);
 WebIDL::ExceptionOr<::Crypto::UnsignedBigInteger> base64_url_uint_decode(JS::Realm&, Utf16String const& base64_url_string);
+WebIDL::ExceptionOr<ByteBuffer> result_of_parallel_operation(JS::VM&, ErrorOr<ByteBuffer>);
 
 }
@@ -10,12 +10,14 @@
 #include <AK/NeverDestroyed.h>
 #include <AK/QuickSort.h>
 #include <LibCrypto/Hash/HashManager.h>
+#include <LibCore/EventLoop.h>
 #include <LibGC/Heap.h>
 #include <LibJS/Runtime/ArrayBuffer.h>
 #include <LibJS/Runtime/JSONObject.h>
 #include <LibJS/Runtime/Object.h>
 #include <LibJS/Runtime/PrimitiveString.h>
 #include <LibJS/Runtime/ValueInlines.h>
+#include <LibThreading/ThreadPool.h>
 #include <LibWeb/Crypto/SubtleCrypto.h>
 #include <LibWeb/HTML/Scripting/TemporaryExecutionContext.h>
 #include <LibWeb/Platform/EventLoopPlugin.h>
@@ -58,6 +60,38 @@ SubtleCrypto::SubtleCrypto()
 
 SubtleCrypto::~SubtleCrypto() = default;
 
+// Performs the rest of an operation with data on the thread pool. Then queues a global task on the crypto task source,
+// given realm's global object, to resolve promise with an ArrayBuffer containing its result, or to reject promise with
+// its error.
+static void perform_rest_of_operation_in_parallel(JS::Realm& realm, GC::Ref<WebIDL::Promise> promise, AlgorithmMethods::ParallelOperation operation, ByteBuffer data)
+{
+    auto& origin_event_loop = Core::EventLoop::current();
+
+    // Keep the callback on the origin thread, so that the roots it holds are also destroyed there.
+    auto* callback = new Function<void(ErrorOr<ByteBuffer>)>([realm = GC::make_root(realm), promise = GC::make_root(promise)](ErrorOr<ByteBuffer> result) mutable {
+        HTML::queue_global_task(HTML::Task::Source::Crypto, realm->global_object(), GC::create_function(GC::Heap::the(), [realm = GC::Ref(*realm), promise = GC::Ref(*promise), result = move(result)]() mutable {
+            HTML::TemporaryExecutionContext context(realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes);
+
+            auto bytes = result_of_parallel_operation(realm->vm(), move(result));
+            if (bytes.is_error()) {
+                WebIDL::reject_promise_with_exception(promise, bytes.release_error());
+                return;
+            }
+
+            WebIDL::resolve_promise(promise, JS::ArrayBuffer::create(realm, bytes.release_value()));
+        }));
+    });
+
+    Threading::ThreadPool::the().submit([operation = move(operation), data = move(data), callback, &origin_event_loop]() mutable {
+        auto result = operation(data);
+
+        origin_event_loop.deferred_invoke([callback, result = move(result)]() mutable {
+            (*callback)(move(result));
+            delete callback;
+        });
+    });
+}
+
 static JS::ThrowCompletionOr<JS::Value> export_key_result_to_js_value(JS::Realm& realm, ExportKeyResult result)
 {
     if (result.has<ByteBuffer>())
@@ -185,7 +219,7 @@ GC::Ref<WebIDL::Promise> SubtleCrypto::encrypt(JS::Realm& realm, AlgorithmIdenti
     auto promise = WebIDL::create_promise(realm);
 
     // 7. Return promise and perform the remaining steps in parallel.
-    Platform::EventLoopPlugin::the().deferred_invoke(GC::create_function(GC::Heap::the(), [&realm, &global, &heap, normalized_algorithm = normalized_algorithm.release_value(), promise, key, data = move(data)]() -> void {
+    Platform::EventLoopPlugin::the().deferred_invoke(GC::create_function(GC::Heap::the(), [&realm, &global, &heap, normalized_algorithm = normalized_algorithm.release_value(), promise, key, data = move(data)]() mutable -> void {
         HTML::TemporaryExecutionContext context(realm, HTML::TemporaryExecutionContext::CallbacksEnabled::No);
 
         // 8. If the following steps or referenced procedures say to throw an error, queue a global task on the
@@ -210,6 +244,17 @@ GC::Ref<WebIDL::Promise> SubtleCrypto::encrypt(JS::Realm& realm, AlgorithmIdenti
         }
 
         // 11. Let ciphertext be the result of performing the encrypt operation specified by normalizedAlgorithm using algorithm and key and with data as plaintext.
+        auto operation = normalized_algorithm.methods->encrypt_in_parallel(realm, *normalized_algorithm.parameter, key);
+        if (operation.is_error()) {
+            throw_in_this_context(WebIDL::exception_to_throw_completion(realm.vm(), realm, operation.release_error()));
+            return;
+        }
+        if (auto parallel_operation = operation.release_value()) {
+            // NOTE: This performs steps 12 to 14 once the encryption is done.
+            perform_rest_of_operation_in_parallel(realm, promise, move(parallel_operation), move(data));
+            return;
+        }
+
         auto cipher_text = normalized_algorithm.methods->encrypt(realm, *normalized_algorithm.parameter, key, data);
         if (cipher_text.is_error()) {
             throw_in_this_context(WebIDL::exception_to_throw_completion(realm.vm(), realm, cipher_text.release_error()));
@@ -259,7 +304,7 @@ GC::Ref<WebIDL::Promise> SubtleCrypto::decrypt(JS::Realm& realm, AlgorithmIdenti
     auto promise = WebIDL::create_promise(realm);
 
     // 7. Return promise and perform the remaining steps in parallel.
-    Platform::EventLoopPlugin::the().deferred_invoke(GC::create_function(GC::Heap::the(), [&realm, &global, &heap, normalized_algorithm = normalized_algorithm.release_value(), promise, key, data = move(data)]() -> void {
+    Platform::EventLoopPlugin::the().deferred_invoke(GC::create_function(GC::Heap::the(), [&realm, &global, &heap, normalized_algorithm = normalized_algorithm.release_value(), promise, key, data = move(data)]() mutable -> void {
         HTML::TemporaryExecutionContext context(realm, HTML::TemporaryExecutionContext::CallbacksEnabled::No);
 
         // 8. If the following steps or referenced procedures say to throw an error, queue a global task on the
@@ -284,6 +329,17 @@ GC::Ref<WebIDL::Promise> SubtleCrypto::decrypt(JS::Realm& realm, AlgorithmIdenti
         }
 
         // 11. Let plaintext be the result of performing the decrypt operation specified by normalizedAlgorithm using key and algorithm and with data as ciphertext.
+        auto operation = normalized_algorithm.methods->decrypt_in_parallel(realm, *normalized_algorithm.parameter, key);
+        if (operation.is_error()) {
+            throw_in_this_context(WebIDL::exception_to_throw_completion(realm.vm(), realm, operation.release_error()));
+            return;
+        }
+        if (auto parallel_operation = operation.release_value()) {
+            // NOTE: This performs steps 12 to 14 once the decryption is done.
+            perform_rest_of_operation_in_parallel(realm, promise, move(parallel_operation), move(data));
+            return;
+        }
+
         auto plain_text = normalized_algorithm.methods->decrypt(realm, *normalized_algorithm.parameter, key, data);
         if (plain_text.is_error()) {
             throw_in_this_context(WebIDL::exception_to_throw_completion(realm.vm(), realm, plain_text.release_error()));
@@ -334,7 +390,7 @@ GC::Ref<WebIDL::Promise> SubtleCrypto::digest(JS::Realm& realm, AlgorithmIdentif
     auto promise = WebIDL::create_promise(realm);
 
     // 7. Return promise and perform the remaining steps in parallel.
-    Platform::EventLoopPlugin::the().deferred_invoke(GC::create_function(GC::Heap::the(), [&realm, &global, &heap, algorithm_object = normalized_algorithm.release_value(), promise, data_buffer = move(data_buffer)]() -> void {
+    Platform::EventLoopPlugin::the().deferred_invoke(GC::create_function(GC::Heap::the(), [&realm, &global, &heap, algorithm_object = normalized_algorithm.release_value(), promise, data_buffer = move(data_buffer)]() mutable -> void {
         HTML::TemporaryExecutionContext context(realm, HTML::TemporaryExecutionContext::CallbacksEnabled::No);
 
         // 8. If the following steps or referenced procedures say to throw an error, queue a global task on the
@@ -347,6 +403,17 @@ GC::Ref<WebIDL::Promise> SubtleCrypto::digest(JS::Realm& realm, AlgorithmIdentif
         };
 
         // 9. Let digest be the result of performing the digest operation specified by normalizedAlgorithm using algorithm, with data as message.
+        auto operation = algorithm_object.methods->digest_in_parallel(realm, *algorithm_object.parameter);
+        if (operation.is_error()) {
+            throw_in_this_context(WebIDL::exception_to_throw_completion(realm.vm(), realm, operation.release_error()));
+            return;
+        }
+        if (auto parallel_operation = operation.release_value()) {
+            // NOTE: This performs steps 10 to 12 once the digest is done.
+            perform_rest_of_operation_in_parallel(realm, promise, move(parallel_operation), move(data_buffer));
+            return;
+        }
+
         auto digest = algorithm_object.methods->digest(realm, *algorithm_object.parameter, data_buffer);
 
         if (digest.is_exception()) {
@@ -743,6 +810,17 @@ GC::Ref<WebIDL::Promise> SubtleCrypto::derive_bits(JS::Realm& realm, AlgorithmId
         }
 
         // 9. Let result be the result of creating an ArrayBuffer containing the result of performing the derive bits operation specified by normalizedAlgorithm using baseKey, algorithm and length.
+        auto operation = normalized_algorithm.methods->derive_bits_in_parallel(realm, *normalized_algorithm.parameter, base_key, length_optional);
+        if (operation.is_error()) {
+            WebIDL::reject_promise_with_exception(promise, operation.release_error());
+            return;
+        }
+        if (auto parallel_operation = operation.release_value()) {
+            // NOTE: This performs step 10 once the bits are derived.
+            perform_rest_of_operation_in_parallel(realm, promise, move(parallel_operation), {});
+            return;
+        }
+
         auto result = normalized_algorithm.methods->derive_bits(realm, *normalized_algorithm.parameter, base_key, length_optional);
         if (result.is_error()) {
             WebIDL::reject_promise_with_exception(promise, result.release_error());
@@ -1095,6 +1095,8 @@ namespace Web::Platform {
 
 class Timer;
 
+struct DecodedImage;
+
 }
 
 namespace Web::ReferrerPolicy {
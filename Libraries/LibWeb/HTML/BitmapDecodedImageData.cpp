@@ -4,27 +4,33 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Math.h>
 #include <LibGC/Heap.h>
+#include <LibGC/Weak.h>
 #include <LibGfx/Bitmap.h>
 #include <LibJS/Runtime/ExternalMemory.h>
 #include <LibWeb/CSS/ComputedValues.h>
 #include <LibWeb/HTML/BitmapDecodedImageData.h>
+#include <LibWeb/Platform/ImageCodecPlugin.h>
 
 namespace Web::HTML {
 
 GC_DEFINE_ALLOCATOR(BitmapDecodedImageData);
 
-ErrorOr<GC::Ref<BitmapDecodedImageData>> BitmapDecodedImageData::create(Vector<Frame>&& frames, size_t loop_count, bool animated)
+ErrorOr<GC::Ref<BitmapDecodedImageData>> BitmapDecodedImageData::create(Vector<Frame>&& frames, size_t loop_count, bool animated, Gfx::IntSize natural_size)
 {
     (void)loop_count;
     (void)animated;
     if (frames.is_empty())
         return Error::from_string_literal("Bitmap image has no frames");
-    return GC::Heap::the().allocate<BitmapDecodedImageData>(move(frames[0].frame));
+    if (natural_size.is_empty())
+        natural_size = frames[0].frame.size();
+    return GC::Heap::the().allocate<BitmapDecodedImageData>(move(frames[0].frame), natural_size);
 }
 
-BitmapDecodedImageData::BitmapDecodedImageData(Gfx::DecodedImageFrame&& frame)
+BitmapDecodedImageData::BitmapDecodedImageData(Gfx::DecodedImageFrame&& frame, Gfx::IntSize natural_size)
     : m_frame(move(frame))
+    , m_natural_size(natural_size)
 {
 }
 
@@ -32,37 +38,152 @@ BitmapDecodedImageData::~BitmapDecodedImageData() = default;
 
 size_t BitmapDecodedImageData::external_memory_size() const
 {
-    return m_frame.bitmap().data_size();
+    return JS::saturating_add_external_memory_size(m_frame.bitmap().data_size(), m_encoded_data.size());
 }
 
-Optional<Gfx::DecodedImageFrame> BitmapDecodedImageData::current_frame(Gfx::IntSize) const
+void BitmapDecodedImageData::set_encoded_data(ByteBuffer encoded_data, Optional<String> cache_partition)
+{
+    if (m_frame.size() == m_natural_size)
+        return;
+    m_encoded_data = move(encoded_data);
+    m_cache_partition = move(cache_partition);
+}
+
+void BitmapDecodedImageData::ensure_decoded_for_size(Optional<Gfx::IntSize> size)
+{
+    if (!size.has_value() || size->is_empty())
+        size = m_natural_size;
+
+    // The image decoder returns a frame that covers the ideal size, but never one larger than the natural size.
+    Gfx::IntSize target { min(size->width(), m_natural_size.width()), min(size->height(), m_natural_size.height()) };
+    auto covers = [&](Gfx::IntSize frame_size) {
+        return frame_size.width() >= target.width() && frame_size.height() >= target.height();
+    };
+    if (covers(m_frame.size()) || m_encoded_data.is_empty())
+        return;
+    if (m_size_being_decoded.has_value() && covers(*m_size_being_decoded))
+        return;
+
+    // NB: Without an ideal size, the frame may be shared with anyone else who decoded the image at its natural size.
+    Optional<Gfx::IntSize> ideal_size;
+    if (target != m_natural_size)
+        ideal_size = target;
+    m_size_being_decoded = target;
+
+    auto weak_this = GC::Weak { *this };
+    (void)Platform::ImageCodecPlugin::the().decode_image(
+        m_encoded_data,
+        [weak_this, target](Platform::DecodedImage& result) -> ErrorOr<void> {
+            auto self = weak_this.ptr();
+            if (!self)
+                return {};
+            if (self->m_size_being_decoded == target)
+                self->m_size_being_decoded.clear();
+
+            if (result.frames.is_empty() || !result.frames.first().bitmap)
+                return {};
+
+            // NB: A decode for an even larger size may have finished first.
+            auto& bitmap = *result.frames.first().bitmap;
+            if (bitmap.width() < self->m_frame.width() || bitmap.height() < self->m_frame.height() || bitmap.size() == self->m_frame.size())
+                return {};
+
+            self->replace_frame(Gfx::DecodedImageFrame { bitmap, result.color_space });
+            self->notify_clients_did_update();
+            return {};
+        },
+        [weak_this, target](Error&) {
+            auto self = weak_this.ptr();
+            if (!self)
+                return;
+            if (self->m_size_being_decoded == target)
+                self->m_size_being_decoded.clear();
+
+            // NB: The data did decode once, so trying again whenever the image is painted would only fail again.
+            self->m_encoded_data.clear();
+        },
+        ideal_size,
+        m_cache_partition);
+}
+
+void BitmapDecodedImageData::replace_frame(Gfx::DecodedImageFrame frame) const
 {
+    m_frame = move(frame);
+
+    // Once we have every pixel of the image, it never needs to be decoded again.
+    if (m_frame.size() == m_natural_size)
+        m_encoded_data.clear();
+}
+
+// Whoever asks for a frame gets the image's pixels in natural image coordinates, e.g. to draw a part of them into a
+// canvas or to upload them into a texture. A frame that was decoded at a lower resolution doesn't have those pixels, so
+// the image is decoded at its natural size for them first. Painting the image itself uses image_paint(), which doesn't
+// need this.
+Optional<Gfx::DecodedImageFrame> BitmapDecodedImageData::natural_size_frame() const
+{
+    if (m_frame.size() == m_natural_size)
+        return m_frame;
+
+    // NB: An image that is still loading has no complete encoded data to decode again, so there are no pixels to read.
+    if (m_encoded_data.is_empty())
+        return {};
+
+    auto result = Platform::ImageCodecPlugin::the().decode_image_at_natural_size(m_encoded_data, m_cache_partition);
+    if (result.is_error()) {
+        dbgln("Could not decode image at its natural size: {}", result.error());
+        return {};
+    }
+
+    auto& frames = result.value().frames;
+    if (frames.is_empty() || !frames.first().bitmap || frames.first().bitmap->size() != m_natural_size)
+        return {};
+
+    replace_frame(Gfx::DecodedImageFrame { *frames.first().bitmap, result.value().color_space });
     return m_frame;
 }
 
+Optional<Gfx::DecodedImageFrame> BitmapDecodedImageData::current_frame(Gfx::IntSize) const
+{
+    return natural_size_frame();
+}
+
 Optional<Gfx::DecodedImageFrame> BitmapDecodedImageData::default_frame(Gfx::IntSize) const
 {
-    return m_frame;
+    return natural_size_frame();
 }
 
 Optional<CSSPixels> BitmapDecodedImageData::intrinsic_width() const
 {
-    return m_frame.width();
+    return m_natural_size.width();
 }
 
 Optional<CSSPixels> BitmapDecodedImageData::intrinsic_height() const
 {
-    return m_frame.height();
+    return m_natural_size.height();
 }
 
 Optional<CSSPixelFraction> BitmapDecodedImageData::intrinsic_aspect_ratio() const
 {
-    return CSSPixels(m_frame.width()) / CSSPixels(m_frame.height());
+    return CSSPixels(m_natural_size.width()) / CSSPixels(m_natural_size.height());
 }
 
-Optional<Painting::ImagePaint> BitmapDecodedImageData::image_paint(Painting::ImagePaintRequest const&) const
+Optional<Painting::ImagePaint> BitmapDecodedImageData::image_paint(Painting::ImagePaintRequest const& request) const
 {
-    return Painting::ImagePaint { Painting::ImagePaint::DecodedFrame { .frame = m_frame, .natural_size = m_frame.size() } };
+    // The frame may have been decoded for a smaller size than the image is painted at now, e.g. because layout made its
+    // box larger. It's painted scaled up until the larger frame has been decoded.
+    if (m_frame.size() != m_natural_size) {
+        auto device_pixels = [](float size, float scale) {
+            if (!(scale > 0))
+                scale = 1;
+            return clamp_to<int>(ceilf(size * scale));
+        };
+        const_cast<BitmapDecodedImageData&>(*this).ensure_decoded_for_size(Gfx::IntSize {
+            device_pixels(request.dest_rect.width(), request.accumulated_scale.width()),
+            device_pixels(request.dest_rect.height(), request.accumulated_scale.height()),
+        });
+    }
+
+    return Painting::ImagePaint { Painting::ImagePaint::DecodedFrame { .frame = m_frame, .natural_size = m_natural_size } };
 }
 
 }
@@ -6,6 +6,8 @@
 
 #pragma once
 
+#include <AK/ByteBuffer.h>
+#include <AK/String.h>
 #include <LibGfx/DecodedImageFrame.h>
 #include <LibGfx/Forward.h>
 #include <LibWeb/HTML/DecodedImageData.h>
@@ -22,9 +24,19 @@ public:
         int duration { 0 };
     };
 
-    static ErrorOr<GC::Ref<BitmapDecodedImageData>> create(Vector<Frame>&&, size_t loop_count, bool animated);
+    // The frames may have been decoded at a lower resolution than natural_size, if the image is only drawn that small.
+    // An empty natural_size means they were not.
+    static ErrorOr<GC::Ref<BitmapDecodedImageData>> create(Vector<Frame>&&, size_t loop_count, bool animated, Gfx::IntSize natural_size = {});
     virtual ~BitmapDecodedImageData() override;
 
+    // A frame that was decoded at a lower resolution can only be decoded again with the encoded image, so we keep it
+    // until we have the frame at its natural size.
+    void set_encoded_data(ByteBuffer, Optional<String> cache_partition);
+
+    // Decodes the image again if its frame is smaller than the given size in device pixels, or than its natural size if
+    // no size is given. Clients are notified once the larger frame has replaced the current one.
+    void ensure_decoded_for_size(Optional<Gfx::IntSize>);
+
     virtual Optional<Gfx::DecodedImageFrame> default_frame(Gfx::IntSize = {}) const override;
     virtual Optional<Gfx::DecodedImageFrame> current_frame(Gfx::IntSize = {}) const override;
 
@@ -35,11 +47,20 @@ public:
     virtual Optional<Painting::ImagePaint> image_paint(Painting::ImagePaintRequest const&) const override;
 
 private:
-    BitmapDecodedImageData(Gfx::DecodedImageFrame&& frame);
+    BitmapDecodedImageData(Gfx::DecodedImageFrame&& frame, Gfx::IntSize natural_size);
 
     virtual size_t external_memory_size() const override;
 
-    Gfx::DecodedImageFrame m_frame;
+    Optional<Gfx::DecodedImageFrame> natural_size_frame() const;
+    void replace_frame(Gfx::DecodedImageFrame) const;
+
+    mutable Gfx::DecodedImageFrame m_frame;
+    Gfx::IntSize m_natural_size;
+    mutable ByteBuffer m_encoded_data;
+    Optional<String> m_cache_partition;
+
+    // The size that a decode of a larger frame is in progress for.
+    Optional<Gfx::IntSize> m_size_being_decoded;
 };
 
 }
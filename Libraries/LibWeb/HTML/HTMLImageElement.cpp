@@ -47,6 +47,7 @@
 #include <LibWeb/Layout/Box.h>
 #include <LibWeb/Loader/ResourceLoader.h>
 #include <LibWeb/Namespace.h>
+#include <LibWeb/Page/Page.h>
 #include <LibWeb/Painting/BoxViews.h>
 #include <LibWeb/Platform/EventLoopPlugin.h>
 #include <LibWeb/Platform/ImageCodecPlugin.h>
@@ -242,6 +243,26 @@ void HTMLImageElement::set_dimension_attribute_source(DOM::Element const* source
     }
 }
 
+// The size, in device pixels, that this element draws its image at, once layout has determined it. The image decoder
+// may then decode large images at a lower resolution. If the box grows later, painting it decodes the image again at
+// the larger size.
+Optional<Gfx::IntSize> HTMLImageElement::ideal_image_decode_size() const
+{
+    // NB: Until there is a used size, the image is decoded at its natural size. The width and height attributes don't
+    //     tell us how large it's drawn, as style may size the box differently, e.g. with "width: 100%".
+    auto const* layout_node = this->layout_node();
+    if (!layout_node || !Painting::has_committed_box(*layout_node))
+        return {};
+
+    auto width = Painting::content_width(*layout_node).to_double();
+    auto height = Painting::content_height(*layout_node).to_double();
+    auto device_pixels_per_css_pixel = document().page().client().device_pixels_per_css_pixel();
+    Gfx::IntSize size { clamp_to<int>(ceil(width * device_pixels_per_css_pixel)), clamp_to<int>(ceil(height * device_pixels_per_css_pixel)) };
+    if (size.is_empty())
+        return {};
+    return size;
+}
+
 bool HTMLImageElement::is_presentational_hint(Utf16FlyString const& name) const
 {
     if (Base::is_presentational_hint(name))
@@ -649,7 +670,9 @@ void HTMLImageElement::decode(GC::Ref<WebIDL::Promise> promise) const
                     return;
                 }
                 queue_reject_task("Current request state is broken"_utf16);
-            });
+            },
+            {},
+            ideal_image_decode_size());
     }));
 
     // 3. Return promise.
@@ -1164,6 +1187,10 @@ void HTMLImageElement::add_callbacks_to_image_request(GC::Ref<ImageRequest> imag
 
                 VERIFY(image_request->shared_resource_request());
                 auto image_data = image_request->shared_resource_request()->image_data();
+
+                // AD-HOC: The current request may have been showing partially decoded image data until now.
+                if (image_request == m_current_request)
+                    unregister_with_decoded_image_data_if_needed();
                 image_request->set_image_data(image_data);
 
                 // 1. If image request is the pending request, abort the image request for the current request,
@@ -1238,7 +1265,33 @@ void HTMLImageElement::add_callbacks_to_image_request(GC::Ref<ImageRequest> imag
                 dispatch_event(create_event_for_element(*this, HTML::EventNames::error));
 
             m_load_event_delayer.clear();
-        });
+        },
+        [this, image_request]() {
+            // AD-HOC: Present whatever part of the image has been decoded so far, like other browsers do. This only
+            //         applies to the current request; a pending request keeps the previous image on screen until it
+            //         is completely available.
+            if (!document().is_fully_active() || image_request->was_aborted() || image_request != m_current_request)
+                return;
+            if (image_request->state() != ImageRequest::State::Unavailable && image_request->state() != ImageRequest::State::PartiallyAvailable)
+                return;
+
+            VERIFY(image_request->shared_resource_request());
+            auto image_data = image_request->shared_resource_request()->partially_decoded_image_data();
+            if (!image_data)
+                return;
+
+            unregister_with_decoded_image_data_if_needed();
+            image_request->set_image_data(image_data);
+            register_with_decoded_image_data_if_needed();
+
+            // https://html.spec.whatwg.org/multipage/images.html#img-req-state
+            // Partially available: The user agent has obtained some of the image data.
+            image_request->set_state(ImageRequest::State::PartiallyAvailable);
+
+            document().style_computer().style_engine().record_element_style_input_change(style_node_id());
+            set_needs_layout_update_or_repaint_after_image_data_change(DOM::SetNeedsLayoutReason::HTMLImageElementUpdateTheImageData);
+        },
+        ideal_image_decode_size());
 }
 
 void HTMLImageElement::did_set_viewport_rect(CSSPixelRect const& viewport_rect)
@@ -1407,7 +1460,9 @@ void HTMLImageElement::react_to_changes_in_the_environment()
                 //    or if the user agent is able to determine that image request's image is corrupted in some
                 //    fatal way such that the image dimensions cannot be obtained,
                 m_pending_request = nullptr;
-            });
+            },
+            {},
+            ideal_image_decode_size());
 
         // 5. Let response be the result of fetching request.
         image_request->fetch_image(request);
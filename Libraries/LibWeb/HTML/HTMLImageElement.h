@@ -13,6 +13,7 @@
 #include <AK/Utf16View.h>
 #include <LibGC/Function.h>
 #include <LibGfx/Forward.h>
+#include <LibGfx/Size.h>
 #include <LibWeb/DOM/DocumentLoadEventDelayer.h>
 #include <LibWeb/DOM/ViewportClient.h>
 #include <LibWeb/HTML/CORSSettingAttribute.h>
@@ -143,6 +144,7 @@ private:
 
     void handle_failed_fetch();
     void add_callbacks_to_image_request(GC::Ref<ImageRequest>, bool maybe_omit_events, Utf16View url_string, Utf16View previous_url);
+    Optional<Gfx::IntSize> ideal_image_decode_size() const;
 
     void create_alt_text_shadow_tree();
     void remove_alt_text_shadow_tree();
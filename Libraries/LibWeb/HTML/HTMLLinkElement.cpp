@@ -1007,7 +1007,8 @@ static NonnullRefPtr<Core::Promise<NonnullRefPtr<Gfx::Bitmap const>>> decode_fav
         return {};
     };
 
-    (void)Platform::ImageCodecPlugin::the().decode_image(favicon_data, move(on_successful_decode), move(on_failed_decode));
+    auto cache_partition = Platform::ImageCodecPlugin::cache_partition_for(document->relevant_settings_object());
+    (void)Platform::ImageCodecPlugin::the().decode_image(favicon_data, move(on_successful_decode), move(on_failed_decode), {}, move(cache_partition));
 
     return promise;
 }
@@ -248,7 +248,9 @@ WebIDL::ExceptionOr<void> HTMLVideoElement::determine_element_poster_frame(Optio
                     if (!weak_self)
                         return;
                     finalize(*weak_self, nullptr);
-                });
+                },
+                {},
+                Platform::ImageCodecPlugin::cache_partition_for(weak_self->document().relevant_settings_object()));
         });
 
         VERIFY(response->body());
@@ -287,7 +287,8 @@ static void compile_remaining_functions_off_thread(JS::Bytecode::Executable& exe
             (*callback)(move(compiled_functions));
             delete callback;
         });
-    });
+    },
+        Threading::ThreadPool::Priority::Background);
 }
 
 static void compile_remaining_module_functions_off_thread(ModuleScript& module_script, NonnullRefPtr<JS::SourceCode const> source_code)
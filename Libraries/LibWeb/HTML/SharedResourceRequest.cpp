@@ -12,6 +12,7 @@
 #include <LibWeb/Fetch/Fetching/Fetching.h>
 #include <LibWeb/Fetch/Infrastructure/FetchAlgorithms.h>
 #include <LibWeb/Fetch/Infrastructure/FetchController.h>
+#include <LibWeb/Fetch/Infrastructure/HTTP/Bodies.h>
 #include <LibWeb/Fetch/Infrastructure/HTTP/MIME.h>
 #include <LibWeb/Fetch/Infrastructure/HTTP/Requests.h>
 #include <LibWeb/Fetch/Infrastructure/HTTP/Responses.h>
@@ -61,8 +62,12 @@ void SharedResourceRequest::finalize()
     m_callbacks.clear();
     m_load_event_delayer.clear();
     m_image_data = nullptr;
+    m_partially_decoded_image_data = nullptr;
     m_fetch_controller = nullptr;
 
+    if (m_incremental_decode_id.has_value())
+        Web::Platform::ImageCodecPlugin::the().cancel_incremental_decode(m_incremental_decode_id.release_value());
+
     if (m_document) {
         auto& shared_resource_requests = m_document->shared_resource_requests();
         if (auto it = shared_resource_requests.find(m_url);
@@ -81,8 +86,10 @@ void SharedResourceRequest::visit_edges(JS::Cell::Visitor& visitor)
     for (auto& callback : m_callbacks) {
         visitor.visit(callback.on_finish);
         visitor.visit(callback.on_fail);
+        visitor.visit(callback.on_partially_decoded);
     }
     visitor.visit(m_image_data);
+    visitor.visit(m_partially_decoded_image_data);
 }
 
 GC::Ptr<DecodedImageData> SharedResourceRequest::image_data() const
@@ -136,17 +143,31 @@ void SharedResourceRequest::fetch_resource(GC::Ref<Fetch::Infrastructure::Reques
         //        https://github.com/whatwg/html/issues/9355
         response = response->unsafe_response();
 
-        auto process_body = GC::create_function(GC::Heap::the(), [weak_this, request, response, image_data_is_cors_cross_origin](ByteBuffer data) {
+        // Check for failed fetch response
+        if (!Fetch::Infrastructure::is_ok_status(response->status()) || !response->body()) {
+            self->handle_failed_fetch();
+            return;
+        }
+
+        auto extracted_mime_type = Fetch::Infrastructure::extract_mime_type(response->header_list());
+        auto const is_svg_image = extracted_mime_type.has_value()
+            ? extracted_mime_type.value().essence() == "image/svg+xml"sv
+            : request->url().basename().ends_with(".svg"sv);
+
+        // Raster images are decoded as their data arrives, so that we can show something before the download is done.
+        if (!is_svg_image) {
+            self->decode_body_incrementally(realm, *response->body(), image_data_is_cors_cross_origin);
+            return;
+        }
+
+        auto process_body = GC::create_function(GC::Heap::the(), [weak_this, request, image_data_is_cors_cross_origin](ByteBuffer data) {
             auto self = weak_this.ptr();
             if (!self)
                 return;
 
-            auto extracted_mime_type = Fetch::Infrastructure::extract_mime_type(response->header_list());
-            auto const is_svg_image = extracted_mime_type.has_value()
-                ? extracted_mime_type.value().essence() == "image/svg+xml"sv
-                : request->url().basename().ends_with(".svg"sv);
-            self->handle_successful_fetch(request->url(), is_svg_image ? IsSVGImage::Yes : IsSVGImage::No, move(data), image_data_is_cors_cross_origin);
+            self->handle_successful_svg_fetch(request->url(), move(data), image_data_is_cors_cross_origin);
         });
+
         auto process_body_error = GC::create_function(GC::Heap::the(), [weak_this](JS::Value) {
             auto self = weak_this.ptr();
             if (!self)
@@ -155,12 +176,6 @@ void SharedResourceRequest::fetch_resource(GC::Ref<Fetch::Infrastructure::Reques
             self->handle_failed_fetch();
         });
 
-        // Check for failed fetch response
-        if (!Fetch::Infrastructure::is_ok_status(response->status()) || !response->body()) {
-            self->handle_failed_fetch();
-            return;
-        }
-
         response->body()->fully_read(realm, process_body, process_body_error, GC::Ref { realm.global_object() });
     };
 
@@ -175,9 +190,12 @@ void SharedResourceRequest::fetch_resource(GC::Ref<Fetch::Infrastructure::Reques
     set_fetch_controller(fetch_controller);
 }
 
-void SharedResourceRequest::add_callbacks(Function<void()> on_finish, Function<void()> on_fail)
+void SharedResourceRequest::add_callbacks(Function<void()> on_finish, Function<void()> on_fail, Function<void()> on_partially_decoded, Optional<Gfx::IntSize> ideal_size)
 {
     if (m_state == State::Finished) {
+        // NB: The image may have been decoded for clients that draw it smaller than this one does.
+        if (auto* bitmap_image_data = as_if<BitmapDecodedImageData>(m_image_data.ptr()))
+            bitmap_image_data->ensure_decoded_for_size(ideal_size);
         if (on_finish)
             on_finish();
         return;
@@ -194,73 +212,185 @@ void SharedResourceRequest::add_callbacks(Function<void()> on_finish, Function<v
         callbacks.on_finish = GC::create_function(GC::Heap::the(), move(on_finish));
     if (on_fail)
         callbacks.on_fail = GC::create_function(GC::Heap::the(), move(on_fail));
+    if (on_partially_decoded)
+        callbacks.on_partially_decoded = GC::create_function(GC::Heap::the(), move(on_partially_decoded));
+
+    if (!ideal_size.has_value() || ideal_size->is_empty()) {
+        m_needs_natural_size_decode = true;
+    } else if (m_ideal_decode_size.has_value()) {
+        m_ideal_decode_size = Gfx::IntSize {
+            max(m_ideal_decode_size->width(), ideal_size->width()),
+            max(m_ideal_decode_size->height(), ideal_size->height()),
+        };
+    } else {
+        m_ideal_decode_size = ideal_size;
+    }
 
     m_callbacks.append(move(callbacks));
 }
 
-void SharedResourceRequest::handle_successful_fetch(URL::URL const& url_string, IsSVGImage is_svg_image, ByteBuffer data, bool image_data_is_cors_cross_origin)
+Optional<Gfx::IntSize> SharedResourceRequest::ideal_decode_size() const
+{
+    if (m_needs_natural_size_decode)
+        return {};
+    return m_ideal_decode_size;
+}
+
+void SharedResourceRequest::handle_successful_svg_fetch(URL::URL const& url_string, ByteBuffer data, bool image_data_is_cors_cross_origin)
 {
     // AD-HOC: At this point, things gets very ad-hoc.
     // FIXME: Bring this closer to spec.
 
-    if (is_svg_image == IsSVGImage::Yes) {
-        auto result = SVG::SVGDecodedImageData::create(m_page, url_string, data);
-        if (result.is_error()) {
-            handle_failed_fetch();
-        } else {
-            m_image_data = result.release_value();
-            m_image_data->set_is_cors_cross_origin(image_data_is_cors_cross_origin);
-            handle_successful_resource_load();
-        }
-        return;
+    auto result = SVG::SVGDecodedImageData::create(m_page, url_string, data);
+    if (result.is_error()) {
+        handle_failed_fetch();
+    } else {
+        m_image_data = result.release_value();
+        m_image_data->set_is_cors_cross_origin(image_data_is_cors_cross_origin);
+        handle_successful_resource_load();
     }
+}
 
-    auto handle_successful_bitmap_decode = [strong_this = GC::Root(*this), image_data_is_cors_cross_origin](Web::Platform::DecodedImage& result) -> ErrorOr<void> {
-        if (result.session_id != 0) {
-            // Streaming animated decode: create AnimatedBitmapDecodedImageData.
-            Vector<NonnullRefPtr<Gfx::Bitmap>> initial_bitmaps;
-            initial_bitmaps.ensure_capacity(result.frames.size());
-            for (auto& frame : result.frames)
-                initial_bitmaps.unchecked_append(*frame.bitmap);
-
-            auto first_bitmap = result.frames.first().bitmap;
-            auto size = first_bitmap->size();
-
-            strong_this->m_image_data = AnimatedBitmapDecodedImageData::create(
-                *strong_this->m_document,
-                result.session_id,
-                result.frame_count,
-                result.loop_count,
-                size,
-                move(result.color_space),
-                move(result.all_durations),
-                move(initial_bitmaps));
-        } else {
-            // Single-shot decode: create BitmapDecodedImageData as before.
-            Vector<BitmapDecodedImageData::Frame> frames;
-            for (auto& frame : result.frames) {
-                frames.append(BitmapDecodedImageData::Frame {
-                    .frame = Gfx::DecodedImageFrame { *frame.bitmap, result.color_space },
-                    .duration = static_cast<int>(frame.duration),
-                });
-            }
-            strong_this->m_image_data = BitmapDecodedImageData::create(move(frames), result.loop_count, result.is_animated).release_value_but_fixme_should_propagate_errors();
+void SharedResourceRequest::decode_body_incrementally(JS::Realm& realm, Fetch::Infrastructure::Body& body, bool image_data_is_cors_cross_origin)
+{
+    GC::Weak weak_this { *this };
+
+    auto handle_partially_decoded_image = [weak_this, image_data_is_cors_cross_origin](Web::Platform::PartiallyDecodedImage& result) {
+        auto self = weak_this.ptr();
+        if (!self || !self->is_fetching())
+            return;
+
+        Vector<BitmapDecodedImageData::Frame> frames;
+        frames.append(BitmapDecodedImageData::Frame {
+            .frame = Gfx::DecodedImageFrame { *result.bitmap, result.color_space },
+            .duration = 0,
+        });
+        auto image_data = BitmapDecodedImageData::create(move(frames), 0, false, result.natural_size);
+        if (image_data.is_error())
+            return;
+
+        self->m_partially_decoded_image_data = image_data.release_value();
+        self->m_partially_decoded_image_data->set_is_cors_cross_origin(image_data_is_cors_cross_origin);
+        for (auto& callback : self->m_callbacks) {
+            if (callback.on_partially_decoded)
+                callback.on_partially_decoded->function()();
         }
-        strong_this->m_image_data->set_is_cors_cross_origin(image_data_is_cors_cross_origin);
-        strong_this->handle_successful_resource_load();
+    };
+
+    auto handle_successful_bitmap_decode = [weak_this, image_data_is_cors_cross_origin](Web::Platform::DecodedImage& result) -> ErrorOr<void> {
+        auto self = weak_this.ptr();
+        if (!self)
+            return {};
+
+        self->m_incremental_decode_id.clear();
+        self->handle_successful_bitmap_decode(result, image_data_is_cors_cross_origin);
         return {};
     };
 
-    auto handle_failed_decode = [strong_this = GC::Root(*this)](Error&) -> void {
-        strong_this->handle_failed_fetch();
+    auto handle_failed_decode = [weak_this](Error&) {
+        auto self = weak_this.ptr();
+        if (!self)
+            return;
+
+        self->m_incremental_decode_id.clear();
+        self->handle_failed_fetch();
     };
 
-    (void)Web::Platform::ImageCodecPlugin::the().decode_image(data.bytes(), move(handle_successful_bitmap_decode), move(handle_failed_decode));
+    // A downscaled image may need to be decoded again, for clients that are added later or draw it larger.
+    auto ideal_size = ideal_decode_size();
+    m_keeps_encoded_data = ideal_size.has_value();
+
+    auto request_id = Web::Platform::ImageCodecPlugin::the().begin_incremental_decode(move(handle_partially_decoded_image), move(handle_successful_bitmap_decode), move(handle_failed_decode), ideal_size, Web::Platform::ImageCodecPlugin::cache_partition_for(m_document->relevant_settings_object()));
+
+    // NB: The decode fails right away if there's no image decoder to talk to.
+    if (!is_fetching())
+        return;
+    m_incremental_decode_id = request_id;
+
+    auto process_body_chunk = GC::create_function(GC::Heap::the(), [weak_this](ByteBuffer bytes) {
+        auto self = weak_this.ptr();
+        if (!self || !self->m_incremental_decode_id.has_value())
+            return;
+
+        if (self->m_keeps_encoded_data && self->m_encoded_data.try_append(bytes).is_error()) {
+            Web::Platform::ImageCodecPlugin::the().cancel_incremental_decode(self->m_incremental_decode_id.release_value());
+            self->handle_failed_fetch();
+            return;
+        }
+
+        Web::Platform::ImageCodecPlugin::the().append_incremental_decode_data(*self->m_incremental_decode_id, bytes);
+    });
+
+    auto process_end_of_body = GC::create_function(GC::Heap::the(), [weak_this] {
+        auto self = weak_this.ptr();
+        if (!self || !self->m_incremental_decode_id.has_value())
+            return;
+
+        Web::Platform::ImageCodecPlugin::the().finish_incremental_decode(*self->m_incremental_decode_id);
+    });
+
+    auto process_body_error = GC::create_function(GC::Heap::the(), [weak_this](JS::Value) {
+        auto self = weak_this.ptr();
+        if (!self)
+            return;
+
+        if (self->m_incremental_decode_id.has_value())
+            Web::Platform::ImageCodecPlugin::the().cancel_incremental_decode(self->m_incremental_decode_id.release_value());
+        self->handle_failed_fetch();
+    });
+
+    body.incrementally_read(realm, process_body_chunk, process_end_of_body, process_body_error, GC::Ref { realm.global_object() });
+}
+
+void SharedResourceRequest::handle_successful_bitmap_decode(Web::Platform::DecodedImage& result, bool image_data_is_cors_cross_origin)
+{
+    // AD-HOC: At this point, things gets very ad-hoc.
+    // FIXME: Bring this closer to spec.
+
+    if (result.session_id != 0) {
+        // Streaming animated decode: create AnimatedBitmapDecodedImageData.
+        Vector<NonnullRefPtr<Gfx::Bitmap>> initial_bitmaps;
+        initial_bitmaps.ensure_capacity(result.frames.size());
+        for (auto& frame : result.frames)
+            initial_bitmaps.unchecked_append(*frame.bitmap);
+
+        auto first_bitmap = result.frames.first().bitmap;
+        auto size = first_bitmap->size();
+
+        m_image_data = AnimatedBitmapDecodedImageData::create(
+            *m_document,
+            result.session_id,
+            result.frame_count,
+            result.loop_count,
+            size,
+            move(result.color_space),
+            move(result.all_durations),
+            move(initial_bitmaps));
+    } else {
+        // Single-shot decode: create BitmapDecodedImageData as before.
+        Vector<BitmapDecodedImageData::Frame> frames;
+        for (auto& frame : result.frames) {
+            frames.append(BitmapDecodedImageData::Frame {
+                .frame = Gfx::DecodedImageFrame { *frame.bitmap, result.color_space },
+                .duration = static_cast<int>(frame.duration),
+            });
+        }
+        auto image_data = BitmapDecodedImageData::create(move(frames), result.loop_count, result.is_animated, result.natural_size).release_value_but_fixme_should_propagate_errors();
+        image_data->set_encoded_data(move(m_encoded_data), Web::Platform::ImageCodecPlugin::cache_partition_for(m_document->relevant_settings_object()));
+
+        // NB: Clients that were added after the decode began may draw the image larger than it was decoded for.
+        image_data->ensure_decoded_for_size(ideal_decode_size());
+        m_image_data = image_data;
+    }
+    m_image_data->set_is_cors_cross_origin(image_data_is_cors_cross_origin);
+    handle_successful_resource_load();
 }
 
 void SharedResourceRequest::handle_failed_fetch()
 {
     m_state = State::Failed;
+    m_encoded_data.clear();
+    m_partially_decoded_image_data = nullptr;
     m_load_event_delayer.clear();
     m_fetch_controller = nullptr;
     for (auto& callback : m_callbacks) {
@@ -273,6 +403,8 @@ void SharedResourceRequest::handle_failed_fetch()
 void SharedResourceRequest::handle_successful_resource_load()
 {
     m_state = State::Finished;
+    m_encoded_data.clear();
+    m_partially_decoded_image_data = nullptr;
     m_load_event_delayer.clear();
     m_fetch_controller = nullptr;
     for (auto& callback : m_callbacks) {
@@ -6,8 +6,10 @@
 
 #pragma once
 
+#include <AK/ByteBuffer.h>
 #include <LibGC/Function.h>
 #include <LibGC/Ptr.h>
+#include <LibGfx/Size.h>
 #include <LibJS/Heap/Cell.h>
 #include <LibURL/URL.h>
 #include <LibWeb/DOM/DocumentLoadEventDelayer.h>
@@ -29,6 +31,9 @@ public:
     URL::URL const& url() const { return m_url; }
 
     [[nodiscard]] GC::Ptr<DecodedImageData> image_data() const;
+
+    // The part of a raster image that could be decoded from the data received so far, while it is still being fetched.
+    [[nodiscard]] GC::Ptr<DecodedImageData> partially_decoded_image_data() const { return m_partially_decoded_image_data; }
     [[nodiscard]] bool can_be_pruned_from_memory_cache() const;
     [[nodiscard]] u64 cache_touch_serial() const { return m_cache_touch_serial; }
     void touch_memory_cache_entry();
@@ -38,7 +43,10 @@ public:
 
     void fetch_resource(GC::Ref<Fetch::Infrastructure::Request>);
 
-    void add_callbacks(Function<void()> on_finish, Function<void()> on_fail);
+    // A client that passes an ideal_size only ever draws the image at up to that size in device pixels. Unless some
+    // other client needs the image at its natural size, the decode may then produce smaller frames. A client that
+    // needs more than the frames that were decoded for the others makes the image decode again.
+    void add_callbacks(Function<void()> on_finish, Function<void()> on_fail, Function<void()> on_partially_decoded = {}, Optional<Gfx::IntSize> ideal_size = {});
 
     bool is_fetching() const;
     bool needs_fetching() const;
@@ -49,14 +57,12 @@ private:
     virtual void finalize() override;
     virtual void visit_edges(JS::Cell::Visitor&) override;
 
-    enum class IsSVGImage {
-        No,
-        Yes,
-    };
-
-    void handle_successful_fetch(URL::URL const&, IsSVGImage, ByteBuffer data, bool image_data_is_cors_cross_origin);
+    void handle_successful_svg_fetch(URL::URL const&, ByteBuffer data, bool image_data_is_cors_cross_origin);
+    void decode_body_incrementally(JS::Realm&, Fetch::Infrastructure::Body&, bool image_data_is_cors_cross_origin);
+    void handle_successful_bitmap_decode(Web::Platform::DecodedImage&, bool image_data_is_cors_cross_origin);
     void handle_failed_fetch();
     void handle_successful_resource_load();
+    Optional<Gfx::IntSize> ideal_decode_size() const;
 
     enum class State {
         New,
@@ -72,11 +78,22 @@ private:
     struct Callbacks {
         GC::Ptr<GC::Function<void()>> on_finish;
         GC::Ptr<GC::Function<void()>> on_fail;
+        GC::Ptr<GC::Function<void()>> on_partially_decoded;
     };
     Vector<Callbacks> m_callbacks;
 
+    // The largest size any client will draw the image at, unless a client needs the image at its natural size.
+    Optional<Gfx::IntSize> m_ideal_decode_size;
+    bool m_needs_natural_size_decode { false };
+
+    // The encoded image, kept while it's decoded for an ideal size. The decoded image needs it to decode again.
+    ByteBuffer m_encoded_data;
+    bool m_keeps_encoded_data { false };
+
     URL::URL m_url;
     GC::Ptr<DecodedImageData> m_image_data;
+    GC::Ptr<DecodedImageData> m_partially_decoded_image_data;
+    Optional<i64> m_incremental_decode_id;
     GC::Ptr<Fetch::Infrastructure::FetchController> m_fetch_controller;
     u64 m_cache_touch_serial { 0 };
 
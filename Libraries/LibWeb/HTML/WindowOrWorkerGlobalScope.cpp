@@ -330,6 +330,8 @@ void WindowOrWorkerGlobalScopeMixin::create_image_bitmap_impl(JS::Realm& realm,
     image.visit(
         // -> Blob
         [&](GC::Ref<FileAPI::Blob> blob) {
+            auto cache_partition = Platform::ImageCodecPlugin::cache_partition_for(relevant_settings_object(*this));
+
             // Run these step in parallel:
             Platform::EventLoopPlugin::the().deferred_invoke(GC::create_function(GC::Heap::the(), [=]() {
                 // 1. Let imageData be the result of reading image's data. If an error occurs during reading of the
@@ -385,7 +387,7 @@ void WindowOrWorkerGlobalScopeMixin::create_image_bitmap_impl(JS::Realm& realm,
                     return {};
                 };
 
-                (void)Web::Platform::ImageCodecPlugin::the().decode_image(image_data, move(on_successful_decode), move(on_failed_decode));
+                (void)Web::Platform::ImageCodecPlugin::the().decode_image(image_data, move(on_successful_decode), move(on_failed_decode), {}, cache_partition);
             }));
         },
         // -> ImageData
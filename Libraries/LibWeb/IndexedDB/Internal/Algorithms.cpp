@@ -45,6 +45,7 @@
 #include <LibWeb/IndexedDB/Internal/Database.h>
 #include <LibWeb/IndexedDB/Internal/Index.h>
 #include <LibWeb/IndexedDB/Internal/Key.h>
+#include <LibWeb/IndexedDB/Internal/RecordRange.h>
 #include <LibWeb/Infra/Strings.h>
 #include <LibWeb/StorageAPI/StorageKey.h>
 #include <LibWeb/WebIDL/AbstractOperations.h>
@@ -1672,6 +1673,46 @@ WebIDL::ExceptionOr<JS::Value> retrieve_a_value_from_an_object_store(JS::Realm&
     return deserialize_a_stored_record(realm, serialized);
 }
 
+static GC::Ptr<Key> greater_of_keys(GC::Ptr<Key> a, GC::Ptr<Key> b)
+{
+    if (!a || !b)
+        return a ? a : b;
+    return Key::compare_two_keys(*a, *b) >= 0 ? a : b;
+}
+
+static GC::Ptr<Key> lesser_of_keys(GC::Ptr<Key> a, GC::Ptr<Key> b)
+{
+    if (!a || !b)
+        return a ? a : b;
+    return Key::compare_two_keys(*a, *b) <= 0 ? a : b;
+}
+
+// Records are sorted by key, so when every requirement of a cursor step demands a key of at least lower_bound, the
+// search can skip straight to the first such record instead of testing every record from the start.
+template<typename Records, typename Requirements>
+static Variant<Empty, ObjectStoreRecord, IndexRecord> first_record_matching(Records const& records, GC::Ptr<Key> lower_bound, Requirements const& requirements)
+{
+    auto start = lower_bound ? first_record_index_with_key_at_or_after(records, *lower_bound, false) : 0;
+    for (auto it = records.iterator_at(start); it != records.end(); ++it) {
+        if (requirements(*it))
+            return *it;
+    }
+    return Empty {};
+}
+
+// Likewise for steps that demand a key of at most upper_bound, searching backwards from the last such record.
+template<typename Records, typename Requirements>
+static Variant<Empty, ObjectStoreRecord, IndexRecord> last_record_matching(Records const& records, GC::Ptr<Key> upper_bound, Requirements const& requirements)
+{
+    auto end = upper_bound ? first_record_index_with_key_after(records, *upper_bound, false) : records.size();
+    for (auto it = records.iterator_at(end); it != records.begin();) {
+        --it;
+        if (requirements(*it))
+            return *it;
+    }
+    return Empty {};
+}
+
 // https://w3c.github.io/IndexedDB/#iterate-a-cursor
 WebIDL::ExceptionOr<GC::Ptr<IDBCursor>> iterate_a_cursor(JS::Realm& realm, GC::Ref<IDBCursor> cursor, GC::Ptr<Key> key, GC::Ptr<Key> primary_key, u64 count)
 {
@@ -1687,12 +1728,12 @@ WebIDL::ExceptionOr<GC::Ptr<IDBCursor>> iterate_a_cursor(JS::Realm& realm, GC::R
         VERIFY(source.has<GC::Ref<Index>>() && direction_is_next_or_prev);
 
     // 4. Let records be the list of records in source.
-    Variant<ReadonlySpan<ObjectStoreRecord>, ReadonlySpan<IndexRecord>> records = source.visit(
-        [](GC::Ref<ObjectStore> object_store) -> Variant<ReadonlySpan<ObjectStoreRecord>, ReadonlySpan<IndexRecord>> {
-            return object_store->records();
+    Variant<RecordTree<ObjectStoreRecord> const*, RecordTree<IndexRecord> const*> records = source.visit(
+        [](GC::Ref<ObjectStore> object_store) -> Variant<RecordTree<ObjectStoreRecord> const*, RecordTree<IndexRecord> const*> {
+            return &object_store->records();
         },
-        [](GC::Ref<Index> index) -> Variant<ReadonlySpan<ObjectStoreRecord>, ReadonlySpan<IndexRecord>> {
-            return index->records();
+        [](GC::Ref<Index> index) -> Variant<RecordTree<ObjectStoreRecord> const*, RecordTree<IndexRecord> const*> {
+            return &index->records();
         });
 
     // 5. Let range be cursor’s range.
@@ -1886,50 +1927,39 @@ WebIDL::ExceptionOr<GC::Ptr<IDBCursor>> iterate_a_cursor(JS::Realm& realm, GC::R
     // 9. While count is greater than 0:
     Variant<Empty, ObjectStoreRecord, IndexRecord> found_record;
     while (count > 0) {
+        // NOTE: Every requirement below bounds the record's key by key, position and range, so only records past the
+        //       tightest of those bounds need to be tested.
+        auto lower_bound = greater_of_keys(greater_of_keys(key, position), range->lower_key());
+        auto upper_bound = lesser_of_keys(lesser_of_keys(key, position), range->upper_key());
+
         // 1. Switch on direction:
         switch (direction) {
         case CursorDirection::Next: {
             // Let found record be the first record in records which satisfy all of the following requirements:
-            found_record = records.visit([&](auto content) -> Variant<Empty, ObjectStoreRecord, IndexRecord> {
-                auto value = content.first_matching(next_requirements);
-                if (value.has_value())
-                    return *value;
-
-                return Empty {};
+            found_record = records.visit([&](auto const* content) {
+                return first_record_matching(*content, lower_bound, next_requirements);
             });
             break;
         }
         case CursorDirection::Nextunique: {
             // Let found record be the first record in records which satisfy all of the following requirements:
-            found_record = records.visit([&](auto content) -> Variant<Empty, ObjectStoreRecord, IndexRecord> {
-                auto value = content.first_matching(next_unique_requirements);
-                if (value.has_value())
-                    return *value;
-
-                return Empty {};
+            found_record = records.visit([&](auto const* content) {
+                return first_record_matching(*content, lower_bound, next_unique_requirements);
             });
             break;
         }
         case CursorDirection::Prev: {
             // Let found record be the last record in records which satisfy all of the following requirements:
-            found_record = records.visit([&](auto content) -> Variant<Empty, ObjectStoreRecord, IndexRecord> {
-                auto value = content.last_matching(prev_requirements);
-                if (value.has_value())
-                    return *value;
-
-                return Empty {};
+            found_record = records.visit([&](auto const* content) {
+                return last_record_matching(*content, upper_bound, prev_requirements);
             });
             break;
         }
 
         case CursorDirection::Prevunique: {
             // Let temp record be the last record in records which satisfy all of the following requirements:
-            auto temp_record = records.visit([&](auto content) -> Variant<Empty, ObjectStoreRecord, IndexRecord> {
-                auto value = content.last_matching(prev_unique_requirements);
-                if (value.has_value())
-                    return *value;
-
-                return Empty {};
+            auto temp_record = records.visit([&](auto const* content) {
+                return last_record_matching(*content, upper_bound, prev_unique_requirements);
             });
 
             // If temp record is defined, let found record be the first record in records whose key is equal to temp record’s key.
@@ -1938,14 +1968,10 @@ WebIDL::ExceptionOr<GC::Ptr<IDBCursor>> iterate_a_cursor(JS::Realm& realm, GC::R
                     [](Empty) -> GC::Ref<Key> { VERIFY_NOT_REACHED(); },
                     [](auto const& record) { return record.key; });
 
-                found_record = records.visit([&](auto content) -> Variant<Empty, ObjectStoreRecord, IndexRecord> {
-                    auto value = content.first_matching([&](auto const& content_record) {
+                found_record = records.visit([&](auto const* content) {
+                    return first_record_matching(*content, temp_record_key, [&](auto const& content_record) {
                         return Key::equals(content_record.key, temp_record_key);
                     });
-                    if (value.has_value())
-                        return *value;
-
-                    return Empty {};
                 });
             }
 
@@ -73,16 +73,14 @@ HTML::StorageSerializationRecord const& Index::referenced_value(IndexRecord cons
 {
     // Records in an index are said to have a referenced value.
     // This is the value of the record in the index’s referenced object store which has a key equal to the index’s record’s value.
-    auto* store_record = AK::binary_search(m_object_store->records(), index_record.value, nullptr, [](auto const& needle, auto const& record) {
-        return Key::compare_two_keys(needle, record.key);
-    });
-    VERIFY(store_record);
+    auto store_record = m_object_store->record_with_key(index_record.value);
+    VERIFY(store_record.has_value());
     return *store_record->value;
 }
 
 void Index::clear_records()
 {
-    auto deleted = move(m_records);
+    auto deleted = m_records.take_all();
     if (auto log = m_object_store->mutation_log(); log && !deleted.is_empty())
         log->note_index_records_deleted(*this, move(deleted));
 }
@@ -99,8 +97,9 @@ GC::ConservativeVector<IndexRecord> Index::first_n_in_range(GC::Ref<IDBKeyRange>
 {
     GC::ConservativeVector<IndexRecord> records;
     auto record_range = record_range_for_key_range(m_records, range);
-    for (size_t i = record_range.start; i < record_range.end; ++i) {
-        records.append(m_records[i]);
+    auto it = m_records.iterator_at(record_range.start);
+    for (size_t i = record_range.start; i < record_range.end; ++i, ++it) {
+        records.append(*it);
 
         if (count.has_value() && records.size() >= *count)
             break;
@@ -113,9 +112,10 @@ GC::ConservativeVector<IndexRecord> Index::last_n_in_range(GC::Ref<IDBKeyRange>
 {
     GC::ConservativeVector<IndexRecord> records;
     auto record_range = record_range_for_key_range(m_records, range);
-    for (size_t i = record_range.end; i > record_range.start;) {
-        --i;
-        records.append(m_records[i]);
+    auto it = m_records.iterator_at(record_range.end);
+    for (size_t i = record_range.end; i > record_range.start; --i) {
+        --it;
+        records.append(*it);
 
         if (count.has_value() && records.size() >= *count)
             break;
@@ -153,19 +153,10 @@ void Index::remove_record(IndexRecord const& record)
 
 void Index::remove_records_with_value_in_range(GC::Ref<IDBKeyRange> range)
 {
-    auto log = m_object_store->mutation_log();
-    Vector<IndexRecord> removed_records;
-    for (size_t i = 0; i < m_records.size();) {
-        auto const& record = m_records[i];
-        if (range->is_in_range(record.value)) {
-            auto removed_record = m_records.take(i);
-            if (log)
-                removed_records.append(removed_record);
-            continue;
-        }
-        i++;
-    }
-    if (!removed_records.is_empty())
+    auto removed_records = m_records.take_all_matching([&](auto const& record) {
+        return range->is_in_range(record.value);
+    });
+    if (auto log = m_object_store->mutation_log(); log && !removed_records.is_empty())
         log->note_index_records_deleted(*this, move(removed_records));
 }
 
@@ -11,6 +11,7 @@
 #include <LibJS/Heap/Cell.h>
 #include <LibWeb/IndexedDB/IDBRecord.h>
 #include <LibWeb/IndexedDB/Internal/ObjectStore.h>
+#include <LibWeb/IndexedDB/Internal/RecordTree.h>
 
 namespace Web::IndexedDB {
 
@@ -30,7 +31,7 @@ public:
     [[nodiscard]] bool unique() const { return m_unique; }
     [[nodiscard]] bool multi_entry() const { return m_multi_entry; }
     [[nodiscard]] GC::Ref<ObjectStore> object_store() const { return m_object_store; }
-    [[nodiscard]] AK::ReadonlySpan<IndexRecord> records() const { return m_records; }
+    [[nodiscard]] RecordTree<IndexRecord> const& records() const { return m_records; }
     [[nodiscard]] KeyPath const& key_path() const { return m_key_path; }
 
     [[nodiscard]] bool is_deleted() const { return m_deleted; }
@@ -58,7 +59,7 @@ private:
     GC::Ref<ObjectStore> m_object_store;
 
     // The index has a list of records which hold the data stored in the index.
-    Vector<IndexRecord> m_records;
+    RecordTree<IndexRecord> m_records;
 
     // An index has a name, which is a name. At any one time, the name is unique within index’s referenced object store.
     Utf16String m_name;
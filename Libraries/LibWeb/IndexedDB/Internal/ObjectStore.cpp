@@ -68,14 +68,10 @@ void ObjectStore::remove_records_in_range(GC::Ref<IDBKeyRange> range)
     auto record_range = record_range_for_key_range(m_records, range);
 
     if (record_range.start < record_range.end) {
-        if (m_mutation_log) {
-            Vector<ObjectStoreRecord> deleted;
-            deleted.ensure_capacity(record_range.end - record_range.start);
-            for (size_t i = record_range.start; i < record_range.end; ++i)
-                deleted.append(move(m_records[i]));
-            m_mutation_log->note_records_deleted(move(deleted));
-        }
-        m_records.remove(record_range.start, record_range.end - record_range.start);
+        if (m_mutation_log)
+            m_mutation_log->note_records_deleted(m_records.take(record_range.start, record_range.end - record_range.start));
+        else
+            m_records.remove(record_range.start, record_range.end - record_range.start);
     }
 }
 
@@ -91,9 +87,15 @@ void ObjectStore::remove_record_with_key(GC::Ref<Key> key)
 
 bool ObjectStore::has_record_with_key(GC::Ref<Key> key)
 {
-    return binary_search(m_records, key, nullptr, [](auto const& needle, auto const& record) -> int {
-        return Key::compare_two_keys(needle, record.key);
-    }) != nullptr;
+    return record_with_key(key).has_value();
+}
+
+Optional<ObjectStoreRecord const&> ObjectStore::record_with_key(GC::Ref<Key> key) const
+{
+    auto index = first_record_index_with_key_at_or_after(m_records, key, false);
+    if (index == m_records.size() || Key::compare_two_keys(m_records[index].key, key) != 0)
+        return {};
+    return m_records[index];
 }
 
 void ObjectStore::store_a_record(ObjectStoreRecord record)
@@ -107,7 +109,8 @@ void ObjectStore::store_a_record(ObjectStoreRecord record)
         return;
     }
 
-    m_records.insert(first_record_index_with_key_at_or_after(m_records, record.key, false), move(record));
+    auto index = first_record_index_with_key_at_or_after(m_records, record.key, false);
+    m_records.insert(index, move(record));
 }
 
 u64 ObjectStore::count_records_in_range(GC::Ref<IDBKeyRange> range)
@@ -126,7 +129,7 @@ Optional<ObjectStoreRecord&> ObjectStore::first_in_range(GC::Ref<IDBKeyRange> ra
 
 void ObjectStore::clear_records()
 {
-    auto deleted_records = move(m_records);
+    auto deleted_records = m_records.take_all();
     if (m_mutation_log && !deleted_records.is_empty())
         m_mutation_log->note_records_deleted(deleted_records);
 }
@@ -184,8 +187,9 @@ GC::ConservativeVector<ObjectStoreRecord> ObjectStore::first_n_in_range(GC::Ref<
 {
     GC::ConservativeVector<ObjectStoreRecord> records;
     auto record_range = record_range_for_key_range(m_records, range);
-    for (size_t i = record_range.start; i < record_range.end; ++i) {
-        records.append(m_records[i]);
+    auto it = m_records.iterator_at(record_range.start);
+    for (size_t i = record_range.start; i < record_range.end; ++i, ++it) {
+        records.append(*it);
 
         if (count.has_value() && records.size() >= *count)
             break;
@@ -198,9 +202,10 @@ GC::ConservativeVector<ObjectStoreRecord> ObjectStore::last_n_in_range(GC::Ref<I
 {
     GC::ConservativeVector<ObjectStoreRecord> records;
     auto record_range = record_range_for_key_range(m_records, range);
-    for (size_t i = record_range.end; i > record_range.start;) {
-        --i;
-        records.append(m_records[i]);
+    auto it = m_records.iterator_at(record_range.end);
+    for (size_t i = record_range.end; i > record_range.start; --i) {
+        --it;
+        records.append(*it);
 
         if (count.has_value() && records.size() >= *count)
             break;
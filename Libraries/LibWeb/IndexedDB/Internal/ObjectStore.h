@@ -19,6 +19,7 @@
 #include <LibWeb/IndexedDB/Internal/Index.h>
 #include <LibWeb/IndexedDB/Internal/KeyGenerator.h>
 #include <LibWeb/IndexedDB/Internal/MutationLog.h>
+#include <LibWeb/IndexedDB/Internal/RecordTree.h>
 
 namespace Web::IndexedDB {
 
@@ -46,10 +47,11 @@ public:
     void set_deleted(bool deleted) { m_deleted = deleted; }
 
     GC::Ref<Database> database() const { return m_database; }
-    ReadonlySpan<ObjectStoreRecord> records() const { return m_records; }
+    RecordTree<ObjectStoreRecord> const& records() const { return m_records; }
 
     void remove_records_in_range(GC::Ref<IDBKeyRange> range);
     bool has_record_with_key(GC::Ref<Key> key);
+    Optional<ObjectStoreRecord const&> record_with_key(GC::Ref<Key> key) const;
     void store_a_record(ObjectStoreRecord record);
     void remove_record_with_key(GC::Ref<Key> key);
     u64 count_records_in_range(GC::Ref<IDBKeyRange> range);
@@ -91,7 +93,9 @@ private:
     Optional<KeyGenerator> m_key_generator;
 
     // An object store has a list of records
-    Vector<ObjectStoreRecord> m_records;
+    // NOTE: Records only live in this process's memory. Writing them to disk is a separate change, since it needs
+    //       an on-disk format for keys, serialized values and schemas, and a process that owns databases.
+    RecordTree<ObjectStoreRecord> m_records;
 
     bool m_deleted { false };
 
@@ -0,0 +1,333 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/StdLibExtras.h>
+#include <AK/Vector.h>
+
+namespace Web::IndexedDB {
+
+// A list of records split into pages of at most max_page_size records each. A Fenwick tree over the page sizes finds
+// the page that holds a position, and is updated in logarithmic time when a record is added to or removed from a page.
+// Inserting or removing a record therefore only shifts the records of one page, instead of every record after it, so
+// loading a few hundred thousand records into an object store or index no longer takes quadratic time. Splitting a full
+// page rebuilds the Fenwick tree in time linear in the number of pages, which happens at most once every
+// max_page_size / 2 inserts.
+//
+// The tree does not order the records itself. Callers keep them sorted by inserting at positions they found with the
+// binary searches in RecordRange.h, which work on any container with size() and operator[].
+template<typename Record>
+class RecordTree {
+    AK_MAKE_NONCOPYABLE(RecordTree);
+
+public:
+    static constexpr size_t max_page_size = 256;
+
+    template<bool is_const>
+    class IteratorBase {
+    public:
+        using Tree = Conditional<is_const, RecordTree const, RecordTree>;
+        using Reference = Conditional<is_const, Record const&, Record&>;
+
+        Reference operator*() const { return m_tree->m_pages[m_page][m_index_in_page]; }
+        auto* operator->() const { return &**this; }
+
+        bool operator==(IteratorBase const& other) const { return m_page == other.m_page && m_index_in_page == other.m_index_in_page; }
+
+        IteratorBase& operator++()
+        {
+            if (++m_index_in_page == m_tree->m_pages[m_page].size()) {
+                ++m_page;
+                m_index_in_page = 0;
+            }
+            return *this;
+        }
+
+        IteratorBase& operator--()
+        {
+            if (m_index_in_page == 0) {
+                --m_page;
+                m_index_in_page = m_tree->m_pages[m_page].size();
+            }
+            --m_index_in_page;
+            return *this;
+        }
+
+    private:
+        friend class RecordTree;
+
+        IteratorBase(Tree& tree, size_t page, size_t index_in_page)
+            : m_tree(&tree)
+            , m_page(page)
+            , m_index_in_page(index_in_page)
+        {
+        }
+
+        Tree* m_tree { nullptr };
+        size_t m_page { 0 };
+        size_t m_index_in_page { 0 };
+    };
+
+    using Iterator = IteratorBase<false>;
+    using ConstIterator = IteratorBase<true>;
+
+    RecordTree() = default;
+    RecordTree(RecordTree&&) = default;
+    RecordTree& operator=(RecordTree&&) = default;
+
+    size_t size() const { return m_size; }
+    bool is_empty() const { return m_size == 0; }
+
+    Record& operator[](size_t index)
+    {
+        auto location = locate(index);
+        return m_pages[location.page][location.index_in_page];
+    }
+
+    Record const& operator[](size_t index) const
+    {
+        auto location = locate(index);
+        return m_pages[location.page][location.index_in_page];
+    }
+
+    Record& last() { return m_pages.last().last(); }
+    Record const& last() const { return m_pages.last().last(); }
+
+    Iterator begin() { return { *this, 0, 0 }; }
+    Iterator end() { return { *this, m_pages.size(), 0 }; }
+    ConstIterator begin() const { return { *this, 0, 0 }; }
+    ConstIterator end() const { return { *this, m_pages.size(), 0 }; }
+
+    ConstIterator iterator_at(size_t index) const
+    {
+        if (index >= m_size)
+            return end();
+        auto location = locate(index);
+        return { *this, location.page, location.index_in_page };
+    }
+
+    void append(Record record)
+    {
+        // Appending is the common case for generated keys. Start a new page rather than splitting a full one, so that
+        // pages filled in key order stay full.
+        if (m_pages.is_empty() || m_pages.last().size() >= max_page_size) {
+            m_pages.append({});
+            m_pages.last().ensure_capacity(max_page_size);
+            m_pages.last().append(move(record));
+            append_to_page_size_index();
+        } else {
+            m_pages.last().append(move(record));
+            add_to_page_size(m_pages.size() - 1, 1);
+        }
+        ++m_size;
+    }
+
+    void insert(size_t index, Record record)
+    {
+        VERIFY(index <= m_size);
+        if (index == m_size) {
+            append(move(record));
+            return;
+        }
+
+        auto location = locate(index);
+        auto& page = m_pages[location.page];
+        page.insert(location.index_in_page, move(record));
+        ++m_size;
+
+        if (page.size() > max_page_size)
+            split_page(location.page);
+        else
+            add_to_page_size(location.page, 1);
+    }
+
+    void remove(size_t index, size_t count = 1)
+    {
+        if (count == 0)
+            return;
+        VERIFY(index + count <= m_size);
+
+        auto location = locate(index);
+        auto page_index = location.page;
+        auto index_in_page = location.index_in_page;
+        bool removed_a_page = false;
+
+        while (count > 0) {
+            auto& page = m_pages[page_index];
+            auto removed_count = min(count, page.size() - index_in_page);
+            page.remove(index_in_page, removed_count);
+            count -= removed_count;
+            m_size -= removed_count;
+
+            if (page.is_empty()) {
+                m_pages.remove(page_index);
+                removed_a_page = true;
+            } else {
+                if (!removed_a_page)
+                    subtract_from_page_size(page_index, removed_count);
+                ++page_index;
+            }
+            index_in_page = 0;
+        }
+
+        if (removed_a_page)
+            rebuild_page_size_index();
+    }
+
+    Vector<Record> take(size_t index, size_t count)
+    {
+        if (count == 0)
+            return {};
+
+        Vector<Record> records;
+        records.ensure_capacity(count);
+
+        auto location = locate(index);
+        for (auto page_index = location.page, index_in_page = location.index_in_page; records.size() < count; ++page_index, index_in_page = 0) {
+            auto& page = m_pages[page_index];
+            for (; index_in_page < page.size() && records.size() < count; ++index_in_page)
+                records.unchecked_append(move(page[index_in_page]));
+        }
+
+        remove(index, count);
+        return records;
+    }
+
+    Vector<Record> take_all()
+    {
+        Vector<Record> records;
+        records.ensure_capacity(m_size);
+        for (auto& page : m_pages) {
+            for (auto& record : page)
+                records.unchecked_append(move(record));
+        }
+        clear();
+        return records;
+    }
+
+    template<typename Callback>
+    Vector<Record> take_all_matching(Callback callback)
+    {
+        Vector<Record> taken_records;
+        for (size_t page_index = 0; page_index < m_pages.size();) {
+            auto& page = m_pages[page_index];
+            size_t kept_count = 0;
+            for (size_t i = 0; i < page.size(); ++i) {
+                if (callback(page[i])) {
+                    taken_records.append(move(page[i]));
+                    continue;
+                }
+                if (kept_count != i)
+                    page[kept_count] = move(page[i]);
+                ++kept_count;
+            }
+            page.shrink(kept_count);
+
+            if (page.is_empty())
+                m_pages.remove(page_index);
+            else
+                ++page_index;
+        }
+
+        m_size -= taken_records.size();
+        rebuild_page_size_index();
+        return taken_records;
+    }
+
+    void clear()
+    {
+        m_pages.clear();
+        m_page_size_index.clear();
+        m_size = 0;
+    }
+
+private:
+    struct Location {
+        size_t page { 0 };
+        size_t index_in_page { 0 };
+    };
+
+    // The Fenwick tree is stored 1-based: node n, at m_page_size_index[n - 1], holds the total size of the pages in
+    // (n - lowest_set_bit(n), n].
+    static constexpr size_t lowest_set_bit(size_t n) { return n & (~n + 1); }
+
+    Location locate(size_t index) const
+    {
+        VERIFY(index < m_size);
+
+        // Descend the Fenwick tree to find how many whole pages come before the index.
+        size_t step = 1;
+        while (step * 2 <= m_page_size_index.size())
+            step *= 2;
+
+        size_t page = 0;
+        size_t index_in_page = index;
+        for (; step > 0; step /= 2) {
+            if (page + step <= m_page_size_index.size() && m_page_size_index[page + step - 1] <= index_in_page) {
+                page += step;
+                index_in_page -= m_page_size_index[page - 1];
+            }
+        }
+        return { page, index_in_page };
+    }
+
+    void add_to_page_size(size_t page_index, size_t count)
+    {
+        for (auto node = page_index + 1; node <= m_page_size_index.size(); node += lowest_set_bit(node))
+            m_page_size_index[node - 1] += count;
+    }
+
+    void subtract_from_page_size(size_t page_index, size_t count)
+    {
+        for (auto node = page_index + 1; node <= m_page_size_index.size(); node += lowest_set_bit(node))
+            m_page_size_index[node - 1] -= count;
+    }
+
+    // Adds the node for the last page, which covers that page and some of the nodes before it.
+    void append_to_page_size_index()
+    {
+        auto node = m_pages.size();
+        auto covered_size = m_pages.last().size();
+        for (size_t step = 1; step < lowest_set_bit(node); step *= 2)
+            covered_size += m_page_size_index[node - step - 1];
+        m_page_size_index.append(covered_size);
+    }
+
+    void rebuild_page_size_index()
+    {
+        m_page_size_index.resize(m_pages.size());
+        for (size_t i = 0; i < m_pages.size(); ++i)
+            m_page_size_index[i] = m_pages[i].size();
+        for (size_t node = 1; node <= m_page_size_index.size(); ++node) {
+            auto parent = node + lowest_set_bit(node);
+            if (parent <= m_page_size_index.size())
+                m_page_size_index[parent - 1] += m_page_size_index[node - 1];
+        }
+    }
+
+    void split_page(size_t page_index)
+    {
+        auto& page = m_pages[page_index];
+        auto split_index = page.size() / 2;
+
+        Vector<Record> upper_half;
+        upper_half.ensure_capacity(max_page_size);
+        for (size_t i = split_index; i < page.size(); ++i)
+            upper_half.unchecked_append(move(page[i]));
+        page.shrink(split_index);
+
+        m_pages.insert(page_index + 1, move(upper_half));
+        rebuild_page_size_index();
+    }
+
+    // Every page holds at least one record.
+    Vector<Vector<Record>> m_pages;
+    Vector<size_t> m_page_size_index;
+    size_t m_size { 0 };
+};
+
+}
@@ -34,6 +34,78 @@ DisplayList::DisplayList(u64 compatible_visual_context_tree_version, u64 id, Byt
 {
 }
 
+ErrorOr<NonnullRefPtr<DisplayList>> DisplayList::create_from_delta(DisplayList const& base, DisplayListDelta&& delta)
+{
+    if (delta.base_display_list_id != base.id())
+        return Error::from_string_literal("Display list delta is based on a different display list");
+
+    auto base_bytes = base.command_bytes();
+    if (delta.unchanged_prefix_size > base_bytes.size() || delta.unchanged_suffix_size > base_bytes.size() - delta.unchanged_prefix_size)
+        return Error::from_string_literal("Display list delta keeps more commands than its base display list has");
+
+    auto prefix = base_bytes.trim(delta.unchanged_prefix_size);
+    auto suffix = base_bytes.slice_from_end(delta.unchanged_suffix_size);
+    auto command_bytes = TRY(ByteBuffer::create_uninitialized(prefix.size() + delta.changed_command_bytes.size() + suffix.size()));
+    prefix.copy_to(command_bytes.span());
+    delta.changed_command_bytes.span().copy_to(command_bytes.span().slice(prefix.size()));
+    suffix.copy_to(command_bytes.span().slice(prefix.size() + delta.changed_command_bytes.size()));
+
+    return adopt_ref(*new DisplayList(delta.compatible_visual_context_tree_version, delta.id, move(command_bytes), delta.surface_clear_color, move(delta.async_scrolling_metadata), move(delta.mask_display_lists)));
+}
+
+// Returns where each command starts, followed by where the last one ends.
+static Vector<size_t> command_boundaries(ReadonlyBytes command_bytes)
+{
+    Vector<size_t> boundaries;
+    boundaries.append(0);
+    DisplayList::for_each_command_header(command_bytes, [&](auto const&, ReadonlyBytes payload) {
+        boundaries.append(payload.data() + payload.size() - command_bytes.data());
+    });
+    return boundaries;
+}
+
+Optional<DisplayListDelta> DisplayList::delta_from(DisplayList const& base) const
+{
+    auto base_bytes = base.command_bytes();
+    auto new_bytes = command_bytes();
+    auto base_boundaries = command_boundaries(base_bytes);
+    auto new_boundaries = command_boundaries(new_bytes);
+
+    auto base_command = [&](size_t index) { return base_bytes.slice(base_boundaries[index], base_boundaries[index + 1] - base_boundaries[index]); };
+    auto new_command = [&](size_t index) { return new_bytes.slice(new_boundaries[index], new_boundaries[index + 1] - new_boundaries[index]); };
+
+    auto base_command_count = base_boundaries.size() - 1;
+    auto new_command_count = new_boundaries.size() - 1;
+    auto shared_command_count = min(base_command_count, new_command_count);
+
+    size_t prefix_command_count = 0;
+    while (prefix_command_count < shared_command_count && base_command(prefix_command_count) == new_command(prefix_command_count))
+        ++prefix_command_count;
+
+    size_t suffix_command_count = 0;
+    while (suffix_command_count < shared_command_count - prefix_command_count
+        && base_command(base_command_count - 1 - suffix_command_count) == new_command(new_command_count - 1 - suffix_command_count))
+        ++suffix_command_count;
+
+    auto unchanged_prefix_size = new_boundaries[prefix_command_count];
+    auto unchanged_suffix_size = new_bytes.size() - new_boundaries[new_command_count - suffix_command_count];
+    auto changed_command_bytes = new_bytes.slice(unchanged_prefix_size, new_bytes.size() - unchanged_prefix_size - unchanged_suffix_size);
+    if (changed_command_bytes.size() * 2 > new_bytes.size())
+        return {};
+
+    return DisplayListDelta {
+        .id = m_id,
+        .base_display_list_id = base.id(),
+        .compatible_visual_context_tree_version = m_compatible_visual_context_tree_version,
+        .unchanged_prefix_size = unchanged_prefix_size,
+        .unchanged_suffix_size = unchanged_suffix_size,
+        .changed_command_bytes = MUST(ByteBuffer::copy(changed_command_bytes)),
+        .surface_clear_color = m_surface_clear_color,
+        .async_scrolling_metadata = m_async_scrolling_metadata,
+        .mask_display_lists = m_mask_display_lists,
+    };
+}
+
 bool DisplayList::append_bytes(
     DisplayListCommandType type,
     ReadonlyBytes payload,
@@ -515,4 +587,35 @@ ErrorOr<NonnullRefPtr<Web::Painting::DisplayList>> decode(Decoder& decoder)
     return adopt_ref(*new Web::Painting::DisplayList(compatible_visual_context_tree_version, id, move(command_bytes), surface_clear_color, move(async_scrolling_metadata), move(mask_display_lists)));
 }
 
+template<>
+ErrorOr<void> encode(Encoder& encoder, Web::Painting::DisplayListDelta const& delta)
+{
+    TRY(encoder.encode(delta.id));
+    TRY(encoder.encode(delta.base_display_list_id));
+    TRY(encoder.encode(delta.compatible_visual_context_tree_version));
+    TRY(encoder.encode(delta.unchanged_prefix_size));
+    TRY(encoder.encode(delta.unchanged_suffix_size));
+    TRY(encoder.encode(delta.changed_command_bytes));
+    TRY(encoder.encode(delta.surface_clear_color));
+    TRY(encoder.encode(delta.async_scrolling_metadata));
+    TRY(encoder.encode(delta.mask_display_lists));
+    return {};
+}
+
+template<>
+ErrorOr<Web::Painting::DisplayListDelta> decode(Decoder& decoder)
+{
+    return Web::Painting::DisplayListDelta {
+        .id = TRY(decoder.decode<u64>()),
+        .base_display_list_id = TRY(decoder.decode<u64>()),
+        .compatible_visual_context_tree_version = TRY(decoder.decode<u64>()),
+        .unchanged_prefix_size = TRY(decoder.decode<u64>()),
+        .unchanged_suffix_size = TRY(decoder.decode<u64>()),
+        .changed_command_bytes = TRY(decoder.decode<ByteBuffer>()),
+        .surface_clear_color = TRY(decoder.decode<Optional<Gfx::Color>>()),
+        .async_scrolling_metadata = TRY(decoder.decode<Optional<Web::Painting::DisplayList::AsyncScrollingMetadata>>()),
+        .mask_display_lists = TRY(decoder.decode<HashMap<Web::Painting::VisualContextIndex, Web::Painting::DisplayListResourceId>>()),
+    };
+}
+
 }
@@ -91,6 +91,8 @@ private:
     ReplayPaletteStorage m_replay_palette_storage;
 };
 
+struct DisplayListDelta;
+
 class DisplayList : public AtomicRefCounted<DisplayList> {
 public:
     struct AsyncScrollingMetadata {
@@ -112,6 +114,13 @@ public:
         return display_list;
     }
 
+    static ErrorOr<NonnullRefPtr<DisplayList>> create_from_delta(DisplayList const& base, DisplayListDelta&&);
+
+    // Returns the commands that changed since the base display list, or nothing if that is not much less than the
+    // whole display list. Only unchanged commands at the start and end are left out, which covers the common case of
+    // a frame repainting a few boxes of an otherwise unchanged page.
+    Optional<DisplayListDelta> delta_from(DisplayList const& base) const;
+
     template<DisplayListCommand Command>
     bool append(Command const& command, AccumulatedVisualContextTree const& visual_context_tree, VisualContextIndex context_index, bool context_geometry_only, ReadonlyBytes inline_data = {})
     {
@@ -204,6 +213,19 @@ private:
     friend ErrorOr<T> IPC::decode(IPC::Decoder&);
 };
 
+// A display list described by the commands it does not share with a display list the receiver already has.
+struct DisplayListDelta {
+    u64 id { 0 };
+    u64 base_display_list_id { 0 };
+    u64 compatible_visual_context_tree_version { 0 };
+    u64 unchanged_prefix_size { 0 };
+    u64 unchanged_suffix_size { 0 };
+    ByteBuffer changed_command_bytes;
+    Optional<Gfx::Color> surface_clear_color;
+    Optional<DisplayList::AsyncScrollingMetadata> async_scrolling_metadata;
+    HashMap<VisualContextIndex, DisplayListResourceId> mask_display_lists;
+};
+
 }
 
 namespace IPC {
@@ -220,4 +242,9 @@ WEB_API ErrorOr<void> encode(Encoder&, NonnullRefPtr<Web::Painting::DisplayList>
 template<>
 WEB_API ErrorOr<NonnullRefPtr<Web::Painting::DisplayList>> decode(Decoder&);
 
+template<>
+WEB_API ErrorOr<void> encode(Encoder&, Web::Painting::DisplayListDelta const&);
+template<>
+WEB_API ErrorOr<Web::Painting::DisplayListDelta> decode(Decoder&);
+
 }
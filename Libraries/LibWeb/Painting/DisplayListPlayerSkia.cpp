@@ -5,6 +5,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/HashMap.h>
 #include <AK/TemporaryChange.h>
 #include <core/SkBitmap.h>
 #include <core/SkBlurTypes.h>
@@ -36,6 +37,9 @@
 #include <LibGfx/PainterSkia.h>
 #include <LibGfx/SkiaBackendContext.h>
 #include <LibGfx/SkiaUtils.h>
+#include <LibSync/ConditionVariable.h>
+#include <LibSync/Mutex.h>
+#include <LibThreading/ThreadPool.h>
 #include <LibWeb/Painting/CanvasSurfaceRegistry.h>
 #include <LibWeb/Painting/DisplayListPlayerSkia.h>
 
@@ -74,6 +78,213 @@ void DisplayListPlayerSkia::execute(
         canvas_surface_registry);
 }
 
+static constexpr int MIN_AREA_FOR_TILED_RASTER = 512 * 512;
+
+NonnullRefPtr<Gfx::PaintingSurface> RasterTilePool::take()
+{
+    auto tile = [&] {
+        if (!m_available_tiles.is_empty())
+            return m_available_tiles.take_last();
+        ++m_allocated_tile_count;
+        return Gfx::PaintingSurface::create_with_size({ tile_size, tile_size }, Gfx::BitmapFormat::BGRA8888, Gfx::AlphaType::Premultiplied);
+    }();
+    m_peak_tiles_in_use_since_trim = max(m_peak_tiles_in_use_since_trim, m_allocated_tile_count - m_available_tiles.size());
+    return tile;
+}
+
+void RasterTilePool::give_back(NonnullRefPtr<Gfx::PaintingSurface> tile)
+{
+    m_available_tiles.append(move(tile));
+}
+
+void RasterTilePool::did_paint_frame()
+{
+    if (++m_frames_since_trim < frames_per_trim)
+        return;
+
+    while (m_allocated_tile_count > m_peak_tiles_in_use_since_trim && !m_available_tiles.is_empty()) {
+        m_available_tiles.take_last();
+        --m_allocated_tile_count;
+    }
+    m_frames_since_trim = 0;
+    m_peak_tiles_in_use_since_trim = m_allocated_tile_count - m_available_tiles.size();
+}
+
+void RasterTilePool::release_available_tiles()
+{
+    m_allocated_tile_count -= m_available_tiles.size();
+    m_available_tiles.clear();
+    m_frames_since_trim = 0;
+    m_peak_tiles_in_use_since_trim = m_allocated_tile_count;
+}
+
+// Returns whether every tile can replay the display list at the same time. The resources that the player resolves
+// lazily (decoded image frames and font hinting) are resolved here, on the calling thread, so that the tiles only ever
+// read them.
+static bool prepare_display_list_for_concurrent_replay(DisplayList const& display_list, DisplayListResourceStorage const& resource_storage)
+{
+    // Masks are painted with nested display lists, whose rasters are cached in the resource storage.
+    if (!display_list.mask_display_lists().is_empty())
+        return false;
+
+    HashMap<u64, float> font_scales;
+    Vector<ImageFrameResourceId> image_frames;
+    bool can_replay_concurrently = true;
+
+    auto use_font = [&](FontResourceId font_id, float scale) {
+        // Font only remembers the hinting options of the last scale it was used with.
+        auto existing_scale = font_scales.get(font_id.value());
+        if (existing_scale.has_value() && *existing_scale != scale)
+            can_replay_concurrently = false;
+        font_scales.set(font_id.value(), scale);
+    };
+
+    auto uses_pattern = [](PathPaintKind paint_kind, DisplayListPaintStyle const& paint_style) {
+        return paint_kind == PathPaintKind::PaintStyle && paint_style.paint_style_type == DisplayListPaintStyleType::Pattern;
+    };
+
+    display_list.for_each_command_header([&](DisplayListCommandHeader const& header, ReadonlyBytes payload) {
+        if (!can_replay_concurrently)
+            return;
+
+        switch (header.command_type) {
+        case DisplayListCommandType::DrawCompositedContext:
+        case DisplayListCommandType::DrawCanvas:
+        case DisplayListCommandType::DrawVideoFrame:
+        case DisplayListCommandType::DrawRepeatedDisplayList:
+        case DisplayListCommandType::PaintNestedDisplayList:
+        // Backdrop filters read back pixels that may belong to a neighbouring tile.
+        case DisplayListCommandType::ApplyBackdropFilter:
+            can_replay_concurrently = false;
+            break;
+        case DisplayListCommandType::DrawGlyphRun: {
+            auto command = read_display_list_command_payload<DrawGlyphRun>(payload);
+            use_font(command.font_id, command.scale);
+            break;
+        }
+        case DisplayListCommandType::PaintTextShadow: {
+            auto command = read_display_list_command_payload<PaintTextShadow>(payload);
+            use_font(command.font_id, command.scale);
+            break;
+        }
+        case DisplayListCommandType::DrawScaledDecodedImageFrame:
+            image_frames.append(read_display_list_command_payload<DrawScaledDecodedImageFrame>(payload).frame_id);
+            break;
+        case DisplayListCommandType::DrawRepeatedDecodedImageFrame:
+            image_frames.append(read_display_list_command_payload<DrawRepeatedDecodedImageFrame>(payload).frame_id);
+            break;
+        case DisplayListCommandType::DrawTiledDecodedImageFrame:
+            image_frames.append(read_display_list_command_payload<DrawTiledDecodedImageFrame>(payload).frame_id);
+            break;
+        case DisplayListCommandType::FillPath: {
+            auto command = read_display_list_command_payload<FillPath>(payload);
+            if (uses_pattern(command.paint_kind, command.paint_style))
+                can_replay_concurrently = false;
+            break;
+        }
+        case DisplayListCommandType::StrokePath: {
+            auto command = read_display_list_command_payload<StrokePath>(payload);
+            if (uses_pattern(command.paint_kind, command.paint_style))
+                can_replay_concurrently = false;
+            break;
+        }
+        default:
+            break;
+        }
+    });
+
+    if (!can_replay_concurrently)
+        return false;
+
+    for (auto const& [font_id, scale] : font_scales)
+        (void)resource_storage.font(FontResourceId { font_id }).skia_font(scale);
+    for (auto frame_id : image_frames)
+        (void)resource_storage.skia_image_for_image_frame(frame_id, nullptr);
+    return true;
+}
+
+bool DisplayListPlayerSkia::execute_tiled(
+    DisplayList const& display_list,
+    AccumulatedVisualContextTree const& visual_context_tree,
+    DisplayListResourceStorage const& resource_storage,
+    ScrollStateSnapshot const& scroll_state_snapshot,
+    Gfx::PaintingSurface& surface,
+    Gfx::IntRect rect,
+    Gfx::Color clear_color,
+    RasterTilePool& tile_pool)
+{
+    if (surface.skia_backend_context())
+        return false;
+
+    rect.intersect({ {}, surface.size() });
+    if (rect.width() * rect.height() < MIN_AREA_FOR_TILED_RASTER)
+        return false;
+
+    if (!prepare_display_list_for_concurrent_replay(display_list, resource_storage))
+        return false;
+
+    // Tiles cover cells of a fixed grid rather than being aligned to the rect, so that every tile has the pool's size
+    // and a cell is split the same way in every frame. Only the part of a cell inside the rect is painted and copied.
+    struct Tile {
+        Gfx::IntPoint origin;
+        Gfx::IntRect paint_rect;
+        NonnullRefPtr<Gfx::PaintingSurface> surface;
+    };
+    Vector<Tile> tiles;
+    auto first_column = rect.left() / RasterTilePool::tile_size;
+    auto last_column = (rect.right() - 1) / RasterTilePool::tile_size;
+    auto first_row = rect.top() / RasterTilePool::tile_size;
+    auto last_row = (rect.bottom() - 1) / RasterTilePool::tile_size;
+    for (auto row = first_row; row <= last_row; ++row) {
+        for (auto column = first_column; column <= last_column; ++column) {
+            Gfx::IntRect cell_rect { column * RasterTilePool::tile_size, row * RasterTilePool::tile_size, RasterTilePool::tile_size, RasterTilePool::tile_size };
+            tiles.append({ cell_rect.location(), cell_rect.intersected(rect), tile_pool.take() });
+        }
+    }
+
+    Sync::Mutex mutex;
+    Sync::ConditionVariable all_tiles_painted { mutex };
+    size_t remaining_tile_count = tiles.size();
+
+    for (auto& tile : tiles) {
+        Threading::ThreadPool::the().submit([&] {
+            auto& canvas = tile.surface->canvas();
+            canvas.save();
+            canvas.translate(-tile.origin.x(), -tile.origin.y());
+            canvas.clipIRect(SkIRect::MakeXYWH(tile.paint_rect.x(), tile.paint_rect.y(), tile.paint_rect.width(), tile.paint_rect.height()));
+            canvas.clear(to_skia_color(clear_color));
+
+            // Commands outside of the tile are culled by the player's clip check, so each tile only pays for the
+            // commands that intersect it.
+            DisplayListPlayerSkia player { nullptr };
+            player.execute(display_list, visual_context_tree, resource_storage, scroll_state_snapshot, tile.surface, nullptr, nullptr);
+            canvas.restore();
+
+            Sync::MutexLocker locker(mutex);
+            if (--remaining_tile_count == 0)
+                all_tiles_painted.signal();
+        },
+            Threading::ThreadPool::Priority::UserBlocking);
+    }
+
+    {
+        Sync::MutexLocker locker(mutex);
+        while (remaining_tile_count > 0)
+            all_tiles_painted.wait();
+    }
+
+    SkPaint paint;
+    paint.setBlendMode(SkBlendMode::kSrc);
+    auto& canvas = surface.canvas();
+    for (auto& tile : tiles) {
+        auto image = tile.surface->sk_image_snapshot<sk_sp<SkImage>>();
+        auto source_rect = tile.paint_rect.translated(-tile.origin.x(), -tile.origin.y());
+        canvas.drawImageRect(image.get(), to_skia_rect(source_rect), to_skia_rect(tile.paint_rect), SkSamplingOptions {}, &paint, SkCanvas::kStrict_SrcRectConstraint);
+        tile_pool.give_back(tile.surface);
+    }
+    return true;
+}
+
 static SkRRect to_skia_rrect(auto const& rect, Gfx::CornerRadii const& corner_radii)
 {
     SkRRect rrect;
@@ -18,6 +18,35 @@ class SkPaint;
 
 namespace Web::Painting {
 
+// Surfaces that tiled rasterization paints into, kept alive between frames so that tiles are not reallocated for
+// every frame. Tiles always cover a cell of a fixed grid in surface coordinates, so every tile has the same size.
+class WEB_API RasterTilePool {
+public:
+    static constexpr int tile_size = 256;
+
+    // How many painted frames pass between trims of the pool.
+    static constexpr size_t frames_per_trim = 120;
+
+    NonnullRefPtr<Gfx::PaintingSurface> take();
+    void give_back(NonnullRefPtr<Gfx::PaintingSurface>);
+
+    // Called for every frame that is painted, tiled or not. Every frames_per_trim frames, the tiles beyond the most
+    // that were in use at once since the previous trim are freed, so a pool that grew for one large repaint does not
+    // keep those tiles for as long as the page is open.
+    void did_paint_frame();
+
+    // Frees every tile that is not in use, e.g. once the tiles' owner stops presenting.
+    void release_available_tiles();
+
+    size_t allocated_tile_count() const { return m_allocated_tile_count; }
+
+private:
+    Vector<NonnullRefPtr<Gfx::PaintingSurface>> m_available_tiles;
+    size_t m_allocated_tile_count { 0 };
+    size_t m_peak_tiles_in_use_since_trim { 0 };
+    size_t m_frames_since_trim { 0 };
+};
+
 class WEB_API DisplayListPlayerSkia final : public DisplayListPlayer {
 public:
     using CompositedContextResolver = Function<RefPtr<Gfx::PaintingSurface>(Web::Compositor::CompositorContextId)>;
@@ -36,6 +65,20 @@ public:
         CanvasSurfaceRegistry const*,
         CompositedContextResolver const*);
 
+    // Replays the display list into `rect` of a CPU surface by splitting it along the tile pool's grid into tiles that
+    // are rasterized in parallel, each cleared to `clear_color`. Returns false without painting anything if the
+    // surface is GPU-backed, the rect is too small to be worth splitting, or the list uses resources that can't be
+    // shared between threads (canvases, videos, composited contexts and nested display lists).
+    static bool execute_tiled(
+        DisplayList const&,
+        AccumulatedVisualContextTree const&,
+        DisplayListResourceStorage const&,
+        ScrollStateSnapshot const&,
+        Gfx::PaintingSurface&,
+        Gfx::IntRect rect,
+        Gfx::Color clear_color,
+        RasterTilePool&);
+
     void flush(Gfx::PaintingSurface&) override;
     void flush_async(Gfx::PaintingSurface&, Function<void()>&&);
     void paint_scrollbar(Gfx::PaintingSurface&, PaintScrollBar const&);
@@ -5,6 +5,8 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <LibURL/Site.h>
+#include <LibWeb/Fetch/Infrastructure/NetworkPartitionKey.h>
 #include <LibWeb/Platform/ImageCodecPlugin.h>
 
 namespace Web::Platform {
@@ -30,4 +32,14 @@ void ImageCodecPlugin::install(ImageCodecPlugin& plugin)
     s_the = &plugin;
 }
 
+Optional<String> ImageCodecPlugin::cache_partition_for(HTML::Environment const& environment)
+{
+    auto top_level_origin = Fetch::Infrastructure::determine_the_network_partition_key(environment).top_level_origin;
+
+    // Every opaque site serializes to "null", so we can't tell them apart by their serialization.
+    if (top_level_origin.is_opaque())
+        return {};
+    return URL::Site::obtain(top_level_origin).serialize();
+}
+
 }
@@ -12,7 +12,9 @@
 #include <LibCore/Promise.h>
 #include <LibGfx/ColorSpace.h>
 #include <LibGfx/Forward.h>
+#include <LibGfx/Size.h>
 #include <LibWeb/Export.h>
+#include <LibWeb/Forward.h>
 
 namespace Web::Platform {
 
@@ -23,6 +25,7 @@ struct Frame {
 
 struct DecodedImage {
     bool is_animated { false };
+    Gfx::IntSize natural_size;
     u32 loop_count { 0 };
     u32 frame_count { 0 };
     Vector<Frame> frames;
@@ -31,6 +34,12 @@ struct DecodedImage {
     i64 session_id { 0 };
 };
 
+struct PartiallyDecodedImage {
+    NonnullRefPtr<Gfx::Bitmap> bitmap;
+    Gfx::IntSize natural_size;
+    Gfx::ColorSpace color_space;
+};
+
 class WEB_API ImageCodecPlugin {
 public:
     static ImageCodecPlugin& the();
@@ -39,7 +48,27 @@ public:
 
     virtual ~ImageCodecPlugin();
 
-    virtual NonnullRefPtr<Core::Promise<DecodedImage>> decode_image(ReadonlyBytes, ESCAPING Function<ErrorOr<void>(DecodedImage&)> on_resolved, ESCAPING Function<void(Error&)> on_rejected) = 0;
+    // Images decoded for documents with the same top-level site may share one decoded copy, even across tabs and
+    // processes. Returns nothing for opaque top-level origins, as their images must not be shared with anyone.
+    static Optional<String> cache_partition_for(HTML::Environment const&);
+
+    // Images decoded with the same cache partition may be served from one decoded copy. Without a partition, the image
+    // is decoded on its own. An ideal_size works like it does for begin_incremental_decode().
+    virtual NonnullRefPtr<Core::Promise<DecodedImage>> decode_image(ReadonlyBytes, ESCAPING Function<ErrorOr<void>(DecodedImage&)> on_resolved, ESCAPING Function<void(Error&)> on_rejected, Optional<Gfx::IntSize> ideal_size, Optional<String> cache_partition) = 0;
+
+    // Decodes the first frame of an image at its natural size, and blocks until it is done. Only for callers that need
+    // the real pixels of an image right away, while its frames were decoded at a lower resolution.
+    virtual ErrorOr<DecodedImage> decode_image_at_natural_size(ReadonlyBytes, Optional<String> cache_partition) = 0;
+
+    // Decodes an image whose encoded data arrives in chunks, e.g. from the network. Whatever the data appended so far
+    // yields is passed to on_partially_decoded, until the complete image settles like with decode_image().
+    //
+    // If ideal_size is given, the image is only ever drawn at up to that size in device pixels, so its frames may be
+    // decoded at a lower resolution. The decoded image still reports the image's natural size.
+    virtual i64 begin_incremental_decode(ESCAPING Function<void(PartiallyDecodedImage&)> on_partially_decoded, ESCAPING Function<ErrorOr<void>(DecodedImage&)> on_resolved, ESCAPING Function<void(Error&)> on_rejected, Optional<Gfx::IntSize> ideal_size, Optional<String> cache_partition) = 0;
+    virtual void append_incremental_decode_data(i64 request_id, ReadonlyBytes) = 0;
+    virtual void finish_incremental_decode(i64 request_id) = 0;
+    virtual void cancel_incremental_decode(i64 request_id) = 0;
 
     virtual void request_animation_frames(i64 session_id, u32 start_frame_index, u32 count) = 0;
     virtual void stop_animation_decode(i64 session_id) = 0;
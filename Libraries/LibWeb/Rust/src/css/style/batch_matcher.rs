@@ -725,6 +725,20 @@ pub struct BatchMatcher<'a> {
     witnesses: Option<&'a std::cell::RefCell<RelationalWitnesses>>,
 }
 
+/// How the node being asked stands to the tree whose rules are asked of it. Deciding it reads the
+/// engine's slot and part bookkeeping, so it is decided before a matcher is built, and the matcher
+/// itself needs nothing beyond what it is lent.
+#[derive(Clone, Copy, Debug, PartialEq, Eq)]
+pub(super) enum ScopePlacement {
+    /// The node is in the tree. Only here do the ancestor requirements apply.
+    Inside,
+    SlottedIn,
+    PartExposedHere,
+    HostOfThisTree,
+    /// The node is outside the tree and none of the above reaches it.
+    Outside,
+}
+
 /// Reusable output-side state for one exact matching attempt.
 pub(super) struct BatchMatchState<'a> {
     pub dispatch_workspace: &'a mut DispatchCandidateWorkspace,
@@ -998,6 +1012,22 @@ impl<'a> BatchMatcher<'a> {
         self
     }
 
+    /// Place the node being asked the way `placement` says it stands to this tree.
+    #[must_use]
+    pub(super) fn placed(
+        self,
+        placement: ScopePlacement,
+        ancestor_requirements: Option<&'a AncestorRequirements>,
+    ) -> Self {
+        match (placement, ancestor_requirements) {
+            (ScopePlacement::Inside, Some(requirements)) => self.with_ancestor_requirements(requirements),
+            (ScopePlacement::Inside | ScopePlacement::Outside, _) => self,
+            (ScopePlacement::SlottedIn, _) => self.for_a_node_slotted_in(),
+            (ScopePlacement::PartExposedHere, _) => self.for_a_part_exposed_here(),
+            (ScopePlacement::HostOfThisTree, _) => self.for_the_host_of_this_tree(),
+        }
+    }
+
     #[must_use]
     pub(super) fn with_ancestor_requirements(mut self, requirements: &'a AncestorRequirements) -> Self {
         self.ancestor_requirements = Some(requirements);
@@ -34,7 +34,7 @@ use super::fast_hash::FastMap as HashMap;
 use super::fast_hash::FastSet as HashSet;
 use std::cell::Cell;
 use std::cmp::Reverse;
-use std::rc::Rc;
+use std::sync::Arc;
 
 use super::memory::MemoryCategory;
 use super::memory::MemoryController;
@@ -415,7 +415,7 @@ fn next_batch_generation() -> u64 {
 /// inside the evaluator.
 #[derive(Clone, Default)]
 pub struct StyleNodeFacts {
-    attribute_catalogs: Rc<AttributeCatalogs>,
+    attribute_catalogs: Arc<AttributeCatalogs>,
     primary: bool,
     resident: BitColumn,
     rare_facts: PagedColumn<RareFactPage>,
@@ -473,7 +473,7 @@ pub struct StyleNodeFacts {
 }
 
 pub(super) struct MatchingFactBatch {
-    facts: Rc<StyleNodeFacts>,
+    facts: Arc<StyleNodeFacts>,
     charged_bytes: u64,
 }
 
@@ -481,12 +481,12 @@ impl MatchingFactBatch {
     fn owned(facts: StyleNodeFacts) -> Self {
         let charged_bytes = facts.capacity_bytes();
         Self {
-            facts: Rc::new(facts),
+            facts: Arc::new(facts),
             charged_bytes,
         }
     }
 
-    fn primary_view(facts: Rc<StyleNodeFacts>) -> Self {
+    fn primary_view(facts: Arc<StyleNodeFacts>) -> Self {
         Self {
             facts,
             charged_bytes: 0,
@@ -1216,7 +1216,7 @@ impl StyleNodeFacts {
 
     #[cfg(test)]
     pub fn note_attribute_name_forms(&mut self, name: StyleAtomID, forms: AttributeNameForms) {
-        Rc::make_mut(&mut self.attribute_catalogs)
+        Arc::make_mut(&mut self.attribute_catalogs)
             .name_forms
             .insert(name.0 as usize, forms);
     }
@@ -2311,7 +2311,7 @@ struct RuleDispatchTopology {
     non_prefix_universal_without_parent_filter: Vec<DispatchRow>,
     non_prefix_universal_with_parent_filter: Vec<DispatchRow>,
     finalized: bool,
-    ancestors: Rc<AncestorDispatchTopology>,
+    ancestors: Arc<AncestorDispatchTopology>,
     prefixes: PrefixAutomaton,
     residency: MemoryLease,
 }
@@ -2330,7 +2330,7 @@ impl Default for RuleDispatchTopology {
             non_prefix_universal_without_parent_filter: Vec::new(),
             non_prefix_universal_with_parent_filter: Vec::new(),
             finalized: false,
-            ancestors: Rc::new(AncestorDispatchTopology::default()),
+            ancestors: Arc::new(AncestorDispatchTopology::default()),
             prefixes: PrefixAutomaton::default(),
             residency: MemoryLease::new(MemoryCategory::RuleProgram),
         }
@@ -2341,7 +2341,7 @@ impl Default for RuleDispatchTopology {
 pub(super) struct AncestorDispatchTopologyID(*const AncestorDispatchTopology);
 
 pub struct RuleDispatch {
-    entries: Rc<RuleDispatchEntries>,
+    entries: Arc<RuleDispatchEntries>,
     entry_bindings: Vec<DispatchEntryBinding>,
     entry_rows: Vec<Vec<DispatchRow>>,
     /// Direct cascade-order projection for every rule represented in this dispatch. Rule
@@ -2352,21 +2352,21 @@ pub struct RuleDispatch {
     cascade_orders_by_rule_entry: Vec<u32>,
     cascade_properties: Vec<u16>,
     cascade_entries: Vec<CascadeEntryData>,
-    topology: Rc<RuleDispatchTopology>,
+    topology: Arc<RuleDispatchTopology>,
     residency: MemoryLease,
 }
 
 impl Default for RuleDispatch {
     fn default() -> Self {
         Self {
-            entries: Rc::new(RuleDispatchEntries::default()),
+            entries: Arc::new(RuleDispatchEntries::default()),
             entry_bindings: Vec::new(),
             entry_rows: Vec::new(),
             cascade_order_rule_pages: Vec::new(),
             cascade_orders_by_rule_entry: Vec::new(),
             cascade_properties: Vec::new(),
             cascade_entries: Vec::new(),
-            topology: Rc::new(RuleDispatchTopology::default()),
+            topology: Arc::new(RuleDispatchTopology::default()),
             residency: MemoryLease::new(MemoryCategory::RuleProgram),
         }
     }
@@ -2398,11 +2398,11 @@ impl RuleDispatch {
     }
 
     fn topology_mut(&mut self) -> &mut RuleDispatchTopology {
-        Rc::get_mut(&mut self.topology).expect("a shared selector topology is immutable")
+        Arc::get_mut(&mut self.topology).expect("a shared selector topology is immutable")
     }
 
     fn entries_mut(&mut self) -> &mut Vec<DispatchEntryMetadata> {
-        &mut Rc::make_mut(&mut self.entries).rows
+        &mut Arc::make_mut(&mut self.entries).rows
     }
 
     fn entry(&self, row: DispatchRow) -> DispatchEntry {
@@ -2432,7 +2432,7 @@ impl RuleDispatch {
     pub(super) fn rebind_rules(template: &Self, rules: &[RuleID]) -> Self {
         assert_eq!(template.entries.rows.len(), rules.len());
         Self {
-            entries: Rc::clone(&template.entries),
+            entries: Arc::clone(&template.entries),
             entry_bindings: rules
                 .iter()
                 .copied()
@@ -2446,7 +2446,7 @@ impl RuleDispatch {
             cascade_orders_by_rule_entry: Vec::new(),
             cascade_properties: Vec::new(),
             cascade_entries: Vec::new(),
-            topology: Rc::clone(&template.topology),
+            topology: Arc::clone(&template.topology),
             residency: MemoryLease::new(MemoryCategory::RuleProgram),
         }
     }
@@ -2454,7 +2454,7 @@ impl RuleDispatch {
     pub(super) fn rebind_rules_for_extension(template: &Self, rules: &[RuleID]) -> Self {
         let mut dispatch = Self::rebind_rules(template, rules);
         let topology = &template.topology;
-        dispatch.topology = Rc::new(RuleDispatchTopology {
+        dispatch.topology = Arc::new(RuleDispatchTopology {
             buckets: match topology.finalized {
                 true => topology.bucket_directory.to_buckets(),
                 false => topology.buckets.clone(),
@@ -2472,7 +2472,7 @@ impl RuleDispatch {
             non_prefix_universal_without_parent_filter: Vec::new(),
             non_prefix_universal_with_parent_filter: Vec::new(),
             finalized: false,
-            ancestors: Rc::new((*topology.ancestors).clone()),
+            ancestors: Arc::new((*topology.ancestors).clone()),
             prefixes: topology.prefixes.clone(),
             residency: MemoryLease::new(MemoryCategory::RuleProgram),
         });
@@ -2482,20 +2482,20 @@ impl RuleDispatch {
 
     #[cfg(test)]
     pub(super) fn shares_topology_with(&self, other: &Self) -> bool {
-        Rc::ptr_eq(&self.topology, &other.topology)
+        Arc::ptr_eq(&self.topology, &other.topology)
     }
 
     #[cfg(test)]
     pub(super) fn shares_entries_with(&self, other: &Self) -> bool {
-        Rc::ptr_eq(&self.entries, &other.entries)
+        Arc::ptr_eq(&self.entries, &other.entries)
     }
 
     pub(super) fn shares_ancestor_topology_with(&self, other: &Self) -> bool {
-        Rc::ptr_eq(&self.topology.ancestors, &other.topology.ancestors)
+        Arc::ptr_eq(&self.topology.ancestors, &other.topology.ancestors)
     }
 
     pub(super) fn ancestor_topology_id(&self) -> AncestorDispatchTopologyID {
-        AncestorDispatchTopologyID(Rc::as_ptr(&self.topology.ancestors))
+        AncestorDispatchTopologyID(Arc::as_ptr(&self.topology.ancestors))
     }
 
     pub(super) fn ancestor_dispatch_shape(&self) -> AncestorDispatchShape {
@@ -2518,7 +2518,7 @@ impl RuleDispatch {
             self.topology.ancestors.key_indices,
             template.topology.ancestors.key_indices
         );
-        self.topology_mut().ancestors = Rc::clone(&template.topology.ancestors);
+        self.topology_mut().ancestors = Arc::clone(&template.topology.ancestors);
     }
 
     pub(super) fn insert(&mut self, key: DispatchKey, mut entry: DispatchEntry) -> DispatchRow {
@@ -2528,7 +2528,7 @@ impl RuleDispatch {
         );
         entry.required_ancestor_index = entry.required_ancestor.map(|required| {
             let topology = self.topology_mut();
-            let ancestors = Rc::get_mut(&mut topology.ancestors).expect("a shared ancestor topology is immutable");
+            let ancestors = Arc::get_mut(&mut topology.ancestors).expect("a shared ancestor topology is immutable");
             let next = u32::try_from(ancestors.key_indices.len()).expect("ancestor requirement space exhausted");
             *ancestors.key_indices.entry(required).or_insert(next)
         });
@@ -3084,16 +3084,16 @@ impl RuleDispatch {
 
     pub(super) fn settle_memory(&mut self, memory: &mut MemoryController) {
         self.residency.resize_required_to(memory, self.scope_capacity_bytes());
-        if let Some(entries) = Rc::get_mut(&mut self.entries) {
+        if let Some(entries) = Arc::get_mut(&mut self.entries) {
             entries.residency.resize_required_to(memory, entries.capacity_bytes());
         }
-        let Some(topology) = Rc::get_mut(&mut self.topology) else {
+        let Some(topology) = Arc::get_mut(&mut self.topology) else {
             return;
         };
         topology
             .residency
             .resize_required_to(memory, Self::topology_capacity_bytes(topology));
-        let Some(ancestors) = Rc::get_mut(&mut topology.ancestors) else {
+        let Some(ancestors) = Arc::get_mut(&mut topology.ancestors) else {
             return;
         };
         ancestors
@@ -3244,10 +3244,10 @@ impl super::intern_table::InternIdentity for CustomPropertyNameSetID {
 pub struct ElementFactStore {
     /// Required primary arrangement. Element identity selects its fixed column slots directly;
     /// variable facts are append-only payloads reached through the slots' handles.
-    rows: Rc<StyleNodeFacts>,
+    rows: Arc<StyleNodeFacts>,
     /// Shared dictionaries used by primary rows and materialized batches. Keep this handle outside
     /// `rows` so publishing a catalog entry never copies every primary fact column.
-    attribute_catalogs: Rc<AttributeCatalogs>,
+    attribute_catalogs: Arc<AttributeCatalogs>,
     #[cfg(test)]
     attribute_catalog_copies: u64,
     staging: FactStaging,
@@ -3634,11 +3634,11 @@ impl ElementFactMetadata {
 
 impl Default for ElementFactStore {
     fn default() -> Self {
-        let attribute_catalogs = Rc::new(AttributeCatalogs::default());
+        let attribute_catalogs = Arc::new(AttributeCatalogs::default());
         let mut rows = StyleNodeFacts::new_primary();
-        rows.attribute_catalogs = Rc::clone(&attribute_catalogs);
+        rows.attribute_catalogs = Arc::clone(&attribute_catalogs);
         let mut store = Self {
-            rows: Rc::new(rows),
+            rows: Arc::new(rows),
             attribute_catalogs,
             #[cfg(test)]
             attribute_catalog_copies: 0,
@@ -3675,10 +3675,10 @@ impl ElementFactStore {
 
     fn attribute_catalogs_mut(&mut self) -> &mut AttributeCatalogs {
         #[cfg(test)]
-        if Rc::strong_count(&self.attribute_catalogs) != 1 {
+        if Arc::strong_count(&self.attribute_catalogs) != 1 {
             self.attribute_catalog_copies += 1;
         }
-        Rc::make_mut(&mut self.attribute_catalogs)
+        Arc::make_mut(&mut self.attribute_catalogs)
     }
 
     #[cfg(test)]
@@ -3691,11 +3691,12 @@ impl ElementFactStore {
     }
 
     fn sync_attribute_catalogs(&mut self) {
-        if Rc::ptr_eq(&self.rows.attribute_catalogs, &self.attribute_catalogs) {
+        if Arc::ptr_eq(&self.rows.attribute_catalogs, &self.attribute_catalogs) {
             return;
         }
-        let rows = Rc::get_mut(&mut self.rows).expect("attribute catalog synchronization requires unique primary rows");
-        rows.attribute_catalogs = Rc::clone(&self.attribute_catalogs);
+        let rows =
+            Arc::get_mut(&mut self.rows).expect("attribute catalog synchronization requires unique primary rows");
+        rows.attribute_catalogs = Arc::clone(&self.attribute_catalogs);
     }
 
     fn increment_atom_count(counts: &mut PagedCopyColumn<u32>, atom: StyleAtomID) {
@@ -3976,7 +3977,7 @@ impl ElementFactStore {
             "cannot evaluate facts while fact staging is unapplied"
         );
         self.sync_attribute_catalogs();
-        MatchingFactBatch::primary_view(Rc::clone(&self.rows))
+        MatchingFactBatch::primary_view(Arc::clone(&self.rows))
     }
 
     #[must_use]
@@ -4671,7 +4672,7 @@ impl ElementFactStore {
         let payload_bytes = self.rows.payload_bytes_of_row(row);
         let facts = self.snapshot_row(node);
         self.remove_row_catalog_references(&facts);
-        Rc::get_mut(&mut self.rows)
+        Arc::get_mut(&mut self.rows)
             .expect("forgetting a fact row requires unique primary rows")
             .forget_row(node);
         self.primary_live_bytes = self
@@ -4747,17 +4748,17 @@ impl ElementFactStore {
     /// Whether a borrowed primary view (an active or prepared traversal) shares the fact rows.
     #[cfg(test)]
     pub(super) fn primary_rows_are_shared(&self) -> bool {
-        Rc::strong_count(&self.rows) != 1
+        Arc::strong_count(&self.rows) != 1
     }
 
     pub(super) fn sweep_auxiliary_catalogs_without_sync(&mut self) {
         assert_eq!(
-            Rc::strong_count(&self.rows),
+            Arc::strong_count(&self.rows),
             1,
             "auxiliary catalog sweeping requires unique primary rows"
         );
         self.memory_dirty = true;
-        let attribute_catalogs = Rc::make_mut(&mut self.attribute_catalogs);
+        let attribute_catalogs = Arc::make_mut(&mut self.attribute_catalogs);
         // Language spellings and attribute-name forms are retained until their atom is reclaimed;
         // forget_atoms clears them at that authoritative boundary so a reused identity can publish
         // different text. Attribute values can be dropped earlier when their last fact leaves.
@@ -4803,7 +4804,7 @@ impl ElementFactStore {
         }
         self.memory_dirty = true;
         let atoms = atoms.iter().copied().collect::<HashSet<_>>();
-        let catalogs = Rc::make_mut(&mut self.attribute_catalogs);
+        let catalogs = Arc::make_mut(&mut self.attribute_catalogs);
         for atom in &atoms {
             let index = atom.0 as usize;
             if catalogs.name_forms.get(index).is_some() {
@@ -4848,7 +4849,7 @@ impl ElementFactStore {
     pub fn materialize(&mut self, nodes: impl Iterator<Item = StyleNodeID>, batch: &mut StyleNodeFacts) {
         self.sync_attribute_catalogs();
         batch.clear();
-        batch.attribute_catalogs = Rc::clone(&self.attribute_catalogs);
+        batch.attribute_catalogs = Arc::clone(&self.attribute_catalogs);
         for node in nodes {
             self.materialize_row(node, batch);
         }
@@ -4861,7 +4862,7 @@ impl ElementFactStore {
     /// ask.
     pub fn materialize_missing(&mut self, nodes: impl Iterator<Item = StyleNodeID>, batch: &mut StyleNodeFacts) {
         self.sync_attribute_catalogs();
-        batch.attribute_catalogs = Rc::clone(&self.attribute_catalogs);
+        batch.attribute_catalogs = Arc::clone(&self.attribute_catalogs);
         for node in nodes {
             if batch.row_of(node).is_some() {
                 continue;
@@ -4997,7 +4998,7 @@ impl ElementFactStore {
             // A selector-free transaction may retain the active traversal's immutable primary
             // view. Preserve that view while advancing the authoritative rows for the next
             // transaction.
-            let stale_payload_bytes = Rc::make_mut(&mut self.rows).set_primary_row(node, &facts);
+            let stale_payload_bytes = Arc::make_mut(&mut self.rows).set_primary_row(node, &facts);
             let row = self.rows.row_of(node).unwrap();
             let replacement_bytes = self.rows.logical_bytes_of_row(row);
             let replacement_payload_bytes = self.rows.payload_bytes_of_row(row);
@@ -5042,7 +5043,7 @@ impl ElementFactStore {
         }
         nodes.sort_unstable();
         let mut before = StyleNodeFacts::new();
-        before.attribute_catalogs = Rc::clone(&self.attribute_catalogs);
+        before.attribute_catalogs = Arc::clone(&self.attribute_catalogs);
         for node in nodes {
             let pair = self
                 .staging
@@ -5062,7 +5063,7 @@ impl ElementFactStore {
     pub fn release_staging(&mut self, memory: &mut MemoryController) {
         self.staging.clear();
         if self.primary_stale_payload_bytes > self.primary_live_payload_bytes {
-            Rc::get_mut(&mut self.rows)
+            Arc::get_mut(&mut self.rows)
                 .expect("compacting fact payloads requires unique primary rows")
                 .compact_primary_payloads();
             self.primary_stale_payload_bytes = 0;
@@ -6383,10 +6384,10 @@ mod tests {
         store.apply_staged(&mut memory);
         store.release_staging(&mut memory);
 
-        let primary_rows = Rc::as_ptr(&store.rows);
+        let primary_rows = Arc::as_ptr(&store.rows);
         let view = store.primary_view();
         store.note_attribute_name_forms(name, forms);
-        assert_eq!(Rc::as_ptr(&store.rows), primary_rows);
+        assert_eq!(Arc::as_ptr(&store.rows), primary_rows);
         assert_eq!(store.attribute_name_forms(name), forms);
         assert_eq!(
             view.attribute_name_forms(name),
@@ -6398,7 +6399,7 @@ mod tests {
 
         drop(view);
         store.apply_staged(&mut memory);
-        assert_eq!(Rc::as_ptr(&store.rows), primary_rows);
+        assert_eq!(Arc::as_ptr(&store.rows), primary_rows);
         assert_eq!(store.primary().attribute_name_forms(name), forms);
     }
 
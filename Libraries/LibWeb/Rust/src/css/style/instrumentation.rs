@@ -260,6 +260,13 @@ impl Counters {
         self.values[counter as usize] += amount;
     }
 
+    /// Fold in what another set counted, as when a worker thread's counters rejoin the engine's.
+    pub fn add_all(&mut self, other: &Counters) {
+        for (value, other) in self.values.iter_mut().zip(other.values) {
+            *value += other;
+        }
+    }
+
     pub fn set(&mut self, counter: Counter, value: u64) {
         self.values[counter as usize] = value;
     }
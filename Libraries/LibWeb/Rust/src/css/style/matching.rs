@@ -954,34 +954,17 @@ impl StyleEngine {
     ) -> Result<(), Incomplete> {
         let mut interpreter = BatchMatcher::new(&self.tree, facts, dispatch, &self.programs, &self.program)
             .in_scope(scope)
-            .observing_witnesses(&self.relational_witnesses);
+            .observing_witnesses(&self.relational_witnesses)
+            .placed(self.placement_in_scope(node, scope), ancestor_requirements);
         if attempt.cascade_only {
             interpreter = interpreter.for_cascade();
         }
-        if self.tree.tree_scope(node) == scope
-            && let Some(requirements) = ancestor_requirements
-        {
-            interpreter = interpreter.with_ancestor_requirements(requirements);
-        }
         if let Some(shadow_root) = self.scope_root(scope) {
             interpreter = interpreter.in_shadow_tree(shadow_root);
         }
         if let Some(match_workspace) = match_workspace {
             interpreter = interpreter.with_match_workspace(match_workspace);
         }
-        if self.tree.tree_scope(node) != scope {
-            if self.scopes_slotted_into(node).any(|slotted| slotted == scope) {
-                interpreter = interpreter.for_a_node_slotted_in();
-            } else if self.part_exposure_scopes(node).any(|exposed| exposed == scope) {
-                interpreter = interpreter.for_a_part_exposed_here();
-            } else if self
-                .tree
-                .shadow_root_of(node)
-                .is_some_and(|root| self.scope_root(scope) == Some(root))
-            {
-                interpreter = interpreter.for_the_host_of_this_tree();
-            }
-        }
         let cascade_rejections_before = self.counters.get(Counter::CascadeCandidatesRejectedByWinner);
         let result = interpreter.match_node_collecting_requests(
             node,
@@ -1004,6 +987,25 @@ impl StyleEngine {
         result
     }
 
+    /// How `node` stands to `scope` when that tree's rules are asked of it.
+    pub(super) fn placement_in_scope(&self, node: StyleNodeID, scope: TreeScopeID) -> ScopePlacement {
+        if self.tree.tree_scope(node) == scope {
+            ScopePlacement::Inside
+        } else if self.scopes_slotted_into(node).any(|slotted| slotted == scope) {
+            ScopePlacement::SlottedIn
+        } else if self.part_exposure_scopes(node).any(|exposed| exposed == scope) {
+            ScopePlacement::PartExposedHere
+        } else if self
+            .tree
+            .shadow_root_of(node)
+            .is_some_and(|root| self.scope_root(scope) == Some(root))
+        {
+            ScopePlacement::HostOfThisTree
+        } else {
+            ScopePlacement::Outside
+        }
+    }
+
     /// Keep the retained-witness charge in step with the table. Capacity is already committed
     /// at this boundary, so pressure keeps the table usable for this period and schedules the whole
     /// category for eviction at the next boundary.
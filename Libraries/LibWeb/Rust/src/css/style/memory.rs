@@ -24,8 +24,9 @@
 //! remains usable for the current quota period, closes later admission for that category, and is
 //! followed by whole-category eviction at a flush boundary.
 
-use std::cell::Cell;
-use std::rc::Rc;
+use std::sync::Arc;
+use std::sync::atomic::AtomicU64;
+use std::sync::atomic::Ordering;
 
 const KIB: u64 = 1024;
 const MIB: u64 = 1024 * KIB;
@@ -196,40 +197,46 @@ pub struct BudgetInputs {
     pub compact_style_program_bytes: u64,
 }
 
+// The ledger only ever changes on the engine's thread. It is atomic so that the structures whose
+// leases point at it can be lent to matching workers, which read them but never charge memory.
 struct ChargeLedger {
-    category_bytes: [Cell<u64>; MEMORY_CATEGORY_COUNT],
-    tier_bytes: [Cell<u64>; TIER_COUNT],
+    category_bytes: [AtomicU64; MEMORY_CATEGORY_COUNT],
+    tier_bytes: [AtomicU64; TIER_COUNT],
 }
 
 impl ChargeLedger {
     fn new() -> Self {
         Self {
-            category_bytes: std::array::from_fn(|_| Cell::new(0)),
-            tier_bytes: std::array::from_fn(|_| Cell::new(0)),
+            category_bytes: std::array::from_fn(|_| AtomicU64::new(0)),
+            tier_bytes: std::array::from_fn(|_| AtomicU64::new(0)),
         }
     }
 
+    fn category_bytes(&self, category: MemoryCategory) -> u64 {
+        self.category_bytes[category as usize].load(Ordering::Relaxed)
+    }
+
+    fn tier_bytes(&self, tier: Tier) -> u64 {
+        self.tier_bytes[tier.index()].load(Ordering::Relaxed)
+    }
+
     fn add(&self, category: MemoryCategory, bytes: u64, count_tier: bool) {
-        let category_bytes = &self.category_bytes[category as usize];
-        category_bytes.set(category_bytes.get() + bytes);
+        self.category_bytes[category as usize].fetch_add(bytes, Ordering::Relaxed);
         if count_tier {
-            let tier_bytes = &self.tier_bytes[category.tier().index()];
-            tier_bytes.set(tier_bytes.get() + bytes);
+            self.tier_bytes[category.tier().index()].fetch_add(bytes, Ordering::Relaxed);
         }
     }
 
     fn release(&self, category: MemoryCategory, bytes: u64, count_tier: bool) {
-        let category_bytes = &self.category_bytes[category as usize];
+        let category_bytes = self.category_bytes(category);
         assert!(
-            category_bytes.get() >= bytes,
-            "released {bytes} bytes of {} with only {} reserved",
+            category_bytes >= bytes,
+            "released {bytes} bytes of {} with only {category_bytes} reserved",
             category.name(),
-            category_bytes.get()
         );
-        category_bytes.set(category_bytes.get() - bytes);
+        self.category_bytes[category as usize].fetch_sub(bytes, Ordering::Relaxed);
         if count_tier {
-            let tier_bytes = &self.tier_bytes[category.tier().index()];
-            tier_bytes.set(tier_bytes.get() - bytes);
+            self.tier_bytes[category.tier().index()].fetch_sub(bytes, Ordering::Relaxed);
         }
     }
 }
@@ -241,7 +248,7 @@ impl ChargeLedger {
 /// its accounting lifetime.
 pub struct MemoryLease {
     category: MemoryCategory,
-    ledger: Option<Rc<ChargeLedger>>,
+    ledger: Option<Arc<ChargeLedger>>,
     bytes: u64,
 }
 
@@ -263,11 +270,11 @@ impl MemoryLease {
     fn bind(&mut self, memory: &MemoryController) {
         if let Some(ledger) = &self.ledger {
             assert!(
-                Rc::ptr_eq(ledger, &memory.charges),
+                Arc::ptr_eq(ledger, &memory.charges),
                 "memory lease moved between documents"
             );
         } else {
-            self.ledger = Some(Rc::clone(&memory.charges));
+            self.ledger = Some(Arc::clone(&memory.charges));
         }
     }
 
@@ -379,7 +386,7 @@ impl Drop for MemoryLease {
 #[must_use]
 pub struct ScratchCharge {
     category: MemoryCategory,
-    ledger: Rc<ChargeLedger>,
+    ledger: Arc<ChargeLedger>,
     bytes: u64,
 }
 
@@ -392,7 +399,7 @@ impl Drop for ScratchCharge {
 /// Per-document controller tracking exact bytes by category and tier.
 pub struct MemoryController {
     inputs: BudgetInputs,
-    charges: Rc<ChargeLedger>,
+    charges: Arc<ChargeLedger>,
     refusals: [u64; MEMORY_CATEGORY_COUNT],
     benefit_hits: [u64; MEMORY_CATEGORY_COUNT],
     benefit_observations: [u64; MEMORY_CATEGORY_COUNT],
@@ -413,7 +420,7 @@ impl MemoryController {
     pub fn new(_device_class: DeviceClass) -> Self {
         Self {
             inputs: BudgetInputs::default(),
-            charges: Rc::new(ChargeLedger::new()),
+            charges: Arc::new(ChargeLedger::new()),
             refusals: [0; MEMORY_CATEGORY_COUNT],
             benefit_hits: [0; MEMORY_CATEGORY_COUNT],
             benefit_observations: [0; MEMORY_CATEGORY_COUNT],
@@ -433,7 +440,7 @@ impl MemoryController {
     pub(crate) fn verification_copy(&self) -> Self {
         Self {
             inputs: self.inputs,
-            charges: Rc::new(ChargeLedger::new()),
+            charges: Arc::new(ChargeLedger::new()),
             refusals: [0; MEMORY_CATEGORY_COUNT],
             benefit_hits: [0; MEMORY_CATEGORY_COUNT],
             benefit_observations: [0; MEMORY_CATEGORY_COUNT],
@@ -472,7 +479,7 @@ impl MemoryController {
     pub(super) fn begin_tier3_quota_period(&mut self) {
         for (position, &category) in TIER3_REFUSAL_CATEGORIES.iter().enumerate() {
             let index = category as usize;
-            self.tier3_period_start_bytes[position] = self.charges.category_bytes[index].get();
+            self.tier3_period_start_bytes[position] = self.charges.category_bytes(category);
             self.tier3_admitting[index] = true;
         }
         self.tier3_quota_period_active = true;
@@ -502,7 +509,7 @@ impl MemoryController {
             let index = category as usize;
             let period_index = tier3_period_index(category);
             !self.tier3_admitting[index]
-                && self.charges.category_bytes[index].get() > self.tier3_period_start_bytes[period_index]
+                && self.charges.category_bytes(category) > self.tier3_period_start_bytes[period_index]
         });
         if !growth_crossed_limit {
             return selected;
@@ -529,10 +536,10 @@ impl MemoryController {
         let mut selected_bytes = 0_u64;
         for category in candidates {
             let index = category as usize;
-            if !category.is_boundary_evictable() || self.charges.category_bytes[index].get() == 0 {
+            if !category.is_boundary_evictable() || self.charges.category_bytes(category) == 0 {
                 continue;
             }
-            selected_bytes = selected_bytes.saturating_add(self.charges.category_bytes[index].get());
+            selected_bytes = selected_bytes.saturating_add(self.charges.category_bytes(category));
             candidate_selection[index] = true;
             if selected_bytes >= overage {
                 break;
@@ -569,7 +576,7 @@ impl MemoryController {
             return;
         }
         let category_grew = !self.tier3_quota_period_active
-            || self.charges.category_bytes[index].get() > self.tier3_period_start_bytes[tier3_period_index(category)];
+            || self.charges.category_bytes(category) > self.tier3_period_start_bytes[tier3_period_index(category)];
         if !category_grew {
             self.last_refused_bytes[index] = 0;
             return;
@@ -725,7 +732,7 @@ impl MemoryController {
         self.reserve_required(category, bytes);
         ScratchCharge {
             category,
-            ledger: Rc::clone(&self.charges),
+            ledger: Arc::clone(&self.charges),
             bytes,
         }
     }
@@ -738,12 +745,12 @@ impl MemoryController {
 
     #[must_use]
     pub fn bytes_in_category(&self, category: MemoryCategory) -> u64 {
-        self.charges.category_bytes[category as usize].get()
+        self.charges.category_bytes(category)
     }
 
     #[must_use]
     pub fn bytes_in_tier(&self, tier: Tier) -> u64 {
-        self.charges.tier_bytes[tier.index()].get()
+        self.charges.tier_bytes(tier)
     }
 
     /// Admission closures recorded when category growth crosses the Tier-3 limit.
@@ -178,6 +178,7 @@ use batch_matcher::BatchMatcher;
 use batch_matcher::CountRuleMatchEmission;
 use batch_matcher::RuleMatch;
 use batch_matcher::RuleMatches;
+use batch_matcher::ScopePlacement;
 use batch_matcher::append_prefix_matches;
 use batch_matcher::append_retained_matches;
 use batch_matcher::build_scope_dispatch;
@@ -7,6 +7,19 @@
 use super::cascade::Top1Winner;
 use super::*;
 
+/// The fewest nodes of one scope worth handing a worker thread. Below this, spawning costs more
+/// than matching the nodes does.
+const MIN_NODES_PER_MATCH_WORKER: usize = 256;
+
+/// What every worker matching one scope's nodes shares.
+#[derive(Clone, Copy)]
+struct ParallelScopeMatch<'a> {
+    dispatch: &'a RuleDispatch,
+    facts: &'a StyleNodeFacts,
+    ancestor_requirements: &'a AncestorRequirements,
+    run_count: usize,
+}
+
 #[derive(Clone, Copy)]
 enum CascadeCompactionCandidate {
     Rule(usize),
@@ -920,6 +933,19 @@ impl StyleEngine {
     /// reports how many concrete rule matches it found, or the node whose facts were missing - never
     /// a partial answer.
     pub fn match_document(&mut self, root: StyleNodeID) -> Result<usize, Incomplete> {
+        let workers = std::thread::available_parallelism().map_or(1, std::num::NonZeroUsize::get);
+        self.match_document_on(root, workers)
+    }
+
+    /// [`Self::match_document`], splitting each scope's nodes across at most `workers` threads.
+    ///
+    /// Matching one node reads the tree, the facts and the programs and writes only its own
+    /// matches, so a scope's nodes are cut into contiguous preorder runs and each run is matched on
+    /// its own thread with its own workspace and counters. The runs rejoin in preorder, which is
+    /// the order the serial walk produces, and the first run that came back incomplete reports the
+    /// same node the serial walk would have stopped at. Worker threads do not record relational
+    /// witnesses: the table is a cache of proofs, and a proof it lacks is routed conservatively.
+    pub(super) fn match_document_on(&mut self, root: StyleNodeID, workers: usize) -> Result<usize, Incomplete> {
         let nodes = self.elements_under(root);
 
         let mut batch = StyleNodeFacts::new();
@@ -948,7 +974,7 @@ impl StyleEngine {
         let can_have_scope_duplicates = by_scope.iter().filter(|nodes| !nodes.is_empty()).take(2).count() > 1;
 
         let mut matches = RuleMatches::new();
-        let mut dispatch_workspace = DispatchCandidateWorkspace::default();
+        let mut dispatch_workspaces = vec![DispatchCandidateWorkspace::default()];
         let mut ancestor_requirements_cache = AncestorRequirementsCache::default();
         let mut result = Ok(());
         for (index, scope_nodes) in by_scope.into_iter().enumerate() {
@@ -962,27 +988,43 @@ impl StyleEngine {
             // `:host` names the host of this tree, which stands outside it, so the tree's own rules
             // are asked of it as well.
             let host = self.scope_root(scope).and_then(|root| self.tree.host_of(root));
-            for node in scope_nodes.into_iter().chain(host) {
-                if let Err(incomplete) = self.match_node_in_scope(
-                    node,
+            let run_count = workers.min(scope_nodes.len() / MIN_NODES_PER_MATCH_WORKER);
+            if run_count > 1 {
+                result = self.match_scope_on_workers(
                     scope,
-                    &dispatch,
-                    &batch,
-                    &mut dispatch_workspace,
-                    Some(ancestor_requirements),
-                    None,
-                    None,
-                    BatchMatchAttempt {
-                        matches: &mut matches,
-                        requests: None,
-                        completed: None,
-                        deferred_prefix_matches: None,
-                        answer_is_exact: None,
-                        cascade_only: false,
+                    scope_nodes.into_iter().chain(host),
+                    ParallelScopeMatch {
+                        dispatch: &dispatch,
+                        facts: &batch,
+                        ancestor_requirements,
+                        run_count,
                     },
-                ) {
-                    result = Err(incomplete);
-                    break;
+                    &mut dispatch_workspaces,
+                    &mut matches,
+                );
+            } else {
+                for node in scope_nodes.into_iter().chain(host) {
+                    if let Err(incomplete) = self.match_node_in_scope(
+                        node,
+                        scope,
+                        &dispatch,
+                        &batch,
+                        &mut dispatch_workspaces[0],
+                        Some(ancestor_requirements),
+                        None,
+                        None,
+                        BatchMatchAttempt {
+                            matches: &mut matches,
+                            requests: None,
+                            completed: None,
+                            deferred_prefix_matches: None,
+                            answer_is_exact: None,
+                            cascade_only: false,
+                        },
+                    ) {
+                        result = Err(incomplete);
+                        break;
+                    }
                 }
             }
             if result.is_err() {
@@ -990,7 +1032,10 @@ impl StyleEngine {
             }
         }
         ancestor_requirements_cache.release(&mut self.memory);
-        let dispatch_workspace_bytes = dispatch_workspace.capacity_bytes();
+        let dispatch_workspace_bytes = dispatch_workspaces
+            .iter()
+            .map(DispatchCandidateWorkspace::capacity_bytes)
+            .sum();
         self.memory
             .reserve_required(MemoryCategory::BatchScratch, dispatch_workspace_bytes);
 
@@ -1008,6 +1053,74 @@ impl StyleEngine {
         match_count
     }
 
+    /// Match one scope's nodes in `scope.run_count` contiguous runs, one worker thread each, and
+    /// append what they found to `matches` in the order of `nodes`.
+    fn match_scope_on_workers(
+        &mut self,
+        scope: TreeScopeID,
+        nodes: impl Iterator<Item = StyleNodeID>,
+        parallel: ParallelScopeMatch<'_>,
+        dispatch_workspaces: &mut Vec<DispatchCandidateWorkspace>,
+        matches: &mut RuleMatches,
+    ) -> Result<(), Incomplete> {
+        // Where a node stands to the tree reads the engine's slot and part bookkeeping, which stays
+        // on this thread.
+        let placed: Vec<(StyleNodeID, ScopePlacement)> =
+            nodes.map(|node| (node, self.placement_in_scope(node, scope))).collect();
+        let run_length = placed.len().div_ceil(parallel.run_count);
+        if dispatch_workspaces.len() < parallel.run_count {
+            dispatch_workspaces.resize_with(parallel.run_count, DispatchCandidateWorkspace::default);
+        }
+
+        let shadow_root = self.scope_root(scope);
+        let (tree, programs, program) = (&self.tree, &self.programs, &self.program);
+        let runs: Vec<(RuleMatches, Counters, Result<(), Incomplete>)> = std::thread::scope(|threads| {
+            let workers: Vec<_> = placed
+                .chunks(run_length)
+                .zip(dispatch_workspaces.iter_mut())
+                .map(|(run, dispatch_workspace)| {
+                    threads.spawn(move || {
+                        let mut run_matches = RuleMatches::new();
+                        let mut run_counters = Counters::new();
+                        let result = run.iter().try_for_each(|&(node, placement)| {
+                            let mut interpreter =
+                                BatchMatcher::new(tree, parallel.facts, parallel.dispatch, programs, program)
+                                    .in_scope(scope)
+                                    .placed(placement, Some(parallel.ancestor_requirements));
+                            if let Some(shadow_root) = shadow_root {
+                                interpreter = interpreter.in_shadow_tree(shadow_root);
+                            }
+                            interpreter.match_node_collecting_requests(
+                                node,
+                                &mut run_matches,
+                                &mut run_counters,
+                                BatchMatchState {
+                                    dispatch_workspace: &mut *dispatch_workspace,
+                                    requests: None,
+                                    completed: None,
+                                    prefix_states: None,
+                                    deferred_prefix_matches: None,
+                                },
+                            )
+                        });
+                        (run_matches, run_counters, result)
+                    })
+                })
+                .collect();
+            workers
+                .into_iter()
+                .map(|worker| worker.join().unwrap_or_else(|panic| std::panic::resume_unwind(panic)))
+                .collect()
+        });
+
+        for (mut run_matches, run_counters, result) in runs {
+            self.counters.add_all(&run_counters);
+            result?;
+            matches.as_mut_vec().append(run_matches.as_mut_vec());
+        }
+        Ok(())
+    }
+
     /// Every tree whose `::slotted()` can name this element.
     ///
     /// A slot is itself a slottable, so an element can be assigned to a slot that is assigned to
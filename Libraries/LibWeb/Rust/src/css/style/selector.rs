@@ -47,7 +47,8 @@ use std::hash::Hash;
 use std::hash::Hasher;
 use std::num::NonZeroU32;
 use std::rc::Rc;
-use std::rc::Weak;
+use std::sync::Arc;
+use std::sync::Weak;
 
 use super::TransactionFactSide;
 use super::TransactionFactView;
@@ -2373,7 +2374,7 @@ thread_local! {
     static SHARED_SELECTOR_PROGRAMS: RefCell<SharedSelectorPrograms> = RefCell::new(SharedSelectorPrograms::default());
 }
 
-fn share_selector_program(program: SelectorProgram) -> Rc<SharedSelectorProgram> {
+fn share_selector_program(program: SelectorProgram) -> Arc<SharedSelectorProgram> {
     let hash = SelectorPrograms::program_hash(&program);
     SHARED_SELECTOR_PROGRAMS.with_borrow_mut(|shared| {
         let bucket = shared.by_hash.entry(hash).or_default();
@@ -2393,19 +2394,19 @@ fn share_selector_program(program: SelectorProgram) -> Rc<SharedSelectorProgram>
 
         let mut program_memory = MemoryLease::new(MemoryCategory::RuleProgram);
         program_memory.reconcile_committed(&mut shared.memory, program.capacity_bytes());
-        let program = Rc::new(SharedSelectorProgram {
+        let program = Arc::new(SharedSelectorProgram {
             program,
             hash,
             _memory: program_memory,
         });
-        bucket.push(Rc::downgrade(&program));
+        bucket.push(Arc::downgrade(&program));
         program
     })
 }
 
 enum SelectorProgramStorage {
     Document(SelectorProgram),
-    Process(Rc<SharedSelectorProgram>),
+    Process(Arc<SharedSelectorProgram>),
 }
 
 impl SelectorProgramStorage {
@@ -7670,7 +7671,7 @@ mod tests {
         ) else {
             panic!("replay selector programs must have process storage");
         };
-        assert!(Rc::ptr_eq(first_program, second_program));
+        assert!(Arc::ptr_eq(first_program, second_program));
         assert_eq!(first_memory.bytes_in_category(MemoryCategory::RuleProgram), 0);
         assert_eq!(second_memory.bytes_in_category(MemoryCategory::RuleProgram), 0);
         SHARED_SELECTOR_PROGRAMS.with_borrow(|shared| {
@@ -7334,6 +7334,50 @@ fn ancestor_requirement_scratch_is_released_after_document_matching() {
     assert_eq!(engine.memory().bytes_in_category(MemoryCategory::BatchScratch), 0);
 }
 
+#[test]
+fn document_matching_on_worker_threads_agrees_with_one_thread() {
+    // `root -> outer * 600`, each outer holding one inner, with every third outer a guard.
+    const OUTERS: usize = 600;
+    let mut engine = StyleEngine::new(DeviceClass::ForegroundDesktop);
+    let mut raw = vec![0_u32; 1 + 2 * OUTERS];
+    engine.allocate_style_nodes(&mut raw);
+    let nodes: Vec<StyleNodeID> = raw.iter().map(|&raw| StyleNodeID::from_raw(raw).unwrap()).collect();
+    engine.record_tree_delta(nodes[0], None, Some(relations(None, None, None)));
+    for outer in 0..OUTERS {
+        let previous = outer.checked_sub(1).map(|previous| nodes[1 + 2 * previous].raw());
+        engine.record_tree_delta(
+            nodes[1 + 2 * outer],
+            None,
+            Some(relations(Some(nodes[0].raw()), previous, None)),
+        );
+        engine.record_tree_delta(
+            nodes[2 + 2 * outer],
+            None,
+            Some(relations(Some(nodes[1 + 2 * outer].raw()), None, None)),
+        );
+    }
+    for &node in &nodes {
+        set_atom_feature(&mut engine, node, LocalFeatureKey::TagName, StyleAtomID(100));
+    }
+    let guard = StyleAtomID(200);
+    let target = StyleAtomID(201);
+    add_guard_target_rule(&mut engine, guard, target);
+    for outer in 0..OUTERS {
+        if outer % 3 == 0 {
+            add_feature(&mut engine, nodes[1 + 2 * outer], LocalFeatureKey::Class(guard));
+        }
+        add_feature(&mut engine, nodes[2 + 2 * outer], LocalFeatureKey::Class(target));
+    }
+    discard_transaction(&mut engine);
+
+    let serial = engine.match_document_on(nodes[0], 1);
+    assert_eq!(serial, Ok(OUTERS / 3));
+    for workers in [2, 4] {
+        assert_eq!(engine.match_document_on(nodes[0], workers), serial);
+        assert_eq!(engine.memory().bytes_in_category(MemoryCategory::BatchScratch), 0);
+    }
+}
+
 #[test]
 fn identical_sheet_sets_share_a_scope_program() {
     let mut engine = StyleEngine::new(DeviceClass::ForegroundDesktop);
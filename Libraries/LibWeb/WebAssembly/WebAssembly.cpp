@@ -23,18 +23,21 @@
 #include <LibJS/Runtime/Iterator.h>
 #include <LibJS/Runtime/NativeFunction.h>
 #include <LibJS/Runtime/Object.h>
+#include <LibJS/Runtime/Promise.h>
 #include <LibJS/Runtime/VM.h>
 #include <LibJS/Runtime/ValueInlines.h>
 #include <LibRequests/RequestClient.h>
 #include <LibThreading/ThreadPool.h>
 #include <LibURL/Parser.h>
 #include <LibWasm/AbstractMachine/Validator.h>
+#include <LibWasm/Parser/StreamingModuleParser.h>
 #include <LibWeb/Bindings/HostDefined.h>
 #include <LibWeb/Bindings/Intrinsics.h>
 #include <LibWeb/Bindings/PlatformObject.h>
 #include <LibWeb/Bindings/Wrappable.h>
 #include <LibWeb/Bindings/WrapperWorld.h>
 #include <LibWeb/ContentSecurityPolicy/BlockingAlgorithms.h>
+#include <LibWeb/Fetch/Infrastructure/HTTP/Bodies.h>
 #include <LibWeb/Fetch/Infrastructure/HTTP/MIME.h>
 #include <LibWeb/Fetch/Infrastructure/URL.h>
 #include <LibWeb/Fetch/Response.h>
@@ -56,6 +59,7 @@
 namespace Web::WebAssembly {
 
 static GC::Ref<WebIDL::Promise> asynchronously_compile_webassembly_module(JS::Realm&, ByteBuffer, HTML::Task::Source = HTML::Task::Source::Unspecified);
+static GC::Ref<WebIDL::Promise> asynchronously_compile_webassembly_module(JS::Realm&, NonnullRefPtr<Wasm::StreamingModuleParser>, HTML::Task::Source = HTML::Task::Source::Unspecified);
 static GC::Ref<WebIDL::Promise> instantiate_promise_of_module(JS::Realm&, GC::Ref<WebIDL::Promise>, GC::Ptr<JS::Object> import_object);
 static GC::Ref<WebIDL::Promise> asynchronously_instantiate_webassembly_module(JS::Realm&, GC::Ref<Module>, GC::Ptr<JS::Object> import_object);
 static GC::Ref<WebIDL::Promise> compile_potential_webassembly_response(JS::Realm&, GC::Ref<WebIDL::Promise>);
@@ -469,17 +473,22 @@ JS::ThrowCompletionOr<NonnullRefPtr<Wasm::ModuleInstance>> instantiate_module(JS
 // https://webassembly.github.io/spec/js-api/#compile-a-webassembly-module
 // https://webassembly.github.io/content-security-policy/js-api/#compile-a-webassembly-module
 JS::ThrowCompletionOr<NonnullRefPtr<CompiledWebAssemblyModule>> compile_a_webassembly_module(JS::Realm& realm, ByteBuffer data)
+{
+    return compile_a_webassembly_module(realm, Wasm::StreamingModuleParser::create_from_bytes(move(data)));
+}
+
+JS::ThrowCompletionOr<NonnullRefPtr<CompiledWebAssemblyModule>> compile_a_webassembly_module(JS::Realm& realm, NonnullRefPtr<Wasm::StreamingModuleParser> parser)
 {
     auto& vm = realm.vm();
     TRY(host_ensure_can_compile_wasm_bytes(realm));
 
+    auto data = parser->bytes();
+
     Wasm::ModuleStats stats;
     stats.input_size_bytes = data.size();
 
-    auto parse_start = MonotonicTime::now();
-    FixedMemoryStream stream { data.bytes() };
-    auto module_result = Wasm::Module::parse(stream);
-    stats.parse_time = MonotonicTime::now() - parse_start;
+    auto module_result = parser->finish();
+    stats.parse_time = parser->parse_time();
     if (module_result.is_error()) {
         return vm.throw_completion<CompileError>(Wasm::parse_error_to_byte_string(module_result.error()));
     }
@@ -544,9 +553,12 @@ JS::ThrowCompletionOr<NonnullRefPtr<CompiledWebAssemblyModule>> compile_a_webass
     if (wasm_cache_config.has_value())
         compiled_module->module->set_cranelift_cache_config(wasm_cache_config.release_value());
     compiled_module->module->set_compile_stats(move(stats));
-    Threading::ThreadPool::the().submit([module = NonnullRefPtr { compiled_module->module }] {
-        Wasm::start_cranelift_compilation(*module);
-    });
+    // The module can already run in the interpreter, so the optimizing tier must not hold up anything else.
+    Threading::ThreadPool::the().submit(
+        [module = NonnullRefPtr { compiled_module->module }] {
+            Wasm::start_cranelift_compilation(*module);
+        },
+        Threading::ThreadPool::Priority::Background);
     return compiled_module;
 }
 
@@ -978,15 +990,20 @@ JS::ThrowCompletionOr<void> host_ensure_can_compile_wasm_bytes(JS::Realm& realm)
 
 // https://webassembly.github.io/spec/js-api/#asynchronously-compile-a-webassembly-module
 GC::Ref<WebIDL::Promise> asynchronously_compile_webassembly_module(JS::Realm& realm, ByteBuffer bytes, HTML::Task::Source task_source)
+{
+    return asynchronously_compile_webassembly_module(realm, Wasm::StreamingModuleParser::create_from_bytes(move(bytes)), task_source);
+}
+
+GC::Ref<WebIDL::Promise> asynchronously_compile_webassembly_module(JS::Realm& realm, NonnullRefPtr<Wasm::StreamingModuleParser> parser, HTML::Task::Source task_source)
 {
     // 1. Let promise be a new Promise.
     auto promise = WebIDL::create_promise(realm);
 
     // 2. Run the following steps in parallel:
-    Platform::EventLoopPlugin::the().deferred_invoke(GC::create_function(GC::Heap::the(), [&realm, bytes = move(bytes), promise, task_source]() mutable {
+    Platform::EventLoopPlugin::the().deferred_invoke(GC::create_function(GC::Heap::the(), [&realm, parser = move(parser), promise, task_source]() mutable {
         HTML::TemporaryExecutionContext context(realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes);
         // 1. Compile the WebAssembly module bytes and store the result as module.
-        auto module_or_error = Detail::compile_a_webassembly_module(realm, move(bytes));
+        auto module_or_error = Detail::compile_a_webassembly_module(realm, move(parser));
 
         // 2. Queue a task to perform the following steps. If taskSource was provided, queue the task on that task source.
         HTML::queue_a_task(task_source, nullptr, nullptr, GC::create_function(GC::Heap::the(), [&realm, promise, module_or_error = move(module_or_error)]() mutable {
@@ -1167,41 +1184,57 @@ GC::Ref<WebIDL::Promise> compile_potential_webassembly_response(JS::Realm& realm
         }
 
         // 8. Consume response’s body as an ArrayBuffer, and let bodyPromise be the result.
-        auto body_promise_or_error = Bindings::array_buffer_for_webassembly_response(realm, *response_object);
-        if (body_promise_or_error.is_error()) {
-            WebIDL::reject_promise_with_exception(return_value, body_promise_or_error.release_error());
+        // NOTE: Rather than waiting for the whole body, we read it incrementally and hand each chunk to a streaming parser,
+        //       so that function bodies are parsed while the rest of the module is still being received. Steps 9 and 10
+        //       are run once the body has been read to its end, or has failed to be.
+        if (response_object->is_unusable()) {
+            WebIDL::reject_promise(return_value, vm.throw_completion<JS::TypeError>("Body is unusable"_utf16).value());
             return JS::js_undefined();
         }
-        auto body_promise = body_promise_or_error.release_value();
 
-        // 9. Upon fulfillment of bodyPromise with value bodyArrayBuffer:
-        auto body_fulfillment_steps = GC::create_function(GC::Heap::the(), [&vm, return_value](JS::Value body_array_buffer) -> WebIDL::ExceptionOr<JS::Value> {
-            // 1. Let stableBytes be a copy of the bytes held by the buffer bodyArrayBuffer.
-            VERIFY(body_array_buffer.is_object());
-            auto stable_bytes = WebIDL::get_buffer_source_copy(body_array_buffer.as_object());
-            if (stable_bytes.is_error()) {
-                VERIFY(stable_bytes.error().code() == ENOMEM);
+        auto parser = Wasm::StreamingModuleParser::create();
+        auto is_settled = [return_value] {
+            return as<JS::Promise>(*return_value->promise()).state() != JS::Promise::State::Pending;
+        };
+
+        auto process_body_chunk = GC::create_function(GC::Heap::the(), [&vm, return_value, parser, is_settled](ByteBuffer chunk) {
+            if (is_settled())
+                return;
+            if (parser->append(chunk).is_error()) {
+                HTML::TemporaryExecutionContext context(HTML::relevant_realm(*return_value->promise()));
                 WebIDL::reject_promise(return_value, vm.throw_completion<JS::InternalError>(vm.error_message(JS::VM::ErrorMessage::OutOfMemory)).value());
-                return JS::js_undefined();
             }
+        });
+
+        // 9. Upon fulfillment of bodyPromise with value bodyArrayBuffer:
+        auto process_end_of_body = GC::create_function(GC::Heap::the(), [return_value, parser, is_settled] {
+            if (is_settled())
+                return;
+            auto& realm = HTML::relevant_realm(*return_value->promise());
+            HTML::TemporaryExecutionContext context(realm);
+
+            // 1. Let stableBytes be a copy of the bytes held by the buffer bodyArrayBuffer.
+            // NOTE: The parser owns the bytes it has received, which nothing else can modify.
 
             // 2. Asynchronously compile the WebAssembly module stableBytes using the networking task source and resolve returnValue with the result.
-            auto result = asynchronously_compile_webassembly_module(HTML::relevant_realm(*return_value->promise()), stable_bytes.release_value(), HTML::Task::Source::Networking);
+            auto result = asynchronously_compile_webassembly_module(realm, parser, HTML::Task::Source::Networking);
 
             // Need to manually convert WebIDL promise to an ECMAScript value here to resolve
             WebIDL::resolve_promise(return_value, result->promise());
-
-            return JS::js_undefined();
         });
 
         // 10. Upon rejection of bodyPromise with reason reason:
-        auto body_rejection_steps = GC::create_function(GC::Heap::the(), [return_value](JS::Value reason) -> WebIDL::ExceptionOr<JS::Value> {
+        auto process_body_error = GC::create_function(GC::Heap::the(), [return_value](JS::Value reason) {
+            HTML::TemporaryExecutionContext context(HTML::relevant_realm(*return_value->promise()));
+
             // 1. Reject returnValue with reason.
             WebIDL::reject_promise(return_value, reason);
-            return JS::js_undefined();
         });
 
-        WebIDL::react_to_promise(body_promise, body_fulfillment_steps, body_rejection_steps);
+        if (auto body = response_object->body_impl())
+            body->incrementally_read(realm, process_body_chunk, process_end_of_body, process_body_error, GC::Ref { realm.global_object() });
+        else
+            process_end_of_body->function()();
 
         return JS::js_undefined();
     });
@@ -1418,13 +1451,6 @@ GC::Ref<JS::Object> create_webassembly_instantiated_source(JS::Realm& realm, GC:
     return result;
 }
 
-WebIDL::ExceptionOr<GC::Ref<WebIDL::Promise>> array_buffer_for_webassembly_response(JS::Realm& realm, Fetch::Response const& response)
-{
-    auto promise = WebIDL::create_promise(realm);
-    response.array_buffer(promise);
-    return promise;
-}
-
 #define DEFINE_WASM_ERROR_PROTOTYPE_AND_CONSTRUCTOR_WEB_INTRINSIC(ClassName, FullClassName, snake_name, PrototypeName, ConstructorName)    \
     template<>                                                                                                                             \
     void Intrinsics::create_web_prototype_and_constructor<WebAssembly::PrototypeName>(JS::Realm & realm)                                   \
@@ -20,6 +20,7 @@
 #include <LibJS/Runtime/Value.h>
 #include <LibURL/URL.h>
 #include <LibWasm/AbstractMachine/AbstractMachine.h>
+#include <LibWasm/Forward.h>
 #include <LibWeb/Export.h>
 #include <LibWeb/Forward.h>
 #include <LibWeb/WebIDL/Buffers.h>
@@ -123,6 +124,7 @@ NonnullRefPtr<WebAssemblyCache> get_cache(JS::Realm&);
 
 JS::ThrowCompletionOr<NonnullRefPtr<Wasm::ModuleInstance>> instantiate_module(JS::Realm&, Wasm::Module const&, GC::Ptr<JS::Object> import_object);
 JS::ThrowCompletionOr<NonnullRefPtr<CompiledWebAssemblyModule>> compile_a_webassembly_module(JS::Realm&, ByteBuffer);
+JS::ThrowCompletionOr<NonnullRefPtr<CompiledWebAssemblyModule>> compile_a_webassembly_module(JS::Realm&, NonnullRefPtr<Wasm::StreamingModuleParser>);
 Utf16FlyString name_of_webassembly_function(Wasm::Store&, Wasm::FunctionAddress);
 GC::Ptr<JS::NativeFunction> create_native_function(JS::Realm&, Wasm::FunctionAddress address, Utf16FlyString name, GC::Ptr<Instance> instance = nullptr);
 JS::ThrowCompletionOr<Wasm::Value> to_webassembly_value(JS::Realm&, JS::Value value, Wasm::ValueType const& type);
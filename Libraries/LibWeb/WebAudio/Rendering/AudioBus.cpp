@@ -4,9 +4,10 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
-#include <AK/AnyOf.h>
+#include <AK/AllOf.h>
 #include <AK/Math.h>
 #include <LibWeb/WebAudio/Rendering/AudioBus.h>
+#include <LibWeb/WebAudio/Rendering/VectorMath.h>
 
 namespace Web::WebAudio::Rendering {
 
@@ -35,9 +36,7 @@ void AudioBus::zero()
 
 bool AudioBus::is_silent() const
 {
-    return !any_of(m_channels, [](auto const& channel) {
-        return any_of(channel, [](auto sample) { return sample != 0.f; });
-    });
+    return all_of(m_channels, [](auto const& channel) { return VectorMath::is_silent(channel); });
 }
 
 // Changes the number of channels; sample data is not preserved.
@@ -75,10 +74,7 @@ void AudioBus::sum_from_speakers(AudioBus const& source)
     auto destination_channels = channel_count();
 
     auto sum_channel = [&](size_t destination_index, size_t source_index, float gain = 1.f) {
-        auto destination_span = channel(destination_index);
-        auto source_span = source.channel(source_index);
-        for (size_t frame = 0; frame < m_frame_count; ++frame)
-            destination_span[frame] += source_span[frame] * gain;
+        VectorMath::multiply_add(source.channel(source_index), gain, channel(destination_index));
     };
 
     if (source_channels == destination_channels) {
@@ -189,12 +185,8 @@ void AudioBus::sum_from_discrete(AudioBus const& source)
     // Up-mix by filling channels until they run out then zero out remaining channels. Down-mix by filling as many
     // channels as possible, then dropping remaining channels.
     auto channels_to_sum = min(source.channel_count(), channel_count());
-    for (size_t channel_index = 0; channel_index < channels_to_sum; ++channel_index) {
-        auto destination_span = channel(channel_index);
-        auto source_span = source.channel(channel_index);
-        for (size_t frame = 0; frame < m_frame_count; ++frame)
-            destination_span[frame] += source_span[frame];
-    }
+    for (size_t channel_index = 0; channel_index < channels_to_sum; ++channel_index)
+        VectorMath::add(source.channel(channel_index), channel(channel_index));
 }
 
 }
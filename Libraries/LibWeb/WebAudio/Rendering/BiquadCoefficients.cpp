@@ -5,6 +5,7 @@
  */
 
 #include <AK/Math.h>
+#include <AK/SIMD.h>
 #include <LibWeb/WebAudio/Rendering/BiquadCoefficients.h>
 
 namespace Web::WebAudio::Rendering {
@@ -141,4 +142,51 @@ void biquad_frequency_response(BiquadCoefficients const& coefficients, double no
     phase = static_cast<float>(AK::atan2(response_imaginary, response_real));
 }
 
+void biquad_filter(ReadonlySpan<BiquadCoefficients> coefficients, ReadonlySpan<float> input, Span<float> output, BiquadFilterState& state)
+{
+    VERIFY(coefficients.size() == input.size() && output.size() == input.size());
+
+    for (size_t frame = 0; frame < input.size(); ++frame) {
+        auto const& frame_coefficients = coefficients[frame];
+        double x = input[frame];
+        auto y = frame_coefficients.b0 * x + frame_coefficients.b1 * state.x1 + frame_coefficients.b2 * state.x2
+            - frame_coefficients.a1 * state.y1 - frame_coefficients.a2 * state.y2;
+        state.x2 = state.x1;
+        state.x1 = x;
+        state.y2 = state.y1;
+        state.y1 = y;
+        output[frame] = static_cast<float>(y);
+    }
+}
+
+void biquad_filter(ReadonlySpan<BiquadCoefficients> coefficients, ReadonlySpan<float> first_input, ReadonlySpan<float> second_input, Span<float> first_output, Span<float> second_output, BiquadFilterState& first_state, BiquadFilterState& second_state)
+{
+    using AK::SIMD::f64x2;
+
+    VERIFY(coefficients.size() == first_input.size());
+    VERIFY(second_input.size() == first_input.size());
+    VERIFY(first_output.size() == first_input.size() && second_output.size() == first_input.size());
+
+    f64x2 x1 { first_state.x1, second_state.x1 };
+    f64x2 x2 { first_state.x2, second_state.x2 };
+    f64x2 y1 { first_state.y1, second_state.y1 };
+    f64x2 y2 { first_state.y2, second_state.y2 };
+
+    for (size_t frame = 0; frame < first_input.size(); ++frame) {
+        auto const& frame_coefficients = coefficients[frame];
+        f64x2 x { first_input[frame], second_input[frame] };
+        auto y = frame_coefficients.b0 * x + frame_coefficients.b1 * x1 + frame_coefficients.b2 * x2
+            - frame_coefficients.a1 * y1 - frame_coefficients.a2 * y2;
+        x2 = x1;
+        x1 = x;
+        y2 = y1;
+        y1 = y;
+        first_output[frame] = static_cast<float>(y[0]);
+        second_output[frame] = static_cast<float>(y[1]);
+    }
+
+    first_state = { x1[0], x2[0], y1[0], y2[0] };
+    second_state = { x1[1], x2[1], y1[1], y2[1] };
+}
+
 }
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/Span.h>
 #include <LibWeb/Bindings/BiquadFilterNode.h>
 #include <LibWeb/Export.h>
 
@@ -21,6 +22,14 @@ struct BiquadCoefficients {
     double a2 { 0 };
 };
 
+// The last two input and output samples of a single channel.
+struct BiquadFilterState {
+    double x1 { 0 };
+    double x2 { 0 };
+    double y1 { 0 };
+    double y2 { 0 };
+};
+
 // Computes filter coefficients from the BiquadFilterNode's computed parameter values. frequency is expected to already
 // include the detune factor and be given as a fraction of the Nyquist frequency, in the range [0, 1].
 WEB_API BiquadCoefficients compute_biquad_coefficients(Bindings::BiquadFilterType, double normalized_frequency, double q, double gain_db);
@@ -29,4 +38,11 @@ WEB_API BiquadCoefficients compute_biquad_coefficients(Bindings::BiquadFilterTyp
 // frequency in the range [0, 1].
 WEB_API void biquad_frequency_response(BiquadCoefficients const&, double normalized_frequency, float& magnitude, float& phase);
 
+// Filters a channel, using the coefficients at the same index for each frame.
+WEB_API void biquad_filter(ReadonlySpan<BiquadCoefficients>, ReadonlySpan<float> input, Span<float> output, BiquadFilterState&);
+
+// Filters two channels at once. Each output sample only depends on earlier samples of the same channel, so the two
+// channels are processed side by side in one vector rather than one after the other.
+WEB_API void biquad_filter(ReadonlySpan<BiquadCoefficients>, ReadonlySpan<float> first_input, ReadonlySpan<float> second_input, Span<float> first_output, Span<float> second_output, BiquadFilterState& first_state, BiquadFilterState& second_state);
+
 }
@@ -55,6 +55,7 @@ void OfflineAudioRenderer::start_rendering()
 {
     VERIFY(!m_thread);
     m_graph.set_destination(m_destination_node_id);
+    m_graph.set_renders_branches_in_parallel(true);
     m_thread = MUST(Threading::Thread::try_create("OfflineAudioRenderer"sv, [self = NonnullRefPtr(*this)] {
         return self->render_thread_main();
     }));
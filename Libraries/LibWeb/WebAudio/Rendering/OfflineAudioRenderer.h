@@ -30,7 +30,8 @@ class EventLoop;
 namespace Web::WebAudio::Rendering {
 
 // Renders an OfflineAudioContext's graph on a dedicated rendering thread, which is created when rendering starts and
-// exits once the last render quantum has been processed. Progress is reported back to the control thread by posting
+// exits once the last render quantum has been processed. Independent branches of the graph are rendered on the thread
+// pool alongside it. Progress is reported back to the control thread by posting
 // events to the main thread's event loop.
 // https://webaudio.github.io/web-audio-api/#OfflineAudioContext
 class WEB_API OfflineAudioRenderer final : public AtomicRefCounted<OfflineAudioRenderer> {
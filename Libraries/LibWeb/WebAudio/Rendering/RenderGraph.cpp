@@ -4,10 +4,24 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/QuickSort.h>
+#include <LibSync/ConditionVariable.h>
+#include <LibSync/Mutex.h>
+#include <LibThreading/ThreadPool.h>
 #include <LibWeb/WebAudio/Rendering/RenderGraph.h>
 
 namespace Web::WebAudio::Rendering {
 
+// Rendering a branch on another thread costs a task submission and a wakeup per render quantum, which only pays off if
+// each thread has a few nodes to process.
+static constexpr size_t MINIMUM_NODES_PER_BRANCH_GROUP = 4;
+
+void RenderGraph::set_renders_branches_in_parallel(bool renders_branches_in_parallel)
+{
+    m_renders_branches_in_parallel = renders_branches_in_parallel;
+    m_incoming_connections_dirty = true;
+}
+
 void RenderGraph::apply_control_messages(Vector<ControlMessage> messages)
 {
     for (auto& message : messages) {
@@ -47,9 +61,13 @@ void RenderGraph::render_quantum(RenderContext const& context)
     ++m_current_quantum;
     if (m_incoming_connections_dirty) {
         rebuild_incoming_connections();
+        rebuild_branch_groups();
         m_incoming_connections_dirty = false;
     }
 
+    if (m_branch_groups.size() > 1)
+        render_branch_groups(context);
+
     // Pull the destination first so the main graph is processed in dependency order; then process any remaining nodes
     // so unconnected sources still advance their playback state and report ended events.
     if (auto* destination_node = destination())
@@ -126,4 +144,144 @@ void RenderGraph::rebuild_incoming_connections()
     }
 }
 
+// Splits the nodes other than the destination into branches that share no nodes and no params, and distributes the
+// branches over as many groups as there are threads to render them.
+void RenderGraph::rebuild_branch_groups()
+{
+    m_branch_groups.clear();
+    if (!m_renders_branches_in_parallel)
+        return;
+
+    auto* destination_node = destination();
+
+    HashMap<NodeID, size_t> node_indices;
+    Vector<NodeID> node_ids;
+    for (auto& [node_id, graph_node] : m_nodes) {
+        if (graph_node.ptr() == destination_node)
+            continue;
+        node_indices.set(node_id, node_ids.size());
+        node_ids.append(node_id);
+    }
+
+    // NB: The branches are the connected components of the graph without its destination, found with a union-find.
+    Vector<size_t> parents;
+    parents.ensure_capacity(node_ids.size());
+    for (size_t index = 0; index < node_ids.size(); ++index)
+        parents.unchecked_append(index);
+    auto find_root = [&](size_t index) {
+        while (parents[index] != index) {
+            parents[index] = parents[parents[index]];
+            index = parents[index];
+        }
+        return index;
+    };
+    auto join = [&](size_t index, size_t other_index) {
+        parents[find_root(index)] = find_root(other_index);
+    };
+
+    bool reads_from_destination = false;
+    auto join_with_source = [&](size_t index, NodeID source) {
+        if (destination_node && source == destination_node->node_id()) {
+            reads_from_destination = true;
+            return;
+        }
+        if (auto source_index = node_indices.get(source); source_index.has_value())
+            join(index, *source_index);
+    };
+
+    HashMap<RenderAudioParam*, size_t> shared_param_readers;
+    for (size_t index = 0; index < node_ids.size(); ++index) {
+        auto& graph_node = *node(node_ids[index]);
+        for (size_t input_index = 0; input_index < graph_node.input_count(); ++input_index) {
+            for (auto const& connection : graph_node.input_connections(input_index))
+                join_with_source(index, connection.source);
+        }
+        graph_node.for_each_param([&](RenderAudioParam& param) {
+            for (auto const& input : param.inputs())
+                join_with_source(index, input.source);
+        });
+        graph_node.for_each_shared_param([&](RenderAudioParam& param) {
+            for (auto const& input : param.inputs())
+                join_with_source(index, input.source);
+            join(index, shared_param_readers.ensure(&param, [&] { return index; }));
+        });
+    }
+
+    // The destination is pulled after all branches are rendered, so no branch can depend on it.
+    if (reads_from_destination)
+        return;
+
+    // NB: Each branch pulls its nodes in the same order as a serial render_quantum() would, so that the node that gets
+    //     processed first in a cycle, and thus sees the previous quantum's output of the others, stays the same.
+    HashMap<size_t, size_t> branch_indices;
+    Vector<Vector<NodeID>> branches;
+    auto append_to_branch = [&](size_t index) {
+        auto branch_index = branch_indices.ensure(find_root(index), [&] {
+            branches.append({});
+            return branches.size() - 1;
+        });
+        branches[branch_index].append(node_ids[index]);
+    };
+    if (destination_node) {
+        for (size_t input_index = 0; input_index < destination_node->input_count(); ++input_index) {
+            for (auto const& connection : destination_node->input_connections(input_index)) {
+                if (auto index = node_indices.get(connection.source); index.has_value())
+                    append_to_branch(*index);
+            }
+        }
+    }
+    for (size_t index = 0; index < node_ids.size(); ++index) {
+        if (node(node_ids[index])->output_count() > 0)
+            append_to_branch(index);
+    }
+
+    auto group_count = min(branches.size(), Threading::ThreadPool::the().thread_count() + 1);
+    group_count = min(group_count, node_ids.size() / MINIMUM_NODES_PER_BRANCH_GROUP);
+    if (group_count < 2)
+        return;
+
+    // Hand out the largest branches first, each to the group with the fewest nodes so far.
+    quick_sort(branches, [](auto const& a, auto const& b) { return a.size() > b.size(); });
+    m_branch_groups.resize(group_count);
+    for (auto& branch : branches) {
+        auto* smallest_group = &m_branch_groups.first();
+        for (auto& group : m_branch_groups) {
+            if (group.size() < smallest_group->size())
+                smallest_group = &group;
+        }
+        smallest_group->extend(move(branch));
+    }
+}
+
+// Renders every group but the first on the thread pool, and the first on the calling thread. Returns once all of them
+// have been rendered.
+void RenderGraph::render_branch_groups(RenderContext const& context)
+{
+    Sync::Mutex mutex;
+    Sync::ConditionVariable all_groups_rendered { mutex };
+    size_t remaining_group_count = m_branch_groups.size() - 1;
+
+    for (size_t group_index = 1; group_index < m_branch_groups.size(); ++group_index) {
+        Threading::ThreadPool::the().submit([&, group_index] {
+            render_branch_group(m_branch_groups[group_index], context);
+
+            Sync::MutexLocker locker(mutex);
+            if (--remaining_group_count == 0)
+                all_groups_rendered.signal();
+        });
+    }
+
+    render_branch_group(m_branch_groups.first(), context);
+
+    Sync::MutexLocker locker(mutex);
+    while (remaining_group_count > 0)
+        all_groups_rendered.wait();
+}
+
+void RenderGraph::render_branch_group(Vector<NodeID> const& node_ids, RenderContext const& context)
+{
+    for (auto node_id : node_ids)
+        pull_output(node_id, 0, context);
+}
+
 }
@@ -28,6 +28,11 @@ public:
 
     void apply_control_messages(Vector<ControlMessage>);
 
+    // Renders the branches of the graph that share no nodes on the thread pool, in parallel, before the destination
+    // mixes them. This is only worth it for the offline renderer, as the realtime renderer can't wait on other threads
+    // in its audio callback.
+    void set_renders_branches_in_parallel(bool);
+
     void render_quantum(RenderContext const&);
     AudioBus const* pull_output(NodeID source, size_t output_index, RenderContext const&);
 
@@ -41,11 +46,19 @@ public:
 
 private:
     void rebuild_incoming_connections();
+    void rebuild_branch_groups();
+    void render_branch_groups(RenderContext const&);
+    void render_branch_group(Vector<NodeID> const&, RenderContext const&);
 
     HashMap<NodeID, NonnullOwnPtr<RenderNode>> m_nodes;
     NodeID m_destination_id { 0 };
     u64 m_current_quantum { 0 };
     bool m_incoming_connections_dirty { false };
+
+    // The nodes that each thread pulls, in order. Each group holds whole branches, so no node is pulled by more than one
+    // thread.
+    bool m_renders_branches_in_parallel { false };
+    Vector<Vector<NodeID>> m_branch_groups;
 };
 
 }
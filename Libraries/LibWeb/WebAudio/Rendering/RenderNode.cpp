@@ -4,9 +4,9 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
-#include <AK/Math.h>
 #include <LibWeb/WebAudio/Rendering/RenderGraph.h>
 #include <LibWeb/WebAudio/Rendering/RenderNode.h>
+#include <LibWeb/WebAudio/Rendering/VectorMath.h>
 
 namespace Web::WebAudio::Rendering {
 
@@ -53,18 +53,10 @@ void RenderAudioParam::compute(RenderGraph& graph, RenderContext const& context,
         m_input_scratch->sum_from(*bus, Bindings::ChannelInterpretation::Speakers);
 
         auto input_samples = m_input_scratch->channel(0);
-        if (rate == Bindings::AutomationRate::KRate) {
-            for (auto& value : output)
-                value += input_samples[0];
-        } else {
-            for (size_t frame = 0; frame < output.size(); ++frame)
-                output[frame] += input_samples[frame];
-        }
-    }
-    auto default_value = m_timeline->default_value();
-    for (auto& value : output) {
-        if (isnan(value))
-            value = default_value;
+        if (rate == Bindings::AutomationRate::KRate)
+            VectorMath::add(input_samples[0], output);
+        else
+            VectorMath::add(input_samples, output);
     }
 
     // 4. If this AudioParam is a compound parameter, compute its final value with other AudioParams.
@@ -72,10 +64,10 @@ void RenderAudioParam::compute(RenderGraph& graph, RenderContext const& context,
 
     // 5. Set computedValue to paramComputedValue.
 
-    // NB: The computedValue is clamped to the simple nominal range for this parameter.
+    // NB: The computedValue is clamped to the simple nominal range for this parameter. The NaN replacement of step 3
+    //     is done in the same pass.
     // https://webaudio.github.io/web-audio-api/#simple-nominal-range
-    for (auto& value : output)
-        value = clamp(value, m_min_value, m_max_value);
+    VectorMath::replace_nan_and_clamp(output, m_timeline->default_value(), m_min_value, m_max_value);
 }
 
 RenderNode::RenderNode(NodeID node_id, size_t input_count, size_t output_count, size_t quantum_size, size_t output_channel_count)
@@ -112,6 +112,10 @@ public:
     virtual void handle_message(NodeMessage const&) { }
     virtual void for_each_param(Function<void(RenderAudioParam&)> const&) { }
 
+    // Params this node reads that belong to the context rather than to the node, like the AudioListener's. They are
+    // shared with other nodes, so RenderGraph renders all nodes that read the same one on the same thread.
+    virtual void for_each_shared_param(Function<void(RenderAudioParam&)> const&) { }
+
     // Returns true exactly once after this node has stopped playing, so the main thread can fire an ended event.
     virtual bool take_ended_notification() { return false; }
 
@@ -4,11 +4,13 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/AllOf.h>
 #include <AK/Array.h>
 #include <AK/Math.h>
 #include <LibGfx/Vector3.h>
 #include <LibWeb/WebAudio/Rendering/RenderGraph.h>
 #include <LibWeb/WebAudio/Rendering/RenderNodes.h>
+#include <LibWeb/WebAudio/Rendering/VectorMath.h>
 
 namespace Web::WebAudio::Rendering {
 
@@ -67,12 +69,8 @@ void GainRenderNode::process(RenderGraph& graph, RenderContext const& context)
 
     m_gain->compute(graph, context, m_gain_values);
 
-    for (size_t channel_index = 0; channel_index < input.channel_count(); ++channel_index) {
-        auto input_samples = input.channel(channel_index);
-        auto output_samples = gain_output.channel(channel_index);
-        for (size_t frame = 0; frame < context.quantum_size; ++frame)
-            output_samples[frame] = input_samples[frame] * m_gain_values[frame];
-    }
+    for (size_t channel_index = 0; channel_index < input.channel_count(); ++channel_index)
+        VectorMath::multiply(input.channel(channel_index), m_gain_values, gain_output.channel(channel_index));
 }
 
 // https://webaudio.github.io/web-audio-api/#dom-audioscheduledsourcenode-start
@@ -406,26 +404,39 @@ void DelayRenderNode::process(RenderGraph& graph, RenderContext const& context)
     auto& delay_output = output(0);
     delay_output.set_channel_count(input.channel_count());
 
+    // NB: The read positions only depend on the delay time, so they are computed once for all channels.
+    m_read_indices.resize(context.quantum_size);
+    m_read_fractions.resize(context.quantum_size);
+    auto write_index = m_write_index;
     for (size_t frame = 0; frame < context.quantum_size; ++frame) {
         auto delay_seconds = clamp(static_cast<double>(m_delay_values[frame]), 0., m_max_delay_time);
         auto delay_frames = delay_seconds * context.sample_rate;
 
-        for (size_t channel_index = 0; channel_index < input.channel_count(); ++channel_index) {
-            auto& channel_history = m_history[channel_index];
-            channel_history[m_write_index] = input.channel(channel_index)[frame];
-
-            // Read with linear interpolation to support fractional delays.
-            auto read_position = static_cast<double>(m_write_index) - delay_frames;
-            while (read_position < 0)
-                read_position += history_length;
-            auto read_index = static_cast<size_t>(read_position);
-            auto fraction = static_cast<float>(read_position - read_index);
-            auto sample_a = channel_history[read_index % history_length];
-            auto sample_b = channel_history[(read_index + 1) % history_length];
-            delay_output.channel(channel_index)[frame] = sample_a + fraction * (sample_b - sample_a);
+        // Read with linear interpolation to support fractional delays.
+        auto read_position = static_cast<double>(write_index) - delay_frames;
+        while (read_position < 0)
+            read_position += history_length;
+        auto read_index = static_cast<size_t>(read_position);
+        m_read_indices[frame] = read_index % history_length;
+        m_read_fractions[frame] = static_cast<float>(read_position - read_index);
+        write_index = (write_index + 1) % history_length;
+    }
+
+    for (size_t channel_index = 0; channel_index < input.channel_count(); ++channel_index) {
+        auto& channel_history = m_history[channel_index];
+        auto input_samples = input.channel(channel_index);
+        auto output_samples = delay_output.channel(channel_index);
+        write_index = m_write_index;
+        for (size_t frame = 0; frame < context.quantum_size; ++frame) {
+            channel_history[write_index] = input_samples[frame];
+            auto read_index = m_read_indices[frame];
+            auto sample_a = channel_history[read_index];
+            auto sample_b = channel_history[read_index + 1 == history_length ? 0 : read_index + 1];
+            output_samples[frame] = sample_a + m_read_fractions[frame] * (sample_b - sample_a);
+            write_index = write_index + 1 == history_length ? 0 : write_index + 1;
         }
-        m_write_index = (m_write_index + 1) % history_length;
     }
+    m_write_index = write_index;
 }
 
 StereoPannerRenderNode::StereoPannerRenderNode(NodeID node_id, size_t quantum_size, NonnullRefPtr<RenderAudioParam> pan)
@@ -450,7 +461,11 @@ void StereoPannerRenderNode::process(RenderGraph& graph, RenderContext const& co
     auto input_left = input.channel(0);
     auto input_right = input.channel_count() > 1 ? input.channel(1) : input.channel(0);
 
-    for (size_t frame = 0; frame < context.quantum_size; ++frame) {
+    struct FrameGains {
+        float pan { 0 };
+        PanGains gains;
+    };
+    auto compute_gains = [&](size_t frame) -> FrameGains {
         // Let pan be the computedValue of the pan AudioParam of this StereoPannerNode.
         // Clamp pan to [-1, 1].
         auto pan = clamp(m_pan_values[frame], -1.f, 1.f);
@@ -463,7 +478,31 @@ void StereoPannerRenderNode::process(RenderGraph& graph, RenderContext const& co
             x = pan <= 0 ? pan + 1. : pan;
 
         // Left and right gain values are calculated as: gainL = cos(x * π / 2); gainR = sin(x * π / 2);
-        auto [gain_left, gain_right] = equal_power_pan_gains(x);
+        return { pan, equal_power_pan_gains(x) };
+    };
+
+    // NB: Without pan automation, the gains are the same for every frame, so the quantum is processed one channel at
+    //     a time rather than one frame at a time.
+    if (VectorMath::is_constant(m_pan_values)) {
+        auto [pan, gains] = compute_gains(0);
+        if (input.channel_count() == 1) {
+            VectorMath::multiply(input_left, gains.left, output_left);
+            VectorMath::multiply(input_left, gains.right, output_right);
+        } else if (pan <= 0) {
+            input_left.copy_to(output_left);
+            VectorMath::multiply_add(input_right, gains.left, output_left);
+            VectorMath::multiply(input_right, gains.right, output_right);
+        } else {
+            VectorMath::multiply(input_left, gains.left, output_left);
+            input_right.copy_to(output_right);
+            VectorMath::multiply_add(input_left, gains.right, output_right);
+        }
+        return;
+    }
+
+    for (size_t frame = 0; frame < context.quantum_size; ++frame) {
+        auto [pan, gains] = compute_gains(frame);
+        auto [gain_left, gain_right] = gains;
 
         // For mono input, the stereo output is calculated as: outputL = input * gainL; outputR = input * gainR;
         // NB: For stereo input, the attenuated channel is mixed into the opposite output channel instead.
@@ -494,9 +533,7 @@ void ChannelSplitterRenderNode::process(RenderGraph& graph, RenderContext const&
     for (size_t output_index = 0; output_index < output_count(); ++output_index) {
         auto output_samples = output(output_index).channel(0);
         if (output_index < input.channel_count()) {
-            auto input_samples = input.channel(output_index);
-            for (size_t frame = 0; frame < context.quantum_size; ++frame)
-                output_samples[frame] = input_samples[frame];
+            input.channel(output_index).copy_to(output_samples);
         } else {
             output_samples.fill(0.f);
         }
@@ -516,10 +553,7 @@ void ChannelMergerRenderNode::process(RenderGraph& graph, RenderContext const& c
     merger_output.set_channel_count(input_count());
     for (size_t input_index = 0; input_index < input_count(); ++input_index) {
         auto const& input = pull_input(graph, context, input_index);
-        auto input_samples = input.channel(0);
-        auto output_samples = merger_output.channel(input_index);
-        for (size_t frame = 0; frame < context.quantum_size; ++frame)
-            output_samples[frame] = input_samples[frame];
+        input.channel(0).copy_to(merger_output.channel(input_index));
     }
 }
 
@@ -573,22 +607,20 @@ void BiquadFilterRenderNode::process(RenderGraph& graph, RenderContext const& co
     // AD-HOC: The coefficients are recomputed whenever the computed parameter values change, so a-rate automation is
     //         applied with per-frame resolution while k-rate parameters use a single set of coefficients for the
     //         entire quantum.
-    auto coefficients = compute_coefficients_for_frame(0);
-    for (size_t frame = 0; frame < context.quantum_size; ++frame) {
-        if (frame > 0 && parameters_changed(frame))
-            coefficients = compute_coefficients_for_frame(frame);
-        for (size_t channel_index = 0; channel_index < input.channel_count(); ++channel_index) {
-            auto& state = m_filter_states[channel_index];
-            double x = input.channel(channel_index)[frame];
-            auto y = coefficients.b0 * x + coefficients.b1 * state.x1 + coefficients.b2 * state.x2
-                - coefficients.a1 * state.y1 - coefficients.a2 * state.y2;
-            state.x2 = state.x1;
-            state.x1 = x;
-            state.y2 = state.y1;
-            state.y1 = y;
-            filter_output.channel(channel_index)[frame] = static_cast<float>(y);
-        }
+    m_coefficients.resize(context.quantum_size);
+    m_coefficients[0] = compute_coefficients_for_frame(0);
+    for (size_t frame = 1; frame < context.quantum_size; ++frame)
+        m_coefficients[frame] = parameters_changed(frame) ? compute_coefficients_for_frame(frame) : m_coefficients[frame - 1];
+
+    // NB: Channels are filtered in pairs, which covers stereo input in a single pass.
+    size_t channel_index = 0;
+    for (; channel_index + 1 < input.channel_count(); channel_index += 2) {
+        biquad_filter(m_coefficients, input.channel(channel_index), input.channel(channel_index + 1),
+            filter_output.channel(channel_index), filter_output.channel(channel_index + 1),
+            m_filter_states[channel_index], m_filter_states[channel_index + 1]);
     }
+    if (channel_index < input.channel_count())
+        biquad_filter(m_coefficients, input.channel(channel_index), filter_output.channel(channel_index), m_filter_states[channel_index]);
 }
 
 namespace {
@@ -739,6 +771,19 @@ void PannerRenderNode::for_each_param(Function<void(RenderAudioParam&)> const& c
     callback(*m_params.orientation_z);
 }
 
+void PannerRenderNode::for_each_shared_param(Function<void(RenderAudioParam&)> const& callback)
+{
+    callback(*m_listener_params.position_x);
+    callback(*m_listener_params.position_y);
+    callback(*m_listener_params.position_z);
+    callback(*m_listener_params.forward_x);
+    callback(*m_listener_params.forward_y);
+    callback(*m_listener_params.forward_z);
+    callback(*m_listener_params.up_x);
+    callback(*m_listener_params.up_y);
+    callback(*m_listener_params.up_z);
+}
+
 // https://webaudio.github.io/web-audio-api/#Spatialization
 void PannerRenderNode::process(RenderGraph& graph, RenderContext const& context)
 {
@@ -765,7 +810,12 @@ void PannerRenderNode::process(RenderGraph& graph, RenderContext const& context)
     auto input_left = input.channel(0);
     auto input_right = input.channel_count() > 1 ? input.channel(1) : input.channel(0);
 
-    for (size_t frame = 0; frame < context.quantum_size; ++frame) {
+    struct FrameGains {
+        double azimuth { 0 };
+        PanGains pan_gains;
+        float gain { 0 };
+    };
+    auto compute_gains = [&](size_t frame) -> FrameGains {
         Gfx::DoubleVector3 source_position { m_param_values[0][frame], m_param_values[1][frame], m_param_values[2][frame] };
         Gfx::DoubleVector3 source_orientation { m_param_values[3][frame], m_param_values[4][frame], m_param_values[5][frame] };
         Gfx::DoubleVector3 listener_position { m_param_values[6][frame], m_param_values[7][frame], m_param_values[8][frame] };
@@ -790,7 +840,33 @@ void PannerRenderNode::process(RenderGraph& graph, RenderContext const& context)
         else
             x = azimuth <= 0 ? (azimuth + 90) / 90 : azimuth / 90;
 
-        auto [gain_left, gain_right] = equal_power_pan_gains(x);
+        return { azimuth, equal_power_pan_gains(x), gain };
+    };
+
+    // NB: Without automation of the panner or listener, the gains are the same for every frame, so the quantum is
+    //     processed one channel at a time rather than one frame at a time.
+    if (all_of(m_param_values, [](auto const& values) { return VectorMath::is_constant(values); })) {
+        auto [azimuth, pan_gains, gain] = compute_gains(0);
+        if (input.channel_count() == 1) {
+            VectorMath::multiply(input_left, pan_gains.left, output_left);
+            VectorMath::multiply(input_left, pan_gains.right, output_right);
+        } else if (azimuth <= 0) {
+            input_left.copy_to(output_left);
+            VectorMath::multiply_add(input_right, pan_gains.left, output_left);
+            VectorMath::multiply(input_right, pan_gains.right, output_right);
+        } else {
+            VectorMath::multiply(input_left, pan_gains.left, output_left);
+            input_right.copy_to(output_right);
+            VectorMath::multiply_add(input_left, pan_gains.right, output_right);
+        }
+        VectorMath::multiply(output_left, gain, output_left);
+        VectorMath::multiply(output_right, gain, output_right);
+        return;
+    }
+
+    for (size_t frame = 0; frame < context.quantum_size; ++frame) {
+        auto [azimuth, pan_gains, gain] = compute_gains(frame);
+        auto [gain_left, gain_right] = pan_gains;
 
         if (input.channel_count() == 1) {
             output_left[frame] = input_left[frame] * gain_left * gain;
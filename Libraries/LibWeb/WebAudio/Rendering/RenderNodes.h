@@ -165,6 +165,8 @@ private:
     double m_max_delay_time { 0 };
     Vector<Vector<float>> m_history;
     size_t m_write_index { 0 };
+    Vector<size_t> m_read_indices;
+    Vector<float> m_read_fractions;
 };
 
 // https://webaudio.github.io/web-audio-api/#StereoPannerNode
@@ -212,13 +214,6 @@ public:
     }
 
 private:
-    struct FilterState {
-        double x1 { 0 };
-        double x2 { 0 };
-        double y1 { 0 };
-        double y2 { 0 };
-    };
-
     NonnullRefPtr<RenderAudioParam> m_frequency;
     NonnullRefPtr<RenderAudioParam> m_detune;
     NonnullRefPtr<RenderAudioParam> m_q;
@@ -228,7 +223,8 @@ private:
     Vector<float> m_q_values;
     Vector<float> m_gain_values;
     Bindings::BiquadFilterType m_type { Bindings::BiquadFilterType::Lowpass };
-    Vector<FilterState> m_filter_states;
+    Vector<BiquadCoefficients> m_coefficients;
+    Vector<BiquadFilterState> m_filter_states;
 };
 
 // https://webaudio.github.io/web-audio-api/#PannerNode
@@ -259,6 +255,7 @@ public:
     virtual void process(RenderGraph&, RenderContext const&) override;
     virtual void handle_message(NodeMessage const&) override;
     virtual void for_each_param(Function<void(RenderAudioParam&)> const& callback) override;
+    virtual void for_each_shared_param(Function<void(RenderAudioParam&)> const& callback) override;
 
 private:
     Params m_params;
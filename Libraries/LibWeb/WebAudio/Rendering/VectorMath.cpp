@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Math.h>
+#include <AK/SIMDExtras.h>
+#include <LibWeb/WebAudio/Rendering/VectorMath.h>
+
+namespace Web::WebAudio::Rendering::VectorMath {
+
+using AK::SIMD::f32x4;
+using AK::SIMD::i32x4;
+
+static constexpr size_t LANE_COUNT = AK::SIMD::vector_length<f32x4>;
+
+ALWAYS_INLINE static f32x4 load(float const* values)
+{
+    return AK::SIMD::load_unaligned<f32x4>(values);
+}
+
+ALWAYS_INLINE static void store(float* values, f32x4 vector)
+{
+    AK::SIMD::store_unaligned(values, vector);
+}
+
+ALWAYS_INLINE static f32x4 select(i32x4 mask, f32x4 if_true, f32x4 if_false)
+{
+    return bit_cast<f32x4>((mask & bit_cast<i32x4>(if_true)) | (~mask & bit_cast<i32x4>(if_false)));
+}
+
+void multiply(ReadonlySpan<float> source, ReadonlySpan<float> gains, Span<float> destination)
+{
+    VERIFY(source.size() == destination.size() && gains.size() == destination.size());
+
+    size_t index = 0;
+    for (; index + LANE_COUNT <= destination.size(); index += LANE_COUNT)
+        store(&destination[index], load(&source[index]) * load(&gains[index]));
+    for (; index < destination.size(); ++index)
+        destination[index] = source[index] * gains[index];
+}
+
+void multiply(ReadonlySpan<float> source, float gain, Span<float> destination)
+{
+    VERIFY(source.size() == destination.size());
+
+    auto gain_vector = AK::SIMD::expand4(gain);
+    size_t index = 0;
+    for (; index + LANE_COUNT <= destination.size(); index += LANE_COUNT)
+        store(&destination[index], load(&source[index]) * gain_vector);
+    for (; index < destination.size(); ++index)
+        destination[index] = source[index] * gain;
+}
+
+void multiply_add(ReadonlySpan<float> source, float gain, Span<float> destination)
+{
+    VERIFY(source.size() == destination.size());
+
+    // NB: A gain of 1 is the common case when mixing connections, and skips the multiplication without changing the
+    //     result.
+    if (gain == 1.f) {
+        add(source, destination);
+        return;
+    }
+
+    auto gain_vector = AK::SIMD::expand4(gain);
+    size_t index = 0;
+    for (; index + LANE_COUNT <= destination.size(); index += LANE_COUNT)
+        store(&destination[index], load(&destination[index]) + load(&source[index]) * gain_vector);
+    for (; index < destination.size(); ++index)
+        destination[index] += source[index] * gain;
+}
+
+void add(ReadonlySpan<float> source, Span<float> destination)
+{
+    VERIFY(source.size() == destination.size());
+
+    size_t index = 0;
+    for (; index + LANE_COUNT <= destination.size(); index += LANE_COUNT)
+        store(&destination[index], load(&destination[index]) + load(&source[index]));
+    for (; index < destination.size(); ++index)
+        destination[index] += source[index];
+}
+
+void add(float value, Span<float> destination)
+{
+    auto value_vector = AK::SIMD::expand4(value);
+    size_t index = 0;
+    for (; index + LANE_COUNT <= destination.size(); index += LANE_COUNT)
+        store(&destination[index], load(&destination[index]) + value_vector);
+    for (; index < destination.size(); ++index)
+        destination[index] += value;
+}
+
+void replace_nan_and_clamp(Span<float> values, float nan_replacement, float min, float max)
+{
+    VERIFY(max >= min);
+
+    auto nan_replacement_vector = AK::SIMD::expand4(nan_replacement);
+    auto min_vector = AK::SIMD::expand4(min);
+    auto max_vector = AK::SIMD::expand4(max);
+    size_t index = 0;
+    for (; index + LANE_COUNT <= values.size(); index += LANE_COUNT) {
+        auto vector = load(&values[index]);
+        vector = select(vector != vector, nan_replacement_vector, vector);
+        vector = select(vector > max_vector, max_vector, vector);
+        vector = select(vector < min_vector, min_vector, vector);
+        store(&values[index], vector);
+    }
+    for (; index < values.size(); ++index) {
+        auto value = values[index];
+        if (isnan(value))
+            value = nan_replacement;
+        values[index] = clamp(value, min, max);
+    }
+}
+
+bool is_silent(ReadonlySpan<float> values)
+{
+    auto zero_vector = AK::SIMD::expand4(0.f);
+    size_t index = 0;
+    for (; index + LANE_COUNT <= values.size(); index += LANE_COUNT) {
+        if (AK::SIMD::any(load(&values[index]) != zero_vector))
+            return false;
+    }
+    for (; index < values.size(); ++index) {
+        if (values[index] != 0.f)
+            return false;
+    }
+    return true;
+}
+
+bool is_constant(ReadonlySpan<float> values)
+{
+    if (values.is_empty())
+        return true;
+
+    auto first_value = values[0];
+    auto first_value_vector = AK::SIMD::expand4(first_value);
+    size_t index = 0;
+    for (; index + LANE_COUNT <= values.size(); index += LANE_COUNT) {
+        if (!AK::SIMD::all(load(&values[index]) == first_value_vector))
+            return false;
+    }
+    for (; index < values.size(); ++index) {
+        if (values[index] != first_value)
+            return false;
+    }
+    return true;
+}
+
+}
@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Span.h>
+#include <LibWeb/Export.h>
+
+// Kernels for the per-sample loops of the render graph, processing four samples at a time. Each kernel performs the
+// same floating-point operations in the same order as the equivalent scalar loop, so its results are bit-identical.
+// Destinations may alias sources, but spans must otherwise not overlap.
+namespace Web::WebAudio::Rendering::VectorMath {
+
+// destination[i] = source[i] * gains[i]
+WEB_API void multiply(ReadonlySpan<float> source, ReadonlySpan<float> gains, Span<float> destination);
+
+// destination[i] = source[i] * gain
+WEB_API void multiply(ReadonlySpan<float> source, float gain, Span<float> destination);
+
+// destination[i] += source[i] * gain
+WEB_API void multiply_add(ReadonlySpan<float> source, float gain, Span<float> destination);
+
+// destination[i] += source[i]
+WEB_API void add(ReadonlySpan<float> source, Span<float> destination);
+
+// destination[i] += value
+WEB_API void add(float value, Span<float> destination);
+
+// Replaces NaN values with nan_replacement, then clamps all values to [min, max].
+WEB_API void replace_nan_and_clamp(Span<float> values, float nan_replacement, float min, float max);
+
+WEB_API bool is_silent(ReadonlySpan<float>);
+
+// Returns whether all values are equal to the first one, which lets nodes with a-rate parameters that are not being
+// automated take the same path as for k-rate parameters.
+WEB_API bool is_constant(ReadonlySpan<float>);
+
+}
@@ -292,6 +292,7 @@ ErrorOr<void> Application::initialize(Main::Arguments const& arguments)
     bool disable_sandbox = false;
     Vector<StringView> content_blocker_list_paths;
     Optional<StringView> resource_substitution_map_path;
+    Optional<size_t> network_thread_count;
     bool enable_autoplay = false;
     bool expose_experimental_interfaces = false;
     bool expose_internals_object = false;
@@ -409,6 +410,7 @@ ErrorOr<void> Application::initialize(Main::Arguments const& arguments)
     args_parser.add_option(validate_dnssec_locally, "Validate DNSSEC locally", "dnssec");
     args_parser.add_option(default_time_zone, "Default time zone", "default-time-zone", 0, "time-zone-id");
     args_parser.add_option(resource_substitution_map_path, "Path to JSON file mapping URLs to local files", "resource-map", 0, "path");
+    args_parser.add_option(network_thread_count, "Number of threads RequestServer runs network transfers on", "network-threads", 0, "count");
     args_parser.add_option(Core::ArgsParser::Option {
         .argument_mode = Core::ArgsParser::OptionArgumentMode::Optional,
         .help_string = "Enable the Firefox DevTools server, with an optional port",
@@ -596,6 +598,7 @@ ErrorOr<void> Application::initialize(Main::Arguments const& arguments)
         .cache_path = profile().paths().cache,
         .http_disk_cache_mode = http_disk_cache_mode,
         .resource_substitution_map_path = resource_substitution_map_path.has_value() ? Optional<ByteString> { *resource_substitution_map_path } : OptionalNone {},
+        .network_thread_count = network_thread_count,
     };
 
     m_web_content_options = {
@@ -66,6 +66,7 @@ void CompositorConnection::stop_presenting_to_client(Web::Compositor::Compositor
 
 void CompositorConnection::destroy_context(Web::Compositor::CompositorContextId context_id)
 {
+    m_last_sent_display_lists.remove(context_id);
     if (!can_send_message_to_compositor())
         return;
     async_destroy_context(context_id);
@@ -92,7 +93,14 @@ void CompositorConnection::update_display_list(Web::Compositor::CompositorContex
         }
     }
 
-    auto encoded_message = MUST(Messages::CompositorWebContentServer::UpdateDisplayList::static_encode(context_id, display_list, visual_context_tree, resource_transaction, scroll_state_snapshot));
+    Optional<Web::Painting::DisplayListDelta> display_list_delta;
+    if (auto last_sent_display_list = m_last_sent_display_lists.get(context_id); last_sent_display_list.has_value())
+        display_list_delta = display_list->delta_from(*last_sent_display_list.value());
+    m_last_sent_display_lists.set(context_id, display_list);
+
+    auto encoded_message = display_list_delta.has_value()
+        ? MUST(Messages::CompositorWebContentServer::UpdateDisplayListFromDelta::static_encode(context_id, *display_list_delta, visual_context_tree, resource_transaction, scroll_state_snapshot))
+        : MUST(Messages::CompositorWebContentServer::UpdateDisplayList::static_encode(context_id, display_list, visual_context_tree, resource_transaction, scroll_state_snapshot));
     if (post_message(encoded_message).is_error())
         did_lose_compositor();
 }
@@ -394,6 +402,7 @@ void CompositorConnection::did_lose_compositor()
             entry.value.callback();
     }
     m_screenshots.clear();
+    m_last_sent_display_lists.clear();
 
     if (on_compositor_lost)
         on_compositor_lost();
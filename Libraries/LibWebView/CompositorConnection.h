@@ -96,6 +96,10 @@ private:
     Optional<PendingScreenshot> take_screenshot(Web::Compositor::ScreenshotRequestId);
 
     HashMap<Web::Compositor::ScreenshotRequestId, PendingScreenshot> m_screenshots;
+
+    // The last display list sent for each context. Most frames only change a few of its commands, so the next display
+    // list is sent as a delta from it when possible.
+    HashMap<Web::Compositor::CompositorContextId, NonnullRefPtr<Web::Painting::DisplayList>> m_last_sent_display_lists;
     u64 m_next_screenshot_request_id { 1 };
     bool m_has_lost_compositor { false };
     RefPtr<Media::VideoPresentationServerConnection> m_video_presentation_channel;
@@ -288,6 +288,8 @@ ErrorOr<NonnullRefPtr<Requests::RequestClient>> launch_request_server_process()
 
     if (request_server_options.resource_substitution_map_path.has_value())
         arguments.append(ByteString::formatted("--resource-map={}", *request_server_options.resource_substitution_map_path));
+    if (request_server_options.network_thread_count.has_value())
+        arguments.append(ByteString::formatted("--network-threads={}", *request_server_options.network_thread_count));
 
     auto client = TRY(launch_server_process<Requests::RequestClient>("RequestServer"sv, move(arguments)));
 
@@ -108,6 +108,7 @@ struct RequestServerOptions {
     ByteString cache_path;
     HTTPDiskCacheMode http_disk_cache_mode { HTTPDiskCacheMode::Disabled };
     Optional<ByteString> resource_substitution_map_path;
+    Optional<size_t> network_thread_count;
 };
 
 enum class IsTestMode {
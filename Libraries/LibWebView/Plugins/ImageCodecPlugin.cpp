@@ -41,7 +41,24 @@ void ImageCodecPlugin::setup_client_callbacks()
 
 ImageCodecPlugin::~ImageCodecPlugin() = default;
 
-NonnullRefPtr<Core::Promise<Web::Platform::DecodedImage>> ImageCodecPlugin::decode_image(ReadonlyBytes bytes, Function<ErrorOr<void>(Web::Platform::DecodedImage&)> on_resolved, Function<void(Error&)> on_rejected)
+static Web::Platform::DecodedImage to_platform_decoded_image(ImageDecoderClient::DecodedImage& result)
+{
+    // FIXME: Remove this codec plugin and just use the ImageDecoderClient directly to avoid these copies
+    Web::Platform::DecodedImage decoded_image;
+    decoded_image.is_animated = result.is_animated;
+    decoded_image.natural_size = result.natural_size;
+    decoded_image.loop_count = result.loop_count;
+    decoded_image.frame_count = result.frame_count;
+    decoded_image.session_id = result.session_id;
+    decoded_image.all_durations = move(result.all_durations);
+    for (auto& frame : result.frames) {
+        decoded_image.frames.empend(move(frame.bitmap), frame.duration);
+    }
+    decoded_image.color_space = move(result.color_space);
+    return decoded_image;
+}
+
+NonnullRefPtr<Core::Promise<Web::Platform::DecodedImage>> ImageCodecPlugin::decode_image(ReadonlyBytes bytes, Function<ErrorOr<void>(Web::Platform::DecodedImage&)> on_resolved, Function<void(Error&)> on_rejected, Optional<Gfx::IntSize> ideal_size, Optional<String> cache_partition)
 {
     auto promise = Core::Promise<Web::Platform::DecodedImage>::construct();
     if (on_resolved)
@@ -57,27 +74,72 @@ NonnullRefPtr<Core::Promise<Web::Platform::DecodedImage>> ImageCodecPlugin::deco
     auto image_decoder_promise = m_client->decode_image(
         bytes,
         [promise](ImageDecoderClient::DecodedImage& result) -> ErrorOr<void> {
-            // FIXME: Remove this codec plugin and just use the ImageDecoderClient directly to avoid these copies
-            Web::Platform::DecodedImage decoded_image;
-            decoded_image.is_animated = result.is_animated;
-            decoded_image.loop_count = result.loop_count;
-            decoded_image.frame_count = result.frame_count;
-            decoded_image.session_id = result.session_id;
-            decoded_image.all_durations = move(result.all_durations);
-            for (auto& frame : result.frames) {
-                decoded_image.frames.empend(move(frame.bitmap), frame.duration);
-            }
-            decoded_image.color_space = move(result.color_space);
-            promise->resolve(move(decoded_image));
+            promise->resolve(to_platform_decoded_image(result));
             return {};
         },
         [promise](auto& error) {
             promise->reject(Error::copy(error));
-        });
+        },
+        ideal_size, {}, move(cache_partition));
 
     return promise;
 }
 
+ErrorOr<Web::Platform::DecodedImage> ImageCodecPlugin::decode_image_at_natural_size(ReadonlyBytes bytes, Optional<String> cache_partition)
+{
+    if (!m_client)
+        return Error::from_string_literal("ImageDecoderClient is disconnected");
+
+    auto result = TRY(m_client->decode_image_at_natural_size(bytes, {}, move(cache_partition)));
+    return to_platform_decoded_image(result);
+}
+
+i64 ImageCodecPlugin::begin_incremental_decode(Function<void(Web::Platform::PartiallyDecodedImage&)> on_partially_decoded, Function<ErrorOr<void>(Web::Platform::DecodedImage&)> on_resolved, Function<void(Error&)> on_rejected, Optional<Gfx::IntSize> ideal_size, Optional<String> cache_partition)
+{
+    if (!m_client) {
+        auto error = Error::from_string_literal("ImageDecoderClient is disconnected");
+        if (on_rejected)
+            on_rejected(error);
+        return -1;
+    }
+
+    return m_client->begin_incremental_decode(
+        [on_partially_decoded = move(on_partially_decoded)](NonnullRefPtr<Gfx::Bitmap> bitmap, Gfx::IntSize natural_size, Gfx::ColorSpace color_space) {
+            Web::Platform::PartiallyDecodedImage partially_decoded_image { move(bitmap), natural_size, move(color_space) };
+            if (on_partially_decoded)
+                on_partially_decoded(partially_decoded_image);
+        },
+        [on_resolved = move(on_resolved)](ImageDecoderClient::DecodedImage& result) -> ErrorOr<void> {
+            auto decoded_image = to_platform_decoded_image(result);
+            if (on_resolved)
+                return on_resolved(decoded_image);
+            return {};
+        },
+        [on_rejected = move(on_rejected)](Error& error) {
+            if (on_rejected)
+                on_rejected(error);
+        },
+        ideal_size, {}, move(cache_partition));
+}
+
+void ImageCodecPlugin::append_incremental_decode_data(i64 request_id, ReadonlyBytes bytes)
+{
+    if (m_client)
+        m_client->append_incremental_decode_data(request_id, bytes);
+}
+
+void ImageCodecPlugin::finish_incremental_decode(i64 request_id)
+{
+    if (m_client)
+        m_client->finish_incremental_decode(request_id);
+}
+
+void ImageCodecPlugin::cancel_incremental_decode(i64 request_id)
+{
+    if (m_client)
+        m_client->cancel_incremental_decode(request_id);
+}
+
 void ImageCodecPlugin::request_animation_frames(i64 session_id, u32 start_frame_index, u32 count)
 {
     if (m_client)
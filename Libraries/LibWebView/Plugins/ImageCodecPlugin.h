@@ -18,7 +18,13 @@ public:
     explicit ImageCodecPlugin(NonnullRefPtr<ImageDecoderClient::Client>);
     virtual ~ImageCodecPlugin() override;
 
-    virtual NonnullRefPtr<Core::Promise<Web::Platform::DecodedImage>> decode_image(ReadonlyBytes, Function<ErrorOr<void>(Web::Platform::DecodedImage&)> on_resolved, Function<void(Error&)> on_rejected) override;
+    virtual NonnullRefPtr<Core::Promise<Web::Platform::DecodedImage>> decode_image(ReadonlyBytes, Function<ErrorOr<void>(Web::Platform::DecodedImage&)> on_resolved, Function<void(Error&)> on_rejected, Optional<Gfx::IntSize> ideal_size, Optional<String> cache_partition) override;
+    virtual ErrorOr<Web::Platform::DecodedImage> decode_image_at_natural_size(ReadonlyBytes, Optional<String> cache_partition) override;
+
+    virtual i64 begin_incremental_decode(Function<void(Web::Platform::PartiallyDecodedImage&)> on_partially_decoded, Function<ErrorOr<void>(Web::Platform::DecodedImage&)> on_resolved, Function<void(Error&)> on_rejected, Optional<Gfx::IntSize> ideal_size, Optional<String> cache_partition) override;
+    virtual void append_incremental_decode_data(i64 request_id, ReadonlyBytes) override;
+    virtual void finish_incremental_decode(i64 request_id) override;
+    virtual void cancel_incremental_decode(i64 request_id) override;
 
     virtual void request_animation_frames(i64 session_id, u32 start_frame_index, u32 count) override;
     virtual void stop_animation_decode(i64 session_id) override;
@@ -128,6 +128,7 @@ void ConnectionFromWebContent::stop_presenting_to_client(Web::Compositor::Compos
 
 void ConnectionFromWebContent::destroy_context(Web::Compositor::CompositorContextId context_id)
 {
+    m_last_display_lists.remove(context_id);
     if (!context_is_owned_by_this_connection(context_id))
         return;
     m_compositor_state->destroy_context(context_id);
@@ -135,11 +136,30 @@ void ConnectionFromWebContent::destroy_context(Web::Compositor::CompositorContex
 
 void ConnectionFromWebContent::update_display_list(Web::Compositor::CompositorContextId context_id, NonnullRefPtr<Web::Painting::DisplayList> display_list, Web::Painting::AccumulatedVisualContextTree visual_context_tree, Web::Painting::DisplayListResourceTransaction resource_transaction, Web::Painting::ScrollStateSnapshot scroll_state_snapshot)
 {
+    m_last_display_lists.set(context_id, display_list);
     if (!context_is_owned_by_this_connection(context_id))
         return;
     m_compositor_state->update_display_list(context_id, move(display_list), move(visual_context_tree), move(resource_transaction), move(scroll_state_snapshot));
 }
 
+void ConnectionFromWebContent::update_display_list_from_delta(Web::Compositor::CompositorContextId context_id, Web::Painting::DisplayListDelta display_list_delta, Web::Painting::AccumulatedVisualContextTree visual_context_tree, Web::Painting::DisplayListResourceTransaction resource_transaction, Web::Painting::ScrollStateSnapshot scroll_state_snapshot)
+{
+    auto base = m_last_display_lists.get(context_id);
+    if (!base.has_value()) {
+        did_misbehave("WebContent sent a display list delta without a display list to apply it to");
+        return;
+    }
+
+    auto display_list = Web::Painting::DisplayList::create_from_delta(*base.value(), move(display_list_delta));
+    if (display_list.is_error()) {
+        dbgln("Failed to apply display list delta: {}", display_list.error());
+        did_misbehave("WebContent sent an invalid display list delta");
+        return;
+    }
+
+    update_display_list(context_id, display_list.release_value(), move(visual_context_tree), move(resource_transaction), move(scroll_state_snapshot));
+}
+
 void ConnectionFromWebContent::update_image_frame_resources(Web::Compositor::CompositorContextId context_id, Vector<Web::Painting::DisplayListImageFrameResource> image_frames)
 {
     if (!context_is_owned_by_this_connection(context_id))
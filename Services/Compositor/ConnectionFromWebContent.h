@@ -7,6 +7,7 @@
 #pragma once
 
 #include <AK/Function.h>
+#include <AK/HashMap.h>
 #include <AK/Optional.h>
 #include <Compositor/CanvasHost.h>
 #include <Compositor/CompositorState.h>
@@ -46,6 +47,7 @@ private:
     virtual void stop_presenting_to_client(Web::Compositor::CompositorContextId) override;
     virtual void destroy_context(Web::Compositor::CompositorContextId) override;
     virtual void update_display_list(Web::Compositor::CompositorContextId, NonnullRefPtr<Web::Painting::DisplayList>, Web::Painting::AccumulatedVisualContextTree, Web::Painting::DisplayListResourceTransaction, Web::Painting::ScrollStateSnapshot) override;
+    virtual void update_display_list_from_delta(Web::Compositor::CompositorContextId, Web::Painting::DisplayListDelta, Web::Painting::AccumulatedVisualContextTree, Web::Painting::DisplayListResourceTransaction, Web::Painting::ScrollStateSnapshot) override;
     virtual void update_visual_context_tree(Web::Compositor::CompositorContextId, Web::Painting::AccumulatedVisualContextTree) override;
     virtual void update_scroll_state(Web::Compositor::CompositorContextId, Web::Painting::ScrollStateSnapshot) override;
     virtual void update_image_frame_resources(Web::Compositor::CompositorContextId, Vector<Web::Painting::DisplayListImageFrameResource>) override;
@@ -82,6 +84,10 @@ private:
     CanvasHost m_canvas_host;
     Function<void(ConnectionFromWebContent&)> m_on_death;
 
+    // The last display list WebContent sent for each context, which the next display list delta is based on. These are
+    // kept even for contexts that are unavailable, so that we stay in sync with what WebContent thinks we have.
+    HashMap<Web::Compositor::CompositorContextId, NonnullRefPtr<Web::Painting::DisplayList>> m_last_display_lists;
+
     // The presentation client end of this WebContent's video presentation channel (connect-only for now).
     RefPtr<Media::VideoPresentationClientConnection> m_video_presentation_connection;
 };
@@ -121,8 +121,8 @@ void ContextState::stop_presenting_to_client()
 
 void ContextState::did_stop_presenting_to_client_if_needed(bool was_presenting_to_client, bool will_present_to_client)
 {
-    (void)was_presenting_to_client;
-    (void)will_present_to_client;
+    if (was_presenting_to_client && !will_present_to_client)
+        m_raster_tile_pool.release_available_tiles();
 }
 
 void ContextState::set_parent_context(Optional<Web::Compositor::CompositorContextId> parent_context_id)
@@ -981,6 +981,7 @@ Web::Painting::AccumulatedVisualContextTree const& ContextState::visual_context_
 void ContextState::paint_current_display_list(Web::Painting::DisplayListPlayerSkia& display_list_player, Gfx::PaintingSurface& surface, CompositedContextResolver const* composited_context_resolver, Optional<Gfx::IntRect> damage_rect)
 {
     VERIFY(m_display_list);
+    m_raster_tile_pool.did_paint_frame();
     auto surface_clear_color = Gfx::to_skia_color(m_display_list->surface_clear_color().value_or(Gfx::Color::Transparent));
     auto paint_display_list = [&](Gfx::PaintingSurface& target_surface) {
         display_list_player.execute(
@@ -1024,6 +1025,16 @@ void ContextState::paint_current_display_list(Web::Painting::DisplayListPlayerSk
     auto save_count = canvas.save();
     if (damage_rect.has_value()) {
         canvas.clipIRect(SkIRect::MakeXYWH(damage_rect->x(), damage_rect->y(), damage_rect->width(), damage_rect->height()));
+
+        // Without a GPU, large damage is rasterized in tiles on the thread pool. Since only the damaged region is
+        // replayed, pixels outside of it are left alone.
+        auto clear_color = m_display_list->surface_clear_color().value_or(Gfx::Color::Transparent);
+        if (Web::Painting::DisplayListPlayerSkia::execute_tiled(*m_display_list, visual_context_tree_for_compositing(), m_display_list_resource_storage, m_scroll_state_snapshot, surface, *damage_rect, clear_color, m_raster_tile_pool)) {
+            m_viewport_scrollbar_controller.paint(surface, display_list_player, m_scroll_state_snapshot);
+            canvas.restoreToCount(save_count);
+            return;
+        }
+
         canvas.clear(surface_clear_color);
     }
     paint_display_list(surface);
@@ -27,6 +27,7 @@
 #include <LibWeb/Forward.h>
 #include <LibWeb/Painting/AccumulatedVisualContext.h>
 #include <LibWeb/Painting/DisplayList.h>
+#include <LibWeb/Painting/DisplayListPlayerSkia.h>
 #include <LibWeb/Painting/DisplayListResourceStorage.h>
 #include <LibWeb/Painting/ScrollState.h>
 
@@ -95,6 +96,7 @@ public:
     void set_parent_context(Optional<Web::Compositor::CompositorContextId>);
     Optional<Web::Compositor::CompositorContextId> parent_context_id() const { return m_parent_context_id; }
     RefPtr<Gfx::PaintingSurface> latest_rendered_surface() const { return m_latest_rendered_surface; }
+    Web::Painting::RasterTilePool const& raster_tile_pool() const { return m_raster_tile_pool; }
 
     void apply_display_list_resource_transaction(Web::Painting::DisplayListResourceTransaction&&);
     void update_image_frame_resources(Vector<Web::Painting::DisplayListImageFrameResource>);
@@ -195,6 +197,7 @@ private:
     BackingStoreManager m_backing_store_manager;
     RefPtr<Gfx::PaintingSurface> m_latest_rendered_surface;
     RefPtr<Gfx::PaintingSurface> m_damage_surface;
+    Web::Painting::RasterTilePool m_raster_tile_pool;
 
     Web::Compositor::AsyncScrollTree m_async_scroll_tree;
     ViewportScrollbarController m_viewport_scrollbar_controller;
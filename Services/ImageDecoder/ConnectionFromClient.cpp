@@ -8,6 +8,7 @@
 #include <AK/IDAllocator.h>
 #include <AK/NonnullRefPtr.h>
 #include <ImageDecoder/ConnectionFromClient.h>
+#include <ImageDecoder/DecodedImageCache.h>
 #include <ImageDecoder/ImageDecoderClientEndpoint.h>
 #include <LibCore/EventLoop.h>
 #include <LibCore/Process.h>
@@ -36,6 +37,12 @@ void ConnectionFromClient::die()
         job->cancel();
     m_pending_jobs.clear();
 
+    for (auto& [_, incremental_decode] : m_incremental_decodes) {
+        if (incremental_decode.partial_decode_job)
+            incremental_decode.partial_decode_job->cancel();
+    }
+    m_incremental_decodes.clear();
+
     for (auto& [_, job] : m_pending_frame_jobs)
         job->cancel();
     m_pending_frame_jobs.clear();
@@ -105,9 +112,44 @@ static void decode_image_to_bitmaps_and_durations_with_decoder(Gfx::ImageDecoder
 
 static constexpr u32 STREAMING_BATCH_SIZE = 4;
 
-static ErrorOr<ConnectionFromClient::DecodeResult> decode_image_to_details(Core::AnonymousBuffer encoded_buffer, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> const& known_mime_type)
+// A frame decoded for an ideal size may be smaller than the image itself, whose natural size the client still needs for
+// layout.
+static Gfx::IntSize natural_size_of_frame(Gfx::ImageDecoder const& decoder, Gfx::Bitmap const& frame, Optional<Gfx::IntSize> const& ideal_size)
 {
-    auto decoder = TRY(Gfx::ImageDecoder::try_create_for_raw_bytes(ReadonlyBytes { encoded_buffer.data<u8>(), encoded_buffer.size() }, known_mime_type));
+    if (!ideal_size.has_value())
+        return frame.size();
+
+    auto size = decoder.size();
+    if (size.width() < frame.width() || size.height() < frame.height())
+        return frame.size();
+    return size;
+}
+
+static ErrorOr<ConnectionFromClient::DecodeResult> decode_image_to_details(Optional<String> const& cache_partition, Core::AnonymousBuffer encoded_buffer, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> const& known_mime_type)
+{
+    auto encoded_data = ReadonlyBytes { encoded_buffer.data<u8>(), encoded_buffer.size() };
+
+    // Images decoded without a partition aren't shared with anyone, so they stay out of the cache.
+    Optional<ByteString> cache_key;
+    Optional<DecodedImageCache::Image> cached_image;
+    if (cache_partition.has_value()) {
+        cache_key = DecodedImageCache::key_for(cache_partition->bytes_as_string_view(), encoded_data, ideal_size, known_mime_type);
+        cached_image = DecodedImageCache::the().get(*cache_key);
+    }
+
+    if (cached_image.has_value()) {
+        ConnectionFromClient::DecodeResult result;
+        result.loop_count = cached_image->loop_count;
+        result.frame_count = 1;
+        result.natural_size = cached_image->natural_size.is_empty() ? cached_image->bitmap->size() : cached_image->natural_size;
+        result.scale = cached_image->scale;
+        result.bitmaps = Gfx::BitmapSequence { { cached_image->bitmap } };
+        result.durations.append(cached_image->duration);
+        result.color_profile = move(cached_image->color_profile);
+        return result;
+    }
+
+    auto decoder = TRY(Gfx::ImageDecoder::try_create_for_raw_bytes(encoded_data, known_mime_type));
 
     if (!decoder)
         return Error::from_string_literal("Could not find suitable image decoder plugin for data");
@@ -147,11 +189,12 @@ static ErrorOr<ConnectionFromClient::DecodeResult> decode_image_to_details(Core:
         for (u32 i = 0; i < result.frame_count; ++i)
             result.durations.unchecked_append(decoder->frame_duration(i));
 
-        // Decode only the first batch of frames.
+        // Decode only the first batch of frames. The client requests the later frames without an ideal size, so these
+        // are decoded at full resolution too.
         u32 const batch_size = min(STREAMING_BATCH_SIZE, result.frame_count);
         bitmaps.ensure_capacity(batch_size);
         for (u32 i = 0; i < batch_size; ++i) {
-            auto frame_or_error = decoder->frame(i, ideal_size);
+            auto frame_or_error = decoder->frame(i);
             if (frame_or_error.is_error())
                 break;
             auto frame = frame_or_error.release_value();
@@ -166,24 +209,35 @@ static ErrorOr<ConnectionFromClient::DecodeResult> decode_image_to_details(Core:
         result.decoder = decoder;
         result.encoded_data = move(encoded_buffer);
     } else {
-        decode_image_to_bitmaps_and_durations_with_decoder(*decoder, move(ideal_size), bitmaps, result.durations);
+        decode_image_to_bitmaps_and_durations_with_decoder(*decoder, ideal_size, bitmaps, result.durations);
     }
 
     if (bitmaps.is_empty())
         return Error::from_string_literal("Could not decode image");
 
+    if (auto const& first_bitmap = bitmaps.first())
+        result.natural_size = natural_size_of_frame(*decoder, *first_bitmap, use_streaming ? Optional<Gfx::IntSize> {} : ideal_size);
+
+    if (cache_key.has_value() && !result.is_animated && bitmaps.size() == 1 && bitmaps.first()) {
+        auto cached_image = DecodedImageCache::the().set(*cache_key, { *bitmaps.first(), result.scale, result.color_profile, result.loop_count, result.durations.first(), result.natural_size });
+        if (cached_image.is_error())
+            dbgln("Could not cache decoded image: {}", cached_image.error());
+        else
+            bitmaps.first() = cached_image.value().bitmap;
+    }
+
     result.bitmaps = Gfx::BitmapSequence { move(bitmaps) };
 
     return result;
 }
 
-NonnullRefPtr<ConnectionFromClient::PendingJob> ConnectionFromClient::start_decode_image_job(i64 request_id, Core::AnonymousBuffer encoded_buffer, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> mime_type)
+NonnullRefPtr<ConnectionFromClient::PendingJob> ConnectionFromClient::start_decode_image_job(i64 request_id, Core::AnonymousBuffer encoded_buffer, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> mime_type, Optional<String> cache_partition)
 {
     auto job = make_ref_counted<PendingJob>();
     auto& main_thread_event_loop = Core::EventLoop::current();
     Threading::ThreadPool::the().submit(
-        [strong_this = NonnullRefPtr(*this), job, &main_thread_event_loop, request_id, encoded_buffer = move(encoded_buffer), ideal_size = move(ideal_size), mime_type = move(mime_type)]() mutable {
-            auto result = decode_image_to_details(move(encoded_buffer), ideal_size, mime_type);
+        [strong_this = NonnullRefPtr(*this), job, &main_thread_event_loop, request_id, cache_partition = move(cache_partition), encoded_buffer = move(encoded_buffer), ideal_size = move(ideal_size), mime_type = move(mime_type)]() mutable {
+            auto result = decode_image_to_details(cache_partition, move(encoded_buffer), ideal_size, mime_type);
 
             main_thread_event_loop.deferred_invoke([strong_this = move(strong_this), job = move(job), request_id, result = move(result)] mutable {
                 auto current_job = strong_this->m_pending_jobs.get(request_id);
@@ -215,7 +269,7 @@ NonnullRefPtr<ConnectionFromClient::PendingJob> ConnectionFromClient::start_deco
                     strong_this->m_animation_sessions.set(session_id, move(session));
                 }
 
-                strong_this->async_did_decode_image(request_id, result_value.is_animated, result_value.loop_count, move(result_value.bitmaps), move(result_value.durations), result_value.scale, move(result_value.color_profile), session_id);
+                strong_this->async_did_decode_image(request_id, result_value.is_animated, result_value.loop_count, move(result_value.bitmaps), result_value.natural_size, move(result_value.durations), result_value.scale, move(result_value.color_profile), session_id);
                 strong_this->m_pending_jobs.remove(request_id);
             });
         });
@@ -223,7 +277,7 @@ NonnullRefPtr<ConnectionFromClient::PendingJob> ConnectionFromClient::start_deco
     return job;
 }
 
-void ConnectionFromClient::decode_image(Core::AnonymousBuffer encoded_buffer, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> mime_type, i64 request_id)
+void ConnectionFromClient::decode_image(Core::AnonymousBuffer encoded_buffer, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> mime_type, Optional<String> cache_partition, i64 request_id)
 {
     if (!encoded_buffer.is_valid()) {
         dbgln_if(IMAGE_DECODER_DEBUG, "Encoded data is invalid");
@@ -231,13 +285,13 @@ void ConnectionFromClient::decode_image(Core::AnonymousBuffer encoded_buffer, Op
         return;
     }
 
-    if (m_pending_jobs.contains(request_id)) {
-        m_pending_jobs.take(request_id).value()->cancel();
+    if (m_pending_jobs.contains(request_id) || m_incremental_decodes.contains(request_id)) {
+        cancel_decoding(request_id);
         did_misbehave("Duplicate decode request id");
         return;
     }
 
-    m_pending_jobs.set(request_id, start_decode_image_job(request_id, move(encoded_buffer), ideal_size, move(mime_type)));
+    m_pending_jobs.set(request_id, start_decode_image_job(request_id, move(encoded_buffer), ideal_size, move(mime_type), move(cache_partition)));
 }
 
 void ConnectionFromClient::cancel_decoding(i64 request_id)
@@ -245,6 +299,159 @@ void ConnectionFromClient::cancel_decoding(i64 request_id)
     if (auto job = m_pending_jobs.take(request_id); job.has_value()) {
         job.value()->cancel();
     }
+
+    if (auto incremental_decode = m_incremental_decodes.take(request_id); incremental_decode.has_value()) {
+        if (incremental_decode->partial_decode_job)
+            incremental_decode->partial_decode_job->cancel();
+    }
+}
+
+Messages::ImageDecoderServer::DecodeImageAtNaturalSizeResponse ConnectionFromClient::decode_image_at_natural_size(Core::AnonymousBuffer encoded_buffer, Optional<ByteString> mime_type, Optional<String> cache_partition)
+{
+    if (!encoded_buffer.is_valid()) {
+        dbgln_if(IMAGE_DECODER_DEBUG, "Encoded data is invalid");
+        return { Gfx::BitmapSequence {}, Gfx::ColorSpace {} };
+    }
+
+    // NB: The client is blocked until we reply, so there is no point in handing this to the thread pool. Clients only
+    //     ask for this when they need the pixels of an image that they decoded at a lower resolution.
+    auto result = decode_image_to_details(cache_partition, move(encoded_buffer), {}, mime_type);
+    if (result.is_error()) {
+        dbgln_if(IMAGE_DECODER_DEBUG, "Decoding failed: {}", result.error());
+        return { Gfx::BitmapSequence {}, Gfx::ColorSpace {} };
+    }
+
+    // An animation's later frames are only decoded on request, which a one-off decode like this never makes.
+    auto result_value = result.release_value();
+    result_value.bitmaps.bitmaps.shrink(1);
+    return { move(result_value.bitmaps), move(result_value.color_profile) };
+}
+
+void ConnectionFromClient::begin_incremental_decode(i64 request_id, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> mime_type, Optional<String> cache_partition)
+{
+    if (m_pending_jobs.contains(request_id) || m_incremental_decodes.contains(request_id)) {
+        cancel_decoding(request_id);
+        did_misbehave("Duplicate decode request id");
+        return;
+    }
+
+    m_incremental_decodes.set(request_id, IncrementalDecode { .ideal_size = move(ideal_size), .mime_type = move(mime_type), .cache_partition = move(cache_partition) });
+}
+
+void ConnectionFromClient::append_incremental_decode_data(i64 request_id, Core::AnonymousBuffer data)
+{
+    auto incremental_decode = m_incremental_decodes.get(request_id);
+    if (!incremental_decode.has_value() || !data.is_valid())
+        return;
+
+    if (auto result = incremental_decode->encoded_data.try_append(data.data<u8>(), data.size()); result.is_error()) {
+        cancel_decoding(request_id);
+        async_did_fail_to_decode_image(request_id, MUST(String::formatted("Decoding failed: {}", result.release_error())));
+        return;
+    }
+
+    start_partial_decode_job_if_needed(request_id, *incremental_decode);
+}
+
+void ConnectionFromClient::finish_incremental_decode(i64 request_id)
+{
+    auto incremental_decode = m_incremental_decodes.take(request_id);
+    if (!incremental_decode.has_value())
+        return;
+
+    // The complete image supersedes any partial one we're still working on.
+    if (incremental_decode->partial_decode_job)
+        incremental_decode->partial_decode_job->cancel();
+
+    auto encoded_buffer = [&]() -> ErrorOr<Core::AnonymousBuffer> {
+        if (incremental_decode->encoded_data.is_empty())
+            return Error::from_string_literal("No encoded data");
+        auto buffer = TRY(Core::AnonymousBuffer::create_with_size(incremental_decode->encoded_data.size()));
+        memcpy(buffer.data<void>(), incremental_decode->encoded_data.data(), incremental_decode->encoded_data.size());
+        return buffer;
+    }();
+    if (encoded_buffer.is_error()) {
+        async_did_fail_to_decode_image(request_id, MUST(String::formatted("Decoding failed: {}", encoded_buffer.release_error())));
+        return;
+    }
+
+    m_pending_jobs.set(request_id, start_decode_image_job(request_id, encoded_buffer.release_value(), move(incremental_decode->ideal_size), move(incremental_decode->mime_type), move(incremental_decode->cache_partition)));
+}
+
+// Decoding the data received so far costs time linear in its size, so we wait for it to grow by a fraction of what we
+// decoded last time before decoding again. That keeps the total work for an image that trickles in linear as well.
+static constexpr size_t MINIMUM_PARTIAL_DECODE_GROWTH = 16 * KiB;
+static constexpr size_t PARTIAL_DECODE_GROWTH_DIVISOR = 4;
+
+static ErrorOr<ConnectionFromClient::PartialDecodeResult> decode_partial_image(ReadonlyBytes encoded_data, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> const& known_mime_type)
+{
+    auto decoder = TRY(Gfx::ImageDecoder::try_create_for_raw_bytes(encoded_data, known_mime_type));
+    if (!decoder)
+        return Error::from_string_literal("Could not find suitable image decoder plugin for data");
+
+    // Later frames of an animation are composed on top of the earlier ones, so animations are only shown once they
+    // have arrived in full.
+    if (decoder->is_animated())
+        return Error::from_string_literal("Animated images are not decoded incrementally");
+
+    auto frame = TRY(decoder->frame(0, ideal_size));
+    frame.image->set_alpha_type_destructive(Gfx::AlphaType::Premultiplied);
+
+    auto natural_size = natural_size_of_frame(*decoder, *frame.image, ideal_size);
+    ConnectionFromClient::PartialDecodeResult result { .bitmap = move(frame.image), .natural_size = natural_size, .color_profile = {} };
+    if (auto color_space = decoder->color_space(); !color_space.is_error())
+        result.color_profile = color_space.release_value();
+    return result;
+}
+
+void ConnectionFromClient::start_partial_decode_job_if_needed(i64 request_id, IncrementalDecode& incremental_decode)
+{
+    if (incremental_decode.partial_decode_job)
+        return;
+
+    auto const size = incremental_decode.encoded_data.size();
+    auto const required_growth = max(MINIMUM_PARTIAL_DECODE_GROWTH, incremental_decode.size_at_last_partial_decode / PARTIAL_DECODE_GROWTH_DIVISOR);
+    if (size < incremental_decode.size_at_last_partial_decode + required_growth)
+        return;
+
+    // The decoder works on its own copy, as more data may be appended to the session while it runs.
+    auto encoded_data = ByteBuffer::copy(incremental_decode.encoded_data.bytes());
+    if (encoded_data.is_error())
+        return;
+
+    auto job = make_ref_counted<PendingJob>();
+    incremental_decode.partial_decode_job = job;
+    incremental_decode.size_at_last_partial_decode = size;
+
+    auto& main_thread_event_loop = Core::EventLoop::current();
+    Threading::ThreadPool::the().submit(
+        [strong_this = NonnullRefPtr(*this), job, &main_thread_event_loop, request_id, encoded_data = encoded_data.release_value(), ideal_size = incremental_decode.ideal_size, mime_type = incremental_decode.mime_type]() mutable {
+            auto result = [&]() -> ErrorOr<PartialDecodeResult> {
+                if (job->is_canceled())
+                    return Error::from_string_literal("Canceled");
+                return decode_partial_image(encoded_data.bytes(), ideal_size, mime_type);
+            }();
+
+            main_thread_event_loop.deferred_invoke([strong_this = move(strong_this), job = move(job), request_id, result = move(result)] mutable {
+                auto incremental_decode = strong_this->m_incremental_decodes.get(request_id);
+                if (!incremental_decode.has_value() || incremental_decode->partial_decode_job != job.ptr())
+                    return;
+
+                incremental_decode->partial_decode_job = nullptr;
+
+                // Not having enough data to show anything yet is expected, so we stay quiet about errors here. If the
+                // complete image can't be decoded either, finish_incremental_decode() reports it.
+                if (!result.is_error() && strong_this->is_open()) {
+                    auto partial_result = result.release_value();
+                    Vector<RefPtr<Gfx::Bitmap>> bitmaps;
+                    bitmaps.append(move(partial_result.bitmap));
+                    strong_this->async_did_partially_decode_image(request_id, Gfx::BitmapSequence { move(bitmaps) }, partial_result.natural_size, move(partial_result.color_profile));
+                }
+
+                // More data may have arrived while we were decoding.
+                strong_this->start_partial_decode_job_if_needed(request_id, *incremental_decode);
+            });
+        });
 }
 
 void ConnectionFromClient::request_animation_frames(i64 session_id, u32 start_frame_index, u32 count)
@@ -8,6 +8,7 @@
 
 #include <AK/Atomic.h>
 #include <AK/AtomicRefCounted.h>
+#include <AK/ByteBuffer.h>
 #include <AK/HashMap.h>
 #include <ImageDecoder/Forward.h>
 #include <ImageDecoder/ImageDecoderClientEndpoint.h>
@@ -34,6 +35,7 @@ public:
         bool is_animated = false;
         u32 loop_count = 0;
         u32 frame_count = 0;
+        Gfx::IntSize natural_size;
         Gfx::FloatPoint scale { 1, 1 };
         Gfx::BitmapSequence bitmaps;
         Vector<u32> durations;
@@ -44,6 +46,12 @@ public:
         Core::AnonymousBuffer encoded_data;
     };
 
+    struct PartialDecodeResult {
+        NonnullRefPtr<Gfx::Bitmap> bitmap;
+        Gfx::IntSize natural_size;
+        Gfx::ColorSpace color_profile;
+    };
+
     struct AnimationSession : public AtomicRefCounted<AnimationSession> {
         Core::AnonymousBuffer encoded_data;
         RefPtr<Gfx::ImageDecoder> decoder;
@@ -62,10 +70,25 @@ private:
 
     using FrameDecodeResult = Vector<Gfx::ImageFrameDescriptor>;
 
+    // An image whose encoded data arrives in chunks. Until it has all arrived, we periodically decode what we have so
+    // far, and send the client whatever pixels that yields.
+    struct IncrementalDecode {
+        ByteBuffer encoded_data;
+        Optional<Gfx::IntSize> ideal_size;
+        Optional<ByteString> mime_type;
+        Optional<String> cache_partition;
+        size_t size_at_last_partial_decode { 0 };
+        RefPtr<PendingJob> partial_decode_job;
+    };
+
     explicit ConnectionFromClient(NonnullOwnPtr<IPC::Transport>);
 
-    virtual void decode_image(Core::AnonymousBuffer, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> mime_type, i64 request_id) override;
+    virtual void decode_image(Core::AnonymousBuffer, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> mime_type, Optional<String> cache_partition, i64 request_id) override;
     virtual void cancel_decoding(i64 request_id) override;
+    virtual Messages::ImageDecoderServer::DecodeImageAtNaturalSizeResponse decode_image_at_natural_size(Core::AnonymousBuffer, Optional<ByteString> mime_type, Optional<String> cache_partition) override;
+    virtual void begin_incremental_decode(i64 request_id, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> mime_type, Optional<String> cache_partition) override;
+    virtual void append_incremental_decode_data(i64 request_id, Core::AnonymousBuffer) override;
+    virtual void finish_incremental_decode(i64 request_id) override;
     virtual void request_animation_frames(i64 session_id, u32 start_frame_index, u32 count) override;
     virtual void stop_animation_decode(i64 session_id) override;
     virtual Messages::ImageDecoderServer::ConnectNewClientsResponse connect_new_clients(size_t count) override;
@@ -73,11 +96,13 @@ private:
 
     ErrorOr<IPC::TransportHandle> connect_new_client();
 
-    NonnullRefPtr<PendingJob> start_decode_image_job(i64 request_id, Core::AnonymousBuffer, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> mime_type);
+    NonnullRefPtr<PendingJob> start_decode_image_job(i64 request_id, Core::AnonymousBuffer, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> mime_type, Optional<String> cache_partition);
+    void start_partial_decode_job_if_needed(i64 request_id, IncrementalDecode&);
     NonnullRefPtr<PendingJob> start_frame_decode_job(i64 session_id, NonnullRefPtr<AnimationSession>, u32 start_frame_index, u32 end_index);
 
     i64 m_next_session_id { 1 };
     HashMap<i64, NonnullRefPtr<PendingJob>> m_pending_jobs;
+    HashMap<i64, IncrementalDecode> m_incremental_decodes;
     HashMap<i64, NonnullRefPtr<AnimationSession>> m_animation_sessions;
     HashMap<i64, NonnullRefPtr<PendingJob>> m_pending_frame_jobs;
 };
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Endian.h>
+#include <ImageDecoder/DecodedImageCache.h>
+#include <LibCore/AnonymousBuffer.h>
+#include <LibCrypto/Hash/SHA2.h>
+
+namespace ImageDecoder {
+
+DecodedImageCache& DecodedImageCache::the()
+{
+    static DecodedImageCache cache;
+    return cache;
+}
+
+DecodedImageCache::DecodedImageCache(size_t memory_budget)
+    : m_memory_budget(memory_budget)
+{
+}
+
+ByteString DecodedImageCache::key_for(StringView partition, ReadonlyBytes encoded_data, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> const& mime_type)
+{
+    auto hasher = Crypto::Hash::SHA256::create();
+
+    auto update_with_number = [&](u64 value) {
+        LittleEndian<u64> encoded_value = value;
+        hasher->update(ReadonlyBytes { &encoded_value, sizeof(encoded_value) });
+    };
+
+    update_with_number(partition.length());
+    hasher->update(partition.bytes());
+    hasher->update(encoded_data);
+
+    update_with_number(ideal_size.has_value());
+    if (ideal_size.has_value()) {
+        update_with_number(static_cast<u32>(ideal_size->width()));
+        update_with_number(static_cast<u32>(ideal_size->height()));
+    }
+
+    update_with_number(mime_type.has_value());
+    if (mime_type.has_value()) {
+        update_with_number(mime_type->length());
+        hasher->update(mime_type->bytes());
+    }
+
+    return ByteString { hasher->digest().bytes() };
+}
+
+Optional<DecodedImageCache::Image> DecodedImageCache::get(ByteString const& key)
+{
+    Sync::MutexLocker locker { m_mutex };
+
+    auto it = m_entries.find(key);
+    if (it == m_entries.end())
+        return {};
+
+    auto& entry = *it->value;
+    m_entries_by_last_use.remove(entry);
+    m_entries_by_last_use.append(entry);
+    return entry.image;
+}
+
+ErrorOr<DecodedImageCache::Image> DecodedImageCache::set(ByteString const& key, Image const& image)
+{
+    auto const& bitmap = *image.bitmap;
+    auto pitch = Gfx::Bitmap::minimum_pitch(bitmap.width(), bitmap.format());
+    auto size_in_bytes = Gfx::Bitmap::size_in_bytes(pitch, bitmap.height());
+
+    // A single image this large would push most other images out of the cache, so we let its client decode it again.
+    if (size_in_bytes > m_memory_budget / 4)
+        return image;
+
+    // The buffer must be exactly as large as the pixel data, so that BitmapSequence can hand it to clients as is.
+    auto buffer = TRY(Core::AnonymousBuffer::create_with_size(size_in_bytes, Core::AnonymousBuffer::Sealability::Sealable));
+    for (int y = 0; y < bitmap.height(); ++y)
+        memcpy(buffer.data<u8>() + y * pitch, bitmap.scanline(y), pitch);
+
+    // Without a read-only seal, a client could change the cached pixels, so we don't cache the image at all.
+    if (buffer.seal_read_only().is_error())
+        return image;
+
+    auto shared_bitmap = TRY(Gfx::Bitmap::create_with_anonymous_buffer(bitmap.format(), bitmap.alpha_type(), move(buffer), bitmap.size()));
+
+    Sync::MutexLocker locker { m_mutex };
+
+    if (auto it = m_entries.find(key); it != m_entries.end()) {
+        auto& entry = *it->value;
+        m_entries_by_last_use.remove(entry);
+        m_entries_by_last_use.append(entry);
+        return entry.image;
+    }
+
+    evict_entries_until_size_fits(size_in_bytes);
+
+    auto entry = make<Entry>(key, Image { shared_bitmap, image.scale, image.color_profile, image.loop_count, image.duration, image.natural_size });
+    m_entries_by_last_use.append(*entry);
+    m_size_in_bytes += size_in_bytes;
+
+    auto cached_image = entry->image;
+    m_entries.set(key, move(entry));
+    return cached_image;
+}
+
+size_t DecodedImageCache::size_in_bytes() const
+{
+    Sync::MutexLocker locker { m_mutex };
+    return m_size_in_bytes;
+}
+
+void DecodedImageCache::remove_entry(Entry& entry)
+{
+    m_entries_by_last_use.remove(entry);
+    m_size_in_bytes -= entry.image.bitmap->size_in_bytes();
+    auto key = entry.key;
+    m_entries.remove(key);
+}
+
+void DecodedImageCache::evict_entries_until_size_fits(size_t size_in_bytes)
+{
+    while (!m_entries_by_last_use.is_empty() && m_size_in_bytes + size_in_bytes > m_memory_budget)
+        remove_entry(*m_entries_by_last_use.first());
+}
+
+}
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteString.h>
+#include <AK/HashMap.h>
+#include <AK/IntrusiveList.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/Optional.h>
+#include <LibGfx/Bitmap.h>
+#include <LibGfx/ColorSpace.h>
+#include <LibGfx/Point.h>
+#include <LibGfx/Size.h>
+#include <LibSync/Mutex.h>
+
+namespace ImageDecoder {
+
+// Still images decoded on behalf of the clients of this process, keyed by a hash of their encoded data. Pages tend to load
+// the same logos, sprites and icons over and over, so we keep one decoded copy of them.
+//
+// The cache is partitioned by the top-level site of the document that decodes an image, which the client passes along
+// with its request. Documents of the same site share images, no matter which tab or process they are in. Sharing images
+// across sites would let one site tell, from how quickly an image decodes, whether another one loaded it.
+//
+// The bitmaps are sent to clients by sharing their backing memory rather than copying it. Their buffers are sealed
+// read-only, so clients can only map them read-only, and nothing else may write to them either.
+class DecodedImageCache {
+public:
+    struct Image {
+        NonnullRefPtr<Gfx::Bitmap> bitmap;
+        Gfx::FloatPoint scale { 1, 1 };
+        Gfx::ColorSpace color_profile;
+        u32 loop_count { 0 };
+        u32 duration { 0 };
+
+        // The bitmap may have been decoded at a reduced resolution for an ideal size. An empty size means it was not.
+        Gfx::IntSize natural_size;
+    };
+
+    static constexpr size_t DEFAULT_MEMORY_BUDGET = 128 * MiB;
+
+    static DecodedImageCache& the();
+
+    explicit DecodedImageCache(size_t memory_budget = DEFAULT_MEMORY_BUDGET);
+
+    // Decoding options are part of the key, as they change which pixels we decode.
+    static ByteString key_for(StringView partition, ReadonlyBytes encoded_data, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> const& mime_type);
+
+    Optional<Image> get(ByteString const& key);
+
+    // Returns the image that is now in the cache. That is an earlier copy if another thread decoded the same image at
+    // the same time, so that the client still shares it. Images that can't be shared safely are returned as is.
+    ErrorOr<Image> set(ByteString const& key, Image const&);
+
+    size_t size_in_bytes() const;
+
+private:
+    struct Entry {
+        ByteString key;
+        Image image;
+        IntrusiveListNode<Entry> list_node;
+    };
+
+    void remove_entry(Entry&);
+    void evict_entries_until_size_fits(size_t);
+
+    size_t const m_memory_budget { DEFAULT_MEMORY_BUDGET };
+
+    mutable Sync::Mutex m_mutex;
+    HashMap<ByteString, NonnullOwnPtr<Entry>> m_entries;
+    IntrusiveList<&Entry::list_node> m_entries_by_last_use; // The least recently used entry comes first.
+    size_t m_size_in_bytes { 0 };
+};
+
+}
@@ -86,4 +86,110 @@ Requests::NetworkError curl_code_to_network_error(int code)
     }
 }
 
+u32 status_code_for_curl_handle(void* curl_easy_handle)
+{
+    long http_status_code = 0;
+    auto result = curl_easy_getinfo(curl_easy_handle, CURLINFO_RESPONSE_CODE, &http_status_code);
+    VERIFY(result == CURLE_OK);
+
+    return static_cast<u32>(http_status_code);
+}
+
+Requests::RequestTimingInfo timing_info_for_curl_handle(void* curl_easy_handle)
+{
+    // curl_easy_perform()
+    // |
+    // |--QUEUE
+    // |--|--NAMELOOKUP
+    // |--|--|--CONNECT
+    // |--|--|--|--APPCONNECT
+    // |--|--|--|--|--PRETRANSFER
+    // |--|--|--|--|--|--POSTTRANSFER
+    // |--|--|--|--|--|--|--STARTTRANSFER
+    // |--|--|--|--|--|--|--|--TOTAL
+    // |--|--|--|--|--|--|--|--REDIRECT
+
+    auto get_timing_info = [&](auto option) {
+        curl_off_t time_value = 0;
+        auto result = curl_easy_getinfo(curl_easy_handle, option, &time_value);
+        VERIFY(result == CURLE_OK);
+        return time_value;
+    };
+
+    auto queue_time = get_timing_info(CURLINFO_QUEUE_TIME_T);
+    auto domain_lookup_time = get_timing_info(CURLINFO_NAMELOOKUP_TIME_T);
+    auto connect_time = get_timing_info(CURLINFO_CONNECT_TIME_T);
+    auto secure_connect_time = get_timing_info(CURLINFO_APPCONNECT_TIME_T);
+    auto request_start_time = get_timing_info(CURLINFO_PRETRANSFER_TIME_T);
+    auto response_start_time = get_timing_info(CURLINFO_STARTTRANSFER_TIME_T);
+    auto response_end_time = get_timing_info(CURLINFO_TOTAL_TIME_T);
+    auto encoded_body_size = get_timing_info(CURLINFO_SIZE_DOWNLOAD_T);
+
+    long http_version = 0;
+    auto get_version_result = curl_easy_getinfo(curl_easy_handle, CURLINFO_HTTP_VERSION, &http_version);
+    VERIFY(get_version_result == CURLE_OK);
+
+    auto http_version_alpn = Requests::ALPNHttpVersion::None;
+    switch (http_version) {
+    case CURL_HTTP_VERSION_1_0:
+        http_version_alpn = Requests::ALPNHttpVersion::Http1_0;
+        break;
+    case CURL_HTTP_VERSION_1_1:
+        http_version_alpn = Requests::ALPNHttpVersion::Http1_1;
+        break;
+    case CURL_HTTP_VERSION_2_0:
+        http_version_alpn = Requests::ALPNHttpVersion::Http2_TLS;
+        break;
+    case CURL_HTTP_VERSION_3:
+        http_version_alpn = Requests::ALPNHttpVersion::Http3;
+        break;
+    default:
+        http_version_alpn = Requests::ALPNHttpVersion::None;
+        break;
+    }
+
+    return Requests::RequestTimingInfo {
+        .domain_lookup_start_microseconds = queue_time,
+        .domain_lookup_end_microseconds = queue_time + domain_lookup_time,
+        .connect_start_microseconds = queue_time + domain_lookup_time,
+        .connect_end_microseconds = queue_time + domain_lookup_time + connect_time + secure_connect_time,
+        .secure_connect_start_microseconds = queue_time + domain_lookup_time + connect_time,
+        .request_start_microseconds = queue_time + domain_lookup_time + connect_time + secure_connect_time + request_start_time,
+        .response_start_microseconds = queue_time + domain_lookup_time + connect_time + secure_connect_time + response_start_time,
+        .response_end_microseconds = queue_time + domain_lookup_time + connect_time + secure_connect_time + response_end_time,
+        .encoded_body_size = encoded_body_size,
+        .http_version_alpn_identifier = http_version_alpn,
+    };
+}
+
+WireActivity wire_activity_for_curl_handle(void* curl_easy_handle)
+{
+    auto get_off = [&](auto option) {
+        curl_off_t value = 0;
+        (void)curl_easy_getinfo(curl_easy_handle, option, &value);
+        return static_cast<i64>(value);
+    };
+    auto get_long = [&](auto option) {
+        long value = 0;
+        (void)curl_easy_getinfo(curl_easy_handle, option, &value);
+        return value;
+    };
+
+    return WireActivity {
+        .http_status = get_long(CURLINFO_RESPONSE_CODE),
+        .http_version = get_long(CURLINFO_HTTP_VERSION),
+        .queue_us = get_off(CURLINFO_QUEUE_TIME_T),
+        .namelookup_us = get_off(CURLINFO_NAMELOOKUP_TIME_T),
+        .connect_us = get_off(CURLINFO_CONNECT_TIME_T),
+        .appconnect_us = get_off(CURLINFO_APPCONNECT_TIME_T),
+        .pretransfer_us = get_off(CURLINFO_PRETRANSFER_TIME_T),
+        .starttransfer_us = get_off(CURLINFO_STARTTRANSFER_TIME_T),
+        .total_us = get_off(CURLINFO_TOTAL_TIME_T),
+        .bytes_downloaded = get_off(CURLINFO_SIZE_DOWNLOAD_T),
+        .bytes_uploaded = get_off(CURLINFO_SIZE_UPLOAD_T),
+        .download_speed_bps = get_off(CURLINFO_SPEED_DOWNLOAD_T),
+    };
+}
+
+
 }
@@ -14,6 +14,8 @@
 #include <AK/StringView.h>
 #include <LibDNS/Resolver.h>
 #include <LibRequests/NetworkError.h>
+#include <LibRequests/RequestTimingInfo.h>
+#include <RequestServer/WireActivity.h>
 
 #if defined(AK_OS_WINDOWS)
 #    include <AK/Windows.h> // Needed because curl.h includes winsock2.h
@@ -32,4 +34,8 @@ Optional<ByteString> build_curl_connect_to_entry(DNS::LookupResult const& dns_re
 Requests::NetworkError curl_code_to_network_error(int code);
 ErrorOr<void> initialize_libcurl();
 
+u32 status_code_for_curl_handle(void* curl_easy_handle);
+Requests::RequestTimingInfo timing_info_for_curl_handle(void* curl_easy_handle);
+WireActivity wire_activity_for_curl_handle(void* curl_easy_handle);
+
 }
@@ -9,6 +9,7 @@
 namespace RequestServer {
 
 class ConnectionFromClient;
+class NetworkThread;
 class Request;
 class RequestPipe;
 
@@ -0,0 +1,451 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Debug.h>
+#include <AK/HashFunctions.h>
+#include <LibCore/EventLoop.h>
+#include <LibCore/Notifier.h>
+#include <LibCore/Timer.h>
+#include <LibThreading/Thread.h>
+#include <LibURL/URL.h>
+#include <RequestServer/CURL.h>
+#include <RequestServer/NetworkThread.h>
+#include <RequestServer/Request.h>
+
+namespace RequestServer {
+
+static Vector<NonnullOwnPtr<NetworkThread>> s_network_threads;
+
+ErrorOr<void> NetworkThread::start_threads(size_t count)
+{
+    VERIFY(s_network_threads.is_empty());
+    TRY(s_network_threads.try_ensure_capacity(count));
+
+    auto& main_thread_event_loop = Core::EventLoop::current();
+
+    for (size_t i = 0; i < count; ++i) {
+        auto thread = adopt_own(*new NetworkThread(i, main_thread_event_loop));
+
+        bool started = false;
+        {
+            Sync::MutexLocker locker(thread->m_mutex);
+            thread->m_started_condition.wait_while([&]() { return !thread->m_started; });
+            started = thread->m_event_loop != nullptr;
+        }
+
+        if (!started) {
+            stop_threads();
+            return Error::from_string_literal("Unable to start network thread");
+        }
+
+        s_network_threads.unchecked_append(move(thread));
+    }
+
+    return {};
+}
+
+void NetworkThread::stop_threads()
+{
+    // Destroying a thread stops its event loop and waits for it to clean up its transfers.
+    s_network_threads.clear();
+}
+
+Optional<NetworkThread&> NetworkThread::for_url(URL::URL const& url)
+{
+    if (s_network_threads.is_empty())
+        return {};
+
+    // Keep all transfers to an origin on the same thread, so that they share its connections to that origin.
+    auto hash = pair_int_hash(url.serialized_host().hash(), url.port_or_default());
+    return *s_network_threads[hash % s_network_threads.size()];
+}
+
+NetworkThread::NetworkThread(size_t index, Core::EventLoop& main_thread_event_loop)
+    : m_index(index)
+    , m_main_thread_event_loop(main_thread_event_loop)
+    , m_thread(Threading::Thread::construct(ByteString::formatted("Network {}", index), [this]() {
+        return thread_main();
+    }))
+{
+    m_thread->start();
+}
+
+NetworkThread::~NetworkThread()
+{
+    RefPtr<Core::WeakEventLoopReference> event_loop;
+    {
+        Sync::MutexLocker locker(m_mutex);
+        event_loop = m_event_loop;
+    }
+
+    if (event_loop) {
+        if (auto strong_event_loop = event_loop->take()) {
+            strong_event_loop->deferred_invoke([]() {
+                Core::EventLoop::current().quit(0);
+            });
+        }
+    }
+
+    if (m_thread->needs_to_be_joined())
+        (void)m_thread->join();
+}
+
+intptr_t NetworkThread::thread_main()
+{
+    Core::EventLoop event_loop;
+
+    m_curl_multi = curl_multi_init();
+    if (!m_curl_multi) {
+        Sync::MutexLocker locker(m_mutex);
+        m_started = true;
+        m_started_condition.broadcast();
+        return 1;
+    }
+
+    auto set_option = [this](auto option, auto value) {
+        auto result = curl_multi_setopt(m_curl_multi, option, value);
+        VERIFY(result == CURLM_OK);
+    };
+    set_option(CURLMOPT_SOCKETFUNCTION, &on_socket_callback);
+    set_option(CURLMOPT_SOCKETDATA, this);
+    set_option(CURLMOPT_TIMERFUNCTION, &on_timeout_callback);
+    set_option(CURLMOPT_TIMERDATA, this);
+
+    m_timer = Core::Timer::create_single_shot(0, [this] {
+        auto now = MonotonicTime::now();
+        if (m_timer_due_at.has_value() && now < *m_timer_due_at) {
+            auto remaining_ms = (*m_timer_due_at - now).to_milliseconds();
+            m_timer->restart(AK::clamp_to<int>(remaining_ms));
+            return;
+        }
+
+        m_timer_due_at = {};
+
+        auto result = curl_multi_socket_action(m_curl_multi, CURL_SOCKET_TIMEOUT, 0, nullptr);
+        VERIFY(result == CURLM_OK);
+        check_completed_transfers();
+    });
+
+    {
+        Sync::MutexLocker locker(m_mutex);
+        m_event_loop = Core::EventLoop::current_weak();
+        m_started = true;
+        m_started_condition.broadcast();
+    }
+
+    auto result = event_loop.exec();
+
+    {
+        Sync::MutexLocker locker(m_mutex);
+        m_event_loop.clear();
+    }
+
+    for (auto const& it : m_transfers) {
+        auto& transfer = *it.value;
+        (void)curl_multi_remove_handle(m_curl_multi, transfer.curl_easy_handle);
+        curl_easy_cleanup(transfer.curl_easy_handle);
+        for (auto* string_list : transfer.curl_string_lists)
+            curl_slist_free_all(string_list);
+    }
+    m_transfers.clear();
+
+    // Cleaning up the multi handle closes its sockets, which it tells us about through our socket callback.
+    curl_multi_cleanup(m_curl_multi);
+    m_curl_multi = nullptr;
+
+    m_read_notifiers.clear();
+    m_write_notifiers.clear();
+    m_timer = nullptr;
+
+    return result;
+}
+
+u64 NetworkThread::start_transfer(Request& request, void* curl_easy_handle, Vector<curl_slist*> curl_string_lists)
+{
+    auto transfer_id = m_next_transfer_id++;
+    m_requests.set(transfer_id, &request);
+
+    auto transfer = make<Transfer>(*this, transfer_id, curl_easy_handle, move(curl_string_lists));
+
+    // From here on, libcurl reports to the transfer rather than to the request, which lives on the main thread.
+    auto set_option = [&](auto option, auto value) {
+        auto result = curl_easy_setopt(curl_easy_handle, option, value);
+        VERIFY(result == CURLE_OK);
+    };
+    set_option(CURLOPT_PRIVATE, transfer.ptr());
+    set_option(CURLOPT_HEADERFUNCTION, &on_header_received);
+    set_option(CURLOPT_HEADERDATA, transfer.ptr());
+    set_option(CURLOPT_WRITEFUNCTION, &on_data_received);
+    set_option(CURLOPT_WRITEDATA, transfer.ptr());
+
+    if constexpr (REQUESTSERVER_WIRE_DEBUG) {
+        curl_xferinfo_callback on_xferinfo = [](void* user_data, curl_off_t, curl_off_t downloaded_bytes, curl_off_t, curl_off_t) {
+            on_transfer_progress(*static_cast<Transfer*>(user_data), downloaded_bytes);
+            return 0;
+        };
+        set_option(CURLOPT_NOPROGRESS, 0L);
+        set_option(CURLOPT_XFERINFOFUNCTION, on_xferinfo);
+        set_option(CURLOPT_XFERINFODATA, transfer.ptr());
+    } else {
+        set_option(CURLOPT_NOPROGRESS, 1L);
+    }
+
+    RefPtr<Core::WeakEventLoopReference> event_loop;
+    {
+        Sync::MutexLocker locker(m_mutex);
+        event_loop = m_event_loop;
+    }
+
+    if (event_loop) {
+        if (auto strong_event_loop = event_loop->take()) {
+            strong_event_loop->deferred_invoke([this, transfer = move(transfer)]() mutable {
+                add_transfer(move(transfer));
+            });
+            return transfer_id;
+        }
+    }
+
+    // The thread is shutting down, so the request will never hear back about this transfer.
+    curl_easy_cleanup(transfer->curl_easy_handle);
+    for (auto* string_list : transfer->curl_string_lists)
+        curl_slist_free_all(string_list);
+
+    return transfer_id;
+}
+
+void NetworkThread::stop_transfer(u64 transfer_id)
+{
+    m_requests.remove(transfer_id);
+
+    RefPtr<Core::WeakEventLoopReference> event_loop;
+    {
+        Sync::MutexLocker locker(m_mutex);
+        event_loop = m_event_loop;
+    }
+
+    if (!event_loop)
+        return;
+
+    if (auto strong_event_loop = event_loop->take()) {
+        strong_event_loop->deferred_invoke([this, transfer_id]() {
+            remove_transfer(transfer_id);
+        });
+    }
+}
+
+ByteString NetworkThread::alt_svc_cache_path(ByteString const& base_path) const
+{
+    return ByteString::formatted("{}.network-{}", base_path, m_index);
+}
+
+void NetworkThread::add_transfer(NonnullOwnPtr<Transfer> transfer)
+{
+    auto result = curl_multi_add_handle(m_curl_multi, transfer->curl_easy_handle);
+    VERIFY(result == CURLM_OK);
+
+    m_transfers.set(transfer->id, move(transfer));
+}
+
+void NetworkThread::remove_transfer(u64 transfer_id)
+{
+    auto transfer = m_transfers.take(transfer_id);
+    if (!transfer.has_value())
+        return;
+
+    auto result = curl_multi_remove_handle(m_curl_multi, (*transfer)->curl_easy_handle);
+    VERIFY(result == CURLM_OK);
+
+    curl_easy_cleanup((*transfer)->curl_easy_handle);
+    for (auto* string_list : (*transfer)->curl_string_lists)
+        curl_slist_free_all(string_list);
+}
+
+void NetworkThread::perform_socket_action(int sockfd, int select_flag)
+{
+    auto result = curl_multi_socket_action(m_curl_multi, sockfd, select_flag, nullptr);
+    VERIFY(result == CURLM_OK);
+
+    check_completed_transfers();
+}
+
+void NetworkThread::check_completed_transfers()
+{
+    int msgs_in_queue = 0;
+    while (auto* msg = curl_multi_info_read(m_curl_multi, &msgs_in_queue)) {
+        if (msg->msg != CURLMSG_DONE)
+            continue;
+
+        void* application_private = nullptr;
+        auto result = curl_easy_getinfo(msg->easy_handle, CURLINFO_PRIVATE, &application_private);
+        VERIFY(result == CURLE_OK);
+        VERIFY(application_private != nullptr);
+
+        // The handle stays in our multi until the request stops the transfer, so that connect-only transfers keep
+        // their connection open for the request to use.
+        auto& transfer = *static_cast<Transfer*>(application_private);
+
+        Optional<WireActivity> wire_activity;
+        if constexpr (REQUESTSERVER_WIRE_DEBUG)
+            wire_activity = wire_activity_for_curl_handle(msg->easy_handle);
+
+        queue_event(transfer.id,
+            TransferComplete {
+                .result_code = msg->data.result,
+                .status_code = status_code_for_curl_handle(msg->easy_handle),
+                .timing_info = timing_info_for_curl_handle(msg->easy_handle),
+                .wire_activity = move(wire_activity),
+            });
+    }
+
+    send_queued_events_to_main_thread();
+}
+
+void NetworkThread::queue_event(u64 transfer_id, Variant<ReceivedHeader, ReceivedData, ReceivedWireProgress, TransferComplete> event)
+{
+    m_queued_events.append({ transfer_id, move(event) });
+}
+
+void NetworkThread::send_queued_events_to_main_thread()
+{
+    if (m_queued_events.is_empty())
+        return;
+
+    // The main thread's event loop outlives all network threads, so it is safe to reference it (and us) here.
+    m_main_thread_event_loop.deferred_invoke([this, events = move(m_queued_events)]() mutable {
+        deliver_events(move(events));
+    });
+}
+
+void NetworkThread::deliver_events(Vector<Event> events)
+{
+    for (auto& event : events) {
+        // A request may stop its transfer, or go away entirely, while we deliver an earlier event in this batch.
+        auto request = m_requests.get(event.transfer_id);
+        if (!request.has_value())
+            continue;
+
+        event.event.visit(
+            [&](ReceivedHeader const& header) {
+                (*request)->notify_network_header_received({}, header.header_line);
+            },
+            [&](ReceivedData const& data) {
+                (*request)->notify_network_data_received({}, data.status_code, data.data);
+            },
+            [&](ReceivedWireProgress const& progress) {
+                (*request)->notify_network_wire_progress({}, progress.downloaded_bytes, progress.at);
+            },
+            [&](TransferComplete const& complete) {
+                (*request)->notify_network_transfer_complete({}, complete.result_code, complete.status_code, complete.timing_info, complete.wire_activity);
+            });
+    }
+}
+
+int NetworkThread::on_socket_callback(void*, int sockfd, int what, void* user_data, void*)
+{
+    auto* thread = static_cast<NetworkThread*>(user_data);
+
+    if (what == CURL_POLL_REMOVE) {
+        thread->m_read_notifiers.remove(sockfd);
+        thread->m_write_notifiers.remove(sockfd);
+        return 0;
+    }
+
+    auto update_notifier = [thread, sockfd, what](auto& notifiers, Core::NotificationType type, int poll_flag, int select_flag) {
+        if (!(what & poll_flag)) {
+            if (auto notifier = notifiers.get(sockfd); notifier.has_value())
+                notifier.value()->set_enabled(false);
+            return;
+        }
+
+        auto& notifier = notifiers.ensure(sockfd, [thread, sockfd, type, select_flag] {
+            auto notifier = Core::Notifier::construct(sockfd, type);
+            notifier->on_activation = [thread, sockfd, select_flag] {
+                thread->perform_socket_action(sockfd, select_flag);
+            };
+
+            return notifier;
+        });
+
+        notifier->set_enabled(true);
+    };
+
+    update_notifier(thread->m_read_notifiers, Core::NotificationType::Read, CURL_POLL_IN, CURL_CSELECT_IN);
+    update_notifier(thread->m_write_notifiers, Core::NotificationType::Write, CURL_POLL_OUT, CURL_CSELECT_OUT);
+
+    return 0;
+}
+
+int NetworkThread::on_timeout_callback(void*, long timeout_ms, void* user_data)
+{
+    auto* thread = static_cast<NetworkThread*>(user_data);
+    if (!thread->m_timer)
+        return 0;
+
+    // https://curl.se/libcurl/c/CURLMOPT_TIMERFUNCTION.html
+    // A timeout_ms value of -1 passed to this callback means you should delete the timer.
+    if (timeout_ms == -1) {
+        thread->m_timer->stop();
+        thread->m_timer_due_at = {};
+    } else {
+        // All other values are valid expire times in number of milliseconds - including zero milliseconds.
+        VERIFY(timeout_ms >= 0);
+        thread->m_timer_due_at = MonotonicTime::now() + AK::Duration::from_milliseconds(timeout_ms);
+
+        // Core::Timer intervals are ints, so wait for longer valid timeouts in chunks without calling libcurl before its
+        // requested expire time.
+        thread->m_timer->restart(AK::clamp_to<int>(timeout_ms));
+    }
+
+    // The timer callback should return 0 on success, and -1 on error.
+    return 0;
+}
+
+size_t NetworkThread::on_header_received(void* buffer, size_t size, size_t nmemb, void* user_data)
+{
+    auto& transfer = *static_cast<Transfer*>(user_data);
+
+    auto total_size = size * nmemb;
+    transfer.thread.queue_event(transfer.id, ReceivedHeader { ByteString { static_cast<char const*>(buffer), total_size } });
+
+    return total_size;
+}
+
+size_t NetworkThread::on_data_received(void* buffer, size_t size, size_t nmemb, void* user_data)
+{
+    auto& transfer = *static_cast<Transfer*>(user_data);
+
+    auto total_size = size * nmemb;
+    ReadonlyBytes bytes { static_cast<u8 const*>(buffer), total_size };
+
+    // Coalesce the chunks a single socket action produces for a transfer, to deliver them to the request in one go.
+    auto& events = transfer.thread.m_queued_events;
+    if (!events.is_empty() && events.last().transfer_id == transfer.id) {
+        if (auto* data = events.last().event.get_pointer<ReceivedData>()) {
+            if (data->data.try_append(bytes).is_error())
+                return CURL_WRITEFUNC_ERROR;
+            return total_size;
+        }
+    }
+
+    auto data = ByteBuffer::copy(bytes);
+    if (data.is_error())
+        return CURL_WRITEFUNC_ERROR;
+
+    transfer.thread.queue_event(transfer.id, ReceivedData { data.release_value(), status_code_for_curl_handle(transfer.curl_easy_handle) });
+    return total_size;
+}
+
+void NetworkThread::on_transfer_progress(Transfer& transfer, i64 downloaded_bytes)
+{
+    // libcurl calls this at least once a second even while nothing arrives, so only report actual progress.
+    if (downloaded_bytes <= 0 || downloaded_bytes == transfer.wire_downloaded_bytes)
+        return;
+
+    transfer.wire_downloaded_bytes = downloaded_bytes;
+    transfer.thread.queue_event(transfer.id, ReceivedWireProgress { downloaded_bytes, MonotonicTime::now() });
+}
+
+}
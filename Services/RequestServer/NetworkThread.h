@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteBuffer.h>
+#include <AK/ByteString.h>
+#include <AK/HashMap.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/NonnullRefPtr.h>
+#include <AK/Optional.h>
+#include <AK/RefPtr.h>
+#include <AK/Time.h>
+#include <AK/Variant.h>
+#include <AK/Vector.h>
+#include <LibCore/Forward.h>
+#include <LibRequests/RequestTimingInfo.h>
+#include <LibSync/ConditionVariable.h>
+#include <LibSync/Mutex.h>
+#include <LibThreading/Forward.h>
+#include <LibURL/Forward.h>
+#include <RequestServer/Forward.h>
+#include <RequestServer/WireActivity.h>
+
+struct curl_slist;
+
+namespace RequestServer {
+
+// A thread that runs the network transfers of a subset of origins, with its own curl multi handle and event loop. An
+// origin always maps to the same thread, so that its transfers keep reusing the connections that thread has open.
+//
+// Requests themselves stay on the main thread, along with the disk cache and all IPC. A network thread only performs
+// the socket I/O, TLS and HTTP parsing of their transfers, and forwards the received headers and data to the main
+// thread in batches.
+class NetworkThread {
+    AK_MAKE_NONCOPYABLE(NetworkThread);
+    AK_MAKE_NONMOVABLE(NetworkThread);
+
+public:
+    static ErrorOr<void> start_threads(size_t count);
+    static void stop_threads();
+
+    static Optional<NetworkThread&> for_url(URL::URL const&);
+
+    ~NetworkThread();
+
+    // Takes ownership of the easy handle and the string lists it uses. The request is notified of the transfer's
+    // progress until it stops the transfer, which it must do before it is destroyed.
+    u64 start_transfer(Request&, void* curl_easy_handle, Vector<curl_slist*> curl_string_lists);
+    void stop_transfer(u64 transfer_id);
+
+    // libcurl writes the alt-svc cache without coordinating with other threads, so each network thread uses its own file.
+    ByteString alt_svc_cache_path(ByteString const& base_path) const;
+
+private:
+    struct Transfer {
+        NetworkThread& thread;
+        u64 id { 0 };
+        void* curl_easy_handle { nullptr };
+        Vector<curl_slist*> curl_string_lists;
+        i64 wire_downloaded_bytes { 0 };
+    };
+
+    struct ReceivedHeader {
+        ByteString header_line;
+    };
+
+    struct ReceivedData {
+        ByteBuffer data;
+        u32 status_code { 0 };
+    };
+
+    // Only sent with REQUESTSERVER_WIRE_DEBUG, which the request uses to measure gaps on the wire.
+    struct ReceivedWireProgress {
+        i64 downloaded_bytes { 0 };
+        MonotonicTime at;
+    };
+
+    struct TransferComplete {
+        int result_code { 0 };
+        u32 status_code { 0 };
+        Requests::RequestTimingInfo timing_info;
+
+        // Only sent with REQUESTSERVER_WIRE_DEBUG, as the request can't read it from the easy handle it no longer owns.
+        Optional<WireActivity> wire_activity;
+    };
+
+    struct Event {
+        u64 transfer_id { 0 };
+        Variant<ReceivedHeader, ReceivedData, ReceivedWireProgress, TransferComplete> event;
+    };
+
+    NetworkThread(size_t index, Core::EventLoop& main_thread_event_loop);
+
+    intptr_t thread_main();
+
+    // These all run on the network thread.
+    void add_transfer(NonnullOwnPtr<Transfer>);
+    void remove_transfer(u64 transfer_id);
+    void perform_socket_action(int sockfd, int select_flag);
+    void check_completed_transfers();
+    void queue_event(u64 transfer_id, Variant<ReceivedHeader, ReceivedData, ReceivedWireProgress, TransferComplete>);
+    void send_queued_events_to_main_thread();
+
+    static int on_socket_callback(void*, int sockfd, int what, void* user_data, void*);
+    static int on_timeout_callback(void*, long timeout_ms, void* user_data);
+    static size_t on_header_received(void* buffer, size_t size, size_t nmemb, void* user_data);
+    static size_t on_data_received(void* buffer, size_t size, size_t nmemb, void* user_data);
+    static void on_transfer_progress(Transfer&, i64 downloaded_bytes);
+
+    // This runs on the main thread.
+    void deliver_events(Vector<Event>);
+
+    size_t m_index { 0 };
+    Core::EventLoop& m_main_thread_event_loop;
+    NonnullRefPtr<Threading::Thread> m_thread;
+
+    Sync::Mutex m_mutex;
+    Sync::ConditionVariable m_started_condition { m_mutex };
+    bool m_started { false };
+    RefPtr<Core::WeakEventLoopReference> m_event_loop;
+
+    // Owned by the main thread.
+    u64 m_next_transfer_id { 1 };
+    HashMap<u64, Request*> m_requests;
+
+    // Owned by the network thread.
+    void* m_curl_multi { nullptr };
+    HashMap<u64, NonnullOwnPtr<Transfer>> m_transfers;
+    Vector<Event> m_queued_events;
+    RefPtr<Core::Timer> m_timer;
+    Optional<MonotonicTime> m_timer_due_at;
+    HashMap<int, NonnullRefPtr<Core::Notifier>> m_read_notifiers;
+    HashMap<int, NonnullRefPtr<Core::Notifier>> m_write_notifiers;
+};
+
+}
@@ -17,6 +17,7 @@
 #include <LibTextCodec/Decoder.h>
 #include <RequestServer/CURL.h>
 #include <RequestServer/ConnectionFromClient.h>
+#include <RequestServer/NetworkThread.h>
 #include <RequestServer/Request.h>
 #include <RequestServer/Resolver.h>
 #include <RequestServer/ResourceSubstitutionMap.h>
@@ -71,51 +72,24 @@ Request::TransferredBodyFile::~TransferredBodyFile()
         (void)Core::System::close(fd);
 }
 
-static void log_network_activity(URL::URL const& url, ByteString const& method, void* curl_easy_handle, int curl_result_code, bool is_revalidation, RequestType type)
+static void log_network_activity(URL::URL const& url, ByteString const& method, WireActivity const& activity, int curl_result_code, bool is_revalidation, RequestType type)
 {
     if constexpr (!REQUESTSERVER_WIRE_DEBUG)
         return;
-    if (!curl_easy_handle)
-        return;
-
-    auto get_off = [&](auto option) {
-        curl_off_t value = 0;
-        (void)curl_easy_getinfo(curl_easy_handle, option, &value);
-        return value;
-    };
-    auto get_long = [&](auto option) {
-        long value = 0;
-        (void)curl_easy_getinfo(curl_easy_handle, option, &value);
-        return value;
-    };
-
-    long http_status = get_long(CURLINFO_RESPONSE_CODE);
-    long http_version = get_long(CURLINFO_HTTP_VERSION);
-
-    auto queue_us = get_off(CURLINFO_QUEUE_TIME_T);
-    auto namelookup_us = get_off(CURLINFO_NAMELOOKUP_TIME_T);
-    auto connect_us = get_off(CURLINFO_CONNECT_TIME_T);
-    auto appconnect_us = get_off(CURLINFO_APPCONNECT_TIME_T);
-    auto pretransfer_us = get_off(CURLINFO_PRETRANSFER_TIME_T);
-    auto starttransfer_us = get_off(CURLINFO_STARTTRANSFER_TIME_T);
-    auto total_us = get_off(CURLINFO_TOTAL_TIME_T);
-    auto bytes_downloaded = get_off(CURLINFO_SIZE_DOWNLOAD_T);
-    auto bytes_uploaded = get_off(CURLINFO_SIZE_UPLOAD_T);
-    auto download_speed_bps = get_off(CURLINFO_SPEED_DOWNLOAD_T);
 
     // libcurl phase timings are cumulative from t=0, but skipped phases (e.g. DNS/TCP/TLS on a
     // reused connection) are reported as 0, breaking the monotonic ordering. Clamp each marker
     // to the previous one so skipped phases yield a 0-length delta instead of double-counting.
-    auto clamp = [](curl_off_t marker, curl_off_t previous) { return marker > previous ? marker : previous; };
-    auto m_queue = queue_us;
-    auto m_namelookup = clamp(namelookup_us, m_queue);
-    auto m_connect = clamp(connect_us, m_namelookup);
-    auto m_appconnect = clamp(appconnect_us, m_connect);
-    auto m_pretransfer = clamp(pretransfer_us, m_appconnect);
-    auto m_starttransfer = clamp(starttransfer_us, m_pretransfer);
-    auto m_total = clamp(total_us, m_starttransfer);
-
-    auto us_to_ms = [](curl_off_t us) { return static_cast<double>(us) / 1000.0; };
+    auto clamp = [](i64 marker, i64 previous) { return marker > previous ? marker : previous; };
+    auto m_queue = activity.queue_us;
+    auto m_namelookup = clamp(activity.namelookup_us, m_queue);
+    auto m_connect = clamp(activity.connect_us, m_namelookup);
+    auto m_appconnect = clamp(activity.appconnect_us, m_connect);
+    auto m_pretransfer = clamp(activity.pretransfer_us, m_appconnect);
+    auto m_starttransfer = clamp(activity.starttransfer_us, m_pretransfer);
+    auto m_total = clamp(activity.total_us, m_starttransfer);
+
+    auto us_to_ms = [](i64 us) { return static_cast<double>(us) / 1000.0; };
     auto queue_ms = us_to_ms(m_queue);
     auto dns_ms = us_to_ms(m_namelookup - m_queue);
     auto tcp_ms = us_to_ms(m_connect - m_namelookup);
@@ -125,10 +99,10 @@ static void log_network_activity(URL::URL const& url, ByteString const& method,
     auto body_ms = us_to_ms(m_total - m_starttransfer);
     auto total_ms = us_to_ms(m_total);
 
-    auto kib = [](curl_off_t bytes) { return static_cast<double>(bytes) / 1024.0; };
+    auto kib = [](i64 bytes) { return static_cast<double>(bytes) / 1024.0; };
 
     StringView http_version_str = "HTTP/?"sv;
-    switch (http_version) {
+    switch (activity.http_version) {
     case CURL_HTTP_VERSION_1_0:
         http_version_str = "HTTP/1.0"sv;
         break;
@@ -148,7 +122,7 @@ static void log_network_activity(URL::URL const& url, ByteString const& method,
     StringView kind;
     if (curl_result_code != CURLE_OK)
         kind = "FAIL"sv;
-    else if (is_revalidation && http_status == 304)
+    else if (is_revalidation && activity.http_status == 304)
         kind = "REVAL-304"sv;
     else if (is_revalidation)
         kind = "REVAL-FULL"sv;
@@ -160,19 +134,19 @@ static void log_network_activity(URL::URL const& url, ByteString const& method,
     if (curl_result_code != CURLE_OK) {
         char const* err = curl_easy_strerror(static_cast<CURLcode>(curl_result_code));
         dbgln_if(REQUESTSERVER_WIRE_DEBUG, "RequestServer wire: {}{} {} {} -> error: {} (after {:.1} ms, wire {:.1} KiB)",
-            kind, background, method, url, err, total_ms, kib(bytes_downloaded));
+            kind, background, method, url, err, total_ms, kib(activity.bytes_downloaded));
         return;
     }
 
     auto wire_kibps_during_body = body_ms > 0.0
-        ? kib(bytes_downloaded) / (body_ms / 1000.0)
+        ? kib(activity.bytes_downloaded) / (body_ms / 1000.0)
         : 0.0;
 
     dbgln_if(REQUESTSERVER_WIRE_DEBUG, "RequestServer wire: {}{} {} {} {} -> {} | wire {:.1} KiB sent {:.1} KiB | total {:.1} ms = queue {:.1} + dns {:.1} + tcp {:.1} + tls {:.1} + req {:.1} + wait {:.1} + body {:.1} | wire {:.1} KiB/s avg, {:.1} KiB/s during body",
-        kind, background, method, url, http_version_str, http_status,
-        kib(bytes_downloaded), kib(bytes_uploaded),
+        kind, background, method, url, http_version_str, activity.http_status,
+        kib(activity.bytes_downloaded), kib(activity.bytes_uploaded),
         total_ms, queue_ms, dns_ms, tcp_ms, tls_ms, request_ms, wait_ms, body_ms,
-        kib(download_speed_bps), wire_kibps_during_body);
+        kib(activity.download_speed_bps), wire_kibps_during_body);
 }
 
 struct WireStats {
@@ -258,19 +232,17 @@ static void record_chunk(Request const* request, size_t bytes)
         stats.max_chunk_bytes = bytes;
 }
 
-[[maybe_unused]] static int on_xferinfo(void* user_data, curl_off_t /*dltotal*/, curl_off_t dlnow, curl_off_t /*ultotal*/, curl_off_t /*ulnow*/)
+static void record_wire_progress(Request const* request, curl_off_t dlnow, MonotonicTime now)
 {
     if constexpr (!REQUESTSERVER_WIRE_DEBUG)
-        return 0;
-    auto* request = static_cast<Request const*>(user_data);
+        return;
     if (dlnow <= 0)
-        return 0;
+        return;
 
     auto& stats = wire_stats().ensure(request);
     if (dlnow == stats.last_wire_dlnow)
-        return 0;
+        return;
 
-    auto now = MonotonicTime::now();
     if (!stats.first_wire_byte_at.has_value())
         stats.first_wire_byte_at = now;
     if (stats.last_wire_byte_at.has_value()) {
@@ -285,6 +257,11 @@ static void record_chunk(Request const* request, size_t bytes)
     }
     stats.last_wire_byte_at = now;
     stats.last_wire_dlnow = dlnow;
+}
+
+[[maybe_unused]] static int on_xferinfo(void* user_data, curl_off_t /*dltotal*/, curl_off_t dlnow, curl_off_t /*ultotal*/, curl_off_t /*ulnow*/)
+{
+    record_wire_progress(static_cast<Request const*>(user_data), dlnow, MonotonicTime::now());
     return 0;
 }
 
@@ -555,11 +532,54 @@ void Request::notify_retrieved_http_cookie(Badge<ConnectionFromClient>, StringVi
 }
 
 void Request::notify_fetch_complete(Badge<ConnectionFromClient>, int result_code)
+{
+    handle_fetch_complete(result_code);
+}
+
+void Request::notify_network_header_received(Badge<NetworkThread>, StringView header_line)
+{
+    did_receive_header_line(header_line);
+}
+
+void Request::notify_network_data_received(Badge<NetworkThread>, u32 status_code, ReadonlyBytes data)
+{
+    m_network_status_code = status_code;
+
+    if (did_receive_data(data).is_error()) {
+        // Stop the transfer and fail the request, just as libcurl does when our write callback returns an error.
+        MUST(free_curl_structs());
+        handle_fetch_complete(CURLE_WRITE_ERROR);
+    }
+}
+
+void Request::notify_network_wire_progress(Badge<NetworkThread>, i64 downloaded_bytes, MonotonicTime at)
+{
+    // The network thread samples the time when libcurl reports the bytes, so that gaps are not skewed by the hop.
+    record_wire_progress(this, downloaded_bytes, at);
+}
+
+void Request::notify_network_transfer_complete(Badge<NetworkThread>, int result_code, u32 status_code, Requests::RequestTimingInfo const& timing_info, Optional<WireActivity> const& wire_activity)
+{
+    m_network_status_code = status_code;
+    m_network_timing_info = timing_info;
+    m_network_wire_activity = wire_activity;
+
+    handle_fetch_complete(result_code);
+}
+
+void Request::handle_fetch_complete(int result_code)
 {
     mark_lifecycle_event(this, &WireStats::complete_observed_at);
 
     if (m_type == RequestType::Fetch || m_type == RequestType::BackgroundRevalidation) {
-        log_network_activity(m_url, m_method, m_curl_easy_handle, result_code, is_revalidation_request(), m_type);
+        if constexpr (REQUESTSERVER_WIRE_DEBUG) {
+            // Transfers on a network thread send their activity along with their completion, as we don't own their handle.
+            auto wire_activity = m_network_wire_activity;
+            if (m_curl_easy_handle)
+                wire_activity = wire_activity_for_curl_handle(m_curl_easy_handle);
+            if (wire_activity.has_value())
+                log_network_activity(m_url, m_method, *wire_activity, result_code, is_revalidation_request(), m_type);
+        }
         log_chunk_stats(this);
     }
 
@@ -583,6 +603,9 @@ void Request::notify_fetch_complete(Badge<ConnectionFromClient>, int result_code
         m_response_headers->clear();
         m_reason_phrase.clear();
         m_status_code.clear();
+        m_network_status_code.clear();
+        m_network_timing_info.clear();
+        m_network_wire_activity.clear();
         m_content_decoding_disabled = true;
 
         if constexpr (REQUESTSERVER_WIRE_DEBUG) {
@@ -748,7 +771,8 @@ void Request::handle_read_cache_state()
     transfer_headers_to_client_if_needed();
 
     if (m_cache_entry_reader->body_size() < static_cast<u64>(PAGE_SIZE)) {
-        if (inform_client_request_started().is_error())
+        // Small bodies are copied from the cache file into the socket directly, so it has to carry the body itself.
+        if (inform_client_request_started(RequestPipe::UseBodyRing::No).is_error())
             return;
 
         m_cache_entry_reader->send_to(
@@ -959,10 +983,7 @@ void Request::handle_connect_state()
         VERIFY_NOT_REACHED();
     }
 
-    mark_lifecycle_event(this, &WireStats::curl_added_at);
-    auto result = curl_multi_add_handle(m_curl_multi_handle, m_curl_easy_handle);
-    VERIFY(result == CURLM_OK);
-    m_curl_easy_handle_is_in_multi = true;
+    add_curl_handle_to_multi();
 }
 
 void Request::handle_fetch_state()
@@ -1006,8 +1027,14 @@ void Request::handle_fetch_state()
     set_option(CURLOPT_PORT, m_url.port_or_default());
     set_option(CURLOPT_CONNECTTIMEOUT, s_connect_timeout_seconds);
 
-    if (m_alt_svc_cache_path.has_value())
-        set_option(CURLOPT_ALTSVC, m_alt_svc_cache_path->characters());
+    if (m_alt_svc_cache_path.has_value()) {
+        // libcurl rewrites the alt-svc cache file whenever a handle using it is cleaned up. Handles on different network
+        // threads are cleaned up concurrently, so each thread keeps a file of its own.
+        if (auto network_thread = this->network_thread(); network_thread.has_value())
+            set_option(CURLOPT_ALTSVC, network_thread->alt_svc_cache_path(*m_alt_svc_cache_path).characters());
+        else
+            set_option(CURLOPT_ALTSVC, m_alt_svc_cache_path->characters());
+    }
 
     set_option(CURLOPT_CUSTOMREQUEST, m_method.characters());
     set_option(CURLOPT_FOLLOWLOCATION, 0);
@@ -1024,7 +1051,13 @@ void Request::handle_fetch_state()
 
     if (m_method.is_one_of("POST"sv, "PUT"sv, "PATCH"sv, "DELETE"sv)) {
         set_option(CURLOPT_POSTFIELDSIZE, m_request_body.size());
-        set_option(CURLOPT_POSTFIELDS, m_request_body.data());
+
+        // A network thread may still be sending the body when we go away, until it has seen that we stopped the
+        // transfer. So it needs a copy of its own.
+        if (network_thread().has_value())
+            set_option(CURLOPT_COPYPOSTFIELDS, m_request_body.data());
+        else
+            set_option(CURLOPT_POSTFIELDS, m_request_body.data());
 
         // CURLOPT_POSTFIELDS automatically sets the Content-Type header. Tell curl to remove it by setting a blank
         // value if the headers passed in don't contain a content type.
@@ -1107,10 +1140,7 @@ void Request::handle_fetch_state()
         }
     }
 
-    mark_lifecycle_event(this, &WireStats::curl_added_at);
-    auto result = curl_multi_add_handle(m_curl_multi_handle, m_curl_easy_handle);
-    VERIFY(result == CURLM_OK);
-    m_curl_easy_handle_is_in_multi = true;
+    add_curl_handle_to_multi();
 }
 
 void Request::handle_complete_state()
@@ -1184,11 +1214,27 @@ size_t Request::on_header_received(void* buffer, size_t size, size_t nmemb, void
     auto& request = *static_cast<Request*>(user_data);
 
     auto total_size = size * nmemb;
-    auto header_line = StringView { static_cast<char const*>(buffer), total_size };
+    request.did_receive_header_line({ static_cast<char const*>(buffer), total_size });
+
+    return total_size;
+}
+
+size_t Request::on_data_received(void* buffer, size_t size, size_t nmemb, void* user_data)
+{
+    auto& request = *static_cast<Request*>(user_data);
+
+    auto total_size = size * nmemb;
+    if (request.did_receive_data({ static_cast<u8 const*>(buffer), total_size }).is_error())
+        return CURL_WRITEFUNC_ERROR;
+
+    return total_size;
+}
 
+void Request::did_receive_header_line(StringView header_line)
+{
     // We need to extract the HTTP reason phrase since it can be a custom value. Fetching infrastructure needs this
     // value for setting the status message.
-    if (!request.m_reason_phrase.has_value() && header_line.starts_with("HTTP/"sv)) {
+    if (!m_reason_phrase.has_value() && header_line.starts_with("HTTP/"sv)) {
         auto space_index = header_line.find(' ');
         if (space_index.has_value())
             space_index = header_line.find(' ', *space_index + 1);
@@ -1198,8 +1244,8 @@ size_t Request::on_header_received(void* buffer, size_t size, size_t nmemb, void
                 auto decoder = TextCodec::decoder_for_exact_name("ISO-8859-1"sv);
                 VERIFY(decoder.has_value());
 
-                request.m_reason_phrase = MUST(decoder->to_utf8(reason_phrase, TextCodec::IgnoreBOM::No, TextCodec::ErrorMode::Replacement));
-                return total_size;
+                m_reason_phrase = MUST(decoder->to_utf8(reason_phrase, TextCodec::IgnoreBOM::No, TextCodec::ErrorMode::Replacement));
+                return;
             }
         }
     }
@@ -1207,29 +1253,24 @@ size_t Request::on_header_received(void* buffer, size_t size, size_t nmemb, void
     if (auto colon_index = header_line.find(':'); colon_index.has_value()) {
         auto name = HTTP::normalize_header_value(header_line.substring_view(0, *colon_index));
         auto value = HTTP::normalize_header_value(header_line.substring_view(*colon_index + 1));
-        request.m_response_headers->append({ name, value });
+        m_response_headers->append({ name, value });
     }
-
-    return total_size;
 }
 
-size_t Request::on_data_received(void* buffer, size_t size, size_t nmemb, void* user_data)
+ErrorOr<void> Request::did_receive_data(ReadonlyBytes bytes)
 {
-    auto& request = *static_cast<Request*>(user_data);
+    if (m_type == RequestType::Fetch || m_type == RequestType::BackgroundRevalidation)
+        record_chunk(this, bytes.size());
 
-    if (request.m_type == RequestType::Fetch || request.m_type == RequestType::BackgroundRevalidation)
-        record_chunk(&request, size * nmemb);
-
-    if (request.is_revalidation_request()) {
+    if (is_revalidation_request()) {
         // If we arrive here, we did not receive an HTTP 304 response code. We must remove the cache entry and inform
         // the client of the new response headers and data.
-        if (request.revalidation_failed().is_error())
-            return CURL_WRITEFUNC_ERROR;
+        TRY(revalidation_failed());
 
-        request.m_disk_cache->create_entry(request, request.m_url, request.m_method, request.m_request_headers, request.m_request_start_time)
+        m_disk_cache->create_entry(*this, m_url, m_method, m_request_headers, m_request_start_time)
             .visit(
                 [&](Optional<HTTP::CacheEntryWriter&> cache_entry_writer) {
-                    request.m_cache_entry_writer = cache_entry_writer;
+                    m_cache_entry_writer = cache_entry_writer;
                 },
                 [&](HTTP::DiskCache::CacheHasOpenEntry) {
                     // This should not be reachable, as cache revalidation holds an exclusive lock on the cache entry.
@@ -1237,26 +1278,51 @@ size_t Request::on_data_received(void* buffer, size_t size, size_t nmemb, void*
                 });
     }
 
-    request.transfer_headers_to_client_if_needed();
-
-    auto total_size = size * nmemb;
-    ReadonlyBytes bytes { static_cast<u8 const*>(buffer), total_size };
+    transfer_headers_to_client_if_needed();
 
     auto result = [&] -> ErrorOr<void> {
-        TRY(request.m_response_buffer.write_some(bytes));
-        return request.write_queued_bytes_without_blocking();
+        TRY(m_response_buffer.write_some(bytes));
+        return write_queued_bytes_without_blocking();
     }();
 
     if (result.is_error()) {
-        dbgln("Request::on_data_received: Aborting request because error occurred whilst writing data to the client: {}", result.error());
-        return CURL_WRITEFUNC_ERROR;
+        dbgln("Request::did_receive_data: Aborting request because error occurred whilst writing data to the client: {}", result.error());
+        return result.release_error();
     }
 
-    return total_size;
+    return {};
+}
+
+Optional<NetworkThread&> Request::network_thread() const
+{
+    // Private browsing must not share connections with anything else, so it keeps using the connection's own multi.
+    if (m_client->is_private() == IsPrivate::Yes)
+        return {};
+    return NetworkThread::for_url(m_url);
+}
+
+void Request::add_curl_handle_to_multi()
+{
+    mark_lifecycle_event(this, &WireStats::curl_added_at);
+
+    if (auto network_thread = this->network_thread(); network_thread.has_value()) {
+        m_network_thread = &network_thread.value();
+        m_network_transfer_id = m_network_thread->start_transfer(*this, exchange(m_curl_easy_handle, nullptr), move(m_curl_string_lists));
+        return;
+    }
+
+    auto result = curl_multi_add_handle(m_curl_multi_handle, m_curl_easy_handle);
+    VERIFY(result == CURLM_OK);
+    m_curl_easy_handle_is_in_multi = true;
 }
 
 ErrorOr<void> Request::detach_curl_handle_from_multi()
 {
+    if (m_network_thread) {
+        exchange(m_network_thread, nullptr)->stop_transfer(m_network_transfer_id);
+        return {};
+    }
+
     if (!m_curl_easy_handle)
         return {};
 
@@ -1334,14 +1400,14 @@ ErrorOr<void> Request::send_transferred_body_file_to_client()
     return {};
 }
 
-ErrorOr<void> Request::inform_client_request_started()
+ErrorOr<void> Request::inform_client_request_started(RequestPipe::UseBodyRing use_body_ring)
 {
     if (m_type == RequestType::BackgroundRevalidation)
         return {};
     if (m_client_request_pipe.has_value())
         return {};
 
-    auto request_pipe = RequestPipe::create();
+    auto request_pipe = RequestPipe::create(use_body_ring);
     if (request_pipe.is_error()) {
         dbgln("Request::handle_read_from_cache_state: Failed to create pipe: {}", request_pipe.error());
         transition_to_state(State::Error);
@@ -1361,7 +1427,12 @@ ErrorOr<void> Request::send_request_pipe_to_client()
 {
     VERIFY(m_client_request_pipe.has_value());
     auto reader_fd = TRY(Core::System::dup(m_client_request_pipe->reader_fd()));
-    m_client->async_request_started(m_request_id, IPC::File::adopt_fd(reader_fd));
+
+    Core::AnonymousBuffer body_ring;
+    if (auto const& ring = m_client_request_pipe->body_ring(); ring.has_value())
+        body_ring = ring->anonymous_buffer();
+
+    m_client->async_request_started(m_request_id, IPC::File::adopt_fd(reader_fd), move(body_ring));
     return {};
 }
 
@@ -1452,7 +1523,7 @@ ErrorOr<void> Request::write_queued_bytes_without_blocking()
     }
 
     if (!m_client_writer_notifier) {
-        m_client_writer_notifier = Core::Notifier::construct(m_client_request_pipe->writer_fd(), Core::NotificationType::Write);
+        m_client_writer_notifier = Core::Notifier::construct(m_client_request_pipe->writer_fd(), m_client_request_pipe->writable_notification_type());
         m_client_writer_notifier->set_enabled(false);
 
         m_client_writer_notifier->on_activation = weak_callback(*this, [](auto& self) {
@@ -1506,7 +1577,9 @@ ErrorOr<void> Request::write_queued_bytes_without_blocking()
 
         m_bytes_transferred_to_client += written;
 
-        if (written < bytes.size()) {
+        // A short write to the socket means it is full. The body ring only fills up once it refuses to take any more,
+        // which the next write will tell us.
+        if (written < bytes.size() && !m_client_request_pipe->body_ring().has_value()) {
             m_client_writer_notifier->set_enabled(true);
             return {};
         }
@@ -1555,89 +1628,29 @@ bool Request::is_cache_only_request() const
 
 u32 Request::acquire_status_code() const
 {
+    if (m_network_status_code.has_value())
+        return *m_network_status_code;
+
     if (!m_curl_easy_handle)
         return 0;
 
-    long http_status_code = 0;
-    auto result = curl_easy_getinfo(m_curl_easy_handle, CURLINFO_RESPONSE_CODE, &http_status_code);
-    VERIFY(result == CURLE_OK);
-
-    return static_cast<u32>(http_status_code);
+    return status_code_for_curl_handle(m_curl_easy_handle);
 }
 
 Requests::RequestTimingInfo Request::acquire_timing_info() const
 {
-    // curl_easy_perform()
-    // |
-    // |--QUEUE
-    // |--|--NAMELOOKUP
-    // |--|--|--CONNECT
-    // |--|--|--|--APPCONNECT
-    // |--|--|--|--|--PRETRANSFER
-    // |--|--|--|--|--|--POSTTRANSFER
-    // |--|--|--|--|--|--|--STARTTRANSFER
-    // |--|--|--|--|--|--|--|--TOTAL
-    // |--|--|--|--|--|--|--|--REDIRECT
-
     // FIXME: Implement timing info for cache hits.
     if (m_cache_entry_reader.has_value())
         return {};
 
+    if (m_network_timing_info.has_value())
+        return *m_network_timing_info;
+
     // No timing info available for resource substitutions (no curl handle).
     if (!m_curl_easy_handle)
         return {};
 
-    auto get_timing_info = [&](auto option) {
-        curl_off_t time_value = 0;
-        auto result = curl_easy_getinfo(m_curl_easy_handle, option, &time_value);
-        VERIFY(result == CURLE_OK);
-        return time_value;
-    };
-
-    auto queue_time = get_timing_info(CURLINFO_QUEUE_TIME_T);
-    auto domain_lookup_time = get_timing_info(CURLINFO_NAMELOOKUP_TIME_T);
-    auto connect_time = get_timing_info(CURLINFO_CONNECT_TIME_T);
-    auto secure_connect_time = get_timing_info(CURLINFO_APPCONNECT_TIME_T);
-    auto request_start_time = get_timing_info(CURLINFO_PRETRANSFER_TIME_T);
-    auto response_start_time = get_timing_info(CURLINFO_STARTTRANSFER_TIME_T);
-    auto response_end_time = get_timing_info(CURLINFO_TOTAL_TIME_T);
-    auto encoded_body_size = get_timing_info(CURLINFO_SIZE_DOWNLOAD_T);
-
-    long http_version = 0;
-    auto get_version_result = curl_easy_getinfo(m_curl_easy_handle, CURLINFO_HTTP_VERSION, &http_version);
-    VERIFY(get_version_result == CURLE_OK);
-
-    auto http_version_alpn = Requests::ALPNHttpVersion::None;
-    switch (http_version) {
-    case CURL_HTTP_VERSION_1_0:
-        http_version_alpn = Requests::ALPNHttpVersion::Http1_0;
-        break;
-    case CURL_HTTP_VERSION_1_1:
-        http_version_alpn = Requests::ALPNHttpVersion::Http1_1;
-        break;
-    case CURL_HTTP_VERSION_2_0:
-        http_version_alpn = Requests::ALPNHttpVersion::Http2_TLS;
-        break;
-    case CURL_HTTP_VERSION_3:
-        http_version_alpn = Requests::ALPNHttpVersion::Http3;
-        break;
-    default:
-        http_version_alpn = Requests::ALPNHttpVersion::None;
-        break;
-    }
-
-    return Requests::RequestTimingInfo {
-        .domain_lookup_start_microseconds = queue_time,
-        .domain_lookup_end_microseconds = queue_time + domain_lookup_time,
-        .connect_start_microseconds = queue_time + domain_lookup_time,
-        .connect_end_microseconds = queue_time + domain_lookup_time + connect_time + secure_connect_time,
-        .secure_connect_start_microseconds = queue_time + domain_lookup_time + connect_time,
-        .request_start_microseconds = queue_time + domain_lookup_time + connect_time + secure_connect_time + request_start_time,
-        .response_start_microseconds = queue_time + domain_lookup_time + connect_time + secure_connect_time + response_start_time,
-        .response_end_microseconds = queue_time + domain_lookup_time + connect_time + secure_connect_time + response_end_time,
-        .encoded_body_size = encoded_body_size,
-        .http_version_alpn_identifier = http_version_alpn,
-    };
+    return timing_info_for_curl_handle(m_curl_easy_handle);
 }
 
 }
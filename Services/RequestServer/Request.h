@@ -26,6 +26,7 @@
 #include <RequestServer/Forward.h>
 #include <RequestServer/RequestPipe.h>
 #include <RequestServer/RequestType.h>
+#include <RequestServer/WireActivity.h>
 
 struct curl_slist;
 
@@ -87,6 +88,11 @@ public:
     void notify_retrieved_http_cookie(Badge<ConnectionFromClient>, StringView cookie);
     void notify_fetch_complete(Badge<ConnectionFromClient>, int result_code);
 
+    void notify_network_header_received(Badge<NetworkThread>, StringView header_line);
+    void notify_network_data_received(Badge<NetworkThread>, u32 status_code, ReadonlyBytes);
+    void notify_network_wire_progress(Badge<NetworkThread>, i64 downloaded_bytes, MonotonicTime);
+    void notify_network_transfer_complete(Badge<NetworkThread>, int result_code, u32 status_code, Requests::RequestTimingInfo const&, Optional<WireActivity> const&);
+
 private:
     struct TransferredBodyFile {
         TransferredBodyFile() = default;
@@ -181,12 +187,18 @@ private:
     void handle_complete_state();
     void handle_error_state();
 
+    void handle_fetch_complete(int result_code);
+
     static size_t on_header_received(void* buffer, size_t size, size_t nmemb, void* user_data);
     static size_t on_data_received(void* buffer, size_t size, size_t nmemb, void* user_data);
+    void did_receive_header_line(StringView);
+    ErrorOr<void> did_receive_data(ReadonlyBytes);
 
+    Optional<NetworkThread&> network_thread() const;
+    void add_curl_handle_to_multi();
     ErrorOr<void> detach_curl_handle_from_multi();
     ErrorOr<void> free_curl_structs();
-    ErrorOr<void> inform_client_request_started();
+    ErrorOr<void> inform_client_request_started(RequestPipe::UseBodyRing = RequestPipe::UseBodyRing::Yes);
     ErrorOr<void> send_request_pipe_to_client();
     ErrorOr<void> send_transferred_body_file_to_client();
     void transfer_headers_to_client_if_needed();
@@ -215,6 +227,13 @@ private:
     Vector<curl_slist*> m_curl_string_lists;
     Optional<int> m_curl_result_code;
 
+    // Set while a network thread runs our transfer. It owns the easy handle in that case.
+    NetworkThread* m_network_thread { nullptr };
+    u64 m_network_transfer_id { 0 };
+    Optional<u32> m_network_status_code;
+    Optional<Requests::RequestTimingInfo> m_network_timing_info;
+    Optional<WireActivity> m_network_wire_activity;
+
     NonnullRefPtr<Resolver> m_resolver;
     RefPtr<DNS::LookupResult const> m_dns_result;
     CacheLevel m_connect_cache_level { CacheLevel::ResolveOnly };
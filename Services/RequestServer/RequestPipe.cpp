@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Array.h>
 #include <LibCore/SocketAddress.h>
 #include <LibCore/System.h>
 #include <RequestServer/RequestPipe.h>
@@ -14,9 +15,10 @@
 
 namespace RequestServer {
 
-RequestPipe::RequestPipe(int const reader_fd, int const writer_fd)
+RequestPipe::RequestPipe(int const reader_fd, int const writer_fd, Optional<Core::SharedByteRing> body_ring)
     : m_reader_fd(reader_fd)
     , m_writer_fd(writer_fd)
+    , m_body_ring(move(body_ring))
 {
     VERIFY(m_reader_fd >= 0);
     VERIFY(m_writer_fd >= 0);
@@ -25,6 +27,8 @@ RequestPipe::RequestPipe(int const reader_fd, int const writer_fd)
 RequestPipe::RequestPipe(RequestPipe&& other)
     : m_reader_fd(exchange(other.m_reader_fd, -1))
     , m_writer_fd(exchange(other.m_writer_fd, -1))
+    , m_body_ring(move(other.m_body_ring))
+    , m_is_waiting_for_space(other.m_is_waiting_for_space)
 {
 }
 
@@ -32,6 +36,8 @@ RequestPipe& RequestPipe::operator=(RequestPipe&& other)
 {
     m_reader_fd = exchange(other.m_reader_fd, -1);
     m_writer_fd = exchange(other.m_writer_fd, -1);
+    m_body_ring = move(other.m_body_ring);
+    m_is_waiting_for_space = other.m_is_waiting_for_space;
     return *this;
 }
 
@@ -43,8 +49,12 @@ RequestPipe::~RequestPipe()
         MUST(Core::System::close(m_writer_fd));
 }
 
-ErrorOr<RequestPipe> RequestPipe::create()
+ErrorOr<RequestPipe> RequestPipe::create(UseBodyRing use_body_ring)
 {
+    Optional<Core::SharedByteRing> body_ring;
+    if (use_body_ring == UseBodyRing::Yes)
+        body_ring = TRY(Core::SharedByteRing::create());
+
     int socket_fds[2] {};
     TRY(Core::System::socketpair(AF_LOCAL, SOCK_STREAM, 0, socket_fds));
     TRY(Core::System::set_socket_blocking(socket_fds[0], false));
@@ -57,12 +67,69 @@ ErrorOr<RequestPipe> RequestPipe::create()
     (void)Core::System::setsockopt(socket_fds[0], SOL_SOCKET, SO_RCVBUF, &buffer_size, sizeof(buffer_size));
     (void)Core::System::setsockopt(socket_fds[1], SOL_SOCKET, SO_SNDBUF, &buffer_size, sizeof(buffer_size));
 
-    return RequestPipe(socket_fds[0], socket_fds[1]);
+    return RequestPipe(socket_fds[0], socket_fds[1], move(body_ring));
 }
 
 ErrorOr<size_t> RequestPipe::write(ReadonlyBytes bytes)
 {
-    return Core::System::send(m_writer_fd, bytes, MSG_NOSIGNAL);
+    if (!m_body_ring.has_value())
+        return Core::System::send(m_writer_fd, bytes, MSG_NOSIGNAL);
+
+    if (exchange(m_is_waiting_for_space, false))
+        TRY(discard_wake_ups());
+
+    while (true) {
+        auto written = TRY(m_body_ring->write(bytes));
+        if (written > 0 || bytes.is_empty()) {
+            if (m_body_ring->needs_to_wake_reader())
+                TRY(wake_reader());
+            return written;
+        }
+
+        if (m_body_ring->wait_for_space()) {
+            m_is_waiting_for_space = true;
+            return Error::from_errno(EAGAIN);
+        }
+    }
+}
+
+Core::NotificationType RequestPipe::writable_notification_type() const
+{
+    // The reader wakes us up through the socket once it has made space in the body ring.
+    return m_body_ring.has_value() ? Core::NotificationType::Read : Core::NotificationType::Write;
+}
+
+ErrorOr<void> RequestPipe::wake_reader()
+{
+    static constexpr u8 wake_up = 0;
+
+    auto result = Core::System::send(m_writer_fd, { &wake_up, sizeof(wake_up) }, MSG_NOSIGNAL);
+    if (result.is_error()) {
+        // A full socket means there are wake-ups the reader has yet to see, so it will look at the ring regardless.
+        if (first_is_one_of(result.error().code(), EAGAIN, EWOULDBLOCK))
+            return {};
+        return result.release_error();
+    }
+    return {};
+}
+
+ErrorOr<void> RequestPipe::discard_wake_ups()
+{
+    Array<u8, 64> wake_ups;
+
+    while (true) {
+        auto result = Core::System::recv(m_writer_fd, wake_ups, 0);
+        if (result.is_error()) {
+            if (first_is_one_of(result.error().code(), EAGAIN, EWOULDBLOCK))
+                return {};
+            return result.release_error();
+        }
+        // The reader closed its end, so it will never make space for us.
+        if (result.value() == 0)
+            return Error::from_errno(EPIPE);
+        if (result.value() < wake_ups.size())
+            return {};
+    }
 }
 
 }
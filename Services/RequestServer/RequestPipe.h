@@ -6,7 +6,10 @@
 
 #pragma once
 
+#include <AK/Optional.h>
 #include <AK/Span.h>
+#include <LibCore/Notifier.h>
+#include <LibCore/SharedByteRing.h>
 
 namespace RequestServer {
 
@@ -18,18 +21,35 @@ public:
     RequestPipe& operator=(RequestPipe&& other);
     ~RequestPipe();
 
-    static ErrorOr<RequestPipe> create();
+    // With a body ring, response bodies are written into shared memory and the socket only carries wake-ups in both
+    // directions. Without one, they are written into the socket itself.
+    enum class UseBodyRing {
+        No,
+        Yes,
+    };
+    static ErrorOr<RequestPipe> create(UseBodyRing);
 
     int reader_fd() const { return m_reader_fd; }
     int writer_fd() const { return m_writer_fd; }
 
+    Optional<Core::SharedByteRing> const& body_ring() const { return m_body_ring; }
+
+    // Returns EAGAIN if nothing could be written. Wait for a notification of writable_notification_type() on the
+    // writer fd before trying again.
     ErrorOr<size_t> write(ReadonlyBytes bytes);
+    Core::NotificationType writable_notification_type() const;
 
 private:
-    RequestPipe(int reader_fd, int writer_fd);
+    RequestPipe(int reader_fd, int writer_fd, Optional<Core::SharedByteRing>);
+
+    ErrorOr<void> wake_reader();
+    ErrorOr<void> discard_wake_ups();
 
     int m_reader_fd { -1 };
     int m_writer_fd { -1 };
+
+    Optional<Core::SharedByteRing> m_body_ring;
+    bool m_is_waiting_for_space { false };
 };
 
 }
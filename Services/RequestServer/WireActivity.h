@@ -0,0 +1,32 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Types.h>
+
+namespace RequestServer {
+
+// The libcurl statistics of a finished transfer that are logged with REQUESTSERVER_WIRE_DEBUG. Times are in
+// microseconds, measured cumulatively from the start of the transfer just as libcurl reports them.
+struct WireActivity {
+    long http_status { 0 };
+    long http_version { 0 };
+
+    i64 queue_us { 0 };
+    i64 namelookup_us { 0 };
+    i64 connect_us { 0 };
+    i64 appconnect_us { 0 };
+    i64 pretransfer_us { 0 };
+    i64 starttransfer_us { 0 };
+    i64 total_us { 0 };
+
+    i64 bytes_downloaded { 0 };
+    i64 bytes_uploaded { 0 };
+    i64 download_speed_bps { 0 };
+};
+
+}
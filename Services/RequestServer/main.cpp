@@ -7,6 +7,7 @@
 
 #include <AK/ByteString.h>
 #include <AK/Format.h>
+#include <AK/ScopeGuard.h>
 #include <AK/StringView.h>
 #include <AK/Vector.h>
 #include <LibCore/ArgsParser.h>
@@ -18,6 +19,7 @@
 #include <LibMain/Main.h>
 #include <RequestServer/CURL.h>
 #include <RequestServer/ConnectionFromClient.h>
+#include <RequestServer/NetworkThread.h>
 #include <RequestServer/Resolver.h>
 #include <RequestServer/ResourceSubstitutionMap.h>
 #include <RequestServer/Sandbox.h>
@@ -45,6 +47,7 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     StringView http_disk_cache_mode;
     StringView resource_map_path;
     StringView cache_path;
+    size_t network_thread_count = 0;
     bool wait_for_debugger = false;
     bool disable_sandbox = false;
 
@@ -54,6 +57,7 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     args_parser.add_option(http_disk_cache_mode, "HTTP disk cache mode", "http-disk-cache-mode", 0, "mode");
     args_parser.add_option(resource_map_path, "Path to JSON file mapping URLs to local files", "resource-map", 0, "path");
     args_parser.add_option(cache_path, "Path to the profile cache", "cache-path", 0, "path");
+    args_parser.add_option(network_thread_count, "Number of threads to run network transfers on (default: 0, i.e. the main thread)", "network-threads", 0, "count");
     args_parser.add_option(wait_for_debugger, "Wait for debugger", "wait-for-debugger");
     args_parser.add_option(disable_sandbox, "Disable process sandboxing", "disable-sandbox");
     args_parser.parse(arguments);
@@ -106,6 +110,13 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     if (!disable_sandbox)
         TRY(RequestServer::apply_sandbox(certificates, cache_path));
 
+    TRY(RequestServer::NetworkThread::start_threads(network_thread_count));
+
+    // Requests hand their transfers to the network threads, so the threads must outlive all connections.
+    ScopeGuard stop_network_threads = [] {
+        RequestServer::NetworkThread::stop_threads();
+    };
+
     // Connections are stored on the stack to ensure they are destroyed before static destruction begins. This prevents
     // crashes from notifiers trying to unregister from already-destroyed thread data during process exit.
     RequestServer::ConnectionFromClient::ConnectionMap connections;
@@ -157,7 +157,8 @@ void Compiler::start_pending_jobs()
                     complete_job(job_id, move(output), compilation_duration);
                 });
             }
-        });
+        },
+            Threading::ThreadPool::Priority::Background);
     }
 }
 
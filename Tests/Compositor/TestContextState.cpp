@@ -21,27 +21,31 @@ struct TestWebContentClient final : public Compositor::CompositorStateWebContent
     virtual void release_video_edge(Media::VideoSinkHandle) override { }
 };
 
-static NonnullRefPtr<Web::Painting::DisplayList> make_display_list(Web::Painting::AccumulatedVisualContextTree const& visual_context_tree, Optional<Gfx::Color> color, Optional<Gfx::Color> surface_clear_color = {})
+static void append_fill_rect(ByteBuffer& command_bytes, Web::Painting::FillRect const& command)
+{
+    auto payload = Web::Painting::display_list_object_bytes(command);
+    auto record_size = sizeof(Web::Painting::DisplayListCommandHeader) + payload.size();
+    auto payload_size = align_up_to(record_size, Web::Painting::DisplayList::command_alignment) - sizeof(Web::Painting::DisplayListCommandHeader);
+    Web::Painting::DisplayListCommandHeader header {
+        .command_type = Web::Painting::FillRect::command_type,
+        .payload_size = static_cast<u32>(payload_size),
+        .context_index = Web::Painting::VISUAL_VIEWPORT_NODE_INDEX,
+        .context_geometry_only = false,
+        .has_bounding_rect = true,
+        .is_clip = false,
+        .bounding_rect = command.rect,
+    };
+    auto record_offset = command_bytes.size();
+    command_bytes.append(Web::Painting::display_list_object_bytes(header));
+    command_bytes.append(payload);
+    command_bytes.resize(record_offset + sizeof(header) + payload_size, ByteBuffer::ZeroFillNewElements::Yes);
+}
+
+static NonnullRefPtr<Web::Painting::DisplayList> make_display_list(Web::Painting::AccumulatedVisualContextTree const& visual_context_tree, ReadonlySpan<Web::Painting::FillRect> fills, Optional<Gfx::Color> surface_clear_color = {})
 {
     ByteBuffer command_bytes;
-    if (color.has_value()) {
-        auto command = Web::Painting::FillRect { { 0, 0, 4, 4 }, *color };
-        auto payload = Web::Painting::display_list_object_bytes(command);
-        auto record_size = sizeof(Web::Painting::DisplayListCommandHeader) + payload.size();
-        auto payload_size = align_up_to(record_size, Web::Painting::DisplayList::command_alignment) - sizeof(Web::Painting::DisplayListCommandHeader);
-        Web::Painting::DisplayListCommandHeader header {
-            .command_type = Web::Painting::FillRect::command_type,
-            .payload_size = static_cast<u32>(payload_size),
-            .context_index = Web::Painting::VISUAL_VIEWPORT_NODE_INDEX,
-            .context_geometry_only = false,
-            .has_bounding_rect = true,
-            .is_clip = false,
-            .bounding_rect = command.rect,
-        };
-        command_bytes.append(Web::Painting::display_list_object_bytes(header));
-        command_bytes.append(payload);
-        command_bytes.resize(sizeof(header) + payload_size, ByteBuffer::ZeroFillNewElements::Yes);
-    }
+    for (auto const& fill : fills)
+        append_fill_rect(command_bytes, fill);
 
     IPC::MessageBuffer buffer;
     IPC::Encoder encoder { buffer };
@@ -58,6 +62,14 @@ static NonnullRefPtr<Web::Painting::DisplayList> make_display_list(Web::Painting
     return MUST(decoder.decode<NonnullRefPtr<Web::Painting::DisplayList>>());
 }
 
+static NonnullRefPtr<Web::Painting::DisplayList> make_display_list(Web::Painting::AccumulatedVisualContextTree const& visual_context_tree, Optional<Gfx::Color> color, Optional<Gfx::Color> surface_clear_color = {})
+{
+    if (!color.has_value())
+        return make_display_list(visual_context_tree, ReadonlySpan<Web::Painting::FillRect> {}, surface_clear_color);
+    Web::Painting::FillRect fill { { 0, 0, 4, 4 }, *color };
+    return make_display_list(visual_context_tree, { &fill, 1 }, surface_clear_color);
+}
+
 TEST_CASE(rasterization_clears_damaged_pixels_to_the_canvas_color_in_presentation_backing_stores)
 {
     TestWebContentClient client;
@@ -91,6 +103,77 @@ TEST_CASE(rasterization_clears_damaged_pixels_to_the_canvas_color_in_presentatio
     EXPECT_EQ(bitmap->get_pixel(0, 0), Gfx::Color::Transparent);
 }
 
+TEST_CASE(tiled_rasterization_of_unaligned_damage_reuses_grid_tiles)
+{
+    TestWebContentClient client;
+    Web::Painting::CanvasSurfaceRegistry canvas_surface_registry;
+    Compositor::ContextState context { 0, client, canvas_surface_registry, false };
+    Web::Painting::DisplayListPlayerSkia display_list_player { RefPtr<Gfx::SkiaBackendContext> {} };
+    auto visual_context_tree = Web::Painting::AccumulatedVisualContextTree::create();
+    auto viewport_rect = Gfx::IntRect { 0, 0, 1024, 768 };
+    auto damage_rect = Gfx::IntRect { 100, 100, 600, 500 };
+
+    context.viewport_size_updated(viewport_rect.size(), Web::Compositor::WindowResizingInProgress::No);
+    auto publication = context.resize_backing_stores_if_needed({}, Compositor::BackingStoreManager::GpuSharing::Disallowed);
+    VERIFY(publication.has_value());
+
+    auto paint_frame = [&](ReadonlySpan<Web::Painting::FillRect> fills, Gfx::IntRect frame_damage_rect) {
+        context.install_display_list_update(make_display_list(visual_context_tree, fills), visual_context_tree, {});
+        context.queue_present_frame({ viewport_rect, frame_damage_rect });
+        EXPECT(context.present_synchronously(display_list_player, nullptr));
+    };
+
+    Web::Painting::FillRect const background[] = { { viewport_rect, Gfx::Color::Red } };
+    Web::Painting::FillRect const background_and_box[] = { { viewport_rect, Gfx::Color::Red }, { damage_rect, Gfx::Color::Green } };
+
+    // The first frame fills both backing stores with red, and the last one only repaints the damaged box, which
+    // starts and ends in the middle of grid cells.
+    paint_frame(background, viewport_rect);
+    EXPECT(context.acknowledge_presented_bitmap(publication->bitmap_ids[0]));
+    paint_frame(background_and_box, damage_rect);
+    paint_frame(background_and_box, damage_rect);
+
+    auto bitmap = context.latest_rendered_surface()->snapshot_bitmap();
+    EXPECT_EQ(bitmap->get_pixel(99, 99), Gfx::Color::Red);
+    EXPECT_EQ(bitmap->get_pixel(100, 100), Gfx::Color::Green);
+    EXPECT_EQ(bitmap->get_pixel(255, 300), Gfx::Color::Green);
+    EXPECT_EQ(bitmap->get_pixel(256, 300), Gfx::Color::Green);
+    EXPECT_EQ(bitmap->get_pixel(699, 599), Gfx::Color::Green);
+    EXPECT_EQ(bitmap->get_pixel(700, 599), Gfx::Color::Red);
+    EXPECT_EQ(bitmap->get_pixel(699, 600), Gfx::Color::Red);
+    EXPECT_EQ(bitmap->get_pixel(1023, 767), Gfx::Color::Red);
+
+    // The viewport spans 4x3 grid cells. Tiles are reused between frames, so no more than that were ever allocated.
+    EXPECT_EQ(context.raster_tile_pool().allocated_tile_count(), 12u);
+}
+
+TEST_CASE(raster_tile_pool_frees_tiles_that_recent_frames_did_not_need)
+{
+    Web::Painting::RasterTilePool pool;
+    auto paint_frames_using_tiles = [&](size_t frame_count, size_t tiles_per_frame) {
+        for (size_t frame = 0; frame < frame_count; ++frame) {
+            Vector<NonnullRefPtr<Gfx::PaintingSurface>> tiles;
+            for (size_t i = 0; i < tiles_per_frame; ++i)
+                tiles.append(pool.take());
+            for (auto& tile : tiles)
+                pool.give_back(tile);
+            pool.did_paint_frame();
+        }
+    };
+
+    // A large repaint grows the pool, and the trim at the end of its window keeps what that window needed.
+    paint_frames_using_tiles(1, 12);
+    paint_frames_using_tiles(Web::Painting::RasterTilePool::frames_per_trim - 1, 2);
+    EXPECT_EQ(pool.allocated_tile_count(), 12u);
+
+    // A whole window of small repaints shrinks it to what they needed.
+    paint_frames_using_tiles(Web::Painting::RasterTilePool::frames_per_trim, 2);
+    EXPECT_EQ(pool.allocated_tile_count(), 2u);
+
+    pool.release_available_tiles();
+    EXPECT_EQ(pool.allocated_tile_count(), 0u);
+}
+
 TEST_CASE(oversized_backing_stores_are_rejected)
 {
     Compositor::BackingStoreManager manager;
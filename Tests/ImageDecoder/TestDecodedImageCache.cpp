@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <ImageDecoder/DecodedImageCache.h>
+#include <LibCore/AnonymousBuffer.h>
+#include <LibGfx/Bitmap.h>
+#include <LibTest/TestCase.h>
+
+using ImageDecoder::DecodedImageCache;
+
+// The cache refuses to hold images it can't seal read-only.
+static bool can_seal_read_only()
+{
+    auto buffer = MUST(Core::AnonymousBuffer::create_with_size(1, Core::AnonymousBuffer::Sealability::Sealable));
+    return !buffer.seal_read_only().is_error();
+}
+
+static DecodedImageCache::Image create_image(Gfx::IntSize size, Gfx::Color color)
+{
+    auto bitmap = MUST(Gfx::Bitmap::create(Gfx::BitmapFormat::BGRA8888, size));
+    for (int y = 0; y < size.height(); ++y) {
+        for (int x = 0; x < size.width(); ++x)
+            bitmap->set_pixel(x, y, color);
+    }
+    return { bitmap };
+}
+
+static ByteString key_for(StringView partition, StringView encoded_data)
+{
+    return DecodedImageCache::key_for(partition, encoded_data.bytes(), {}, {});
+}
+
+TEST_CASE(hit_returns_the_sealed_cached_image)
+{
+    if (!can_seal_read_only())
+        return;
+
+    DecodedImageCache cache;
+    auto key = key_for("https://example.com"sv, "logo"sv);
+
+    EXPECT(!cache.get(key).has_value());
+
+    auto stored = MUST(cache.set(key, create_image({ 8, 8 }, Gfx::Color::Red)));
+    EXPECT(stored.bitmap->anonymous_buffer().is_sealed_read_only());
+    EXPECT_EQ(stored.bitmap->get_pixel(3, 4), Gfx::Color::Red);
+
+    auto cached = cache.get(key);
+    VERIFY(cached.has_value());
+    EXPECT_EQ(cached->bitmap.ptr(), stored.bitmap.ptr());
+
+    // Storing the same image again keeps the first copy, so the client keeps sharing it.
+    auto stored_again = MUST(cache.set(key, create_image({ 8, 8 }, Gfx::Color::Red)));
+    EXPECT_EQ(stored_again.bitmap.ptr(), stored.bitmap.ptr());
+    EXPECT_EQ(cache.size_in_bytes(), stored.bitmap->size_in_bytes());
+}
+
+TEST_CASE(same_site_clients_share_images)
+{
+    if (!can_seal_read_only())
+        return;
+
+    DecodedImageCache cache;
+
+    // Two clients, e.g. two tabs, that decode the same image for the same top-level site compute the same key.
+    auto first_client_key = key_for("https://example.com"sv, "logo"sv);
+    auto second_client_key = key_for("https://example.com"sv, "logo"sv);
+    EXPECT_EQ(first_client_key, second_client_key);
+
+    auto stored = MUST(cache.set(first_client_key, create_image({ 8, 8 }, Gfx::Color::Red)));
+    auto cached = cache.get(second_client_key);
+    VERIFY(cached.has_value());
+    EXPECT_EQ(cached->bitmap.ptr(), stored.bitmap.ptr());
+}
+
+TEST_CASE(cross_site_clients_do_not_share_images)
+{
+    if (!can_seal_read_only())
+        return;
+
+    DecodedImageCache cache;
+    auto first_key = key_for("https://example.com"sv, "logo"sv);
+    auto second_key = key_for("https://example.org"sv, "logo"sv);
+    EXPECT_NE(first_key, second_key);
+
+    // The partition's length is part of the key, so a partition can't run into the encoded data.
+    EXPECT_NE(key_for("https://example.com"sv, "logo"sv), key_for("https://example.co"sv, "mlogo"sv));
+
+    auto first_image = MUST(cache.set(first_key, create_image({ 8, 8 }, Gfx::Color::Red)));
+    EXPECT(cache.get(first_key).has_value());
+    EXPECT(!cache.get(second_key).has_value());
+
+    auto second_image = MUST(cache.set(second_key, create_image({ 8, 8 }, Gfx::Color::Red)));
+    EXPECT_NE(first_image.bitmap.ptr(), second_image.bitmap.ptr());
+}
+
+TEST_CASE(evicts_the_least_recently_used_image)
+{
+    if (!can_seal_read_only())
+        return;
+
+    // Room for exactly four 8x8 images.
+    auto image_size_in_bytes = create_image({ 8, 8 }, Gfx::Color::Red).bitmap->size_in_bytes();
+    DecodedImageCache cache { 4 * image_size_in_bytes };
+
+    Vector<ByteString> keys;
+    for (auto name : { "a"sv, "b"sv, "c"sv, "d"sv, "e"sv })
+        keys.append(key_for("https://example.com"sv, name));
+
+    for (size_t i = 0; i < 4; ++i)
+        MUST(cache.set(keys[i], create_image({ 8, 8 }, Gfx::Color::Red)));
+    EXPECT_EQ(cache.size_in_bytes(), 4 * image_size_in_bytes);
+
+    // Using the oldest image makes the second one the least recently used.
+    EXPECT(cache.get(keys[0]).has_value());
+    MUST(cache.set(keys[4], create_image({ 8, 8 }, Gfx::Color::Blue)));
+
+    EXPECT(cache.get(keys[0]).has_value());
+    EXPECT(!cache.get(keys[1]).has_value());
+    EXPECT(cache.get(keys[2]).has_value());
+    EXPECT(cache.get(keys[3]).has_value());
+    EXPECT(cache.get(keys[4]).has_value());
+    EXPECT_EQ(cache.size_in_bytes(), 4 * image_size_in_bytes);
+}
+
+TEST_CASE(does_not_cache_images_larger_than_a_quarter_of_the_budget)
+{
+    if (!can_seal_read_only())
+        return;
+
+    auto image = create_image({ 16, 16 }, Gfx::Color::Red);
+    DecodedImageCache cache { 2 * image.bitmap->size_in_bytes() };
+    auto key = key_for("https://example.com"sv, "photo"sv);
+
+    auto stored = MUST(cache.set(key, image));
+    EXPECT_EQ(stored.bitmap.ptr(), image.bitmap.ptr());
+    EXPECT(!cache.get(key).has_value());
+    EXPECT_EQ(cache.size_in_bytes(), 0uz);
+}
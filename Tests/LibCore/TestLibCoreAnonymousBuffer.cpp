@@ -15,6 +15,8 @@
 #    include <AK/Windows.h>
 #else
 #    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <unistd.h>
 #endif
 
 TEST_CASE(create_with_size)
@@ -132,6 +134,34 @@ TEST_CASE(snapshot_rejects_a_buffer_larger_than_its_backing_store)
 }
 #endif
 
+#if defined(AK_OS_LINUX) && defined(F_SEAL_FUTURE_WRITE)
+TEST_CASE(seal_read_only)
+{
+    auto buffer = MUST(Core::AnonymousBuffer::create_with_size(128, Core::AnonymousBuffer::Sealability::Sealable));
+    EXPECT(!buffer.is_sealed_read_only());
+    MUST(buffer.seal_read_only());
+    EXPECT(buffer.is_sealed_read_only());
+
+    // The mapping that existed before sealing stays writable, and others see what it writes.
+    auto fd = MUST(Core::System::dup(buffer.fd()));
+    auto mirror = MUST(Core::AnonymousBuffer::create_from_anon_fd(fd, buffer.size()));
+    EXPECT(mirror.is_sealed_read_only());
+    buffer.data<char>()[0] = 'S';
+    EXPECT_EQ(mirror.data<char const>()[0], 'S');
+
+    // Nobody can map it writable or change its size anymore.
+    EXPECT_EQ(mmap(nullptr, buffer.size(), PROT_READ | PROT_WRITE, MAP_SHARED, buffer.fd(), 0), MAP_FAILED);
+    EXPECT_EQ(ftruncate(buffer.fd(), 0), -1);
+}
+
+TEST_CASE(seal_read_only_rejects_an_unsealable_buffer)
+{
+    auto buffer = MUST(Core::AnonymousBuffer::create_with_size(128));
+    EXPECT(buffer.seal_read_only().is_error());
+    EXPECT(!buffer.is_sealed_read_only());
+}
+
+
 #ifndef AK_OS_WINDOWS
 TEST_CASE(failed_creation_from_an_fd_closes_the_fd)
 {
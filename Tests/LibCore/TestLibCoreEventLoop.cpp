@@ -8,9 +8,13 @@
 #include <AK/Time.h>
 #include <AK/Vector.h>
 #include <LibCore/EventLoop.h>
+#include <LibCore/Notifier.h>
+#include <LibCore/System.h>
 #include <LibCore/Timer.h>
 #include <LibTest/TestCase.h>
 #include <LibThreading/Thread.h>
+#include <fcntl.h>
+#include <unistd.h>
 
 TEST_CASE(test_poll_for_events)
 {
@@ -125,3 +129,35 @@ TEST_CASE(stopped_timer_does_not_fire)
     loop.exec();
     EXPECT_EQ(stopped_count, 0);
 }
+
+TEST_CASE(notifiers_sharing_a_file_descriptor)
+{
+    Core::EventLoop loop;
+    auto fds = MUST(Core::System::pipe2(O_CLOEXEC));
+
+    int first_count = 0;
+    int second_count = 0;
+    auto first = Core::Notifier::construct(fds[0], Core::Notifier::Type::Read);
+    first->on_activation = [&] { ++first_count; };
+    auto second = Core::Notifier::construct(fds[0], Core::Notifier::Type::Read);
+    second->on_activation = [&] { ++second_count; };
+
+    char byte = 'x';
+    MUST(Core::System::write(fds[1], { &byte, 1 }));
+    loop.pump(Core::EventLoop::WaitMode::PollForEvents);
+    EXPECT_EQ(first_count, 1);
+    EXPECT_EQ(second_count, 1);
+
+    // Disabling one notifier must leave the other watching the file descriptor.
+    first->set_enabled(false);
+    loop.pump(Core::EventLoop::WaitMode::PollForEvents);
+    EXPECT_EQ(first_count, 1);
+    EXPECT_EQ(second_count, 2);
+
+    second->set_enabled(false);
+    loop.pump(Core::EventLoop::WaitMode::PollForEvents);
+    EXPECT_EQ(second_count, 2);
+
+    MUST(Core::System::close(fds[0]));
+    MUST(Core::System::close(fds[1]));
+}
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/ByteBuffer.h>
+#include <AK/Vector.h>
+#include <LibCore/SharedByteRing.h>
+#include <LibTest/TestCase.h>
+#include <LibThreading/Thread.h>
+
+static constexpr size_t test_capacity = 16;
+
+static ByteBuffer read_everything(Core::SharedByteRing& ring)
+{
+    ByteBuffer result;
+    while (true) {
+        auto bytes = MUST(ring.peek_some_contiguous());
+        if (bytes.is_empty())
+            return result;
+        result.append(bytes);
+        (void)ring.consume(bytes.size());
+    }
+}
+
+TEST_CASE(write_and_read_across_the_wrap_around)
+{
+    auto writer = MUST(Core::SharedByteRing::create(test_capacity));
+    auto reader = MUST(Core::SharedByteRing::adopt(writer.anonymous_buffer()));
+    EXPECT_EQ(reader.capacity(), test_capacity);
+    EXPECT(reader.is_empty());
+
+    EXPECT_EQ(MUST(writer.write("0123456789"sv.bytes())), 10uz);
+    EXPECT_EQ(read_everything(reader).bytes(), "0123456789"sv.bytes());
+
+    // This write wraps around the end of the ring, so it is read back in two runs.
+    EXPECT_EQ(MUST(writer.write("abcdefghij"sv.bytes())), 10uz);
+    EXPECT_EQ(MUST(reader.peek_some_contiguous()), "abcdef"sv.bytes());
+    EXPECT_EQ(read_everything(reader).bytes(), "abcdefghij"sv.bytes());
+    EXPECT(reader.is_empty());
+}
+
+TEST_CASE(write_stops_when_full)
+{
+    auto writer = MUST(Core::SharedByteRing::create(test_capacity));
+    auto reader = MUST(Core::SharedByteRing::adopt(writer.anonymous_buffer()));
+
+    EXPECT_EQ(MUST(writer.write("0123456789abcdefXYZ"sv.bytes())), test_capacity);
+    EXPECT_EQ(MUST(writer.write("XYZ"sv.bytes())), 0uz);
+
+    // Nothing was consumed yet, so there is nothing to wait for.
+    EXPECT(writer.wait_for_space());
+
+    // Making space wakes up the writer, but only once.
+    EXPECT(reader.consume(4));
+    EXPECT(!reader.consume(4));
+
+    EXPECT_EQ(MUST(writer.write("XYZ"sv.bytes())), 3uz);
+    EXPECT_EQ(read_everything(reader).bytes(), "89abcdefXYZ"sv.bytes());
+}
+
+TEST_CASE(reader_is_woken_up_once_per_catch_up)
+{
+    auto writer = MUST(Core::SharedByteRing::create(test_capacity));
+    auto reader = MUST(Core::SharedByteRing::adopt(writer.anonymous_buffer()));
+
+    EXPECT_EQ(MUST(writer.write("a"sv.bytes())), 1uz);
+    EXPECT(writer.needs_to_wake_reader());
+    EXPECT_EQ(MUST(writer.write("b"sv.bytes())), 1uz);
+    EXPECT(!writer.needs_to_wake_reader());
+
+    reader.did_wake_reader();
+    EXPECT_EQ(read_everything(reader).bytes(), "ab"sv.bytes());
+
+    EXPECT_EQ(MUST(writer.write("c"sv.bytes())), 1uz);
+    EXPECT(writer.needs_to_wake_reader());
+}
+
+TEST_CASE(adopt_rejects_invalid_sizes)
+{
+    auto buffer = MUST(Core::AnonymousBuffer::create_with_size(100));
+    EXPECT(Core::SharedByteRing::adopt(buffer).is_error());
+}
+
+TEST_CASE(reader_rejects_corrupted_positions)
+{
+    auto writer = MUST(Core::SharedByteRing::create(test_capacity));
+    auto reader = MUST(Core::SharedByteRing::adopt(writer.anonymous_buffer()));
+
+    // A reader that claims to have consumed more than was written must not make the writer overrun the ring.
+    (void)reader.consume(test_capacity * 2);
+    EXPECT(writer.write("a"sv.bytes()).is_error());
+    EXPECT(reader.peek_some_contiguous().is_error());
+}
+
+TEST_CASE(producer_consumer_multithread)
+{
+    static constexpr size_t byte_count = 1 * MiB;
+
+    IGNORE_USE_IN_ESCAPING_LAMBDA auto ring = MUST(Core::SharedByteRing::create(4 * KiB));
+    IGNORE_USE_IN_ESCAPING_LAMBDA Atomic<bool> consumer_read_wrong_byte { false };
+
+    auto consumer = Threading::Thread::construct("RingConsumer"sv, [&ring, &consumer_read_wrong_byte]() {
+        auto reader = MUST(Core::SharedByteRing::adopt(ring.anonymous_buffer()));
+        size_t expected_byte = 0;
+        while (expected_byte < byte_count) {
+            auto bytes = MUST(reader.peek_some_contiguous());
+            for (auto byte : bytes) {
+                if (byte != static_cast<u8>(expected_byte++))
+                    consumer_read_wrong_byte.store(true);
+            }
+            (void)reader.consume(bytes.size());
+        }
+        return 0;
+    });
+    consumer->start();
+
+    Vector<u8> chunk;
+    for (size_t i = 0; i < 1024; ++i)
+        chunk.append(static_cast<u8>(i));
+
+    size_t written_byte_count = 0;
+    while (written_byte_count < byte_count) {
+        auto offset = written_byte_count % chunk.size();
+        auto size = min(chunk.size() - offset, byte_count - written_byte_count);
+        written_byte_count += MUST(ring.write(chunk.span().slice(offset, size)));
+    }
+
+    (void)consumer->join();
+    EXPECT(!consumer_read_wrong_byte.load());
+    EXPECT(ring.is_empty());
+}
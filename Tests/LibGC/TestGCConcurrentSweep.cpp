@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Atomic.h>
+#include <AK/Vector.h>
+#include <LibGC/Cell.h>
+#include <LibGC/CellAllocator.h>
+#include <LibGC/Heap.h>
+#include <LibGC/Ptr.h>
+#include <LibGC/Root.h>
+#include <LibTest/TestCase.h>
+
+#include "TestGCHelpers.h"
+
+namespace {
+
+// Destructors of this type run on the background sweeper thread.
+Atomic<size_t> s_live_swept_cells = 0;
+
+class SweptCell final : public GC::Cell {
+    GC_CELL(SweptCell, GC::Cell);
+    GC_DECLARE_ALLOCATOR(SweptCell);
+
+public:
+    static constexpr bool SWEEPS_CONCURRENTLY = true;
+
+    virtual ~SweptCell() override { s_live_swept_cells.fetch_sub(1); }
+
+    GC::Ptr<SweptCell> next() const { return m_next; }
+    void set_next(GC::Ptr<SweptCell> next) { m_next = next; }
+
+private:
+    SweptCell() { s_live_swept_cells.fetch_add(1); }
+
+    virtual void visit_edges(Visitor& visitor) override
+    {
+        Base::visit_edges(visitor);
+        visitor.visit(m_next);
+    }
+
+    GC::Ptr<SweptCell> m_next;
+};
+
+GC_DEFINE_ALLOCATOR(SweptCell);
+
+NEVER_INLINE GC::Root<SweptCell> allocate_chain(GC::Heap& heap, size_t length)
+{
+    auto head = GC::make_root(heap.allocate<SweptCell>());
+    GC::Ptr<SweptCell> tail = head.ptr();
+    for (size_t i = 1; i < length; ++i) {
+        auto cell = heap.allocate<SweptCell>();
+        tail->set_next(cell);
+        tail = cell;
+    }
+    return head;
+}
+
+NEVER_INLINE void allocate_garbage(GC::Heap& heap, size_t count)
+{
+    for (size_t i = 0; i < count; ++i)
+        (void)heap.allocate<SweptCell>();
+}
+
+}
+
+TEST_CASE(concurrent_sweep_frees_unreachable_cells)
+{
+    GC::Heap heap([](auto&) { }, GC::Heap::BecomeProcessDefault::No);
+
+    auto chain = allocate_chain(heap, 1000);
+    allocate_garbage(heap, 20'000);
+    EXPECT_EQ(s_live_swept_cells.load(), 21'000u);
+
+    // The first collection hands the dead cells to the background sweeper; the next one waits for it to finish.
+    scrub_stack();
+    heap.collect_garbage();
+    scrub_stack();
+    heap.collect_garbage();
+    EXPECT_EQ(s_live_swept_cells.load(), 1000u);
+
+    chain = {};
+    scrub_stack();
+    heap.collect_garbage(GC::Heap::CollectionType::CollectEverything);
+    EXPECT_EQ(s_live_swept_cells.load(), 0u);
+}
+
+TEST_CASE(cells_allocated_during_concurrent_sweep_survive)
+{
+    GC::Heap heap([](auto&) { }, GC::Heap::BecomeProcessDefault::No);
+
+    allocate_garbage(heap, 20'000);
+    scrub_stack();
+    heap.collect_garbage();
+
+    // These land in fresh blocks while the old ones may still be out on the sweeper thread.
+    auto chain = allocate_chain(heap, 500);
+    scrub_stack();
+    heap.collect_garbage();
+    EXPECT_EQ(s_live_swept_cells.load(), 500u);
+
+    size_t length = 0;
+    for (GC::Ptr<SweptCell> cell = chain.ptr(); cell; cell = cell->next())
+        ++length;
+    EXPECT_EQ(length, 500u);
+
+    chain = {};
+    scrub_stack();
+    heap.collect_garbage(GC::Heap::CollectionType::CollectEverything);
+    EXPECT_EQ(s_live_swept_cells.load(), 0u);
+}
+
+TEST_CASE(cells_stop_being_young_once_they_survive_a_sweep)
+{
+    GC::Heap heap([](auto&) { }, GC::Heap::BecomeProcessDefault::No);
+
+    auto chain = allocate_chain(heap, 500);
+    for (GC::Ptr<SweptCell> cell = chain.ptr(); cell; cell = cell->next())
+        EXPECT(cell->is_young());
+
+    scrub_stack();
+    heap.collect_garbage();
+    scrub_stack();
+    heap.collect_garbage();
+
+    for (GC::Ptr<SweptCell> cell = chain.ptr(); cell; cell = cell->next())
+        EXPECT(!cell->is_young());
+    EXPECT(heap.allocate<SweptCell>()->is_young());
+
+    chain = {};
+    scrub_stack();
+    heap.collect_garbage(GC::Heap::CollectionType::CollectEverything);
+    EXPECT_EQ(s_live_swept_cells.load(), 0u);
+}
@@ -22,6 +22,8 @@
 #include <LibGC/WeakHashMap.h>
 #include <LibTest/TestCase.h>
 
+#include "TestGCHelpers.h"
+
 class TestCell : public GC::Cell {
     GC_CELL(TestCell, GC::Cell);
     GC_DECLARE_ALLOCATOR(TestCell);
@@ -38,13 +40,6 @@ static GC::Heap& test_heap()
     return *heap;
 }
 
-static NEVER_INLINE void scrub_stack()
-{
-    u8 volatile filler[8 * KiB];
-    for (size_t i = 0; i < sizeof(filler); ++i)
-        filler[i] = 0;
-}
-
 TEST_SETUP
 {
     GC::Heap::set_default_heap_for_testing(test_heap());
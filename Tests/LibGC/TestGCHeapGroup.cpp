@@ -13,6 +13,8 @@
 #include <LibGC/Root.h>
 #include <LibTest/TestCase.h>
 
+#include "TestGCHelpers.h"
+
 namespace {
 
 size_t s_live_linked_cells = 0;
@@ -43,13 +45,6 @@ private:
 
 GC_DEFINE_ALLOCATOR(LinkedCell);
 
-NEVER_INLINE void scrub_stack()
-{
-    u8 volatile filler[8 * KiB];
-    for (size_t i = 0; i < sizeof(filler); ++i)
-        filler[i] = 0;
-}
-
 NEVER_INLINE GC::Root<LinkedCell> allocate_holder_and_foreign_target(GC::Heap& holder_heap, GC::Heap& target_heap)
 {
     auto holder = GC::make_root(holder_heap.allocate<LinkedCell>());
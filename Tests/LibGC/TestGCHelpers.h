@@ -0,0 +1,19 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Platform.h>
+#include <AK/Types.h>
+
+// Overwrites the stack below the caller, so that pointers left behind by earlier calls are not found by the
+// conservative stack scan and do not keep cells alive that a test expects to be collected.
+NEVER_INLINE inline void scrub_stack()
+{
+    u8 volatile filler[8 * KiB];
+    for (size_t i = 0; i < sizeof(filler); ++i)
+        filler[i] = 0;
+}
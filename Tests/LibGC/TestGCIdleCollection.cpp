@@ -56,3 +56,20 @@ TEST_CASE(parks_when_there_is_nothing_to_collect)
     policy.reset(0);
     EXPECT(policy.evaluate(4 * MiB, 0, 8 * MiB) == Decision::Park);
 }
+
+TEST_CASE(rate_drop_gate_discounts_young_cells_that_survive)
+{
+    GC::IdleCollectionPolicy policy;
+    policy.did_sweep_young_cells(1 * MiB, 9 * MiB);
+    policy.reset(0);
+
+    // 4 MiB allocated would clear the gate (0.5 MiB here) on its own, but only a tenth of it is expected to be garbage.
+    EXPECT(policy.evaluate(4 * MiB, 4 * MiB, 8 * MiB) == Decision::KeepWaiting);
+    EXPECT(policy.evaluate(4 * MiB, 4 * MiB, 8 * MiB) == Decision::KeepWaiting);
+
+    // Once most young cells die again, the same allocation is worth collecting.
+    policy.did_sweep_young_cells(9 * MiB, 1 * MiB);
+    policy.reset(0);
+    EXPECT(policy.evaluate(4 * MiB, 4 * MiB, 8 * MiB) == Decision::KeepWaiting);
+    EXPECT(policy.evaluate(4 * MiB, 4 * MiB, 8 * MiB) == Decision::Collect);
+}
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/ScopeGuard.h>
+#include <AK/Vector.h>
+#include <LibGC/Cell.h>
+#include <LibGC/CellAllocator.h>
+#include <LibGC/Heap.h>
+#include <LibGC/Ptr.h>
+#include <LibGC/Root.h>
+#include <LibTest/TestCase.h>
+
+#include "TestGCHelpers.h"
+
+namespace {
+
+size_t s_live_graph_cells = 0;
+
+class GraphCell final : public GC::Cell {
+    GC_CELL(GraphCell, GC::Cell);
+    GC_DECLARE_ALLOCATOR(GraphCell);
+
+public:
+    virtual ~GraphCell() override { --s_live_graph_cells; }
+
+    Vector<GC::Ptr<GraphCell>>& edges() { return m_edges; }
+
+private:
+    GraphCell() { ++s_live_graph_cells; }
+
+    virtual void visit_edges(Visitor& visitor) override
+    {
+        Base::visit_edges(visitor);
+        visitor.visit(m_edges);
+    }
+
+    Vector<GC::Ptr<GraphCell>> m_edges;
+};
+
+GC_DEFINE_ALLOCATOR(GraphCell);
+
+// Builds a wide tree whose leaves also point back into the tree, so that several marking threads race to mark the
+// same cells.
+NEVER_INLINE GC::Root<GraphCell> allocate_shared_graph(GC::Heap& heap, size_t fan_out, size_t depth)
+{
+    auto root = GC::make_root(heap.allocate<GraphCell>());
+    Vector<GC::Ref<GraphCell>> level;
+    level.append(*root);
+    Vector<GC::Ref<GraphCell>> all_cells;
+
+    for (size_t d = 0; d < depth; ++d) {
+        Vector<GC::Ref<GraphCell>> next_level;
+        for (auto& parent : level) {
+            for (size_t i = 0; i < fan_out; ++i) {
+                auto child = heap.allocate<GraphCell>();
+                parent->edges().append(child);
+                next_level.append(child);
+                all_cells.append(child);
+            }
+        }
+        level = move(next_level);
+    }
+
+    for (size_t i = 0; i < level.size(); ++i)
+        level[i]->edges().append(all_cells[(i * 7919) % all_cells.size()]);
+
+    return root;
+}
+
+}
+
+TEST_CASE(parallel_marking_keeps_reachable_graph_alive)
+{
+    GC::Heap heap([](auto&) { }, GC::Heap::BecomeProcessDefault::No);
+    heap.set_incremental_sweep_enabled(false);
+
+    GC::Heap::set_parallel_marking_helper_count(4);
+    ScopeGuard reset_helpers = [] { GC::Heap::set_parallel_marking_helper_count(0); };
+
+    auto root = allocate_shared_graph(heap, 8, 5);
+    auto expected_cells = s_live_graph_cells;
+    EXPECT(expected_cells > 30'000u);
+
+    for (size_t i = 0; i < 3; ++i) {
+        scrub_stack();
+        heap.collect_garbage();
+        EXPECT_EQ(s_live_graph_cells, expected_cells);
+    }
+
+    root->edges().clear();
+    scrub_stack();
+    heap.collect_garbage();
+    EXPECT_EQ(s_live_graph_cells, 1u);
+}
+
+TEST_CASE(parallel_marking_with_tiny_heap)
+{
+    GC::Heap heap([](auto&) { }, GC::Heap::BecomeProcessDefault::No);
+    heap.set_incremental_sweep_enabled(false);
+
+    GC::Heap::set_parallel_marking_helper_count(2);
+    ScopeGuard reset_helpers = [] { GC::Heap::set_parallel_marking_helper_count(0); };
+
+    auto root = GC::make_root(heap.allocate<GraphCell>());
+    scrub_stack();
+    heap.collect_garbage();
+    EXPECT_EQ(s_live_graph_cells, 1u);
+}
@@ -16,6 +16,10 @@
 #include <LibIPC/Message.h>
 #include <LibTest/TestCase.h>
 
+#ifndef AK_OS_WINDOWS
+#    include <fcntl.h>
+#endif
+
 TEST_CASE(ipc_decode_rejects_undersized_single_frame_backing)
 {
     // Issue #10036: A single-frame BitmapSequence whose metadata describes a 50000x10 (2,000,000-byte) bitmap but ships
@@ -75,3 +79,63 @@ TEST_CASE(create_with_raw_data_rejects_undersized_data)
     auto result = Gfx::Bitmap::create_with_raw_data(Gfx::BitmapFormat::BGRA8888, Gfx::AlphaType::Premultiplied, tiny, Gfx::IntSize { 50000, 10 });
     EXPECT(result.is_error());
 }
+
+static Gfx::BitmapSequence round_trip_over_ipc(Gfx::BitmapSequence const& bitmap_sequence)
+{
+    IPC::MessageBuffer message_buffer;
+    IPC::Encoder encoder { message_buffer };
+    MUST(encoder.encode(bitmap_sequence));
+
+    auto data = message_buffer.take_data();
+    FixedMemoryStream stream { data.span() };
+
+    Queue<IPC::Attachment> attachments;
+    for (auto& attachment : message_buffer.take_attachments())
+        attachments.enqueue(move(attachment));
+
+    IPC::Decoder decoder { stream, attachments };
+    return MUST(IPC::decode<Gfx::BitmapSequence>(decoder));
+}
+
+static NonnullRefPtr<Gfx::Bitmap> create_exactly_sized_bitmap(Gfx::IntSize size, Core::AnonymousBuffer::Sealability sealability)
+{
+    auto required = Gfx::Bitmap::size_in_bytes(Gfx::Bitmap::minimum_pitch(size.width(), Gfx::BitmapFormat::BGRA8888), size.height());
+    auto buffer = MUST(Core::AnonymousBuffer::create_with_size(required, sealability));
+    if (sealability == Core::AnonymousBuffer::Sealability::Sealable)
+        MUST(buffer.seal_read_only());
+    return MUST(Gfx::Bitmap::create_with_anonymous_buffer(Gfx::BitmapFormat::BGRA8888, Gfx::AlphaType::Premultiplied, move(buffer), size));
+}
+
+TEST_CASE(ipc_single_frame_copies_unsealed_backing)
+{
+    auto bitmap = create_exactly_sized_bitmap({ 16, 16 }, Core::AnonymousBuffer::Sealability::Unsealable);
+    bitmap->set_pixel(3, 4, Gfx::Color::Red);
+
+    auto result = round_trip_over_ipc(Gfx::BitmapSequence { { bitmap } });
+    EXPECT_EQ(result.bitmaps.size(), 1uz);
+    auto received_bitmap = result.bitmaps.first();
+    EXPECT_EQ(received_bitmap->get_pixel(3, 4), Gfx::Color::Red);
+
+    // Anyone holding a writable mapping could change the pixels, so the receiving side gets a copy.
+    bitmap->set_pixel(5, 6, Gfx::Color::Blue);
+    EXPECT_NE(received_bitmap->get_pixel(5, 6), Gfx::Color::Blue);
+}
+
+#if defined(AK_OS_LINUX) && defined(F_SEAL_FUTURE_WRITE)
+TEST_CASE(ipc_single_frame_shares_sealed_backing)
+{
+    // The bitmap keeps the writable mapping it had before the buffer was sealed.
+    auto bitmap = create_exactly_sized_bitmap({ 16, 16 }, Core::AnonymousBuffer::Sealability::Sealable);
+    bitmap->set_pixel(3, 4, Gfx::Color::Red);
+
+    auto result = round_trip_over_ipc(Gfx::BitmapSequence { { bitmap } });
+    EXPECT_EQ(result.bitmaps.size(), 1uz);
+    auto received_bitmap = result.bitmaps.first();
+    EXPECT_EQ(received_bitmap->get_pixel(3, 4), Gfx::Color::Red);
+    EXPECT(received_bitmap->anonymous_buffer().is_sealed_read_only());
+
+    // The receiving side maps the same memory, rather than a copy of it.
+    bitmap->set_pixel(5, 6, Gfx::Color::Blue);
+    EXPECT_EQ(received_bitmap->get_pixel(5, 6), Gfx::Color::Blue);
+}
+#endif
@@ -54,14 +54,19 @@ TEST_CASE(text_font_is_not_emoji_font)
     EXPECT(!font_is_emoji(TEST_INPUT("fonts/text.ttf"sv)));
 }
 
-static NonnullRefPtr<Gfx::Font> load_text_font(float point_size)
+static NonnullRefPtr<Gfx::Font> load_font(StringView path, float point_size)
 {
-    auto file = MUST(Core::MappedFile::map(TEST_INPUT("fonts/text.ttf"sv)));
+    auto file = MUST(Core::MappedFile::map(path));
     // The typeface outlives the mapping, so let it own a copy of the font data.
     auto typeface = MUST(Gfx::Typeface::try_load_from_temporary_memory(file->bytes()));
     return adopt_ref(*new Gfx::Font(typeface, point_size, point_size, {}, {}));
 }
 
+static NonnullRefPtr<Gfx::Font> load_text_font(float point_size)
+{
+    return load_font(TEST_INPUT("fonts/text.ttf"sv), point_size);
+}
+
 static NonnullRefPtr<Gfx::GlyphRun> shape(Gfx::Font const& font, StringView text)
 {
     auto utf16_text = Utf16String::from_utf8(text);
@@ -151,3 +156,115 @@ TEST_CASE(glyph_run_intercepts)
     // A degenerate scale produces nothing.
     EXPECT(run->get_glyph_intercepts(0, mid_x_height - 1, mid_x_height + 1).is_empty());
 }
+
+static NonnullRefPtr<Gfx::GlyphRun> shape(Gfx::Font const& font, Utf16View const& text, Gfx::TrailingWhitespace* trailing_whitespace = nullptr)
+{
+    return Gfx::shape_text({}, 0, 0, text, font, Gfx::GlyphRun::TextType::Common, trailing_whitespace);
+}
+
+// Text that is shaped one word at a time is stitched together into the same run as if it was shaped all at once.
+TEST_CASE(shape_stitched_from_words_matches_whole_run)
+{
+    auto font = load_font(TEST_INPUT("fonts/text-with-space.ttf"sv), 16);
+    EXPECT(font->typeface().can_shape_words_separately());
+
+    for (auto text : { "AC bAC  cab"sv, "abc AC "sv, "  AC ab   "sv, "a b c"sv }) {
+        // ASCII storage takes the per-word path, while the same text in UTF-16 storage is shaped as one run.
+        auto ascii_text = Utf16String::from_utf8(text);
+        EXPECT(ascii_text.has_ascii_storage());
+        Vector<char16_t> utf16_code_units;
+        for (auto code_unit : text)
+            utf16_code_units.append(code_unit);
+        Utf16View utf16_text { utf16_code_units.data(), utf16_code_units.size() };
+        EXPECT(!utf16_text.has_ascii_storage());
+
+        Gfx::TrailingWhitespace stitched_trailing_whitespace;
+        auto stitched = shape(font, ascii_text.utf16_view(), &stitched_trailing_whitespace);
+
+        // The words were cached on their own, not the whole run.
+        EXPECT(!Gfx::shaping_cache_contains_for_testing(ascii_text.utf16_view(), font));
+
+        Gfx::TrailingWhitespace whole_trailing_whitespace;
+        auto whole = shape(font, utf16_text, &whole_trailing_whitespace);
+
+        EXPECT_EQ(stitched->glyphs().size(), whole->glyphs().size());
+        for (size_t i = 0; i < min(stitched->glyphs().size(), whole->glyphs().size()); ++i) {
+            auto const& stitched_glyph = stitched->glyphs()[i];
+            auto const& whole_glyph = whole->glyphs()[i];
+            EXPECT_EQ(stitched_glyph.glyph_id, whole_glyph.glyph_id);
+            EXPECT_EQ(stitched_glyph.length_in_code_units, whole_glyph.length_in_code_units);
+            EXPECT_APPROXIMATE(stitched_glyph.position.x(), whole_glyph.position.x());
+            EXPECT_APPROXIMATE(stitched_glyph.position.y(), whole_glyph.position.y());
+            EXPECT_APPROXIMATE(stitched_glyph.glyph_width, whole_glyph.glyph_width);
+        }
+        EXPECT_APPROXIMATE(stitched->width(), whole->width());
+        EXPECT_EQ(stitched_trailing_whitespace.length_in_code_units, whole_trailing_whitespace.length_in_code_units);
+        EXPECT_APPROXIMATE(stitched_trailing_whitespace.advance, whole_trailing_whitespace.advance);
+    }
+}
+
+// A face that kerns a glyph against the space glyph would shape words differently on their own.
+TEST_CASE(kerning_against_space_prevents_shaping_words_separately)
+{
+    EXPECT(!load_font(TEST_INPUT("fonts/text-with-space-kerning.ttf"sv), 16)->typeface().can_shape_words_separately());
+
+    // Without a space glyph, there is nothing to stitch words with.
+    EXPECT(!load_text_font(16)->typeface().can_shape_words_separately());
+
+    // Text in such a face is shaped and cached as a whole run, so the pair is still applied.
+    auto kerning_font = load_font(TEST_INPUT("fonts/text-with-space-kerning.ttf"sv), 16);
+    auto font = load_font(TEST_INPUT("fonts/text-with-space.ttf"sv), 16);
+    auto text = Utf16String::from_utf8("bA ab"sv);
+    auto kerned_run = shape(kerning_font, text.utf16_view());
+    EXPECT(Gfx::shaping_cache_contains_for_testing(text.utf16_view(), kerning_font));
+    EXPECT_EQ(kerned_run->glyphs().size(), 5u);
+    EXPECT(kerned_run->width() < shape(font, text.utf16_view())->width());
+}
+
+// Once the cache is full, the least recently used shapes are evicted to keep it within its budget.
+TEST_CASE(shaping_cache_evicts_least_recently_used_within_budget)
+{
+    static constexpr size_t memory_budget = 16 * KiB;
+    Gfx::set_shaping_cache_memory_budget_for_testing(memory_budget);
+    auto state = Gfx::shaping_cache_state_for_testing();
+    EXPECT_EQ(state.memory_budget, memory_budget);
+    EXPECT(state.size_in_bytes <= memory_budget);
+
+    auto font = load_text_font(16);
+    auto word_for_index = [](size_t index) {
+        StringBuilder builder;
+        for (size_t i = 0; i < 6; ++i) {
+            builder.append("abcABC"[index % 6]);
+            index /= 6;
+        }
+        return Utf16String::from_utf8(builder.string_view());
+    };
+
+    auto recently_used_word = word_for_index(0);
+    auto unused_word = word_for_index(1);
+    shape(font, recently_used_word.utf16_view());
+    shape(font, unused_word.utf16_view());
+
+    for (size_t i = 2; i < 2000; ++i) {
+        shape(font, word_for_index(i).utf16_view());
+        shape(font, recently_used_word.utf16_view());
+
+        state = Gfx::shaping_cache_state_for_testing();
+        EXPECT(state.size_in_bytes <= memory_budget);
+    }
+
+    EXPECT(state.entry_count > 0);
+    EXPECT(state.entry_count < 2000);
+    EXPECT(Gfx::shaping_cache_contains_for_testing(recently_used_word.utf16_view(), font));
+    EXPECT(!Gfx::shaping_cache_contains_for_testing(unused_word.utf16_view(), font));
+    EXPECT(Gfx::shaping_cache_contains_for_testing(word_for_index(1999).utf16_view(), font));
+    EXPECT(!Gfx::shaping_cache_contains_for_testing(word_for_index(2).utf16_view(), font));
+
+    // Lowering the budget evicts right away.
+    Gfx::set_shaping_cache_memory_budget_for_testing(memory_budget / 2);
+    EXPECT(Gfx::shaping_cache_state_for_testing().size_in_bytes <= memory_budget / 2);
+    EXPECT(Gfx::shaping_cache_state_for_testing().entry_count < state.entry_count);
+
+    Gfx::set_shaping_cache_memory_budget_for_testing({});
+    EXPECT_EQ(Gfx::shaping_cache_state_for_testing().memory_budget, 16 * MiB);
+}
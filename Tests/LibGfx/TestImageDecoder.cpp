@@ -547,6 +547,44 @@ TEST_CASE(test_jpeg_malformed_frame)
     }
 }
 
+TEST_CASE(test_jpeg_truncated_baseline_keeps_decoded_rows)
+{
+    auto file = TRY_OR_FAIL(Core::MappedFile::map(TEST_INPUT("jpg/rgb24.jpg"sv)));
+    auto truncated_bytes = file->bytes().slice(0, file->size() / 2);
+    auto plugin_decoder = TRY_OR_FAIL(Gfx::JPEGImageDecoderPlugin::create(truncated_bytes));
+
+    auto frame = TRY_OR_FAIL(expect_single_frame_of_size(*plugin_decoder, { 127, 64 }));
+    EXPECT_EQ(frame.image->get_pixel(0, 0).alpha(), 255);
+    EXPECT_EQ(frame.image->get_pixel(0, 63), Gfx::Color::NamedColor::Transparent);
+}
+
+TEST_CASE(test_jpeg_truncated_progressive_shows_earlier_scans)
+{
+    auto file = TRY_OR_FAIL(Core::MappedFile::map(TEST_INPUT("jpg/successive_approximation.jpg"sv)));
+    auto truncated_bytes = file->bytes().slice(0, file->size() / 2);
+    auto plugin_decoder = TRY_OR_FAIL(Gfx::JPEGImageDecoderPlugin::create(truncated_bytes));
+
+    // Every row gets something from the scans that did arrive, even though the last of them is incomplete.
+    auto frame = TRY_OR_FAIL(expect_single_frame_of_size(*plugin_decoder, { 600, 800 }));
+    EXPECT_EQ(frame.image->get_pixel(0, 0).alpha(), 255);
+    EXPECT_EQ(frame.image->get_pixel(599, 799).alpha(), 255);
+}
+
+TEST_CASE(test_jpeg_decodes_at_reduced_resolution_for_ideal_size)
+{
+    auto file = TRY_OR_FAIL(Core::MappedFile::map(TEST_INPUT("jpg/several_scans.jpg"sv)));
+    auto plugin_decoder = TRY_OR_FAIL(Gfx::JPEGImageDecoderPlugin::create(file->bytes()));
+
+    // 1/4 of the full resolution is the smallest scale that still covers the ideal size.
+    auto frame = TRY_OR_FAIL(plugin_decoder->frame(0, Gfx::IntSize { 100, 100 }));
+    EXPECT_EQ(frame.image->size(), Gfx::IntSize(148, 200));
+    EXPECT_EQ(plugin_decoder->size(), Gfx::IntSize(592, 800));
+
+    // Asking for the full image afterwards decodes it again.
+    frame = TRY_OR_FAIL(plugin_decoder->frame(0));
+    EXPECT_EQ(frame.image->size(), Gfx::IntSize(592, 800));
+}
+
 TEST_CASE(test_png)
 {
     auto file = TRY_OR_FAIL(Core::MappedFile::map(TEST_INPUT("png/buggie.png"sv)));
@@ -556,6 +594,22 @@ TEST_CASE(test_png)
     TRY_OR_FAIL(expect_single_frame(*plugin_decoder));
 }
 
+TEST_CASE(test_png_downscaled_for_ideal_size)
+{
+    auto file = TRY_OR_FAIL(Core::MappedFile::map(TEST_INPUT("png/buggie.png"sv)));
+    auto decoder = TRY_OR_FAIL(Gfx::ImageDecoder::try_create_for_raw_bytes(file->bytes()));
+    EXPECT(decoder);
+
+    // PNG has no reduced-resolution decoding, so ImageDecoder downscales the full frame instead.
+    auto frame = TRY_OR_FAIL(decoder->frame(0, Gfx::IntSize { 16, 16 }));
+    EXPECT_EQ(frame.image->size(), Gfx::IntSize(16, 35));
+    EXPECT_EQ(decoder->size(), Gfx::IntSize(64, 138));
+
+    // Without an ideal size, we get the full frame.
+    frame = TRY_OR_FAIL(decoder->frame(0));
+    EXPECT_EQ(frame.image->size(), Gfx::IntSize(64, 138));
+}
+
 TEST_CASE(test_apng)
 {
     auto file = TRY_OR_FAIL(Core::MappedFile::map(TEST_INPUT("png/apng-1-frame.png"sv)));
@@ -650,6 +704,45 @@ TEST_CASE(test_png_corrupt_idat_does_not_leak_on_libpng_longjmp)
         (void)plugin_or_error.release_value()->frame(0);
 }
 
+// The gradient fixtures are 16x16, with pixel (x, y) set to rgb(x * 16, y * 16, 128). Their image data is stored
+// uncompressed and split across small IDAT chunks, so cutting the file in half stops libpng at a predictable row.
+TEST_CASE(test_png_truncated_keeps_decoded_rows)
+{
+    auto file = TRY_OR_FAIL(Core::MappedFile::map(TEST_INPUT("png/gradient.png"sv)));
+    auto truncated_bytes = file->bytes().slice(0, file->size() / 2);
+    auto plugin_decoder = TRY_OR_FAIL(Gfx::PNGImageDecoderPlugin::create(truncated_bytes));
+
+    // The first seven rows arrived; everything after them is still transparent.
+    auto frame = TRY_OR_FAIL(expect_single_frame_of_size(*plugin_decoder, { 16, 16 }));
+    EXPECT_EQ(frame.image->get_pixel(0, 0), Gfx::Color(0x00, 0x00, 0x80));
+    EXPECT_EQ(frame.image->get_pixel(15, 6), Gfx::Color(0xf0, 0x60, 0x80));
+    EXPECT_EQ(frame.image->get_pixel(0, 7), Gfx::Color::NamedColor::Transparent);
+    EXPECT_EQ(frame.image->get_pixel(15, 15), Gfx::Color::NamedColor::Transparent);
+}
+
+TEST_CASE(test_png_truncated_interlaced_shows_earlier_passes)
+{
+    auto file = TRY_OR_FAIL(Core::MappedFile::map(TEST_INPUT("png/gradient-adam7.png"sv)));
+    auto truncated_bytes = file->bytes().slice(0, file->size() / 2);
+    auto plugin_decoder = TRY_OR_FAIL(Gfx::PNGImageDecoderPlugin::create(truncated_bytes));
+
+    // The data stops partway through the sixth Adam7 pass. Every pixel is covered by one of the passes that did arrive.
+    auto frame = TRY_OR_FAIL(expect_single_frame_of_size(*plugin_decoder, { 16, 16 }));
+    for (int y = 0; y < 16; ++y) {
+        for (int x = 0; x < 16; ++x)
+            EXPECT_EQ(frame.image->get_pixel(x, y).alpha(), 255);
+    }
+
+    // Even rows up to row 10 have all their pixels, and each odd row still repeats the row above it.
+    EXPECT_EQ(frame.image->get_pixel(3, 2), Gfx::Color(0x30, 0x20, 0x80));
+    EXPECT_EQ(frame.image->get_pixel(3, 3), Gfx::Color(0x30, 0x20, 0x80));
+    EXPECT_EQ(frame.image->get_pixel(15, 10), Gfx::Color(0xf0, 0xa0, 0x80));
+
+    // Further down, the odd columns of the sixth pass are missing, so pixels repeat the one to their left.
+    EXPECT_EQ(frame.image->get_pixel(15, 14), Gfx::Color(0xe0, 0xe0, 0x80));
+    EXPECT_EQ(frame.image->get_pixel(15, 15), Gfx::Color(0xe0, 0xe0, 0x80));
+}
+
 TEST_CASE(test_png_large_dimensions)
 {
     auto file = TRY_OR_FAIL(Core::MappedFile::map(TEST_INPUT("png/65535x1.png"sv)));
@@ -679,6 +772,16 @@ TEST_CASE(test_webp_simple_lossy)
     EXPECT_EQ(frame.image->get_pixel(198, 202), Gfx::Color(0x7a, 0xaa, 0xd5, 255));
 }
 
+TEST_CASE(test_webp_decodes_at_reduced_resolution_for_ideal_size)
+{
+    auto file = TRY_OR_FAIL(Core::MappedFile::map(TEST_INPUT("webp/simple-vp8.webp"sv)));
+    auto plugin_decoder = TRY_OR_FAIL(Gfx::WebPImageDecoderPlugin::create(file->bytes()));
+
+    auto frame = TRY_OR_FAIL(plugin_decoder->frame(0, Gfx::IntSize { 60, 30 }));
+    EXPECT_EQ(frame.image->size(), Gfx::IntSize(60, 60));
+    EXPECT_EQ(plugin_decoder->size(), Gfx::IntSize(240, 240));
+}
+
 TEST_CASE(test_webp_extended_missing_declared_icc_chunk)
 {
     auto file = TRY_OR_FAIL(Core::MappedFile::map(TEST_INPUT("webp/simple-vp8.webp"sv)));
@@ -187,3 +187,74 @@ TEST_CASE(negative_stored_sizes_are_skipped_as_corrupt)
     auto entry = reloaded_index.find_entry(1, *request_headers);
     EXPECT(!entry.has_value());
 }
+
+TEST_CASE(has_entry_sees_entries_that_were_not_loaded)
+{
+    auto state = create_cache_index();
+
+    auto request_headers = HTTP::HeaderList::create();
+    auto response_headers = HTTP::HeaderList::create({ { "Cache-Control"sv, "max-age=60"sv } });
+    auto vary_key = HTTP::create_vary_key(*request_headers, *response_headers);
+    auto now = UnixDateTime::now();
+
+    TRY_OR_FAIL(state.index.create_entry(1, vary_key, "https://example.com"_string, request_headers, response_headers, 10, now, now));
+
+    auto reloaded_index = MUST(HTTP::CacheIndex::create(*state.database, cache_directory()));
+    EXPECT(reloaded_index.has_entry(1, vary_key));
+    EXPECT(!reloaded_index.has_entry(2, vary_key));
+    EXPECT(!reloaded_index.find_entry(2, *request_headers).has_value());
+
+    reloaded_index.remove_entry(1, vary_key);
+    EXPECT(!reloaded_index.has_entry(1, vary_key));
+    EXPECT(!reloaded_index.find_entry(1, *request_headers).has_value());
+}
+
+TEST_CASE(batched_updates_are_written_when_flushed)
+{
+    auto state = create_cache_index();
+
+    auto request_headers = HTTP::HeaderList::create();
+    auto response_headers = HTTP::HeaderList::create({ { "Cache-Control"sv, "max-age=60"sv } });
+    auto vary_key = HTTP::create_vary_key(*request_headers, *response_headers);
+    auto now = UnixDateTime::now();
+
+    for (u64 cache_key = 1; cache_key <= 3; ++cache_key) {
+        TRY_OR_FAIL(state.index.create_entry(cache_key, vary_key, "https://example.com"_string, request_headers, response_headers, 10, now, now));
+        TRY_OR_FAIL(state.index.update_associated_data_size(cache_key, vary_key, 5 * cache_key));
+        state.index.update_last_access_time(cache_key, vary_key);
+    }
+
+    // Size estimates are computed by the database, so they must account for updates that have not been flushed yet.
+    auto total_size = state.index.estimate_cache_size_accessed_since(UnixDateTime::earliest()).total;
+
+    TRY_OR_FAIL(state.index.update_associated_data_size(2, vary_key, 20));
+    state.index.flush_pending_writes();
+
+    auto reloaded_index = MUST(HTTP::CacheIndex::create(*state.database, cache_directory()));
+    for (u64 cache_key = 1; cache_key <= 3; ++cache_key) {
+        auto entry = reloaded_index.find_entry(cache_key, *request_headers);
+        VERIFY(entry.has_value());
+        EXPECT_EQ(entry->associated_data_size, cache_key == 2 ? 20u : 5 * cache_key);
+    }
+
+    EXPECT_EQ(reloaded_index.estimate_cache_size_accessed_since(UnixDateTime::earliest()).total, total_size + 10);
+}
+
+TEST_CASE(replacing_an_index_writes_its_batched_updates)
+{
+    auto state = create_cache_index();
+
+    auto request_headers = HTTP::HeaderList::create();
+    auto response_headers = HTTP::HeaderList::create({ { "Cache-Control"sv, "max-age=60"sv } });
+    auto vary_key = HTTP::create_vary_key(*request_headers, *response_headers);
+    auto now = UnixDateTime::now();
+
+    TRY_OR_FAIL(state.index.create_entry(1, vary_key, "https://example.com"_string, request_headers, response_headers, 10, now, now));
+    TRY_OR_FAIL(state.index.update_associated_data_size(1, vary_key, 20));
+
+    state.index = MUST(HTTP::CacheIndex::create(*state.database, cache_directory()));
+
+    auto entry = state.index.find_entry(1, *request_headers);
+    VERIFY(entry.has_value());
+    EXPECT_EQ(entry->associated_data_size, 20u);
+}
@@ -353,6 +353,72 @@ TEST_CASE(required_literal_prefilter_compiles_long_literal_alternations)
     EXPECT_EQ(regex.test(Utf16String::from_utf8(missing_subject), 0), regex::MatchResult::NoMatch);
 }
 
+TEST_CASE(dfa_rejects_nested_quantifiers_without_exceeding_limit)
+{
+    auto regex = MUST(compile_regex_result("(a+)+b"sv, {}));
+
+    StringBuilder subject_builder;
+    for (size_t i = 0; i < 5000; ++i)
+        subject_builder.append('a');
+    auto subject = Utf16String::from_utf8(MUST(subject_builder.to_string()));
+
+    EXPECT_EQ(regex.test(subject, 0), regex::MatchResult::NoMatch);
+    EXPECT_EQ(regex.exec(subject, 0), regex::MatchResult::NoMatch);
+
+    auto matching_subject = Utf16String::from_utf8("xaaab"sv);
+    EXPECT_EQ(regex.exec(matching_subject, 0), regex::MatchResult::Match);
+    EXPECT_EQ(regex.capture_slot(0), 1);
+    EXPECT_EQ(regex.capture_slot(1), 5);
+    expect_capture_eq(regex, matching_subject, 1, "aaa"sv);
+}
+
+TEST_CASE(dfa_preserves_leftmost_first_match_bounds)
+{
+    auto regex = compile_regex("[a-z]+\\d{2,}"sv);
+    EXPECT_EQ(regex.find_all("ab1 cd12 e345 f6"sv, 0), 2);
+    EXPECT_EQ(regex.find_all_match(0).start, 4);
+    EXPECT_EQ(regex.find_all_match(0).end, 8);
+    EXPECT_EQ(regex.find_all_match(1).start, 9);
+    EXPECT_EQ(regex.find_all_match(1).end, 13);
+
+    auto shorter_first = compile_regex("a|ab"sv);
+    EXPECT_EQ(shorter_first.find_all("xab"sv, 0), 1);
+    EXPECT_EQ(shorter_first.find_all_match(0).start, 1);
+    EXPECT_EQ(shorter_first.find_all_match(0).end, 2);
+
+    auto lazy = compile_regex("(?:ab){1,3}?"sv);
+    EXPECT_EQ(lazy.find_all("ababab"sv, 0), 3);
+    EXPECT_EQ(lazy.find_all_match(2).start, 4);
+    EXPECT_EQ(lazy.find_all_match(2).end, 6);
+
+    auto optional_group = compile_regex("(ab)?c"sv);
+    auto subject = Utf16String::from_utf8("xabc"sv);
+    EXPECT_EQ(optional_group.exec(subject, 0), regex::MatchResult::Match);
+    EXPECT_EQ(optional_group.capture_slot(0), 1);
+    expect_capture_eq(optional_group, subject, 1, "ab"sv);
+}
+
+TEST_CASE(dfa_finds_leftmost_match_that_ends_after_an_earlier_one)
+{
+    // The first match to end is "c", but the match that starts first wins.
+    auto regex = compile_regex("a.*b|c"sv);
+    auto subject = Utf16String::from_utf8("xa c bc"sv);
+    EXPECT_EQ(regex.exec(subject, 0), regex::MatchResult::Match);
+    EXPECT_EQ(regex.capture_slot(0), 1);
+    EXPECT_EQ(regex.capture_slot(1), 6);
+
+    // Every position could start a match until the "c" is reached, which must not make the search quadratic.
+    auto long_prefix = compile_regex("a*b|c"sv);
+    StringBuilder subject_builder;
+    for (size_t i = 0; i < 100'000; ++i)
+        subject_builder.append('a');
+    subject_builder.append('c');
+    auto long_subject = Utf16String::from_utf8(MUST(subject_builder.to_string()));
+    EXPECT_EQ(long_prefix.exec(long_subject, 0), regex::MatchResult::Match);
+    EXPECT_EQ(long_prefix.capture_slot(0), 100'000);
+    EXPECT_EQ(long_prefix.capture_slot(1), 100'001);
+}
+
 TEST_CASE(restored_ecmascript_parse_coverage)
 {
     struct Test {
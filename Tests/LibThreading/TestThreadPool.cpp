@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Atomic.h>
+#include <LibCore/System.h>
+#include <LibTest/TestCase.h>
+#include <LibThreading/ThreadPool.h>
+
+static bool wait_until(Function<bool()> condition)
+{
+    for (auto i = 0; i < 500; ++i) {
+        if (condition())
+            return true;
+        (void)Core::System::sleep_ms(10);
+    }
+    return false;
+}
+
+TEST_CASE(runs_every_submitted_task)
+{
+    auto& pool = Threading::ThreadPool::the();
+    EXPECT(pool.thread_count() >= 2);
+
+    static Atomic<size_t> s_completed = 0;
+    static constexpr size_t task_count = 1000;
+
+    for (size_t i = 0; i < task_count; ++i) {
+        auto priority = static_cast<Threading::ThreadPool::Priority>(i % Threading::ThreadPool::priority_count);
+        pool.submit([] { s_completed.fetch_add(1); }, priority);
+    }
+
+    EXPECT(wait_until([] { return s_completed.load() == task_count; }));
+}
+
+TEST_CASE(tasks_submitted_from_a_worker_run)
+{
+    static Atomic<bool> s_inner_ran = false;
+
+    Threading::ThreadPool::the().submit([] {
+        Threading::ThreadPool::the().submit([] { s_inner_ran = true; });
+    });
+
+    EXPECT(wait_until([] { return s_inner_ran.load(); }));
+}
+
+TEST_CASE(cancelled_tasks_do_not_run)
+{
+    auto& pool = Threading::ThreadPool::the();
+
+    // Occupy every worker so the task below stays queued until we have cancelled it.
+    static Atomic<bool> s_release_workers = false;
+    static Atomic<size_t> s_busy_workers = 0;
+    for (size_t i = 0; i < pool.thread_count(); ++i) {
+        pool.submit([] {
+            s_busy_workers.fetch_add(1);
+            while (!s_release_workers.load())
+                (void)Core::System::sleep_ms(1);
+        });
+    }
+    EXPECT(wait_until([&] { return s_busy_workers.load() == pool.thread_count(); }));
+
+    static Atomic<bool> s_cancelled_task_ran = false;
+    auto task = pool.submit([] { s_cancelled_task_ran = true; });
+    EXPECT(task->cancel());
+    EXPECT(task->is_cancelled());
+    EXPECT(!task->cancel());
+
+    static Atomic<bool> s_later_task_ran = false;
+    pool.submit([] { s_later_task_ran = true; });
+
+    s_release_workers = true;
+    EXPECT(wait_until([] { return s_later_task_ran.load(); }));
+    EXPECT(!s_cancelled_task_ran.load());
+}
@@ -10,6 +10,7 @@
 #include <LibWasm/AbstractMachine/AbstractMachine.h>
 #include <LibWasm/AbstractMachine/Configuration.h>
 #include <LibWasm/Constants.h>
+#include <LibWasm/Parser/StreamingModuleParser.h>
 
 TEST_CASE(compiled_to_interpreter_call_restores_label_stack)
 {
@@ -210,3 +211,47 @@ TEST_CASE(compiled_memory_access_traps_out_of_bounds)
     expect_oob_trap(invoke(load_high, { Wasm::Value(static_cast<i32>(0)) }));
     expect_oob_trap(invoke(load_high, { Wasm::Value(static_cast<i32>(0xffffffff)) }));
 }
+
+TEST_CASE(streaming_parser_matches_parsing_all_bytes_at_once)
+{
+    auto file = MUST(Core::File::open("Fixtures/indirect-call.wasm"sv, Core::File::OpenMode::Read));
+    auto bytes = MUST(file->read_until_eof());
+    FixedMemoryStream stream { bytes.bytes() };
+    auto expected = MUST(Wasm::Module::parse(stream));
+
+    for (size_t chunk_size : { 1uz, 7uz, bytes.size() }) {
+        auto parser = Wasm::StreamingModuleParser::create();
+        for (size_t offset = 0; offset < bytes.size(); offset += chunk_size)
+            MUST(parser->append(bytes.bytes().slice(offset, min(chunk_size, bytes.size() - offset))));
+        auto module = MUST(parser->finish());
+
+        auto const& functions = module->code_section().functions();
+        auto const& expected_functions = expected->code_section().functions();
+        EXPECT_EQ(functions.size(), expected_functions.size());
+        for (size_t i = 0; i < min(functions.size(), expected_functions.size()); ++i)
+            EXPECT_EQ(functions[i].func().body().instructions().size(), expected_functions[i].func().body().instructions().size());
+
+        Wasm::AbstractMachine machine;
+        auto instance = MUST(machine.instantiate(*module, {}));
+        Optional<Wasm::FunctionAddress> run;
+        for (auto const& export_ : instance->exports()) {
+            if (export_.name() == "run"sv)
+                run = export_.value().get<Wasm::FunctionAddress>();
+        }
+        VERIFY(run.has_value());
+
+        auto result = machine.invoke(*run, { Wasm::Value(static_cast<i32>(41)) });
+        EXPECT(!result.is_trap());
+        EXPECT_EQ(result.values()[0].to<i32>(), 42);
+    }
+}
+
+TEST_CASE(streaming_parser_reports_truncated_modules)
+{
+    auto file = MUST(Core::File::open("Fixtures/indirect-call.wasm"sv, Core::File::OpenMode::Read));
+    auto bytes = MUST(file->read_until_eof());
+
+    auto parser = Wasm::StreamingModuleParser::create();
+    MUST(parser->append(bytes.bytes().slice(0, bytes.size() - 1)));
+    EXPECT(parser->finish().is_error());
+}
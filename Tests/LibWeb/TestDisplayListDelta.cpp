@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/ByteBuffer.h>
+#include <LibTest/TestCase.h>
+#include <LibWeb/Painting/DisplayList.h>
+
+using namespace Web::Painting;
+
+static ByteBuffer fill_command_bytes(Gfx::IntRect rect, Gfx::Color color)
+{
+    FillRect command { rect, color };
+    auto payload = display_list_object_bytes(command);
+    auto payload_size = align_up_to(sizeof(DisplayListCommandHeader) + payload.size(), DisplayList::command_alignment) - sizeof(DisplayListCommandHeader);
+    DisplayListCommandHeader header {
+        .command_type = FillRect::command_type,
+        .payload_size = static_cast<u32>(payload_size),
+        .context_index = VISUAL_VIEWPORT_NODE_INDEX,
+        .context_geometry_only = false,
+        .has_bounding_rect = true,
+        .is_clip = false,
+        .bounding_rect = rect,
+    };
+    ByteBuffer bytes;
+    bytes.append(display_list_object_bytes(header));
+    bytes.append(payload);
+    bytes.resize(sizeof(header) + payload_size, ByteBuffer::ZeroFillNewElements::Yes);
+    return bytes;
+}
+
+static NonnullRefPtr<DisplayList> display_list_filling(AccumulatedVisualContextTree const& visual_context_tree, Vector<Gfx::Color> const& colors)
+{
+    ByteBuffer command_bytes;
+    for (size_t i = 0; i < colors.size(); ++i)
+        command_bytes.append(fill_command_bytes({ static_cast<int>(i) * 10, 0, 10, 10 }, colors[i]));
+    return DisplayList::create_from_command_bytes(visual_context_tree, move(command_bytes));
+}
+
+TEST_CASE(delta_contains_only_changed_commands)
+{
+    auto visual_context_tree = AccumulatedVisualContextTree::create();
+    auto base = display_list_filling(visual_context_tree, { Gfx::Color::Red, Gfx::Color::Red, Gfx::Color::Red, Gfx::Color::Red, Gfx::Color::Red });
+    auto display_list = display_list_filling(visual_context_tree, { Gfx::Color::Red, Gfx::Color::Red, Gfx::Color::Blue, Gfx::Color::Red, Gfx::Color::Red });
+    display_list->set_surface_clear_color(Gfx::Color::White);
+
+    auto delta = display_list->delta_from(base);
+    VERIFY(delta.has_value());
+    auto command_size = fill_command_bytes({}, {}).size();
+    EXPECT_EQ(delta->base_display_list_id, base->id());
+    EXPECT_EQ(delta->unchanged_prefix_size, 2 * command_size);
+    EXPECT_EQ(delta->unchanged_suffix_size, 2 * command_size);
+    EXPECT_EQ(delta->changed_command_bytes.size(), command_size);
+
+    auto applied_display_list = MUST(DisplayList::create_from_delta(base, delta.release_value()));
+    EXPECT_EQ(applied_display_list->id(), display_list->id());
+    EXPECT_EQ(applied_display_list->command_bytes(), display_list->command_bytes());
+    EXPECT(applied_display_list->surface_clear_color() == Gfx::Color::White);
+}
+
+TEST_CASE(delta_handles_inserted_and_removed_commands)
+{
+    auto visual_context_tree = AccumulatedVisualContextTree::create();
+    auto base = display_list_filling(visual_context_tree, { Gfx::Color::Red, Gfx::Color::Green, Gfx::Color::Blue, Gfx::Color::Black, Gfx::Color::White });
+
+    // The inserted command shifts every command after it, which still ends up in the unchanged suffix.
+    auto with_insertion = display_list_filling(visual_context_tree, { Gfx::Color::Red, Gfx::Color::Green, Gfx::Color::Yellow, Gfx::Color::Blue, Gfx::Color::Black, Gfx::Color::White });
+    auto insertion_delta = with_insertion->delta_from(base);
+    VERIFY(insertion_delta.has_value());
+    EXPECT_EQ(MUST(DisplayList::create_from_delta(base, insertion_delta.release_value()))->command_bytes(), with_insertion->command_bytes());
+
+    auto with_removal = display_list_filling(visual_context_tree, { Gfx::Color::Red, Gfx::Color::Green, Gfx::Color::Black, Gfx::Color::White });
+    auto removal_delta = with_removal->delta_from(base);
+    VERIFY(removal_delta.has_value());
+    EXPECT(removal_delta->changed_command_bytes.is_empty());
+    EXPECT_EQ(MUST(DisplayList::create_from_delta(base, removal_delta.release_value()))->command_bytes(), with_removal->command_bytes());
+}
+
+TEST_CASE(no_delta_when_most_commands_changed)
+{
+    auto visual_context_tree = AccumulatedVisualContextTree::create();
+    auto base = display_list_filling(visual_context_tree, { Gfx::Color::Red, Gfx::Color::Red, Gfx::Color::Red });
+    auto display_list = display_list_filling(visual_context_tree, { Gfx::Color::Blue, Gfx::Color::Blue, Gfx::Color::Red });
+    EXPECT(!display_list->delta_from(base).has_value());
+}
+
+TEST_CASE(delta_rejects_mismatched_base)
+{
+    auto visual_context_tree = AccumulatedVisualContextTree::create();
+    auto base = display_list_filling(visual_context_tree, { Gfx::Color::Red, Gfx::Color::Red, Gfx::Color::Red });
+    auto other_base = display_list_filling(visual_context_tree, { Gfx::Color::Red, Gfx::Color::Red, Gfx::Color::Red });
+    auto display_list = display_list_filling(visual_context_tree, { Gfx::Color::Red, Gfx::Color::Blue, Gfx::Color::Red });
+
+    auto delta = display_list->delta_from(base);
+    VERIFY(delta.has_value());
+    EXPECT(DisplayList::create_from_delta(other_base, Web::Painting::DisplayListDelta { *delta }).is_error());
+
+    delta->unchanged_suffix_size = base->command_bytes().size();
+    EXPECT(DisplayList::create_from_delta(base, delta.release_value()).is_error());
+}
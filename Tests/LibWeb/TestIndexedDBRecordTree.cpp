@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Random.h>
+#include <AK/Vector.h>
+#include <LibTest/TestCase.h>
+#include <LibWeb/IndexedDB/Internal/RecordTree.h>
+
+using Web::IndexedDB::RecordTree;
+
+static void expect_same_records(RecordTree<int> const& tree, Vector<int> const& expected)
+{
+    EXPECT_EQ(tree.size(), expected.size());
+
+    size_t index = 0;
+    for (auto record : tree) {
+        EXPECT_EQ(record, expected[index]);
+        ++index;
+    }
+    EXPECT_EQ(index, expected.size());
+
+    for (size_t i = 0; i < expected.size(); i += 13)
+        EXPECT_EQ(tree[i], expected[i]);
+
+    index = expected.size();
+    for (auto it = tree.end(); it != tree.begin();) {
+        --it;
+        --index;
+        EXPECT_EQ(*it, expected[index]);
+    }
+}
+
+TEST_CASE(appended_records_fill_whole_pages)
+{
+    RecordTree<int> tree;
+    Vector<int> expected;
+
+    for (int i = 0; i < 10'000; ++i) {
+        tree.append(i);
+        expected.append(i);
+    }
+
+    expect_same_records(tree, expected);
+    EXPECT_EQ(*tree.iterator_at(RecordTree<int>::max_page_size), static_cast<int>(RecordTree<int>::max_page_size));
+    EXPECT(tree.iterator_at(tree.size()) == tree.end());
+}
+
+TEST_CASE(inserting_at_the_front_splits_pages)
+{
+    RecordTree<int> tree;
+    Vector<int> expected;
+
+    for (int i = 0; i < 20'000; ++i) {
+        tree.insert(0, i);
+        expected.prepend(i);
+    }
+
+    expect_same_records(tree, expected);
+    for (size_t i = 0; i < expected.size(); ++i)
+        EXPECT_EQ(tree[i], expected[i]);
+}
+
+TEST_CASE(inserting_and_removing_matches_a_vector)
+{
+    RecordTree<int> tree;
+    Vector<int> expected;
+
+    for (size_t round = 0; round < 5'000; ++round) {
+        auto operation = get_random_uniform(8);
+        if (operation < 5 || expected.is_empty()) {
+            auto index = get_random_uniform(expected.size() + 1);
+            auto value = static_cast<int>(get_random<u16>());
+            tree.insert(index, value);
+            expected.insert(index, value);
+        } else if (operation < 7) {
+            auto index = get_random_uniform(expected.size());
+            auto count = get_random_uniform(min<size_t>(expected.size() - index, 600) + 1);
+            tree.remove(index, count);
+            expected.remove(index, count);
+        } else {
+            auto index = get_random_uniform(expected.size());
+            auto count = get_random_uniform(min<size_t>(expected.size() - index, 300) + 1);
+            auto taken = tree.take(index, count);
+            EXPECT_EQ(taken.size(), count);
+            for (size_t i = 0; i < count; ++i)
+                EXPECT_EQ(taken[i], expected[index + i]);
+            expected.remove(index, count);
+        }
+
+        if (round % 250 == 0)
+            expect_same_records(tree, expected);
+    }
+
+    expect_same_records(tree, expected);
+}
+
+TEST_CASE(take_all_matching_keeps_order)
+{
+    RecordTree<int> tree;
+    for (int i = 0; i < 2'000; ++i)
+        tree.append(i);
+
+    auto taken = tree.take_all_matching([](int record) { return record % 3 == 0; });
+    EXPECT_EQ(taken.size(), 667u);
+    EXPECT_EQ(taken.first(), 0);
+    EXPECT_EQ(taken.last(), 1998);
+
+    Vector<int> expected;
+    for (int i = 0; i < 2'000; ++i) {
+        if (i % 3 != 0)
+            expected.append(i);
+    }
+    expect_same_records(tree, expected);
+
+    auto everything = tree.take_all();
+    EXPECT_EQ(everything.size(), expected.size());
+    EXPECT(tree.is_empty());
+    EXPECT(tree.begin() == tree.end());
+}
@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2026-present, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Math.h>
+#include <AK/Vector.h>
+#include <LibTest/TestCase.h>
+#include <LibWeb/WebAudio/Rendering/BiquadCoefficients.h>
+#include <LibWeb/WebAudio/Rendering/VectorMath.h>
+
+namespace VectorMath = Web::WebAudio::Rendering::VectorMath;
+
+// NB: An odd length covers both the vector loops and the scalar loops that process the remaining samples.
+static constexpr size_t SAMPLE_COUNT = 131;
+
+static Vector<float> make_samples(float phase)
+{
+    Vector<float> samples;
+    for (size_t index = 0; index < SAMPLE_COUNT; ++index)
+        samples.append(AK::sin(phase + static_cast<float>(index) * 0.1f));
+    return samples;
+}
+
+TEST_CASE(multiply_matches_scalar_loop)
+{
+    auto source = make_samples(0.f);
+    auto gains = make_samples(1.f);
+
+    Vector<float> destination;
+    destination.resize(SAMPLE_COUNT);
+    VectorMath::multiply(source, gains, destination);
+    for (size_t index = 0; index < SAMPLE_COUNT; ++index)
+        EXPECT_EQ(destination[index], source[index] * gains[index]);
+
+    VectorMath::multiply(source, 0.25f, destination);
+    for (size_t index = 0; index < SAMPLE_COUNT; ++index)
+        EXPECT_EQ(destination[index], source[index] * 0.25f);
+}
+
+TEST_CASE(multiply_add_matches_scalar_loop)
+{
+    auto source = make_samples(0.f);
+    auto initial = make_samples(2.f);
+
+    auto destination = initial;
+    VectorMath::multiply_add(source, AK::Sqrt1_2<float>, destination);
+    for (size_t index = 0; index < SAMPLE_COUNT; ++index)
+        EXPECT_EQ(destination[index], initial[index] + source[index] * AK::Sqrt1_2<float>);
+
+    destination = initial;
+    VectorMath::multiply_add(source, 1.f, destination);
+    for (size_t index = 0; index < SAMPLE_COUNT; ++index)
+        EXPECT_EQ(destination[index], initial[index] + source[index]);
+
+    destination = initial;
+    VectorMath::add(0.5f, destination);
+    for (size_t index = 0; index < SAMPLE_COUNT; ++index)
+        EXPECT_EQ(destination[index], initial[index] + 0.5f);
+}
+
+TEST_CASE(replace_nan_and_clamp)
+{
+    auto values = make_samples(0.f);
+    values[3] = NAN;
+    values[SAMPLE_COUNT - 1] = NAN;
+    values[7] = 5.f;
+    values[SAMPLE_COUNT - 2] = -5.f;
+
+    VectorMath::replace_nan_and_clamp(values, 0.75f, -0.5f, 0.5f);
+
+    EXPECT_EQ(values[3], 0.5f);
+    EXPECT_EQ(values[SAMPLE_COUNT - 1], 0.5f);
+    EXPECT_EQ(values[7], 0.5f);
+    EXPECT_EQ(values[SAMPLE_COUNT - 2], -0.5f);
+    for (auto value : values) {
+        EXPECT(value >= -0.5f);
+        EXPECT(value <= 0.5f);
+    }
+}
+
+TEST_CASE(is_silent_and_is_constant)
+{
+    Vector<float> values;
+    values.resize(SAMPLE_COUNT);
+    EXPECT(VectorMath::is_silent(values));
+    EXPECT(VectorMath::is_constant(values));
+
+    values[SAMPLE_COUNT - 1] = 1.f;
+    EXPECT(!VectorMath::is_silent(values));
+    EXPECT(!VectorMath::is_constant(values));
+
+    values.fill(1.f);
+    EXPECT(!VectorMath::is_silent(values));
+    EXPECT(VectorMath::is_constant(values));
+
+    values[1] = NAN;
+    EXPECT(!VectorMath::is_silent(values));
+}
+
+TEST_CASE(biquad_filter_of_two_channels_matches_single_channel)
+{
+    Vector<Web::WebAudio::Rendering::BiquadCoefficients> coefficients;
+    for (size_t index = 0; index < SAMPLE_COUNT; ++index)
+        coefficients.append(Web::WebAudio::Rendering::compute_biquad_coefficients(Web::Bindings::BiquadFilterType::Lowpass, 0.1 + index * 0.001, 1, 0));
+
+    auto first_input = make_samples(0.f);
+    auto second_input = make_samples(1.f);
+
+    Vector<float> expected_first_output;
+    Vector<float> expected_second_output;
+    expected_first_output.resize(SAMPLE_COUNT);
+    expected_second_output.resize(SAMPLE_COUNT);
+    Web::WebAudio::Rendering::BiquadFilterState expected_first_state;
+    Web::WebAudio::Rendering::BiquadFilterState expected_second_state;
+    Web::WebAudio::Rendering::biquad_filter(coefficients, first_input, expected_first_output, expected_first_state);
+    Web::WebAudio::Rendering::biquad_filter(coefficients, second_input, expected_second_output, expected_second_state);
+
+    Vector<float> first_output;
+    Vector<float> second_output;
+    first_output.resize(SAMPLE_COUNT);
+    second_output.resize(SAMPLE_COUNT);
+    Web::WebAudio::Rendering::BiquadFilterState first_state;
+    Web::WebAudio::Rendering::BiquadFilterState second_state;
+    Web::WebAudio::Rendering::biquad_filter(coefficients, first_input, second_input, first_output, second_output, first_state, second_state);
+
+    EXPECT_EQ(first_output, expected_first_output);
+    EXPECT_EQ(second_output, expected_second_output);
+    EXPECT_EQ(first_state.y1, expected_first_state.y1);
+    EXPECT_EQ(second_state.y2, expected_second_state.y2);
+}